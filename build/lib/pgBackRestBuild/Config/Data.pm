@@ -98,6 +98,8 @@ use constant CFGCMD_REMOTE                                          => 'remote';
     push @EXPORT, qw(CFGCMD_REMOTE);
 use constant CFGCMD_RESTORE                                         => 'restore';
     push @EXPORT, qw(CFGCMD_RESTORE);
+use constant CFGCMD_SERVER                                          => 'server';
+    push @EXPORT, qw(CFGCMD_SERVER);
 use constant CFGCMD_STANZA_CREATE                                   => 'stanza-create';
     push @EXPORT, qw(CFGCMD_STANZA_CREATE);
 use constant CFGCMD_STANZA_DELETE                                   => 'stanza-delete';
@@ -110,6 +112,8 @@ use constant CFGCMD_STOP                                            => 'stop';
     push @EXPORT, qw(CFGCMD_STOP);
 use constant CFGCMD_STORAGE_LIST                                    => 'ls';
     push @EXPORT, qw(CFGCMD_STORAGE_LIST);
+use constant CFGCMD_VERIFY                                          => 'verify';
+    push @EXPORT, qw(CFGCMD_VERIFY);
 use constant CFGCMD_VERSION                                         => 'version';
     push @EXPORT, qw(CFGCMD_VERSION);
 
@@ -167,6 +171,8 @@ use constant CFGOPT_RECURSE                                         => 'recurse'
     push @EXPORT, qw(CFGOPT_RECURSE);
 use constant CFGOPT_SORT                                            => 'sort';
     push @EXPORT, qw(CFGOPT_SORT);
+use constant CFGOPT_SORT_MAX                                        => 'sort-max';
+    push @EXPORT, qw(CFGOPT_SORT_MAX);
 
 # Command-line only test options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -207,9 +213,25 @@ use constant CFGOPT_LOCK_PATH                                       => 'lock-pat
     push @EXPORT, qw(CFGOPT_LOCK_PATH);
 use constant CFGOPT_LOG_PATH                                        => 'log-path';
     push @EXPORT, qw(CFGOPT_LOG_PATH);
+use constant CFGOPT_METRIC_PATH                                     => 'metric-path';
+    push @EXPORT, qw(CFGOPT_METRIC_PATH);
 use constant CFGOPT_SPOOL_PATH                                      => 'spool-path';
     push @EXPORT, qw(CFGOPT_SPOOL_PATH);
 
+# TLS server
+use constant CFGOPT_TLS_SERVER_ADDRESS                              => 'tls-server-address';
+    push @EXPORT, qw(CFGOPT_TLS_SERVER_ADDRESS);
+use constant CFGOPT_TLS_SERVER_AUTH                                 => 'tls-server-auth';
+    push @EXPORT, qw(CFGOPT_TLS_SERVER_AUTH);
+use constant CFGOPT_TLS_SERVER_CA_FILE                              => 'tls-server-ca-file';
+    push @EXPORT, qw(CFGOPT_TLS_SERVER_CA_FILE);
+use constant CFGOPT_TLS_SERVER_CERT_FILE                            => 'tls-server-cert-file';
+    push @EXPORT, qw(CFGOPT_TLS_SERVER_CERT_FILE);
+use constant CFGOPT_TLS_SERVER_KEY_FILE                             => 'tls-server-key-file';
+    push @EXPORT, qw(CFGOPT_TLS_SERVER_KEY_FILE);
+use constant CFGOPT_TLS_SERVER_PORT                                 => 'tls-server-port';
+    push @EXPORT, qw(CFGOPT_TLS_SERVER_PORT);
+
 # Perl
 use constant CFGOPT_PERL_OPTION                                     => 'perl-option';
     push @EXPORT, qw(CFGOPT_PERL_OPTION);
@@ -225,6 +247,8 @@ use constant CFGOPT_LOG_SUBPROCESS                                  => 'log-subp
     push @EXPORT, qw(CFGOPT_LOG_SUBPROCESS);
 use constant CFGOPT_LOG_TIMESTAMP                                   => 'log-timestamp';
     push @EXPORT, qw(CFGOPT_LOG_TIMESTAMP);
+use constant CFGOPT_PROFILE                                         => 'profile';
+    push @EXPORT, qw(CFGOPT_PROFILE);
 
 # Repository options
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -236,6 +260,10 @@ use constant CFGDEF_PREFIX_REPO                                     => 'repo';
     push @EXPORT, qw(CFGDEF_PREFIX_REPO);
 
 # Repository General
+use constant CFGOPT_REPO_CACHE_PATH                                 => CFGDEF_PREFIX_REPO . '-cache-path';
+    push @EXPORT, qw(CFGOPT_REPO_CACHE_PATH);
+use constant CFGOPT_REPO_CACHE_SIZE                                 => CFGDEF_PREFIX_REPO . '-cache-size';
+    push @EXPORT, qw(CFGOPT_REPO_CACHE_SIZE);
 use constant CFGOPT_REPO_CIPHER_TYPE                                => CFGDEF_PREFIX_REPO . '-cipher-type';
     push @EXPORT, qw(CFGOPT_REPO_CIPHER_TYPE);
 use constant CFGOPT_REPO_CIPHER_PASS                                => CFGDEF_PREFIX_REPO . '-cipher-pass';
@@ -260,6 +288,12 @@ use constant CFGOPT_REPO_RETENTION_FULL                             => CFGDEF_PR
 # Repository Host
 use constant CFGOPT_REPO_HOST                                       => CFGDEF_PREFIX_REPO . '-host';
     push @EXPORT, qw(CFGOPT_REPO_HOST);
+use constant CFGOPT_REPO_HOST_CA_FILE                               => CFGOPT_REPO_HOST . '-ca-file';
+    push @EXPORT, qw(CFGOPT_REPO_HOST_CA_FILE);
+use constant CFGOPT_REPO_HOST_CA_PATH                               => CFGOPT_REPO_HOST . '-ca-path';
+    push @EXPORT, qw(CFGOPT_REPO_HOST_CA_PATH);
+use constant CFGOPT_REPO_HOST_CERT_FILE                             => CFGOPT_REPO_HOST . '-cert-file';
+    push @EXPORT, qw(CFGOPT_REPO_HOST_CERT_FILE);
 use constant CFGOPT_REPO_HOST_CMD                                   => CFGOPT_REPO_HOST . '-cmd';
     push @EXPORT, qw(CFGOPT_REPO_HOST_CMD);
 use constant CFGOPT_REPO_HOST_CONFIG                                => CFGOPT_REPO_HOST . '-config';
@@ -268,8 +302,12 @@ use constant CFGOPT_REPO_HOST_CONFIG_INCLUDE_PATH                   => CFGOPT_RE
     push @EXPORT, qw(CFGOPT_REPO_HOST_CONFIG_INCLUDE_PATH);
 use constant CFGOPT_REPO_HOST_CONFIG_PATH                           => CFGOPT_REPO_HOST_CONFIG . '-path';
     push @EXPORT, qw(CFGOPT_REPO_HOST_CONFIG_PATH);
+use constant CFGOPT_REPO_HOST_KEY_FILE                              => CFGOPT_REPO_HOST . '-key-file';
+    push @EXPORT, qw(CFGOPT_REPO_HOST_KEY_FILE);
 use constant CFGOPT_REPO_HOST_PORT                                  => CFGOPT_REPO_HOST . '-port';
     push @EXPORT, qw(CFGOPT_REPO_HOST_PORT);
+use constant CFGOPT_REPO_HOST_TYPE                                  => CFGOPT_REPO_HOST . '-type';
+    push @EXPORT, qw(CFGOPT_REPO_HOST_TYPE);
 use constant CFGOPT_REPO_HOST_USER                                  => CFGOPT_REPO_HOST . '-user';
     push @EXPORT, qw(CFGOPT_REPO_HOST_USER);
 
@@ -289,6 +327,8 @@ use constant CFGOPT_REPO_S3_ENDPOINT                                => CFGDEF_RE
     push @EXPORT, qw(CFGOPT_REPO_S3_ENDPOINT);
 use constant CFGOPT_REPO_S3_HOST                                    => CFGDEF_REPO_S3 . '-host';
     push @EXPORT, qw(CFGOPT_REPO_S3_HOST);
+use constant CFGOPT_REPO_S3_LIST_PARALLEL                           => CFGDEF_REPO_S3 . '-list-parallel';
+    push @EXPORT, qw(CFGOPT_REPO_S3_LIST_PARALLEL);
 use constant CFGOPT_REPO_S3_PORT                                    => CFGDEF_REPO_S3 . '-port';
     push @EXPORT, qw(CFGOPT_REPO_S3_PORT);
 use constant CFGOPT_REPO_S3_REGION                                  => CFGDEF_REPO_S3 . '-region';
@@ -304,6 +344,8 @@ use constant CFGOPT_ARCHIVE_ASYNC                                   => 'archive-
     push @EXPORT, qw(CFGOPT_ARCHIVE_ASYNC);
 use constant CFGOPT_ARCHIVE_GET_QUEUE_MAX                           => 'archive-get-queue-max';
     push @EXPORT, qw(CFGOPT_ARCHIVE_GET_QUEUE_MAX);
+use constant CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG                   => 'archive-push-compress-backlog';
+    push @EXPORT, qw(CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG);
 use constant CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                          => 'archive-push-queue-max';
     push @EXPORT, qw(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX);
 
@@ -313,6 +355,10 @@ use constant CFGOPT_ARCHIVE_CHECK                                   => 'archive-
     push @EXPORT, qw(CFGOPT_ARCHIVE_CHECK);
 use constant CFGOPT_ARCHIVE_COPY                                    => 'archive-copy';
     push @EXPORT, qw(CFGOPT_ARCHIVE_COPY);
+use constant CFGOPT_BACKUP_CIPHER_SIDE                              => 'backup-cipher-side';
+    push @EXPORT, qw(CFGOPT_BACKUP_CIPHER_SIDE);
+use constant CFGOPT_BACKUP_COMPRESS_SIDE                            => 'backup-compress-side';
+    push @EXPORT, qw(CFGOPT_BACKUP_COMPRESS_SIDE);
 use constant CFGOPT_BACKUP_STANDBY                                  => 'backup-standby';
     push @EXPORT, qw(CFGOPT_BACKUP_STANDBY);
 use constant CFGOPT_CHECKSUM_PAGE                                   => 'checksum-page';
@@ -355,6 +401,12 @@ use constant CFGDEF_PREFIX_PG                                       => 'pg';
 
 use constant CFGOPT_PG_HOST                                         => CFGDEF_PREFIX_PG . '-host';
     push @EXPORT, qw(CFGOPT_PG_HOST);
+use constant CFGOPT_PG_HOST_CA_FILE                                 => CFGOPT_PG_HOST . '-ca-file';
+    push @EXPORT, qw(CFGOPT_PG_HOST_CA_FILE);
+use constant CFGOPT_PG_HOST_CA_PATH                                 => CFGOPT_PG_HOST . '-ca-path';
+    push @EXPORT, qw(CFGOPT_PG_HOST_CA_PATH);
+use constant CFGOPT_PG_HOST_CERT_FILE                               => CFGOPT_PG_HOST . '-cert-file';
+    push @EXPORT, qw(CFGOPT_PG_HOST_CERT_FILE);
 use constant CFGOPT_PG_HOST_CMD                                     => CFGOPT_PG_HOST . '-cmd';
     push @EXPORT, qw(CFGOPT_PG_HOST_CMD);
 use constant CFGOPT_PG_HOST_CONFIG                                  => CFGOPT_PG_HOST . '-config';
@@ -363,8 +415,12 @@ use constant CFGOPT_PG_HOST_CONFIG_INCLUDE_PATH                     => CFGOPT_PG
     push @EXPORT, qw(CFGOPT_PG_HOST_CONFIG_INCLUDE_PATH);
 use constant CFGOPT_PG_HOST_CONFIG_PATH                             => CFGOPT_PG_HOST_CONFIG . '-path';
     push @EXPORT, qw(CFGOPT_PG_HOST_CONFIG_PATH);
+use constant CFGOPT_PG_HOST_KEY_FILE                                => CFGOPT_PG_HOST . '-key-file';
+    push @EXPORT, qw(CFGOPT_PG_HOST_KEY_FILE);
 use constant CFGOPT_PG_HOST_PORT                                    => CFGOPT_PG_HOST . '-port';
     push @EXPORT, qw(CFGOPT_PG_HOST_PORT);
+use constant CFGOPT_PG_HOST_TYPE                                    => CFGOPT_PG_HOST . '-type';
+    push @EXPORT, qw(CFGOPT_PG_HOST_TYPE);
 use constant CFGOPT_PG_HOST_USER                                    => CFGOPT_PG_HOST . '-user';
     push @EXPORT, qw(CFGOPT_PG_HOST_USER);
 
@@ -399,6 +455,20 @@ use constant CFGOPTVAL_BACKUP_TYPE_DIFF                             => 'diff';
 use constant CFGOPTVAL_BACKUP_TYPE_INCR                             => 'incr';
     push @EXPORT, qw(CFGOPTVAL_BACKUP_TYPE_INCR);
 
+# Backup filter side
+#-----------------------------------------------------------------------------------------------------------------------------------
+use constant CFGOPTVAL_BACKUP_FILTER_SIDE_DB                        => 'db';
+    push @EXPORT, qw(CFGOPTVAL_BACKUP_FILTER_SIDE_DB);
+use constant CFGOPTVAL_BACKUP_FILTER_SIDE_REPO                      => 'repo';
+    push @EXPORT, qw(CFGOPTVAL_BACKUP_FILTER_SIDE_REPO);
+
+# Remote host type
+#-----------------------------------------------------------------------------------------------------------------------------------
+use constant CFGOPTVAL_HOST_TYPE_SSH                                => 'ssh';
+    push @EXPORT, qw(CFGOPTVAL_HOST_TYPE_SSH);
+use constant CFGOPTVAL_HOST_TYPE_TLS                                => 'tls';
+    push @EXPORT, qw(CFGOPTVAL_HOST_TYPE_TLS);
+
 # Repo type
 #-----------------------------------------------------------------------------------------------------------------------------------
 use constant CFGOPTVAL_REPO_TYPE_CIFS                               => 'cifs';
@@ -421,6 +491,8 @@ use constant CFGOPTVAL_OUTPUT_TEXT                                  => 'text';
     push @EXPORT, qw(CFGOPTVAL_OUTPUT_TEXT);
 use constant CFGOPTVAL_OUTPUT_JSON                                  => 'json';
     push @EXPORT, qw(CFGOPTVAL_OUTPUT_JSON);
+use constant CFGOPTVAL_OUTPUT_JSON_LINES                            => 'json-lines';
+    push @EXPORT, qw(CFGOPTVAL_OUTPUT_JSON_LINES);
 
 # Restore type
 #-----------------------------------------------------------------------------------------------------------------------------------
@@ -672,6 +744,10 @@ my $rhCommandDefine =
     {
     },
 
+    &CFGCMD_SERVER =>
+    {
+    },
+
     &CFGCMD_STANZA_CREATE =>
     {
         &CFGDEF_LOCK_REQUIRED => true,
@@ -706,6 +782,10 @@ my $rhCommandDefine =
         &CFGDEF_PARAMETER_ALLOWED => true,
     },
 
+    &CFGCMD_VERIFY =>
+    {
+    },
+
     &CFGCMD_VERSION =>
     {
         &CFGDEF_LOG_FILE => false,
@@ -738,12 +818,14 @@ my %hConfigDefine =
             &CFGCMD_LOCAL => {},
             &CFGCMD_REMOTE => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -857,7 +939,8 @@ my %hConfigDefine =
             &CFGCMD_STOP =>
             {
                 &CFGDEF_REQUIRED => false
-            }
+            },
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -1030,6 +1113,7 @@ my %hConfigDefine =
                 [
                     &CFGOPTVAL_OUTPUT_TEXT,
                     &CFGOPTVAL_OUTPUT_JSON,
+                    &CFGOPTVAL_OUTPUT_JSON_LINES,
                 ]
             }
         }
@@ -1123,6 +1207,17 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_SORT_MAX =>
+    {
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 100000,
+        &CFGDEF_ALLOW_RANGE => [1000, 1000000000],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_STORAGE_LIST => {},
+        }
+    },
+
     # Command-line only test options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_TEST =>
@@ -1213,6 +1308,7 @@ my %hConfigDefine =
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -1313,6 +1409,7 @@ my %hConfigDefine =
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -1339,6 +1436,7 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -1365,6 +1463,7 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         },
     },
 
@@ -1390,6 +1489,7 @@ my %hConfigDefine =
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
+            &CFGCMD_VERIFY => {},
         },
     },
 
@@ -1411,12 +1511,33 @@ my %hConfigDefine =
             &CFGCMD_LOCAL => {},
             &CFGCMD_REMOTE => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
+        },
+    },
+
+    &CFGOPT_METRIC_PATH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_GET => {},
+            &CFGCMD_ARCHIVE_GET_ASYNC => {},
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+            &CFGCMD_BACKUP => {},
+            &CFGCMD_EXPIRE => {},
+            &CFGCMD_LOCAL => {},
+            &CFGCMD_RESTORE => {},
+            &CFGCMD_VERIFY => {},
         },
     },
 
@@ -1464,15 +1585,91 @@ my %hConfigDefine =
             &CFGCMD_LOCAL => {},
             &CFGCMD_REMOTE => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
+    &CFGOPT_TLS_SERVER_ADDRESS =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => 'localhost',
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_SERVER => {},
+        },
+    },
+
+    &CFGOPT_TLS_SERVER_AUTH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_HASH,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_CA_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_CERT_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_KEY_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
+    &CFGOPT_TLS_SERVER_PORT =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_DEFAULT => 8432,
+        &CFGDEF_ALLOW_RANGE => [1, 65535],
+        &CFGDEF_COMMAND => CFGOPT_TLS_SERVER_ADDRESS,
+    },
+
     # Repository options
     #-------------------------------------------------------------------------------------------------------------------------------
+    &CFGOPT_REPO_CACHE_PATH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+    },
+
+    &CFGOPT_REPO_CACHE_SIZE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_SIZE,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => 1024 * 1024 * 1024, # 1GB
+        &CFGDEF_ALLOW_RANGE => [1024 * 1024, 4 * 1024 * 1024 * 1024 * 1024 * 1024], # 1MB-4PB
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_CACHE_PATH,
+        },
+    },
+
     &CFGOPT_REPO_CIPHER_PASS =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1573,6 +1770,52 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
+        },
+    },
+
+    &CFGOPT_REPO_HOST_CA_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_REPO_HOST_CA_PATH =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_REPO_HOST_CERT_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_REQUIRED => true,
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
         },
     },
 
@@ -1600,6 +1843,7 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         },
         &CFGDEF_DEPEND =>
         {
@@ -1639,6 +1883,20 @@ my %hConfigDefine =
         &CFGDEF_DEFAULT => CFGDEF_DEFAULT_CONFIG_INCLUDE_PATH,
     },
 
+    &CFGOPT_REPO_HOST_KEY_FILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
     &CFGOPT_REPO_HOST_PORT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1658,6 +1916,25 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_REPO_HOST_TYPE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => CFGOPTVAL_HOST_TYPE_SSH,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_HOST_TYPE_SSH,
+            &CFGOPTVAL_HOST_TYPE_TLS,
+        ],
+        &CFGDEF_COMMAND => CFGOPT_REPO_HOST_CMD,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_REPO_HOST
+        },
+    },
+
     &CFGOPT_REPO_HOST_USER =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1851,6 +2128,7 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         },
     },
 
@@ -1887,6 +2165,18 @@ my %hConfigDefine =
         &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
     },
 
+    &CFGOPT_REPO_S3_LIST_PARALLEL =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_PREFIX => CFGDEF_PREFIX_REPO,
+        &CFGDEF_INDEX_TOTAL => CFGDEF_INDEX_REPO,
+        &CFGDEF_DEFAULT => 4,
+        &CFGDEF_ALLOW_RANGE => [1, 64],
+        &CFGDEF_DEPEND => CFGOPT_REPO_S3_BUCKET,
+        &CFGDEF_COMMAND => CFGOPT_REPO_TYPE,
+    },
+
     &CFGOPT_REPO_S3_PORT =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -1967,6 +2257,7 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         },
     },
 
@@ -1996,6 +2287,7 @@ my %hConfigDefine =
                 },
             },
             &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+            &CFGCMD_STORAGE_LIST => {},
         },
     },
 
@@ -2013,6 +2305,7 @@ my %hConfigDefine =
             &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
             &CFGCMD_BACKUP => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -2044,12 +2337,14 @@ my %hConfigDefine =
             &CFGCMD_EXPIRE => {},
             &CFGCMD_INFO => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -2078,12 +2373,14 @@ my %hConfigDefine =
                 &CFGDEF_DEFAULT => lc(OFF),
             },
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -2106,12 +2403,14 @@ my %hConfigDefine =
             &CFGCMD_LOCAL => {},
             &CFGCMD_REMOTE => {},
             &CFGCMD_RESTORE => {},
+            &CFGCMD_SERVER => {},
             &CFGCMD_STANZA_CREATE => {},
             &CFGCMD_STANZA_DELETE => {},
             &CFGCMD_STANZA_UPGRADE => {},
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -2139,6 +2438,7 @@ my %hConfigDefine =
             &CFGCMD_START => {},
             &CFGCMD_STOP => {},
             &CFGCMD_STORAGE_LIST => {},
+            &CFGCMD_VERIFY => {},
         }
     },
 
@@ -2150,6 +2450,14 @@ my %hConfigDefine =
         &CFGDEF_COMMAND => CFGOPT_LOG_LEVEL_CONSOLE,
     },
 
+    &CFGOPT_PROFILE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_BOOLEAN,
+        &CFGDEF_DEFAULT => false,
+        &CFGDEF_COMMAND => CFGOPT_LOG_PATH,
+    },
+
     # Archive options
     #-------------------------------------------------------------------------------------------------------------------------------
     &CFGOPT_ARCHIVE_ASYNC =>
@@ -2164,6 +2472,19 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_INTEGER,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_ALLOW_RANGE => [1, 1000000],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_ARCHIVE_PUSH => {},
+            &CFGCMD_ARCHIVE_PUSH_ASYNC => {},
+        },
+    },
+
     &CFGOPT_ARCHIVE_PUSH_QUEUE_MAX =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2233,6 +2554,38 @@ my %hConfigDefine =
         }
     },
 
+    &CFGOPT_BACKUP_CIPHER_SIDE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => CFGOPTVAL_BACKUP_FILTER_SIDE_DB,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_BACKUP_FILTER_SIDE_DB,
+            &CFGOPTVAL_BACKUP_FILTER_SIDE_REPO,
+        ],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+    },
+
+    &CFGOPT_BACKUP_COMPRESS_SIDE =>
+    {
+        &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
+        &CFGDEF_TYPE => CFGDEF_TYPE_STRING,
+        &CFGDEF_DEFAULT => CFGOPTVAL_BACKUP_FILTER_SIDE_DB,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_BACKUP_FILTER_SIDE_DB,
+            &CFGOPTVAL_BACKUP_FILTER_SIDE_REPO,
+        ],
+        &CFGDEF_COMMAND =>
+        {
+            &CFGCMD_BACKUP => {},
+        },
+    },
+
     &CFGOPT_BACKUP_STANDBY =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_GLOBAL,
@@ -2442,6 +2795,40 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_PG_HOST_CA_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_PG_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_PG_HOST_CA_PATH =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_TYPE => CFGDEF_TYPE_PATH,
+        &CFGDEF_REQUIRED => false,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_PG_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
+    &CFGOPT_PG_HOST_CERT_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_REQUIRED => true,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_PG_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
     &CFGOPT_PG_HOST_CMD =>
     {
         &CFGDEF_SECTION => CFGDEF_SECTION_STANZA,
@@ -2498,6 +2885,17 @@ my %hConfigDefine =
         &CFGDEF_DEFAULT => CFGDEF_DEFAULT_CONFIG_INCLUDE_PATH,
     },
 
+    &CFGOPT_PG_HOST_KEY_FILE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_REQUIRED => true,
+        &CFGDEF_DEPEND =>
+        {
+            &CFGDEF_DEPEND_OPTION => CFGOPT_PG_HOST_TYPE,
+            &CFGDEF_DEPEND_LIST => [CFGOPTVAL_HOST_TYPE_TLS],
+        },
+    },
+
     &CFGOPT_PG_HOST_PORT =>
     {
         &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
@@ -2511,6 +2909,18 @@ my %hConfigDefine =
         },
     },
 
+    &CFGOPT_PG_HOST_TYPE =>
+    {
+        &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
+        &CFGDEF_DEFAULT => CFGOPTVAL_HOST_TYPE_SSH,
+        &CFGDEF_REQUIRED => true,
+        &CFGDEF_ALLOW_LIST =>
+        [
+            &CFGOPTVAL_HOST_TYPE_SSH,
+            &CFGOPTVAL_HOST_TYPE_TLS,
+        ],
+    },
+
     &CFGOPT_PG_HOST_USER =>
     {
         &CFGDEF_INHERIT => CFGOPT_PG_HOST_CMD,
@@ -306,7 +306,12 @@ sub processManifest
         $oBackupProcess->hostAdd($self->{iMasterRemoteIdx}, 1);
     }
 
-    $oBackupProcess->hostAdd($self->{iCopyRemoteIdx}, cfgOption(CFGOPT_PROCESS_MAX));
+    # Add the hosts that will copy files
+    my $iCopyHostTotal = $self->copyHostAdd($oBackupProcess);
+
+    # With multiple standbys the pg path may be different on each so copy files using paths relative to the pg path
+    my $bCopyMulti = $iCopyHostTotal > 1;
+    my $hCopySize = {};
 
     # Variables used for parallel copy
     my $lFileTotal = 0;
@@ -369,7 +374,7 @@ sub processManifest
 
         # Create the file hash
         my $bIgnoreMissing = true;
-        my $strDbFile = $oBackupManifest->dbPathGet($strDbCopyPath, $strRepoFile);
+        my $strDbFile = $oBackupManifest->dbPathGet($bCopyMulti ? undef : $strDbCopyPath, $strRepoFile);
         my $iHostConfigIdx = $self->{iCopyRemoteIdx};
 
         # Certain files must be copied from the master
@@ -400,7 +405,9 @@ sub processManifest
                 defined($strLsnStart) ? hex((split('/', $strLsnStart))[0]) : 0xFFFFFFFF,
                 defined($strLsnStart) ? hex((split('/', $strLsnStart))[1]) : 0xFFFFFFFF,
                 $strRepoFile, defined($strReference) ? true : false, $bCompress, cfgOption(CFGOPT_COMPRESS_LEVEL),
-                $strBackupLabel, cfgOption(CFGOPT_DELTA)],
+                $strBackupLabel, cfgOption(CFGOPT_DELTA),
+                cfgOption(CFGOPT_BACKUP_COMPRESS_SIDE) eq CFGOPTVAL_BACKUP_COMPRESS_SIDE_REPO ? true : false,
+                cfgOption(CFGOPT_BACKUP_CIPHER_SIDE) eq CFGOPTVAL_BACKUP_CIPHER_SIDE_REPO ? true : false],
             {rParamSecure => $oBackupManifest->cipherPassSub() ? [$oBackupManifest->cipherPassSub()] : undef});
 
         # Size and checksum will be removed and then verified later as a sanity check
@@ -440,9 +447,22 @@ sub processManifest
     {
         foreach my $hJob (@{$hyJob})
         {
+            my $strDbFile = @{$hJob->{rParam}}[0];
+
+            # Relative paths are logged using the pg path of the host that copied the file
+            if ($bCopyMulti)
+            {
+                if (index($strDbFile, '/') != 0)
+                {
+                    $strDbFile = cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_PATH, $hJob->{iHostConfigIdx})) . "/${strDbFile}";
+                }
+
+                $hCopySize->{$hJob->{iHostConfigIdx}} += @{$hJob->{rResult}}[1];
+            }
+
             ($lSizeCurrent, $lManifestSaveCurrent) = backupManifestUpdate(
                 $oBackupManifest, cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $hJob->{iHostConfigIdx}), false),
-                $hJob->{iProcessId}, @{$hJob->{rParam}}[0], @{$hJob->{rParam}}[7], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],
+                $hJob->{iProcessId}, $strDbFile, @{$hJob->{rParam}}[7], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],
                 @{$hJob->{rParam}}[4], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent, $lManifestSaveSize,
                 $lManifestSaveCurrent);
         }
@@ -452,6 +472,15 @@ sub processManifest
         protocolKeepAlive();
     }
 
+    # Log how much was copied from each standby
+    foreach my $iHostConfigIdx (sort {$a <=> $b} keys(%{$hCopySize}))
+    {
+        &log(DETAIL,
+            'copied ' . fileSizeFormat($hCopySize->{$iHostConfigIdx}) . ' from pg' . $iHostConfigIdx .
+            (cfgOptionTest(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $iHostConfigIdx)) ?
+                ' (' . cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $iHostConfigIdx)) . ')' : ''));
+    }
+
     foreach my $strFile ($oBackupManifest->keys(MANIFEST_SECTION_TARGET_FILE))
     {
         # If the file has a reference, then it was not copied since it can be retrieved from the referenced backup. However, if
@@ -490,6 +519,123 @@ sub processManifest
     );
 }
 
+####################################################################################################################################
+# copyHostAdd
+#
+# Add the hosts that will copy files to the backup process.  When more than one standby is available split the processes between
+# them.  All standbys take jobs from the queue of the first standby so faster standbys will end up copying more files.  Returns the
+# number of hosts that will copy files.
+####################################################################################################################################
+sub copyHostAdd
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my
+    (
+        $strOperation,
+        $oBackupProcess,
+    ) =
+        logDebugParam
+        (
+            __PACKAGE__ . '->copyHostAdd', \@_,
+            {name => 'oBackupProcess', trace => true},
+        );
+
+    my @iyCopyRemoteIdx = defined($self->{iyCopyRemoteIdx}) ? @{$self->{iyCopyRemoteIdx}} : ($self->{iCopyRemoteIdx});
+    my $iCopyProcessMax = cfgOption(CFGOPT_PROCESS_MAX);
+
+    # There is no point in using more standbys than processes
+    if (@iyCopyRemoteIdx > $iCopyProcessMax)
+    {
+        splice(@iyCopyRemoteIdx, $iCopyProcessMax);
+    }
+
+    for (my $iCopyIdx = 0; $iCopyIdx < @iyCopyRemoteIdx; $iCopyIdx++)
+    {
+        $oBackupProcess->hostAdd(
+            $iyCopyRemoteIdx[$iCopyIdx],
+            int($iCopyProcessMax / @iyCopyRemoteIdx) + ($iCopyIdx < $iCopyProcessMax % @iyCopyRemoteIdx ? 1 : 0),
+            $self->{iCopyRemoteIdx});
+    }
+
+    # Return from function and log return values if any
+    return logDebugReturn
+    (
+        $strOperation,
+        {name => 'iCopyHostTotal', value => scalar(@iyCopyRemoteIdx), trace => true}
+    );
+}
+
+####################################################################################################################################
+# standbyCopyGet
+#
+# Get the additional standbys that can be used to copy files.  A standby that does not replay to the backup start is skipped with a
+# warning rather than failing the backup since the first standby is sufficient.  The db objects are released as each standby is
+# checked.
+####################################################################################################################################
+sub standbyCopyGet
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my
+    (
+        $strOperation,
+        $oBackupInfo,
+        $hyDbStandbyOther,
+        $strLsnStart,
+    ) =
+        logDebugParam
+        (
+            __PACKAGE__ . '->standbyCopyGet', \@_,
+            {name => 'oBackupInfo', trace => true},
+            {name => 'hyDbStandbyOther', trace => true},
+            {name => 'strLsnStart', trace => true},
+        );
+
+    my @iyRemoteIdx;
+
+    foreach my $hDbStandbyOther (@{$hyDbStandbyOther})
+    {
+        my $iRemoteIdx = $hDbStandbyOther->{iRemoteIdx};
+        my $oDbStandbyOther = $hDbStandbyOther->{oDb};
+
+        my ($strStandbyDbVersion, $iStandbyControlVersion, $iStandbyCatalogVersion, $ullStandbyDbSysId) = $oDbStandbyOther->info();
+        $oBackupInfo->check($strStandbyDbVersion, $iStandbyControlVersion, $iStandbyCatalogVersion, $ullStandbyDbSysId);
+
+        $oDbStandbyOther->configValidate();
+
+        &log(INFO, "wait for replay on standby pg${iRemoteIdx} to reach ${strLsnStart}");
+
+        logWarnOnErrorEnable();
+        eval
+        {
+            my ($strReplayedLSN) = $oDbStandbyOther->replayWait($strLsnStart);
+            push(@iyRemoteIdx, $iRemoteIdx);
+
+            &log(INFO, "replay on standby pg${iRemoteIdx} reached ${strReplayedLSN}");
+            return true;
+        }
+        or do
+        {
+            &log(WARN, "standby pg${iRemoteIdx} did not reach ${strLsnStart} and will not be used to copy files");
+        };
+        logWarnOnErrorDisable();
+
+        undef($oDbStandbyOther);
+        delete($hDbStandbyOther->{oDb});
+        protocolDestroy(CFGOPTVAL_REMOTE_TYPE_DB, $iRemoteIdx, true);
+    }
+
+    # Return from function and log return values if any
+    return logDebugReturn
+    (
+        $strOperation,
+        {name => 'iyRemoteIdx', value => \@iyRemoteIdx, trace => true}
+    );
+}
+
 ####################################################################################################################################
 # process
 #
@@ -523,9 +669,10 @@ sub process
     # Initialize database objects
     my $oDbMaster = undef;
     my $oDbStandby = undef;
+    my $hyDbStandbyOther = undef;
 
     # Get the database objects
-    ($oDbMaster, $self->{iMasterRemoteIdx}, $oDbStandby, $self->{iCopyRemoteIdx}) = dbObjectGet();
+    ($oDbMaster, $self->{iMasterRemoteIdx}, $oDbStandby, $self->{iCopyRemoteIdx}, $hyDbStandbyOther) = dbObjectGet();
 
     # If remote copy was not explicitly set then set it equal to master
     if (!defined($self->{iCopyRemoteIdx}))
@@ -875,6 +1022,15 @@ sub process
             # The standby db object won't be used anymore so undef it to catch any subsequent references
             undef($oDbStandby);
             protocolDestroy(CFGOPTVAL_REMOTE_TYPE_DB, $self->{iCopyRemoteIdx}, true);
+
+            # Additional standbys can share the file copy load as long as they have also replayed to the backup start
+            $self->{iyCopyRemoteIdx} =
+                [$self->{iCopyRemoteIdx}, $self->standbyCopyGet($oBackupInfo, $hyDbStandbyOther, $strLsnStart)];
+
+            if (@{$self->{iyCopyRemoteIdx}} > 1)
+            {
+                &log(INFO, 'copy files from standbys ' . join(', ', map {"pg$_"} @{$self->{iyCopyRemoteIdx}}));
+            }
         }
     }
 
@@ -1075,8 +1231,9 @@ sub process
         }
     }
 
-    # Final save of the backup manifest
+    # Final save of the backup manifest and its binary copy
     $oBackupManifest->save();
+    $oBackupManifest->saveBin();
 
     &log(INFO, "new backup label = ${strBackupLabel}");
 
@@ -236,12 +236,15 @@ sub backupManifestUpdate
         }
     }
 
-    # Determine whether to save the manifest
+    # Add the file to the journal so the change will be saved
+    $oManifest->journalAdd($strRepoFile);
+
+    # Determine whether to save the journal
     $lManifestSaveCurrent += $lSize;
 
     if ($lManifestSaveCurrent >= $lManifestSaveSize)
     {
-        $oManifest->saveCopy();
+        $oManifest->journalSave();
 
         logDebugMisc
         (
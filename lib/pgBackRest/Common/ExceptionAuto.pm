@@ -173,6 +173,8 @@ use constant ERROR_SERVICE                                          => 101;
 push @EXPORT, qw(ERROR_SERVICE);
 use constant ERROR_EXECUTE                                          => 102;
 push @EXPORT, qw(ERROR_EXECUTE);
+use constant ERROR_REPO_INVALID                                     => 103;
+push @EXPORT, qw(ERROR_REPO_INVALID);
 use constant ERROR_RUNTIME                                          => 122;
 push @EXPORT, qw(ERROR_RUNTIME);
 use constant ERROR_INVALID                                          => 123;
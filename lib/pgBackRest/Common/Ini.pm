@@ -211,6 +211,9 @@ sub load
 
             confess &log(ERROR, "unable to open $self->{strFileName} or $self->{strFileName}" . INI_COPY_EXT, ERROR_FILE_MISSING);
         }
+
+        # Remember that the copy was loaded so subclasses can apply changes saved after the copy
+        $self->{bLoadCopy} = true;
     }
 
     $self->{bExists} = true;
@@ -921,7 +921,8 @@ sub replayWait
 #
 # Gets the database objects(s) and indexes. The databases required for the backup type must be online. A connection to the available
 # databases will be established to determine which is the master and which, if any, is the standby. If there is a master and a
-# standby to which a connection can be established, it returns both, else just the master.
+# standby to which a connection can be established, it returns both, else just the master.  When backing up from a standby any
+# additional standbys found are also returned so file copies can be spread across all of them.
 ####################################################################################################################################
 sub dbObjectGet
 {
@@ -940,6 +941,7 @@ sub dbObjectGet
     my $iMasterRemoteIdx = 1;
     my $oDbMaster = undef;
     my $oDbStandby = undef;
+    my $hyDbStandbyOther = [];
 
     # Only iterate databases if online and more than one is defined.  It might be better to check the version of each database but
     # this is simple and works.
@@ -981,6 +983,12 @@ sub dbObjectGet
                                 $iStandbyIdx = $iRemoteIdx;
                                 $bAssigned = true;
                             }
+                            # Else keep additional standbys so they can share the file copy load
+                            elsif (cfgOption(CFGOPT_BACKUP_STANDBY))
+                            {
+                                push(@{$hyDbStandbyOther}, {oDb => $oDb, iRemoteIdx => $iRemoteIdx});
+                                $bAssigned = true;
+                            }
                         }
                         # Else this db is a master
                         else
@@ -1035,6 +1043,7 @@ sub dbObjectGet
         {name => 'iDbMasterIdx', value => $iMasterRemoteIdx},
         {name => 'oDbStandby', value => $oDbStandby},
         {name => 'iDbStandbyIdx', value => $iStandbyIdx},
+        {name => 'hyDbStandbyOther', value => $hyDbStandbyOther},
     );
 }
 
@@ -11,15 +11,28 @@ sub libcAutoConstant
 {
     return
     {
+        CFGOPTVAL_BACKUP_CIPHER_SIDE_DB                                  => 'db',
+        CFGOPTVAL_BACKUP_CIPHER_SIDE_REPO                                => 'repo',
+
+        CFGOPTVAL_BACKUP_COMPRESS_SIDE_DB                                => 'db',
+        CFGOPTVAL_BACKUP_COMPRESS_SIDE_REPO                              => 'repo',
+
         CFGOPTVAL_INFO_OUTPUT_TEXT                                       => 'text',
         CFGOPTVAL_INFO_OUTPUT_JSON                                       => 'json',
 
         CFGOPTVAL_LS_OUTPUT_TEXT                                         => 'text',
         CFGOPTVAL_LS_OUTPUT_JSON                                         => 'json',
+        CFGOPTVAL_LS_OUTPUT_JSON_LINES                                   => 'json-lines',
+
+        CFGOPTVAL_PG_HOST_TYPE_SSH                                       => 'ssh',
+        CFGOPTVAL_PG_HOST_TYPE_TLS                                       => 'tls',
 
         CFGOPTVAL_REPO_CIPHER_TYPE_NONE                                  => 'none',
         CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                           => 'aes-256-cbc',
 
+        CFGOPTVAL_REPO_HOST_TYPE_SSH                                     => 'ssh',
+        CFGOPTVAL_REPO_HOST_TYPE_TLS                                     => 'tls',
+
         CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL                       => 'full',
         CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF                       => 'diff',
         CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR                       => 'incr',
@@ -75,6 +88,11 @@ sub libcAutoExportTag
 {
     return
     {
+        backup =>
+        [
+            'backupDelta',
+        ],
+
         checksum =>
         [
             'pageChecksum',
@@ -82,12 +100,21 @@ sub libcAutoExportTag
 
         config =>
         [
+            'CFGOPTVAL_BACKUP_CIPHER_SIDE_DB',
+            'CFGOPTVAL_BACKUP_CIPHER_SIDE_REPO',
+            'CFGOPTVAL_BACKUP_COMPRESS_SIDE_DB',
+            'CFGOPTVAL_BACKUP_COMPRESS_SIDE_REPO',
             'CFGOPTVAL_INFO_OUTPUT_TEXT',
             'CFGOPTVAL_INFO_OUTPUT_JSON',
             'CFGOPTVAL_LS_OUTPUT_TEXT',
             'CFGOPTVAL_LS_OUTPUT_JSON',
+            'CFGOPTVAL_LS_OUTPUT_JSON_LINES',
+            'CFGOPTVAL_PG_HOST_TYPE_SSH',
+            'CFGOPTVAL_PG_HOST_TYPE_TLS',
             'CFGOPTVAL_REPO_CIPHER_TYPE_NONE',
             'CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC',
+            'CFGOPTVAL_REPO_HOST_TYPE_SSH',
+            'CFGOPTVAL_REPO_HOST_TYPE_TLS',
             'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL',
             'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF',
             'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR',
@@ -127,18 +154,23 @@ sub libcAutoExportTag
             'CFGCMD_LS',
             'CFGCMD_REMOTE',
             'CFGCMD_RESTORE',
+            'CFGCMD_SERVER',
             'CFGCMD_STANZA_CREATE',
             'CFGCMD_STANZA_DELETE',
             'CFGCMD_STANZA_UPGRADE',
             'CFGCMD_START',
             'CFGCMD_STOP',
+            'CFGCMD_VERIFY',
             'CFGCMD_VERSION',
             'CFGOPT_ARCHIVE_ASYNC',
             'CFGOPT_ARCHIVE_CHECK',
             'CFGOPT_ARCHIVE_COPY',
             'CFGOPT_ARCHIVE_GET_QUEUE_MAX',
+            'CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG',
             'CFGOPT_ARCHIVE_PUSH_QUEUE_MAX',
             'CFGOPT_ARCHIVE_TIMEOUT',
+            'CFGOPT_BACKUP_CIPHER_SIDE',
+            'CFGOPT_BACKUP_COMPRESS_SIDE',
             'CFGOPT_BACKUP_STANDBY',
             'CFGOPT_BUFFER_SIZE',
             'CFGOPT_C',
@@ -168,6 +200,7 @@ sub libcAutoExportTag
             'CFGOPT_LOG_SUBPROCESS',
             'CFGOPT_LOG_TIMESTAMP',
             'CFGOPT_MANIFEST_SAVE_THRESHOLD',
+            'CFGOPT_METRIC_PATH',
             'CFGOPT_NEUTRAL_UMASK',
             'CFGOPT_ONLINE',
             'CFGOPT_OUTPUT',
@@ -180,6 +213,30 @@ sub libcAutoExportTag
             'CFGOPT_PG_HOST6',
             'CFGOPT_PG_HOST7',
             'CFGOPT_PG_HOST8',
+            'CFGOPT_PG_HOST_CA_FILE',
+            'CFGOPT_PG_HOST_CA_FILE2',
+            'CFGOPT_PG_HOST_CA_FILE3',
+            'CFGOPT_PG_HOST_CA_FILE4',
+            'CFGOPT_PG_HOST_CA_FILE5',
+            'CFGOPT_PG_HOST_CA_FILE6',
+            'CFGOPT_PG_HOST_CA_FILE7',
+            'CFGOPT_PG_HOST_CA_FILE8',
+            'CFGOPT_PG_HOST_CA_PATH',
+            'CFGOPT_PG_HOST_CA_PATH2',
+            'CFGOPT_PG_HOST_CA_PATH3',
+            'CFGOPT_PG_HOST_CA_PATH4',
+            'CFGOPT_PG_HOST_CA_PATH5',
+            'CFGOPT_PG_HOST_CA_PATH6',
+            'CFGOPT_PG_HOST_CA_PATH7',
+            'CFGOPT_PG_HOST_CA_PATH8',
+            'CFGOPT_PG_HOST_CERT_FILE',
+            'CFGOPT_PG_HOST_CERT_FILE2',
+            'CFGOPT_PG_HOST_CERT_FILE3',
+            'CFGOPT_PG_HOST_CERT_FILE4',
+            'CFGOPT_PG_HOST_CERT_FILE5',
+            'CFGOPT_PG_HOST_CERT_FILE6',
+            'CFGOPT_PG_HOST_CERT_FILE7',
+            'CFGOPT_PG_HOST_CERT_FILE8',
             'CFGOPT_PG_HOST_CMD',
             'CFGOPT_PG_HOST_CMD2',
             'CFGOPT_PG_HOST_CMD3',
@@ -212,6 +269,14 @@ sub libcAutoExportTag
             'CFGOPT_PG_HOST_CONFIG_PATH6',
             'CFGOPT_PG_HOST_CONFIG_PATH7',
             'CFGOPT_PG_HOST_CONFIG_PATH8',
+            'CFGOPT_PG_HOST_KEY_FILE',
+            'CFGOPT_PG_HOST_KEY_FILE2',
+            'CFGOPT_PG_HOST_KEY_FILE3',
+            'CFGOPT_PG_HOST_KEY_FILE4',
+            'CFGOPT_PG_HOST_KEY_FILE5',
+            'CFGOPT_PG_HOST_KEY_FILE6',
+            'CFGOPT_PG_HOST_KEY_FILE7',
+            'CFGOPT_PG_HOST_KEY_FILE8',
             'CFGOPT_PG_HOST_PORT',
             'CFGOPT_PG_HOST_PORT2',
             'CFGOPT_PG_HOST_PORT3',
@@ -220,6 +285,14 @@ sub libcAutoExportTag
             'CFGOPT_PG_HOST_PORT6',
             'CFGOPT_PG_HOST_PORT7',
             'CFGOPT_PG_HOST_PORT8',
+            'CFGOPT_PG_HOST_TYPE',
+            'CFGOPT_PG_HOST_TYPE2',
+            'CFGOPT_PG_HOST_TYPE3',
+            'CFGOPT_PG_HOST_TYPE4',
+            'CFGOPT_PG_HOST_TYPE5',
+            'CFGOPT_PG_HOST_TYPE6',
+            'CFGOPT_PG_HOST_TYPE7',
+            'CFGOPT_PG_HOST_TYPE8',
             'CFGOPT_PG_HOST_USER',
             'CFGOPT_PG_HOST_USER2',
             'CFGOPT_PG_HOST_USER3',
@@ -254,18 +327,26 @@ sub libcAutoExportTag
             'CFGOPT_PG_SOCKET_PATH8',
             'CFGOPT_PROCESS',
             'CFGOPT_PROCESS_MAX',
+            'CFGOPT_PROFILE',
             'CFGOPT_PROTOCOL_TIMEOUT',
             'CFGOPT_RECOVERY_OPTION',
             'CFGOPT_RECURSE',
+            'CFGOPT_REPO_CACHE_PATH',
+            'CFGOPT_REPO_CACHE_SIZE',
             'CFGOPT_REPO_CIPHER_PASS',
             'CFGOPT_REPO_CIPHER_TYPE',
             'CFGOPT_REPO_HARDLINK',
             'CFGOPT_REPO_HOST',
+            'CFGOPT_REPO_HOST_CA_FILE',
+            'CFGOPT_REPO_HOST_CA_PATH',
+            'CFGOPT_REPO_HOST_CERT_FILE',
             'CFGOPT_REPO_HOST_CMD',
             'CFGOPT_REPO_HOST_CONFIG',
             'CFGOPT_REPO_HOST_CONFIG_INCLUDE_PATH',
             'CFGOPT_REPO_HOST_CONFIG_PATH',
+            'CFGOPT_REPO_HOST_KEY_FILE',
             'CFGOPT_REPO_HOST_PORT',
+            'CFGOPT_REPO_HOST_TYPE',
             'CFGOPT_REPO_HOST_USER',
             'CFGOPT_REPO_PATH',
             'CFGOPT_REPO_RETENTION_ARCHIVE',
@@ -279,6 +360,7 @@ sub libcAutoExportTag
             'CFGOPT_REPO_S3_HOST',
             'CFGOPT_REPO_S3_KEY',
             'CFGOPT_REPO_S3_KEY_SECRET',
+            'CFGOPT_REPO_S3_LIST_PARALLEL',
             'CFGOPT_REPO_S3_PORT',
             'CFGOPT_REPO_S3_REGION',
             'CFGOPT_REPO_S3_TOKEN',
@@ -287,6 +369,7 @@ sub libcAutoExportTag
             'CFGOPT_RESUME',
             'CFGOPT_SET',
             'CFGOPT_SORT',
+            'CFGOPT_SORT_MAX',
             'CFGOPT_SPOOL_PATH',
             'CFGOPT_STANZA',
             'CFGOPT_START_FAST',
@@ -300,6 +383,12 @@ sub libcAutoExportTag
             'CFGOPT_TEST',
             'CFGOPT_TEST_DELAY',
             'CFGOPT_TEST_POINT',
+            'CFGOPT_TLS_SERVER_ADDRESS',
+            'CFGOPT_TLS_SERVER_AUTH',
+            'CFGOPT_TLS_SERVER_CA_FILE',
+            'CFGOPT_TLS_SERVER_CERT_FILE',
+            'CFGOPT_TLS_SERVER_KEY_FILE',
+            'CFGOPT_TLS_SERVER_PORT',
             'CFGOPT_TYPE',
             'cfgCommandName',
             'cfgOptionIndex',
@@ -352,6 +441,11 @@ sub libcAutoExportTag
             'lockRelease',
         ],
 
+        manifest =>
+        [
+            'manifestBinFromText',
+        ],
+
         random =>
         [
             'cryptoRandomBytes',
@@ -11,6 +11,7 @@ use Carp qw(confess);
 use Exporter qw(import);
     our @EXPORT = qw();
 use File::Basename qw(dirname basename);
+use JSON::PP;
 use Time::Local qw(timelocal);
 
 use pgBackRest::DbVersion;
@@ -19,6 +20,7 @@ use pgBackRest::Common::Ini;
 use pgBackRest::Common::Log;
 use pgBackRest::Common::Wait;
 use pgBackRest::Config::Config;
+use pgBackRest::LibC qw(:backup :manifest);
 use pgBackRest::Protocol::Helper;
 use pgBackRest::Protocol::Storage::Helper;
 use pgBackRest::Storage::Helper;
@@ -32,6 +34,8 @@ use constant FILE_MANIFEST                                          => 'backup.m
     push @EXPORT, qw(FILE_MANIFEST);
 use constant FILE_MANIFEST_COPY                                     => FILE_MANIFEST . INI_COPY_EXT;
     push @EXPORT, qw(FILE_MANIFEST_COPY);
+use constant FILE_MANIFEST_BIN                                      => FILE_MANIFEST . '.bin';
+    push @EXPORT, qw(FILE_MANIFEST_BIN);
 
 ####################################################################################################################################
 # Default match factor
@@ -353,10 +357,210 @@ sub save
     # Call inherited save
     $self->SUPER::save();
 
+    # The main manifest contains everything in the journal so it can be removed
+    $self->journalRemove();
+
+    # Return from function and log return values if any
+    return logDebugReturn($strOperation);
+}
+
+####################################################################################################################################
+# saveBin
+#
+# Save a binary copy of the manifest next to the manifest so files can be found without parsing JSON.  The manifest must be saved
+# first so the checksum is current.
+####################################################################################################################################
+sub saveBin
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my ($strOperation) = logDebugParam(__PACKAGE__ . '->saveBin');
+
+    $self->{oStorage}->put(
+        dirname($self->{strFileName}) . '/' . FILE_MANIFEST_BIN, manifestBinFromText(iniRender($self->{oContent})),
+        {strCipherPass => $self->{strCipherPass}});
+
+    # Return from function and log return values if any
+    return logDebugReturn($strOperation);
+}
+
+####################################################################################################################################
+# load
+#
+# Load the manifest.  If only the copy exists (i.e. the backup was aborted) then replay the journal on top of it.
+####################################################################################################################################
+sub load
+{
+    my $self = shift;
+    my $bIgnoreMissing = shift;
+
+    # Call inherited load
+    $self->SUPER::load($bIgnoreMissing);
+
+    if ($self->{bLoadCopy})
+    {
+        $self->journalReplay();
+    }
+}
+
+####################################################################################################################################
+# saveCopy
+#
+# Save a copy of the manifest.  The copy contains everything in the journal so the journal can be removed.
+####################################################################################################################################
+sub saveCopy
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my ($strOperation) = logDebugParam(__PACKAGE__ . '->saveCopy');
+
+    # Call inherited saveCopy
+    $self->SUPER::saveCopy();
+
+    # Pending journal entries are now in the copy
+    $self->journalRemove();
+
     # Return from function and log return values if any
     return logDebugReturn($strOperation);
 }
 
+####################################################################################################################################
+# journalAdd
+#
+# Add a file to the journal.  The current state of the file in the manifest (or its absence) will be written on the next
+# journalSave().
+####################################################################################################################################
+sub journalAdd
+{
+    my $self = shift;
+    my $strRepoFile = shift;
+
+    $self->{hJournal}{$strRepoFile} = true;
+}
+
+####################################################################################################################################
+# journalSave
+#
+# Save files added to the journal since the last save in a new journal segment.  This is much cheaper than saving a copy of the
+# full manifest since only the files that changed are written.  Segments are written as separate files rather than appended to
+# a single file because object stores do not support appends.
+####################################################################################################################################
+sub journalSave
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my ($strOperation) = logDebugParam(__PACKAGE__ . '->journalSave');
+
+    if (defined($self->{hJournal}))
+    {
+        # Store the current state of each file, undef when the file has been removed
+        my $hContent;
+
+        foreach my $strRepoFile (keys(%{$self->{hJournal}}))
+        {
+            $hContent->{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile} =
+                $self->{oContent}{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile};
+        }
+
+        $self->{iJournalTotal} = (defined($self->{iJournalTotal}) ? $self->{iJournalTotal} : 0) + 1;
+
+        $self->{oStorage}->put(
+            $self->journalFile($self->{iJournalTotal}), iniRender($hContent), {strCipherPass => $self->{strCipherPass}});
+
+        delete($self->{hJournal});
+    }
+
+    # Return from function and log return values if any
+    return logDebugReturn($strOperation);
+}
+
+####################################################################################################################################
+# journalReplay
+#
+# Apply journal segments in order.  Replay stops at the first missing or invalid segment since a segment may be incomplete if
+# the backup was aborted while it was being written.
+####################################################################################################################################
+sub journalReplay
+{
+    my $self = shift;
+
+    # Assign function parameters, defaults, and log debug info
+    my ($strOperation) = logDebugParam(__PACKAGE__ . '->journalReplay');
+
+    my $iSegmentIdx = 1;
+
+    while (true)
+    {
+        my $rstrContent = $self->{oStorage}->get(
+            $self->{oStorage}->openRead(
+                $self->journalFile($iSegmentIdx), {bIgnoreMissing => true, strCipherPass => $self->{strCipherPass}}));
+
+        last if !defined($rstrContent);
+
+        my $hContent = iniParse($$rstrContent, {bIgnoreInvalid => true});
+
+        last if !defined($hContent);
+
+        foreach my $strRepoFile (keys(%{$hContent->{&MANIFEST_SECTION_TARGET_FILE}}))
+        {
+            my $hFile = $hContent->{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile};
+
+            if (defined($hFile))
+            {
+                $self->{oContent}{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile} = $hFile;
+            }
+            else
+            {
+                delete($self->{oContent}{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile});
+            }
+        }
+
+        $self->{bModified} = true;
+        $iSegmentIdx++;
+    }
+
+    # Return from function and log return values if any
+    return logDebugReturn
+    (
+        $strOperation,
+        {name => 'iSegmentTotal', value => $iSegmentIdx - 1, trace => true}
+    );
+}
+
+####################################################################################################################################
+# journalRemove
+#
+# Remove pending journal entries and journal segments written by this object.
+####################################################################################################################################
+sub journalRemove
+{
+    my $self = shift;
+
+    delete($self->{hJournal});
+
+    if (defined($self->{iJournalTotal}))
+    {
+        $self->{oStorage}->remove([map {$self->journalFile($_)} (1 .. $self->{iJournalTotal})]);
+        delete($self->{iJournalTotal});
+    }
+}
+
+####################################################################################################################################
+# journalFile
+#
+# Get the name of a journal segment.
+####################################################################################################################################
+sub journalFile
+{
+    my $self = shift;
+    my $iSegmentIdx = shift;
+
+    return $self->{strFileName} . INI_COPY_EXT . '.journal.' . sprintf('%06d', $iSegmentIdx);
+}
+
 ####################################################################################################################################
 # get
 #
@@ -1114,98 +1318,31 @@ sub build
                               $hDatabaseMap->{$strDbName}{&MANIFEST_KEY_DB_LAST_SYSTEM_ID});
         }
 
-        # Determine if delta checksum should be enabled
-        if (!$bDelta)
+        # Compare files against the last manifest to determine if delta checksum should be enabled and which files can be
+        # referenced. The comparison is a merge-join in C that sets the reference, checksum, and future attributes directly.
+        if ($self->test(MANIFEST_SECTION_TARGET_FILE))
         {
-            my @stryFileList = $self->keys(MANIFEST_SECTION_TARGET_FILE);
-
-            if (@stryFileList)
+            my $hDelta = JSON::PP->new()->decode(
+                backupDelta(
+                    $self->{oContent}{&MANIFEST_SECTION_TARGET_FILE},
+                    defined($oLastManifest) ? $oLastManifest->{oContent}{&MANIFEST_SECTION_TARGET_FILE} : undef,
+                    defined($oLastManifest) ? $oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LABEL) : undef,
+                    $lTimeBegin, $bDelta));
+
+            if ($hDelta->{deltaReason} eq 'future')
             {
-                $bDelta = $self->checkDeltaFile(\@stryFileList, $oLastManifest, $lTimeBegin);
+                &log(WARN, "file $hDelta->{deltaFile} has timestamp in the future, enabling delta checksum");
             }
-        }
-
-        # Loop though all files
-        foreach my $strName ($self->keys(MANIFEST_SECTION_TARGET_FILE))
-        {
-            # If modification time is in the future (in this backup OR the last backup) set warning flag and do not
-            # allow a reference
-            if ($self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP) > $lTimeBegin ||
-                (defined($oLastManifest) &&
-                 $oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_FUTURE, 'y')))
+            elsif ($hDelta->{deltaReason} eq 'change')
             {
-                $bTimeInFuture = true;
-
-                # Only mark as future if still in the future in the current backup
-                if ($self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP) > $lTimeBegin)
-                {
-                    $self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_FUTURE, 'y');
-                }
+                &log(
+                    WARN,
+                    "file $hDelta->{deltaFile} timestamp in the past or size changed but timestamp did not, enabling delta" .
+                        " checksum");
             }
-            # Else check if the size and timestamp match OR if the size matches and the delta option is set, then keep the file.
-            # In the latter case, if there had been a timestamp change then rather than removing and recopying the file, the file
-            # will be tested in backupFile to see if the db/repo checksum still matches: if so, it is not necessary to recopy,
-            # else it will need to be copied to the new backup. For zero sized files, the reference will be set and copying
-            # will be skipped later.
-            elsif (defined($oLastManifest) && $oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName) &&
-                   $self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE) ==
-                       $oLastManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE) &&
-                   ($bDelta || ($self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE) == 0 ||
-                   $self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP) ==
-                       $oLastManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP))))
-            {
-                # Copy reference from previous backup if possible
-                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE))
-                {
-                    $self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE,
-                        $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE));
-                }
-                # Otherwise the reference is to the previous backup
-                else
-                {
-                    $self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE,
-                        $oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LABEL));
-                }
-
-                # Copy the checksum from previous manifest (if it exists - zero sized files don't have checksums)
-                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM))
-                {
-                    $self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM,
-                               $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM));
-                }
-
-                # Copy repo size from the previous manifest (if it exists)
-                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE))
-                {
-                    $self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE,
-                        $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE));
-                }
-
-                # Copy master flag from the previous manifest (if it exists)
-                if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER))
-                {
-                    $self->set(
-                        MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER,
-                        $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER));
-                }
-
-                # Copy checksum page from the previous manifest (if it exists)
-                my $bChecksumPage = $oLastManifest->get(
-                    MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE, false);
-
-                if (defined($bChecksumPage))
-                {
-                    $self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE, $bChecksumPage);
 
-                    if (!$bChecksumPage &&
-                        $oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR))
-                    {
-                        $self->set(
-                            MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR,
-                            $oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR));
-                    }
-                }
-            }
+            $bDelta = $hDelta->{delta} ? true : false;
+            $bTimeInFuture = $hDelta->{timeInFuture} ? true : false;
         }
 
         # Warn if any files in the current backup are in the future
@@ -10,6 +10,7 @@ use Carp qw(confess);
 use Exporter qw(import);
     our @EXPORT = qw();
 
+use pgBackRest::Common::Exception;
 use pgBackRest::Common::Log;
 use pgBackRest::Config::Config;
 use pgBackRest::Protocol::Remote::Master;
@@ -61,6 +62,8 @@ use constant OP_STORAGE_PATH_GET                                    => 'storageP
 # Restore module
 use constant OP_RESTORE_FILE                                         => 'restoreFile';
     push @EXPORT, qw(OP_RESTORE_FILE);
+use constant OP_RESTORE_PATH                                         => 'restorePath';
+    push @EXPORT, qw(OP_RESTORE_PATH);
 
 # Wait
 use constant OP_WAIT                                                 => 'wait';
@@ -162,9 +165,11 @@ sub protocolParam
     my $strOptionDbPort = undef;
     my $strOptionDbSocketPath = undef;
     my $strOptionSshPort = CFGOPT_REPO_HOST_PORT;
+    my $iOptionIdType = CFGOPT_REPO_HOST_TYPE;
 
     if ($strRemoteType eq CFGOPTVAL_REMOTE_TYPE_DB)
     {
+        $iOptionIdType = cfgOptionIdFromIndex(CFGOPT_PG_HOST_TYPE, $iRemoteIdx);
         $iOptionIdCmd = cfgOptionIdFromIndex(CFGOPT_PG_HOST_CMD, $iRemoteIdx);
         $iOptionIdConfig = cfgOptionIdFromIndex(CFGOPT_PG_HOST_CONFIG, $iRemoteIdx);
         $iOptionIdConfigIncludePath = cfgOptionIdFromIndex(CFGOPT_PG_HOST_CONFIG_INCLUDE_PATH, $iRemoteIdx);
@@ -174,6 +179,16 @@ sub protocolParam
         $strOptionSshPort = cfgOptionIdFromIndex(CFGOPT_PG_HOST_PORT, $iRemoteIdx);
     }
 
+    # The TLS transport is only implemented in C so error rather than silently connecting with SSH
+    if (cfgOptionValid($iOptionIdType) && cfgOption($iOptionIdType) eq CFGOPTVAL_REPO_HOST_TYPE_TLS)
+    {
+        confess &log(
+            ERROR,
+            "option '" . cfgOptionName($iOptionIdType) . '=' . CFGOPTVAL_REPO_HOST_TYPE_TLS . "' is not supported by the " .
+                cfgCommandName(cfgCommandGet()) . ' command',
+            ERROR_OPTION_INVALID_VALUE);
+    }
+
     # Db path is not valid in all contexts (restore, for instance)
     if (cfgOptionValid(cfgOptionIdFromIndex(CFGOPT_PG_PATH, $iRemoteIdx)))
     {
@@ -35,6 +35,7 @@ sub new
         $self->{iSelectTimeout},
         $self->{strBackRestBin},
         $self->{bConfessError},
+        $self->{bQueueDynamic},
     ) =
         logDebugParam
         (
@@ -43,6 +44,8 @@ sub new
             {name => 'iSelectTimeout', default => int(cfgOption(CFGOPT_PROTOCOL_TIMEOUT) / 2)},
             {name => 'strBackRestBin', default => projectBin()},
             {name => 'bConfessError', default => true},
+            # Allow jobs to be queued while processing, e.g. when a job result determines what jobs run next
+            {name => 'bQueueDynamic', default => false},
         );
 
     # Declare host map and array
@@ -95,7 +98,9 @@ sub reset
 ####################################################################################################################################
 # hostAdd
 #
-# Add a host where jobs can be executed.
+# Add a host where jobs can be executed.  A host may share the queue of a host that was previously added so jobs are taken by
+# whichever host is free first.  Locals on faster hosts finish their jobs sooner and take more jobs from the shared queue so work is
+# spread across the hosts in proportion to their throughput.
 ####################################################################################################################################
 sub hostAdd
 {
@@ -107,12 +112,14 @@ sub hostAdd
         $strOperation,
         $iHostConfigIdx,
         $iProcessMax,
+        $iQueueHostConfigIdx,
     ) =
         logDebugParam
         (
             __PACKAGE__ . '->hostAdd', \@_,
             {name => 'iHostConfigIdx'},
             {name => 'iProcessMax'},
+            {name => 'iQueueHostConfigIdx', required => false},
         );
 
     my $iHostIdx = $self->{hHostMap}{$iHostConfigIdx};
@@ -129,12 +136,36 @@ sub hostAdd
         iProcessMax => $iProcessMax,
     };
 
+    # If sharing the queue of another host then store the index of the host that owns the queue
+    if (defined($iQueueHostConfigIdx) && $iQueueHostConfigIdx != $iHostConfigIdx)
+    {
+        $hHost->{iQueueHostIdx} = $self->{hHostMap}{$iQueueHostConfigIdx};
+
+        if (!defined($hHost->{iQueueHostIdx}))
+        {
+            confess &log(ASSERT, "iQueueHostConfigIdx = ${iQueueHostConfigIdx} must be added before it can be shared");
+        }
+    }
+
     push(@{$self->{hyHost}}, $hHost);
 
     # Return from function and log return values if any
     return logDebugReturn($strOperation);
 }
 
+####################################################################################################################################
+# hostQueue
+#
+# Get the host that owns the queue used by a host.
+####################################################################################################################################
+sub hostQueue
+{
+    my $self = shift;
+    my $hHost = shift;
+
+    return defined($hHost->{iQueueHostIdx}) ? $self->{hyHost}[$hHost->{iQueueHostIdx}] : $hHost;
+}
+
 ####################################################################################################################################
 # hostConnect
 #
@@ -156,7 +187,7 @@ sub hostConnect
     foreach my $hHost (@{$self->{hyHost}})
     {
         # If there are no jobs in the queue for this host then no need to connect
-        if (!defined($hHost->{hyQueue}))
+        if (!defined($self->hostQueue($hHost)->{hyQueue}))
         {
             logDebugMisc(
                 $strOperation, "no jobs for host",
@@ -239,31 +270,18 @@ sub init
         foreach my $hLocal (@{$self->{hyLocal}})
         {
             my $hHost = $self->{hyHost}[$hLocal->{iHostIdx}];
-            my $hyQueue = $hHost->{hyQueue};
+            my $hyQueue = $self->hostQueue($hHost)->{hyQueue};
 
             # Initialize variables to keep track of what job the local is working on
             $hLocal->{iDirection} = $hLocal->{iHostProcessIdx} % 2 == 0 ? 1 : -1;
             $hLocal->{iQueueIdx} = int((@{$hyQueue} / $hHost->{iProcessMax}) * $hLocal->{iHostProcessIdx});
 
-            # Calculate the last queue that this process should pull from
-            $hLocal->{iQueueLastIdx} = $hLocal->{iQueueIdx} + ($hLocal->{iDirection} * -1);
-
-            if ($hLocal->{iQueueLastIdx} < 0)
-            {
-                $hLocal->{iQueueLastIdx} = @{$hyQueue} - 1;
-            }
-            elsif ($hLocal->{iQueueLastIdx} >= @{$hyQueue})
-            {
-                $hLocal->{iQueueLastIdx} = 0;
-            }
-
             logDebugMisc(
                 $strOperation, 'init local process',
                 {name => 'iHostIdx', value => $hLocal->{iHostIdx}},
                 {name => 'iProcessId', value => $hLocal->{iProcessId}},
                 {name => 'iDirection', value => $hLocal->{iDirection}},
-                {name => 'iQueueIdx', value => $hLocal->{iQueueIdx}},
-                {name => 'iQueueLastIdx', value => $hLocal->{iQueueLastIdx}});
+                {name => 'iQueueIdx', value => $hLocal->{iQueueIdx}});
         }
 
         $self->{bProcessing} = true;
@@ -300,6 +318,12 @@ sub process
         }
     }
 
+    # Assign jobs that were queued since the last call so they do not wait for a running job to complete
+    if ($self->{bQueueDynamic} && $self->{iQueued} > 0)
+    {
+        $self->jobAssign();
+    }
+
     # If jobs are running then wait for any of them to complete
     my @hyResult = ();
     my $iCompleted = 0;
@@ -390,105 +414,148 @@ sub process
             {name => 'iRunning', value => $self->{iRunning}, trace => true},
             {name => 'iCompleted', value => $iCompleted, trace => true});
 
-        my $bFound = false;
-        my $iLocalIdx = -1;
+        my $bFound = $self->jobAssign(@hyResult > 0);
 
-        # Iterate all local processes
-        foreach my $hLocal (@{$self->{hyLocal}})
+        # If nothing is running, no more jobs, and nothing to return, then processing is complete
+        if (!$bFound && !$self->{iRunning} && @hyResult == 0)
         {
-            # Skip this local process if it has already completed
-            $iLocalIdx++;
-            next if (!defined($hLocal));
+            logDebugMisc($strOperation, 'all jobs complete');
+            $self->reset();
+            return;
+        }
+    }
 
-            my $hHost = $self->{hyHost}[$hLocal->{iHostIdx}];
-            my $hyQueue = $hHost->{hyQueue};
+    # Return job results
+    return \@hyResult;
+}
 
-            # If this process does not currently have a job assigned then find one
-            if (!defined($hLocal->{hJob}))
-            {
-                # Search queues for a new job
-                my $iQueueIdx = $hLocal->{iQueueIdx};
-                my $hJob = shift(@{$$hyQueue[$iQueueIdx]});
+####################################################################################################################################
+# jobAssign
+#
+# Assign queued jobs to local processes that are not running a job.
+####################################################################################################################################
+sub jobAssign
+{
+    my $self = shift;
 
-                while (!defined($hJob) && $iQueueIdx != $hLocal->{iQueueLastIdx})
-                {
-                    $iQueueIdx += $hLocal->{iDirection};
+    # Assign function parameters, defaults, and log debug info
+    my
+    (
+        $strOperation,
+        $bResultPending,                            # Are there results that have not been returned to the caller yet?
+    ) =
+        logDebugParam
+        (
+            __PACKAGE__ . '->jobAssign', \@_,
+            {name => 'bResultPending', default => false, trace => true},
+        );
 
-                    if ($iQueueIdx < 0)
-                    {
-                        $iQueueIdx = @{$hyQueue} - 1;
-                    }
-                    elsif ($iQueueIdx >= @{$hyQueue})
-                    {
-                        $iQueueIdx = 0;
-                    }
+    my $bFound = false;
+    my $iLocalIdx = -1;
 
-                    $hJob = shift(@{$$hyQueue[$iQueueIdx]});
-                }
+    # Iterate all local processes
+    foreach my $hLocal (@{$self->{hyLocal}})
+    {
+        # Skip this local process if it has already completed
+        $iLocalIdx++;
+        next if (!defined($hLocal));
 
-                # If no job was found then stop the local process
-                if (!defined($hJob))
-                {
-                    logDebugMisc(
-                        $strOperation, 'no jobs found, stop local',
-                        {name => 'strHostType', value => $hLocal->{strHostType}},
-                        {name => 'iHostConfigIdx', value => $hLocal->{iHostConfigIdx}},
-                        {name => 'iHostIdx', value => $hLocal->{iHostIdx}},
-                        {name => 'iProcessId', value => $hLocal->{iProcessId}});
+        my $hHost = $self->{hyHost}[$hLocal->{iHostIdx}];
+        my $hyQueue = $self->hostQueue($hHost)->{hyQueue};
 
-                    # Remove input handle from the select object
-                    my $iHandleTotal = $self->{oSelect}->count();
+        # If this process does not currently have a job assigned then find one
+        if (!defined($hLocal->{hJob}))
+        {
+            # Search queues for a new job starting with the queue assigned to this process and wrapping around until all queues
+            # have been searched.  The number of queues is checked on each search since queues may be added while processing.
+            my $iQueueIdx = $hLocal->{iQueueIdx};
+            my $hJob = shift(@{$$hyQueue[$iQueueIdx]});
+            my $iQueueSearched = 1;
 
-                    $self->{oSelect}->remove($hLocal->{hndIn});
+            while (!defined($hJob) && $iQueueSearched < @{$hyQueue})
+            {
+                $iQueueIdx += $hLocal->{iDirection};
 
-                    if ($iHandleTotal - $self->{oSelect}->count() != 1)
-                    {
-                        confess &log(ASSERT,
-                            "iProcessId $hLocal->{iProcessId}, handle $hLocal->{hndIn} was not removed from select object");
-                    }
+                if ($iQueueIdx < 0)
+                {
+                    $iQueueIdx = @{$hyQueue} - 1;
+                }
+                elsif ($iQueueIdx >= @{$hyQueue})
+                {
+                    $iQueueIdx = 0;
+                }
+
+                $hJob = shift(@{$$hyQueue[$iQueueIdx]});
+                $iQueueSearched++;
+            }
+
+            # If no job was found but the results of running or completed jobs may still cause new jobs to be queued then leave the
+            # local process idle
+            if (!defined($hJob) && $self->{bQueueDynamic} && ($self->{iRunning} > 0 || $bResultPending))
+            {
+                next;
+            }
 
-                    # Remove input handle from the map
-                    delete($self->{hLocalMap}{$hLocal->{hndIn}});
+            # If no job was found then stop the local process
+            if (!defined($hJob))
+            {
+                logDebugMisc(
+                    $strOperation, 'no jobs found, stop local',
+                    {name => 'strHostType', value => $hLocal->{strHostType}},
+                    {name => 'iHostConfigIdx', value => $hLocal->{iHostConfigIdx}},
+                    {name => 'iHostIdx', value => $hLocal->{iHostIdx}},
+                    {name => 'iProcessId', value => $hLocal->{iProcessId}});
 
-                    # Close the local process
-                    $hLocal->{oLocal}->close(true);
+                # Remove input handle from the select object
+                my $iHandleTotal = $self->{oSelect}->count();
 
-                    # Undefine local process so it is no longer checked for new jobs
-                    undef(${$self->{hyLocal}}[$iLocalIdx]);
+                $self->{oSelect}->remove($hLocal->{hndIn});
 
-                    # Skip to next local process
-                    next;
+                if ($iHandleTotal - $self->{oSelect}->count() != 1)
+                {
+                    confess &log(ASSERT,
+                        "iProcessId $hLocal->{iProcessId}, handle $hLocal->{hndIn} was not removed from select object");
                 }
 
-                # Assign job to local process
-                $hLocal->{hJob} = $hJob;
-                $bFound = true;
-                $self->{iRunning}++;
-                $self->{iQueued}--;
+                # Remove input handle from the map
+                delete($self->{hLocalMap}{$hLocal->{hndIn}});
 
-                logDebugMisc(
-                    $strOperation, 'get job from queue',
-                    {name => 'iHostIdx', value => $hLocal->{iHostIdx}},
-                    {name => 'iProcessId', value => $hLocal->{iProcessId}},
-                    {name => 'strQueueIdx', value => $iQueueIdx},
-                    {name => 'strKey', value => $hLocal->{hJob}{strKey}});
+                # Close the local process
+                $hLocal->{oLocal}->close(true);
+
+                # Undefine local process so it is no longer checked for new jobs
+                undef(${$self->{hyLocal}}[$iLocalIdx]);
 
-                # Send job to local process
-                $hLocal->{oLocal}->cmdWrite($hLocal->{hJob}{strOp}, $hLocal->{hJob}->{rParam});
+                # Skip to next local process
+                next;
             }
-        }
 
-        # If nothing is running, no more jobs, and nothing to return, then processing is complete
-        if (!$bFound && !$self->{iRunning} && @hyResult == 0)
-        {
-            logDebugMisc($strOperation, 'all jobs complete');
-            $self->reset();
-            return;
+            # Assign job to local process.  The job may have been queued for a host that shares its queue so record the host that
+            # actually runs the job.
+            $hJob->{iHostConfigIdx} = $hHost->{iHostConfigIdx};
+            $hLocal->{hJob} = $hJob;
+            $bFound = true;
+            $self->{iRunning}++;
+            $self->{iQueued}--;
+
+            logDebugMisc(
+                $strOperation, 'get job from queue',
+                {name => 'iHostIdx', value => $hLocal->{iHostIdx}},
+                {name => 'iProcessId', value => $hLocal->{iProcessId}},
+                {name => 'strQueueIdx', value => $iQueueIdx},
+                {name => 'strKey', value => $hLocal->{hJob}{strKey}});
+
+            # Send job to local process
+            $hLocal->{oLocal}->cmdWrite($hLocal->{hJob}{strOp}, $hLocal->{hJob}->{rParam});
         }
     }
 
-    # Return job results
-    return \@hyResult;
+    # Return from function and log return values if any
+    return logDebugReturn
+    (
+        $strOperation,
+        {name => 'bFound', value => $bFound, trace => true}
+    );
 }
 
 ####################################################################################################################################
@@ -522,8 +589,8 @@ sub queueJob
             {name => 'rParamSecure', optional => true, redact => true},
         );
 
-    # Don't add jobs while in the middle of processing the current queue
-    if ($self->processing())
+    # Don't add jobs while in the middle of processing the current queue unless dynamic queueing is enabled
+    if ($self->processing() && !$self->{bQueueDynamic})
     {
         confess &log(ASSERT, 'new jobs cannot be added until processing is complete');
     }
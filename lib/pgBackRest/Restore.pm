@@ -25,6 +25,19 @@ use pgBackRest::Protocol::Storage::Helper;
 use pgBackRest::Storage::Helper;
 use pgBackRest::Version;
 
+####################################################################################################################################
+# Restore path entry keys and types (must match command/restore/path.h)
+####################################################################################################################################
+use constant RESTORE_PATH_KEY_DESTINATION                           => 'destination';
+use constant RESTORE_PATH_KEY_GROUP                                 => 'group';
+use constant RESTORE_PATH_KEY_MODE                                  => 'mode';
+use constant RESTORE_PATH_KEY_TYPE                                  => 'type';
+use constant RESTORE_PATH_KEY_USER                                  => 'user';
+
+use constant RESTORE_PATH_TYPE_FILE                                 => 'f';
+use constant RESTORE_PATH_TYPE_LINK                                 => 'l';
+use constant RESTORE_PATH_TYPE_PATH                                 => 'd';
+
 ####################################################################################################################################
 # CONSTRUCTOR
 ####################################################################################################################################
@@ -461,8 +474,8 @@ sub manifestLoad
 ####################################################################################################################################
 # clean
 #
-# Checks that the restore paths are empty, or if --force was used then it cleans files/paths/links from the restore directories that
-# are not present in the manifest.
+# Checks that the restore paths exist and are empty (unless --force or --delta specified).  Files/paths/links that are not present in
+# the manifest are removed by the restorePath jobs in process().
 ####################################################################################################################################
 sub clean
 {
@@ -484,14 +497,6 @@ sub clean
     # Db storage
     my $oStorageDb = storageDb();
 
-    # Track if files/links/paths where removed
-    my %oRemoveHash =
-    (
-        &MANIFEST_SECTION_TARGET_FILE => 0,
-        &MANIFEST_SECTION_TARGET_PATH => 0,
-        &MANIFEST_SECTION_TARGET_LINK => 0
-    );
-
     # Check that all targets exist and are empty (unless --force or --delta specified)
     my %oTargetFound;
     my $bDelta = cfgOption(CFGOPT_FORCE) || cfgOption(CFGOPT_DELTA);
@@ -499,7 +504,6 @@ sub clean
     for my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET))
     {
         ${$self->{oTargetPath}}{$strTarget} = $oManifest->get(MANIFEST_SECTION_BACKUP_TARGET, $strTarget, MANIFEST_SUBKEY_PATH);
-        $oTargetFound{$strTarget} = false;
 
         my $strCheckPath = ${$self->{oTargetPath}}{$strTarget};
 
@@ -538,10 +542,9 @@ sub clean
             my $strCheckFile = "${strCheckPath}/" .
                                $oManifest->get(MANIFEST_SECTION_BACKUP_TARGET, $strTarget, MANIFEST_SUBKEY_FILE);
 
-            # Check if the file exists
+            # If the file exists and this is not a delta then error
             if ($oStorageDb->exists($strCheckFile))
             {
-                # If the file exists and this is not a delta then error
                 if (!$bDelta)
                 {
                     confess &log(ERROR, "cannot restore file '${strCheckFile}' that already exists - " .
@@ -561,22 +564,20 @@ sub clean
                 # Construct the special tablespace path
                 ${$self->{oTargetPath}}{$strTarget} = "${$self->{oTargetPath}}{$strTarget}" .
                     (($oManifest->dbVersion() >= PG_VERSION_90) ? "/" . $oManifest->tablespacePathGet() : "");
-
-                # If this path does not exist then skip the rest of the checking - the path will be created later
-                if (!$oStorageDb->pathExists(${$self->{oTargetPath}}{$strTarget}))
-                {
-                    next;
-                }
             }
 
-            # Build a manifest of the path to check for existing files
-            my $hTargetManifest = $oStorageDb->manifest(${$self->{oTargetPath}}{$strTarget});
+            # If the path does not exist then skip the rest of the checking - the path will be created later
+            if (!$oStorageDb->pathExists(${$self->{oTargetPath}}{$strTarget}))
+            {
+                next;
+            }
 
-            for my $strName (keys(%{$hTargetManifest}))
+            # Only the top level of the path needs to be checked to know whether it contains files.  Paths below it are cleaned by
+            # the restorePath jobs in process().
+            for my $strName ($oStorageDb->list(${$self->{oTargetPath}}{$strTarget}))
             {
-                # Skip the root path and backup.manifest in the base path
-                if ($strName eq '.' ||
-                    (($strName eq FILE_MANIFEST || $strName eq DB_FILE_RECOVERYCONF) && $strTarget eq MANIFEST_TARGET_PGDATA))
+                # Skip backup.manifest and recovery.conf in the base path
+                if (($strName eq FILE_MANIFEST || $strName eq DB_FILE_RECOVERYCONF) && $strTarget eq MANIFEST_TARGET_PGDATA)
                 {
                     next;
                 }
@@ -590,316 +591,41 @@ sub clean
 
                 # Mark that some files were found
                 $oTargetFound{$strTarget} = true;
+                last;
             }
         }
     }
 
-    # Clean up each target starting from the most nested
-    my %oFileChecked;
-
+    # Report the targets that will be cleaned starting from the most nested.  The cleaning is done by the restorePath jobs in
+    # process().
     for my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET, INI_SORT_REVERSE))
     {
         if ($oTargetFound{$strTarget})
         {
             &log(INFO, "remove invalid files/paths/links from ${$self->{oTargetPath}}{$strTarget}");
-
-            # OK for the special tablespace path to not exist yet - it will be created later
-            if (!$oStorageDb->pathExists(${$self->{oTargetPath}}{$strTarget}) &&
-                $oManifest->isTargetTablespace($strTarget))
-            {
-                next;
-            }
-
-            # Load path manifest so it can be compared to deleted files/paths/links that are not in the backup
-            my $hTargetManifest = $oStorageDb->manifest(${$self->{oTargetPath}}{$strTarget});
-
-            # If the target is a file it doesn't matter whether it already exists or not.
-            if ($oManifest->isTargetFile($strTarget))
-            {
-                next;
-            }
-
-            foreach my $strName (sort {$b cmp $a} (keys(%{$hTargetManifest})))
-            {
-                # Skip the root path
-                if ($strName eq '.' || ($strName eq FILE_MANIFEST && $strTarget eq MANIFEST_TARGET_PGDATA))
-                {
-                    next;
-                }
-
-                my $strOsFile = "${$self->{oTargetPath}}{$strTarget}/${strName}";
-                my $strManifestFile = $oManifest->repoPathGet($strTarget, $strName);
-
-                # Determine the file/path/link type
-                my $strSection = MANIFEST_SECTION_TARGET_FILE;
-
-                if ($hTargetManifest->{$strName}{type} eq 'd')
-                {
-                    $strSection = MANIFEST_SECTION_TARGET_PATH;
-                }
-                elsif ($hTargetManifest->{$strName}{type} eq 'l')
-                {
-                    $strSection = MANIFEST_SECTION_TARGET_LINK;
-                }
-
-                # Check to see if the file/path/link exists in the manifest
-                if ($oManifest->test($strSection, $strManifestFile) &&
-                    !defined($oFileChecked{$strSection}{$strManifestFile}))
-                {
-                    my $strUser = $oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_USER);
-                    my $strGroup = $oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_GROUP);
-
-                    # If ownership does not match, fix it
-                    if (!defined($hTargetManifest->{$strName}{user}) ||
-                        $strUser ne $hTargetManifest->{$strName}{user} ||
-                        !defined($hTargetManifest->{$strName}{group}) ||
-                        $strGroup ne $hTargetManifest->{$strName}{group})
-                    {
-                        &log(DETAIL, "set ownership ${strUser}:${strGroup} on ${strOsFile}");
-
-                        $oStorageDb->owner($strOsFile, $strUser, $strGroup);
-                    }
-
-                    # If a link does not have the same destination, then delete it (it will be recreated later)
-                    if ($strSection eq MANIFEST_SECTION_TARGET_LINK)
-                    {
-                        if ($oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_DESTINATION) ne
-                            $hTargetManifest->{$strName}{link_destination})
-                        {
-                            &log(DETAIL, "remove link ${strOsFile} - destination changed");
-                            $oStorageDb->remove($strOsFile);
-                        }
-                    }
-                    # Else if file/path mode does not match, fix it
-                    else
-                    {
-                        my $strMode = $oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_MODE);
-
-                        if ($strMode ne $hTargetManifest->{$strName}{mode})
-                        {
-                            &log(DETAIL, "set mode ${strMode} on ${strOsFile}");
-
-                            chmod(oct($strMode), $strOsFile)
-                                or confess 'unable to set mode ${strMode} on ${strOsFile}';
-                        }
-                    }
-                }
-                # If it does not then remove it
-                else
-                {
-                    # If a path then remove it, all the files should have already been deleted since we are going in reverse order
-                    if ($strSection eq MANIFEST_SECTION_TARGET_PATH)
-                    {
-                        &log(DETAIL, "remove path ${strOsFile}");
-                        rmdir($strOsFile) or confess &log(ERROR, "unable to delete path ${strOsFile}, is it empty?");
-
-                        $oRemoveHash{$strSection} += 1;
-                    }
-                    # Else delete a file/link
-                    else
-                    {
-                        my $strType = (split('\:', $strSection))[1];
-
-                        # Delete only if this is not the recovery.conf file.  This is in case the user wants the recovery.conf file
-                        # preserved.  It will be written/deleted/preserved as needed in recovery().
-                        if ($oManifest->dbPathGet(undef, $strManifestFile) eq DB_FILE_RECOVERYCONF)
-                        {
-                            &log(DETAIL, "preserve ${strType} ${strOsFile}");
-                        }
-                        else
-                        {
-                            &log(DETAIL, "remove ${strType} ${strOsFile}");
-                            $oStorageDb->remove($strOsFile);
-
-                            # Removing a file can be expensive so send protocol keep alive
-                            protocolKeepAlive();
-
-                            $oRemoveHash{$strSection} += 1;
-                        }
-                    }
-                }
-            }
-        }
-
-        # Mark all files, paths, and links in this target as having been checked.  This prevents them from being eligible for
-        # cleaning again in a higher level of the hierarchy.
-        foreach my $strSection (sort (keys %oRemoveHash))
-        {
-            for my $strManifestFile ($oManifest->keys($strSection))
-            {
-                # If a link exactly matches the target then it should be checked at a higher level of the hierarchy.  Otherwise
-                # determine if the file/path/link should be marked as checked.
-                if ($strSection ne MANIFEST_SECTION_TARGET_LINK || $strManifestFile ne $strTarget)
-                {
-                    # If the file/path/link parent path matches the target then it should be marked as checked.
-                    if (index($strManifestFile, "${strTarget}/") == 0)
-                    {
-                        # Mark the file/path/link as checked
-                        $oFileChecked{$strSection}{$strManifestFile} = true;
-                    }
-                }
-            }
         }
     }
 
-    # Loop through types (path, link, file) and emit info if any were removed
-    my @stryMessage;
-
-    foreach my $strFileType (sort (keys %oRemoveHash))
-    {
-        if ($oRemoveHash{$strFileType} > 0)
-        {
-            push(@stryMessage, "$oRemoveHash{$strFileType} " . (split('\:', $strFileType))[1] .
-                 ($oRemoveHash{$strFileType} > 1 ? 's' : ''));
-        }
-    }
-
-    if (@stryMessage)
-    {
-        &log(INFO, 'cleanup removed ' . join(', ', @stryMessage));
-    }
-
     # Return from function and log return values if any
     return logDebugReturn($strOperation);
 }
 
 ####################################################################################################################################
-# build
+# queueKey
 #
-# Creates missing paths and links and sets ownership/mode.
+# Get the queue for a path or file.  Everything is put into a single queue except tablespaces, which get a queue each.
 ####################################################################################################################################
-sub build
+sub queueKey
 {
-    my $self = shift;            # Class hash
-
-    # Assign function parameters, defaults, and log debug info
-    my
-    (
-        $strOperation,
-        $oManifest                                  # Backup manifest
-
-    ) =
-        logDebugParam
-        (
-            __PACKAGE__ . '->build', \@_,
-            {name => 'oManifest'}
-        );
-
-    # Db storage
-    my $oStorageDb = storageDb();
-
-    # Create target paths (except for MANIFEST_TARGET_PGDATA because that must already exist)
-    foreach my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET))
-    {
-        if ($strTarget ne MANIFEST_TARGET_PGDATA)
-        {
-            my $strPath = ${$self->{oTargetPath}}{$strTarget};
-
-            if ($oManifest->isTargetTablespace($strTarget))
-            {
-                # ??? On PG versions < 9.0 this is getting a path above what is really the tblspc if the database is in a tblspc
-                $strPath = dirname($strPath);
-            }
-
-            # ??? This may be dead code as the clean function requires the top level target directories to exist
-            if (!$oStorageDb->pathExists($strPath))
-            {
-                $oStorageDb->pathCreate(
-                    $strPath, {strMode => $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_MODE)});
+    my $self = shift;
+    my $strName = shift;
 
-                # Set ownership (??? this could be done better inside the file functions)
-                my $strUser = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_USER);
-                my $strGroup = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_GROUP);
-
-                if ($strUser ne getpwuid($<) || $strGroup ne getgrgid($())
-                {
-                    $oStorageDb->owner($strPath, $strUser, $strGroup);
-                }
-            }
-        }
-
-        $oManifest->remove(MANIFEST_SECTION_TARGET_PATH, $strTarget);
-    }
-
-    # Create paths and links by level.  It's done this way so that all paths and links can be created within the hierarchy of
-    # $PGDATA without having to worry about where linked files and directories are pointed at.
-    my $iLevel = 1;
-    my $iFound;
-
-    do
+    if (index($strName, DB_PATH_PGTBLSPC . '/') == 0)
     {
-        $iFound = 0;
-
-        &log(DEBUG, "build level ${iLevel} paths/links");
-
-        # Iterate path/link sections
-        foreach my $strSection (&MANIFEST_SECTION_TARGET_PATH, &MANIFEST_SECTION_TARGET_LINK)
-        {
-            # Iterate paths/links in the section
-            foreach my $strName ($oManifest->keys($strSection))
-            {
-                # Skip the root path since this must already exist
-                if ($strName eq '.')
-                {
-                    next;
-                }
-
-                # Determine the level by splitting the path
-                my @stryName = split('\/', $oManifest->dbPathGet(undef, $strName));
-
-                # Only create the path/link of at the current level
-                if (@stryName == $iLevel)
-                {
-                    my $strDbPath = $oManifest->dbPathGet($self->{strDbClusterPath}, $strName);
-
-                    # If the path/link does not already exist then create it.  The clean() method should have determined if the
-                    # permissions, destinations, etc. are correct
-                    if (!$oStorageDb->pathExists($strDbPath) && !$oStorageDb->exists($strDbPath))
-                    {
-                        # Create a path
-                        if ($strSection eq &MANIFEST_SECTION_TARGET_PATH)
-                        {
-                            $oStorageDb->pathCreate(
-                                $strDbPath, {strMode => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_MODE)});
-                        }
-                        # Else create a link
-                        else
-                        {
-                            # Retrieve the link destination
-                            my $strDestination = $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_DESTINATION);
-
-                            # In order to create relative links they must be converted to absolute links and then made relative
-                            # again by linkCreate().  It's possible to modify linkCreate() to accept relative paths but that could
-                            # have an impact elsewhere and doesn't seem worth it.
-                            $oStorageDb->linkCreate(
-                                $oStorageDb->pathAbsolute(
-                                    dirname($strDbPath), $strDestination), $strDbPath,
-                                    {bRelative => (index($strDestination, '/') != 0, bIgnoreExists => true)});
-                        }
-
-                        # Set ownership (??? this could be done better inside the file functions)
-                        my $strUser = $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_USER);
-                        my $strGroup = $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_GROUP);
-
-                        if ($strUser ne getpwuid($<) || $strGroup ne getgrgid($())
-                        {
-                            $oStorageDb->owner($strDbPath, $strUser, $strGroup);
-                        }
-                    }
-
-                    # Indicate that at least one path/link was found at this level
-                    $iFound++;
-                }
-            }
-        }
-
-        # Move to the next path/link level
-        $iLevel++;
+        return DB_PATH_PGTBLSPC . '/' . (split('\/', $strName))[1];
     }
-    while ($iFound > 0);
 
-    # Return from function and log return values if any
-    return logDebugReturn($strOperation);
+    return MANIFEST_TARGET_PGDATA;
 }
 
 ####################################################################################################################################
@@ -1127,16 +853,9 @@ sub process
             $oManifest->get(MANIFEST_SECTION_BACKUP_TARGET, MANIFEST_TARGET_PGDATA, MANIFEST_SUBKEY_PATH),
             MANIFEST_FILE_PGCONTROL));
 
-    # Clean the restore paths
+    # Check the restore paths
     $self->clean($oManifest);
 
-    # Build paths/links in the restore paths
-    $self->build($oManifest);
-
-    # Get variables required for restore
-    my $strCurrentUser = getpwuid($<);
-    my $strCurrentGroup = getgrgid($();
-
     # Build an expression to match files that should be zeroed for filtered restores
     my $strDbFilter;
 
@@ -1240,81 +959,268 @@ sub process
         &log(DETAIL, "database filter: " . (defined($strDbFilter) ? "${strDbFilter}" : ''));
     }
 
-    # Initialize the restore process
-    my $oRestoreProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_BACKUP);
+    # Create missing tablespace paths.  The restorePath jobs reach tablespaces through the links in pg_tblspc so the destination must
+    # exist before they run.
+    foreach my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET))
+    {
+        next if !$oManifest->isTargetTablespace($strTarget);
+
+        my $strPath = dirname(${$self->{oTargetPath}}{$strTarget});
+
+        if (!$oStorageDb->pathExists($strPath))
+        {
+            $oStorageDb->pathCreate(
+                $strPath, {strMode => $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_MODE)});
+
+            my $strUser = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_USER);
+            my $strGroup = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_GROUP);
+
+            if ($strUser ne getpwuid($<) || $strGroup ne getgrgid($())
+            {
+                $oStorageDb->owner($strPath, $strUser, $strGroup);
+            }
+        }
+    }
+
+    # Initialize the restore process.  Jobs are queued dynamically since the files in a path cannot be restored until the path has
+    # been cleaned and built.
+    my $oRestoreProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_BACKUP, undef, undef, undef, true);
     $oRestoreProcess->hostAdd(1, cfgOption(CFGOPT_PROCESS_MAX));
 
     # Variables used for parallel copy
     my $lSizeTotal = 0;
     my $lSizeCurrent = 0;
 
-    foreach my $strRepoFile (
-        sort {sprintf("%016d-%s", $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $b, MANIFEST_SUBKEY_SIZE), $b) cmp
-              sprintf("%016d-%s", $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $a, MANIFEST_SUBKEY_SIZE), $a)}
-        ($oManifest->keys(MANIFEST_SECTION_TARGET_FILE, INI_SORT_NONE)))
+    # Build a hash of the paths to restore.  Each path contains the entries that are expected in it so the path can be cleaned and
+    # built by a local process, the paths below it that can be processed once it is complete, and the files that can be restored
+    # once it is complete.
+    my $bDelta = cfgOption(CFGOPT_FORCE) || cfgOption(CFGOPT_DELTA) ? true : false;
+    my $hPath = {};
+
+    foreach my $strSection (&MANIFEST_SECTION_TARGET_PATH, &MANIFEST_SECTION_TARGET_LINK, &MANIFEST_SECTION_TARGET_FILE)
+    {
+        foreach my $strName ($oManifest->keys($strSection))
+        {
+            # Skip the tablespace path outside of pg_data since it is only a container for the tablespace targets
+            next if $strSection eq MANIFEST_SECTION_TARGET_PATH && $strName eq MANIFEST_TARGET_PGTBLSPC;
+
+            # Skip the tablespace_map file in versions >= 9.5 so Postgres does not rewrite links in DB_PATH_PGTBLSPC.  The tablespace
+            # links are created by the restorePath jobs.
+            next if $strSection eq MANIFEST_SECTION_TARGET_FILE && $strName eq MANIFEST_FILE_TABLESPACEMAP &&
+                $oManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_DB_VERSION) >= PG_VERSION_95;
+
+            # Tablespace targets are linked from pg_data/pg_tblspc
+            my $strParent = dirname($strName);
+            $strParent = MANIFEST_TARGET_PGDATA . '/' . MANIFEST_TARGET_PGTBLSPC if $strParent eq MANIFEST_TARGET_PGTBLSPC;
+
+            if ($strSection eq MANIFEST_SECTION_TARGET_FILE)
+            {
+                push(@{$hPath->{$strParent}{stryFile}}, $strName);
+                $lSizeTotal += $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE);
+            }
+            # Links to paths that have been remapped are no longer in the path section but still need to be processed as paths
+            elsif (($strSection eq MANIFEST_SECTION_TARGET_PATH && $strParent ne '.') ||
+                   ($strSection eq MANIFEST_SECTION_TARGET_LINK && $oManifest->test(MANIFEST_SECTION_BACKUP_TARGET, $strName) &&
+                    !$oManifest->isTargetFile($strName) && !$oManifest->test(MANIFEST_SECTION_TARGET_PATH, $strName)))
+            {
+                push(@{$hPath->{$strParent}{stryPath}}, $strName);
+            }
+
+            # The pg_data path has no parent.  Links take precedence over the path or file at the same location since the path or
+            # file will be restored through the link.
+            next if $strParent eq '.' ||
+                ($strSection ne MANIFEST_SECTION_TARGET_LINK && $oManifest->test(MANIFEST_SECTION_TARGET_LINK, $strName));
+
+            $hPath->{$strParent}{hEntry}{basename($strName)} =
+            {
+                &RESTORE_PATH_KEY_TYPE =>
+                    $strSection eq MANIFEST_SECTION_TARGET_PATH ? RESTORE_PATH_TYPE_PATH :
+                        ($strSection eq MANIFEST_SECTION_TARGET_LINK ? RESTORE_PATH_TYPE_LINK : RESTORE_PATH_TYPE_FILE),
+                &RESTORE_PATH_KEY_MODE => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_MODE, false),
+                &RESTORE_PATH_KEY_USER => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_USER),
+                &RESTORE_PATH_KEY_GROUP => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_GROUP),
+                &RESTORE_PATH_KEY_DESTINATION => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_DESTINATION, false),
+            };
+        }
+    }
+
+    # Preserve the manifest and recovery.conf (unless it was backed up) in pg_data.  recovery.conf will be written/deleted/preserved
+    # as needed in recovery().
+    $hPath->{&MANIFEST_TARGET_PGDATA}{hEntry}{&FILE_MANIFEST} = undef;
+
+    if (!defined($hPath->{&MANIFEST_TARGET_PGDATA}{hEntry}{&DB_FILE_RECOVERYCONF}))
     {
-        # Skip the tablespace_map file in versions >= 9.5 so Postgres does not rewrite links in DB_PATH_PGTBLSPC.
-        # The tablespace links have already been created by Restore::build().
-        if ($strRepoFile eq MANIFEST_FILE_TABLESPACEMAP &&
-            $oManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_DB_VERSION) >= PG_VERSION_95)
+        $hPath->{&MANIFEST_TARGET_PGDATA}{hEntry}{&DB_FILE_RECOVERYCONF} = undef;
+    }
+
+    # Queue a job to clean and build a path
+    my $fnQueuePath = sub
+    {
+        my $strPath = shift;
+
+        # The contents of the tablespace path are not cleaned in versions >= 9.0 since other clusters may be using the tablespace
+        my $bTarget = $oManifest->test(MANIFEST_SECTION_BACKUP_TARGET, $strPath);
+        my $bClean = $bDelta;
+
+        # Remapped links only have ownership in the link section.  The mode is not used since targets must already exist.
+        my $strSection = $oManifest->test(MANIFEST_SECTION_TARGET_PATH, $strPath) ?
+            MANIFEST_SECTION_TARGET_PATH : MANIFEST_SECTION_TARGET_LINK;
+
+        if ($bTarget && $oManifest->isTargetTablespace($strPath))
         {
-            next;
+            $bClean = $oManifest->dbVersion() < PG_VERSION_90 ? true : false;
         }
 
-        # By default put everything into a single queue
-        my $strQueueKey = MANIFEST_TARGET_PGDATA;
+        $oRestoreProcess->queueJob(
+            1, $self->queueKey($strPath), $strPath, OP_RESTORE_PATH,
+            [$strPath eq MANIFEST_TARGET_PGDATA ?
+                $self->{strDbClusterPath} : $oManifest->dbPathGet($self->{strDbClusterPath}, $strPath),
+                $oManifest->get(
+                    $strSection, $strPath, MANIFEST_SUBKEY_MODE, false,
+                    $oManifest->get(MANIFEST_SECTION_TARGET_PATH, MANIFEST_TARGET_PGDATA, MANIFEST_SUBKEY_MODE)),
+                $oManifest->get($strSection, $strPath, MANIFEST_SUBKEY_USER),
+                $oManifest->get($strSection, $strPath, MANIFEST_SUBKEY_GROUP),
+                # Do not fix ownership/mode of existing targets since they may be shared with other clusters
+                $bTarget ? false : true, $bClean,
+                defined($hPath->{$strPath}{hEntry}) ? $hPath->{$strPath}{hEntry} : {}]);
+    };
+
+    # Files whose path is complete, ordered largest first.  Files are queued from this list only as jobs are needed so the largest
+    # ready file is always restored next.  Once all paths are complete this is the same order as a single queue sorted by size.
+    my @hyFileReady;
+    my $iProcessMax = cfgOption(CFGOPT_PROCESS_MAX);
+
+    # Add the files in a path to the ready list
+    my $fnFileReady = sub
+    {
+        my $strPath = shift;
+
+        my @hyFile =
+            sort {$b->[0] cmp $a->[0]}
+            map {[sprintf('%016d-%s', $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $_, MANIFEST_SUBKEY_SIZE), $_), $_]}
+            (defined($hPath->{$strPath}{stryFile}) ? @{$hPath->{$strPath}{stryFile}} : ());
+
+        # Merge with the files that are already ready
+        my @hyFileMerge;
 
-        # If the file belongs in a tablespace then put in a tablespace-specific queue
-        if (index($strRepoFile, DB_PATH_PGTBLSPC . '/') == 0)
+        while (@hyFileReady && @hyFile)
         {
-            $strQueueKey = DB_PATH_PGTBLSPC . '/' . (split('\/', $strRepoFile))[1];
+            push(@hyFileMerge, $hyFileReady[0][0] ge $hyFile[0][0] ? shift(@hyFileReady) : shift(@hyFile));
         }
 
-        # Get restore information
-        my $strDbFile = $oManifest->dbPathGet($self->{strDbClusterPath}, $strRepoFile);
-        my $lSize = $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);
+        @hyFileReady = (@hyFileMerge, @hyFileReady, @hyFile);
+    };
 
-        # Copy pg_control to a temporary file that will be renamed later
-        if ($strRepoFile eq MANIFEST_TARGET_PGDATA . '/' . DB_FILE_PGCONTROL)
+    # Queue the largest ready files until there are enough jobs that no local process will be left waiting
+    my $fnQueueFile = sub
+    {
+        while (@hyFileReady && $oRestoreProcess->jobTotal() < $iProcessMax * 2)
         {
-            $strDbFile .= '.' . STORAGE_TEMP_EXT;
+            my $strRepoFile = (shift(@hyFileReady))->[1];
+
+            # Get restore information
+            my $strDbFile = $oManifest->dbPathGet($self->{strDbClusterPath}, $strRepoFile);
+            my $lSize = $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);
+
+            # Copy pg_control to a temporary file that will be renamed later
+            if ($strRepoFile eq MANIFEST_TARGET_PGDATA . '/' . DB_FILE_PGCONTROL)
+            {
+                $strDbFile .= '.' . STORAGE_TEMP_EXT;
+            }
+
+            # Queue for parallel restore
+            $oRestoreProcess->queueJob(
+                1, $self->queueKey($strRepoFile), $strRepoFile, OP_RESTORE_FILE,
+                [$strDbFile, $lSize,
+                    $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_TIMESTAMP),
+                    $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $lSize > 0),
+                    defined($strDbFilter) && $strRepoFile =~ $strDbFilter && $strRepoFile !~ /\/PG\_VERSION$/ ? true : false,
+                    cfgOption(CFGOPT_FORCE), $strRepoFile,
+                    $oManifest->boolTest(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK, undef, true) ? undef :
+                        $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_REFERENCE, false),
+                    $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_MODE),
+                    $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_USER),
+                    $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_GROUP),
+                    $oManifest->numericGet(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_TIMESTAMP_COPY_START),  cfgOption(CFGOPT_DELTA),
+                    $self->{strBackupSet}, $oManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS)],
+                {rParamSecure => $oManifest->cipherPassSub() ? [$oManifest->cipherPassSub()] : undef});
         }
+    };
 
-        # Increment file size
-        $lSizeTotal += $lSize;
+    # Start with pg_data.  Paths below it are queued as each path completes so links are always created before the paths/files
+    # that are reached through them.
+    $fnQueuePath->(MANIFEST_TARGET_PGDATA);
 
-        # Queue for parallel restore
-        $oRestoreProcess->queueJob(
-            1, $strQueueKey, $strRepoFile, OP_RESTORE_FILE,
-            [$strDbFile, $lSize,
-                $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_TIMESTAMP),
-                $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $lSize > 0),
-                defined($strDbFilter) && $strRepoFile =~ $strDbFilter && $strRepoFile !~ /\/PG\_VERSION$/ ? true : false,
-                cfgOption(CFGOPT_FORCE), $strRepoFile,
-                $oManifest->boolTest(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_HARDLINK, undef, true) ? undef :
-                    $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_REFERENCE, false),
-                $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_MODE),
-                $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_USER),
-                $oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_GROUP),
-                $oManifest->numericGet(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_TIMESTAMP_COPY_START),  cfgOption(CFGOPT_DELTA),
-                $self->{strBackupSet}, $oManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS)],
-            {rParamSecure => $oManifest->cipherPassSub() ? [$oManifest->cipherPassSub()] : undef});
-    }
+    # Track files/links/paths removed
+    my $iFileRemoved = 0;
+    my $iLinkRemoved = 0;
+    my $iPathRemoved = 0;
 
     # Run the restore jobs and process results
     while (my $hyJob = $oRestoreProcess->process())
     {
         foreach my $hJob (@{$hyJob})
         {
-            ($lSizeCurrent) = restoreLog(
-                $hJob->{iProcessId}, @{$hJob->{rParam}}[0..5], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent);
+            # When a path is complete queue the paths below it and add the files in it to the ready list
+            if ($hJob->{strOp} eq OP_RESTORE_PATH)
+            {
+                $iFileRemoved += $hJob->{rResult}[0];
+                $iLinkRemoved += $hJob->{rResult}[1];
+                $iPathRemoved += $hJob->{rResult}[2];
+
+                # Log the actions taken by the local process since locals do not log to the console.  The manifest was written to
+                # pg_data by this restore so there is no need to report that it was preserved.
+                foreach my $strMessage (@{$hJob->{rResult}[3]})
+                {
+                    next if $strMessage eq "preserve file $self->{strDbClusterPath}/" . FILE_MANIFEST;
+
+                    &log(DETAIL, $strMessage);
+                }
+
+                foreach my $strPath (defined($hPath->{$hJob->{strKey}}{stryPath}) ? @{$hPath->{$hJob->{strKey}}{stryPath}} : ())
+                {
+                    $fnQueuePath->($strPath);
+                }
+
+                $fnFileReady->($hJob->{strKey});
+                delete($hPath->{$hJob->{strKey}});
+            }
+            else
+            {
+                ($lSizeCurrent) = restoreLog(
+                    $hJob->{iProcessId}, @{$hJob->{rParam}}[0..5], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent);
+            }
         }
 
+        $fnQueueFile->();
+
         # A keep-alive is required here because if there are a large number of resumed files that need to be checksummed
         # then the remote might timeout while waiting for a command.
         protocolKeepAlive();
     }
 
+    # All files should have been restored
+    if (keys(%{$hPath}) > 0)
+    {
+        confess &log(ASSERT, 'paths not restored: ' . join(', ', sort(keys(%{$hPath}))));
+    }
+
+    # Emit info if any files/links/paths were removed
+    my @stryMessage;
+
+    foreach my $rhRemove (['file', $iFileRemoved], ['link', $iLinkRemoved], ['path', $iPathRemoved])
+    {
+        if ($rhRemove->[1] > 0)
+        {
+            push(@stryMessage, "$rhRemove->[1] $rhRemove->[0]" . ($rhRemove->[1] > 1 ? 's' : ''));
+        }
+    }
+
+    if (@stryMessage)
+    {
+        &log(INFO, 'cleanup removed ' . join(', ', @stryMessage));
+    }
+
     # Create recovery.conf file
     $self->recovery($oManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_DB_VERSION));
 
@@ -1324,6 +1230,9 @@ sub process
         # This is already synced as a subpath of pg_data
         next if $strPath eq MANIFEST_TARGET_PGTBLSPC;
 
+        # Targets are synced below
+        next if $oManifest->test(MANIFEST_SECTION_BACKUP_TARGET, $strPath);
+
         $oStorageDb->pathSync($oManifest->dbPathGet($self->{strDbClusterPath}, $strPath));
     }
 
@@ -56,6 +56,7 @@ These includes are from the src directory.  There is no Perl-specific code in th
 #include "config/define.h"
 #include "config/load.h"
 #include "config/parse.h"
+#include "info/manifestBin.h"
 #include "perl/config.h"
 #include "postgres/pageChecksum.h"
 #include "storage/posix/storage.h"
@@ -70,6 +71,7 @@ XSH includes
 
 These includes define data structures that are required for the C to Perl interface but are not part of the regular C source.
 ***********************************************************************************************************************************/
+#include "xs/command/backup/delta.xsh"
 #include "xs/crypto/hash.xsh"
 #include "xs/common/encode.xsh"
 #include "xs/postgres/client.xsh"
@@ -96,6 +98,7 @@ OUTPUT:
 #
 # These modules should map 1-1 with C modules in src directory.
 # ----------------------------------------------------------------------------------------------------------------------------------
+INCLUDE: xs/command/backup/delta.xs
 INCLUDE: xs/common/encode.xs
 INCLUDE: xs/common/lock.xs
 INCLUDE: xs/config/config.xs
@@ -103,6 +106,7 @@ INCLUDE: xs/config/configTest.xs
 INCLUDE: xs/config/define.xs
 INCLUDE: xs/crypto/hash.xs
 INCLUDE: xs/crypto/random.xs
+INCLUDE: xs/info/manifestBin.xs
 INCLUDE: xs/postgres/client.xs
 INCLUDE: xs/postgres/pageChecksum.xs
 INCLUDE: xs/storage/storage.xs
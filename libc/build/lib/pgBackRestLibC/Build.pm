@@ -71,6 +71,13 @@ sub buildPutDiffers
 ####################################################################################################################################
 my $rhExport =
 {
+    'backup' =>
+    {
+        &BLD_EXPORTTYPE_SUB => [qw(
+            backupDelta
+        )],
+    },
+
     'checksum' =>
     {
         &BLD_EXPORTTYPE_SUB => [qw(
@@ -138,6 +145,13 @@ my $rhExport =
         )],
     },
 
+    'manifest' =>
+    {
+        &BLD_EXPORTTYPE_SUB => [qw(
+            manifestBinFromText
+        )],
+    },
+
     'random' =>
     {
         &BLD_EXPORTTYPE_SUB => [qw(
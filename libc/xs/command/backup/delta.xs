@@ -0,0 +1,41 @@
+# ----------------------------------------------------------------------------------------------------------------------------------
+# Backup Delta Perl Exports
+#
+# XS wrapper for functions in command/backup/delta.c.
+# ----------------------------------------------------------------------------------------------------------------------------------
+
+MODULE = pgBackRest::LibC PACKAGE = pgBackRest::LibC
+
+####################################################################################################################################
+SV *
+backupDelta(fileList, priorList, priorLabel, timeBegin, delta)
+PREINIT:
+    MEM_CONTEXT_XS_TEMP_BEGIN()
+    {
+INPUT:
+    HV *fileList
+    SV *priorList
+    SV *priorLabel
+    IV timeBegin
+    bool delta
+CODE:
+    BackupDeltaXsCallbackData data = {.fileListHv = fileList, .priorLabel = priorLabel};
+
+    if (SvOK(priorList))
+    {
+        CHECK(SvROK(priorList) && SvTYPE(SvRV(priorList)) == SVt_PVHV);
+        data.priorListHv = (HV *)SvRV(priorList);
+    }
+
+    String *result = backupDeltaXsResult(
+        backupDelta(
+            backupDeltaXsFileList(fileList, false),
+            data.priorListHv != NULL ? backupDeltaXsFileList(data.priorListHv, true) : NULL,
+            (time_t)timeBegin, delta, backupDeltaXsCallback, &data));
+
+    RETVAL = newSVpv(strPtr(result), strSize(result));
+OUTPUT:
+    RETVAL
+CLEANUP:
+    }
+    MEM_CONTEXT_XS_TEMP_END();
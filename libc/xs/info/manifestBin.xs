@@ -0,0 +1,24 @@
+####################################################################################################################################
+# Binary Manifest Perl Exports
+#
+# XS wrapper for functions in info/manifestBin.c.
+####################################################################################################################################
+
+MODULE = pgBackRest::LibC PACKAGE = pgBackRest::LibC
+
+####################################################################################################################################
+SV *
+manifestBinFromText(manifest)
+PREINIT:
+    MEM_CONTEXT_XS_TEMP_BEGIN()
+    {
+INPUT:
+    const Buffer *manifest = BUF_CONST_SV($arg);
+CODE:
+    Buffer *result = manifestBinFromText(manifest);
+    RETVAL = newSVpv((char *)bufPtr(result), bufUsed(result));
+OUTPUT:
+    RETVAL
+CLEANUP:
+    }
+    MEM_CONTEXT_XS_TEMP_END();
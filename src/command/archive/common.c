@@ -3,20 +3,27 @@ Archive Common
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <errno.h>
+#include <poll.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+
+#ifdef __linux__
+    #include <sys/inotify.h>
+#endif
 
 #include "command/archive/common.h"
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/object.h"
 #include "common/regExp.h"
 #include "common/wait.h"
 #include "config/config.h"
 #include "postgres/version.h"
 #include "storage/helper.h"
-#include "storage/helper.h"
 
 /***********************************************************************************************************************************
 WAL segment constants
@@ -34,6 +41,11 @@ Global error file constant
 
 STRING_STATIC(STATUS_FILE_GLOBAL_ERROR_STR,                         STATUS_FILE_GLOBAL STATUS_EXT_ERROR);
 
+/***********************************************************************************************************************************
+Interval to wake up a watch that needs to retry something that does not change the spool queue
+***********************************************************************************************************************************/
+#define ARCHIVE_ASYNC_WATCH_RETRY_MSEC                              100
+
 /***********************************************************************************************************************************
 Get the correct spool queue based on the archive mode
 ***********************************************************************************************************************************/
@@ -47,6 +59,158 @@ archiveAsyncSpoolQueue(ArchiveMode archiveMode)
     FUNCTION_TEST_RETURN((archiveMode == archiveModeGet ? STORAGE_SPOOL_ARCHIVE_IN_STR : STORAGE_SPOOL_ARCHIVE_OUT_STR));
 }
 
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct ArchiveAsyncWatch
+{
+    MemContext *memContext;                                         // Context that contains the watch
+    TimeMSec timeout;                                               // Total time to wait
+    TimeMSec beginTime;                                             // Time the watch began (in epoch msec)
+    bool done;                                                      // Has the final check been returned?
+    int handle;                                                     // Notify handle (-1 if the spool queue is being polled)
+    Wait *wait;                                                     // Wait handler used when polling
+};
+
+OBJECT_DEFINE_FREE(ARCHIVE_ASYNC_WATCH);
+
+#ifdef __linux__
+
+/***********************************************************************************************************************************
+Close the notify handle
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(ARCHIVE_ASYNC_WATCH, LOG, logLevelTrace)
+{
+    close(this->handle);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+#endif
+
+/***********************************************************************************************************************************
+New async status watch
+
+The watch must be created before the first status check so no files written by the async process after that check can be missed. If
+notification is not available then fall back to polling with the standard wait handler.
+***********************************************************************************************************************************/
+ArchiveAsyncWatch *
+archiveAsyncWatchNew(ArchiveMode archiveMode, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, archiveMode);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ArchiveAsyncWatch *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ArchiveAsyncWatch")
+    {
+        this = memNew(sizeof(ArchiveAsyncWatch));
+        this->memContext = MEM_CONTEXT_NEW();
+        this->timeout = timeout;
+        this->handle = -1;
+
+#ifdef __linux__
+        // Watch for files that are closed after writing or moved into the queue (atomic writes)
+        this->handle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        if (this->handle != -1)
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                // Create the queue so it can be watched before the async process has run for the first time
+                storagePathCreateNP(storageSpoolWrite(), archiveAsyncSpoolQueue(archiveMode));
+
+                if (inotify_add_watch(
+                        this->handle, strPtr(storagePath(storageSpool(), archiveAsyncSpoolQueue(archiveMode))),
+                        IN_CLOSE_WRITE | IN_MOVED_TO | IN_ONLYDIR) == -1)
+                {
+                    LOG_DEBUG("unable to watch spool queue, falling back to polling: [%d] %s", errno, strerror(errno));
+
+                    close(this->handle);
+                    this->handle = -1;
+                }
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+
+        // Set free callback to ensure the notify handle is closed
+        if (this->handle != -1)
+            memContextCallbackSet(this->memContext, archiveAsyncWatchFreeResource, this);
+#endif
+
+        // Poll if notification is not available
+        if (this->handle == -1)
+            this->wait = waitNew(timeout);
+
+        this->beginTime = timeMSec();
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(ARCHIVE_ASYNC_WATCH, this);
+}
+
+/***********************************************************************************************************************************
+Wait for a change in the spool queue and return whether the caller should check status again
+
+Works like waitMore() in that true is returned one final time after the timeout expires so the caller gets a last chance to check.
+If retry is set then also return after a short interval without notification so the caller can retry something that does not
+change the spool queue, e.g. acquiring the lock held by an async process that is still running.
+***********************************************************************************************************************************/
+bool
+archiveAsyncWatchMore(ArchiveAsyncWatch *this, bool retry)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(ARCHIVE_ASYNC_WATCH, this);
+        FUNCTION_LOG_PARAM(BOOL, retry);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    bool result = false;
+
+    if (this->handle == -1)
+        result = waitMore(this->wait);
+    else if (!this->done)
+    {
+        TimeMSec elapsedTime = timeMSec() - this->beginTime;
+
+        // If there is time left then wait for notification, the retry interval, or the end of the timeout
+        if (elapsedTime < this->timeout)
+        {
+            TimeMSec pollTime = this->timeout - elapsedTime;
+            bool pollRetry = retry && pollTime > ARCHIVE_ASYNC_WATCH_RETRY_MSEC;
+
+            if (pollRetry)
+                pollTime = ARCHIVE_ASYNC_WATCH_RETRY_MSEC;
+
+            struct pollfd pollHandle = {.fd = this->handle, .events = POLLIN};
+            int pollResult = poll(&pollHandle, 1, (int)pollTime);
+
+            // A signal interruption is treated like an event since the caller will check status again anyway
+            THROW_ON_SYS_ERROR(pollResult == -1 && errno != EINTR, FileReadError, "unable to poll spool queue");
+
+            // Drain events. Which files changed does not matter since the caller checks for the files it needs.
+            if (pollResult > 0)
+            {
+                char eventBuffer[4096];
+
+                while (read(this->handle, eventBuffer, sizeof(eventBuffer)) > 0);
+            }
+            // Else the timeout expired so this will be the final check
+            else if (pollResult == 0 && !pollRetry)
+                this->done = true;
+        }
+        // Else this will be the final check
+        else
+            this->done = true;
+
+        result = true;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /***********************************************************************************************************************************
 Check for ok/error status files in the spool in/out directory
 ***********************************************************************************************************************************/
@@ -318,13 +482,32 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
     {
         Wait *wait = timeout > 0 ? waitNew(timeout) : NULL;
 
+        // Build the expression once since it does not change between retries.  The expression is anchored at both ends so files
+        // with extra text before, between, or after the segment and checksum are not matched.  The storage only filters on the
+        // literal segment prefix, which does not need to be compiled, and the compiled expression is applied to the result.
+        const String *path = strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(strSubN(walSegment, 0, 16)));
+        const String *expression = strNewFmt(
+            "^%s%s" WAL_SEGMENT_CHECKSUM_REGEXP, strPtr(strSubN(walSegment, 0, 24)),
+            walIsPartial(walSegment) ? "\\" WAL_SEGMENT_PARTIAL_EXT : "");
+        const String *expressionPrefix = strNewFmt("^%s", strPtr(regExpPrefix(expression)));
+        RegExp *regExp = regExpNew(expression);
+
         do
         {
             // Get a list of all WAL segments that match
-            StringList *list = storageListP(
-                storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(strSubN(walSegment, 0, 16))),
-                .expression = strNewFmt("^%s%s-[0-f]{40}(\\.gz){0,1}$", strPtr(strSubN(walSegment, 0, 24)),
-                    walIsPartial(walSegment) ? WAL_SEGMENT_PARTIAL_EXT : ""), .nullOnMissing = true);
+            StringList *list = NULL;
+            StringList *listPrefix = storageListP(storage, path, .expression = expressionPrefix, .nullOnMissing = true);
+
+            if (listPrefix != NULL)
+            {
+                list = strLstNew();
+
+                for (unsigned int listIdx = 0; listIdx < strLstSize(listPrefix); listIdx++)
+                {
+                    if (regExpMatch(regExp, strLstGet(listPrefix, listIdx)))
+                        strLstAdd(list, strLstGet(listPrefix, listIdx));
+                }
+            }
 
             // If there are results
             if (list != NULL && strLstSize(list) > 0)
@@ -55,9 +55,27 @@ WAL segment constants
 #define WAL_SEGMENT_FILE_REGEXP                                     "^[0-F]{24}-[0-f]{40}(\\.gz){0,1}$"
     STRING_DECLARE(WAL_SEGMENT_FILE_REGEXP_STR);
 
+// Match the checksum and optional compression extension that follow the WAL segment in the repository
+#define WAL_SEGMENT_CHECKSUM_REGEXP                                 "-[0-f]{40}(\\.gz){0,1}$"
+
+/***********************************************************************************************************************************
+Async status watch object
+
+Used by archive-push/archive-get to wait on the async process. On platforms that support it the spool queue is watched for new files
+so the command can return as soon as a status file is written instead of waiting for the next poll interval.
+***********************************************************************************************************************************/
+#define ARCHIVE_ASYNC_WATCH_TYPE                                    ArchiveAsyncWatch
+#define ARCHIVE_ASYNC_WATCH_PREFIX                                  archiveAsyncWatch
+
+typedef struct ArchiveAsyncWatch ArchiveAsyncWatch;
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+ArchiveAsyncWatch *archiveAsyncWatchNew(ArchiveMode archiveMode, TimeMSec timeout);
+bool archiveAsyncWatchMore(ArchiveAsyncWatch *this, bool retry);
+void archiveAsyncWatchFree(ArchiveAsyncWatch *this);
+
 bool archiveAsyncStatus(ArchiveMode archiveMode, const String *walSegment, bool confessOnError);
 void archiveAsyncStatusOkWrite(ArchiveMode archiveMode, const String *walSegment, const String *warning);
 void archiveAsyncStatusErrorWrite(ArchiveMode archiveMode, const String *walSegment, int code, const String *message);
@@ -69,4 +87,12 @@ String *walSegmentFind(const Storage *storage, const String *archiveId, const St
 String *walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion);
 StringList *walSegmentRange(const String *walSegmentBegin, size_t walSegmentSize, unsigned int pgVersion, unsigned int range);
 
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_ARCHIVE_ASYNC_WATCH_TYPE                                                                                      \
+    ArchiveAsyncWatch *
+#define FUNCTION_LOG_ARCHIVE_ASYNC_WATCH_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(value, "ArchiveAsyncWatch", buffer, bufferSize)
+
 #endif
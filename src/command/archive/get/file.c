@@ -12,11 +12,17 @@ Archive Get File
 #include "common/debug.h"
 #include "common/io/filter/group.h"
 #include "common/log.h"
+#include "common/stat.h"
 #include "config/config.h"
 #include "info/infoArchive.h"
 #include "postgres/interface.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Statistics
+***********************************************************************************************************************************/
+STRING_STATIC(ARCHIVE_GET_STAT_FILE_MS_STR,                         "archive.get.file.ms");
+
 /***********************************************************************************************************************************
 Check if a WAL file exists in the repository
 ***********************************************************************************************************************************/
@@ -165,12 +171,16 @@ archiveGetFile(
             }
 
             // Copy the file
+            TimeMSec timeBegin = timeMSec();
+
             storageCopyNP(
                 storageNewReadP(
                     storageRepo(), strNewFmt("%s/%s", STORAGE_REPO_ARCHIVE, strPtr(archiveGetCheckResult.archiveFileActual)),
                     .compressible = compressible),
                 destination);
 
+            statTimeAdd(ARCHIVE_GET_STAT_FILE_MS_STR, timeBegin);
+
             // The WAL file was found
             result = 0;
         }
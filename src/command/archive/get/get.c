@@ -17,8 +17,7 @@ Archive Get Command
 #include "common/fork.h"
 #include "common/log.h"
 #include "common/memContext.h"
-#include "common/regExp.h"
-#include "common/wait.h"
+#include "common/type/stringSet.h"
 #include "config/config.h"
 #include "config/exec.h"
 #include "perl/exec.h"
@@ -60,27 +59,26 @@ queueNeed(const String *walSegment, bool found, uint64_t queueSize, size_t walSe
         if (walSegmentQueueTotal < 2)
             walSegmentQueueTotal = 2;
 
-        // Build the ideal queue -- the WAL segments we want in the queue after the async process has run
-        StringList *idealQueue = walSegmentRange(walSegmentFirst, walSegmentSize, pgVersion, walSegmentQueueTotal);
+        // Build the ideal queue -- the WAL segments we want in the queue after the async process has run.  The queue is sorted so
+        // it can be searched quickly.
+        StringList *idealQueue = strLstSort(
+            walSegmentRange(walSegmentFirst, walSegmentSize, pgVersion, walSegmentQueueTotal), sortOrderAsc);
 
         // Get the list of files actually in the queue
         StringList *actualQueue = strLstSort(
             storageListP(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR, .errorOnMissing = true), sortOrderAsc);
 
-        // Only preserve files that match the ideal queue. error/ok files are deleted so the async process can try again.
-        RegExp *regExpPreserve = regExpNew(strNewFmt("^(%s)$", strPtr(strLstJoin(idealQueue, "|"))));
-
-        // Build a list of WAL segments that are being kept so we can later make a list of what is needed
-        StringList *keepQueue = strLstNew();
+        // Build a set of WAL segments that are being kept so we can later make a list of what is needed
+        StringSet *keepQueue = strSetNew();
 
         for (unsigned int actualQueueIdx = 0; actualQueueIdx < strLstSize(actualQueue); actualQueueIdx++)
         {
             // Get file from actual queue
             const String *file = strLstGet(actualQueue, actualQueueIdx);
 
-            // Does this match a file we want to preserve?
-            if (regExpMatch(regExpPreserve, file))
-                strLstAdd(keepQueue, file);
+            // Only preserve files that match the ideal queue. error/ok files are deleted so the async process can try again.
+            if (strLstExists(idealQueue, file))
+                strSetAdd(keepQueue, file);
 
             // Else delete it
             else
@@ -90,7 +88,7 @@ queueNeed(const String *walSegment, bool found, uint64_t queueSize, size_t walSe
         // Generate a list of the WAL that are needed by removing kept WAL from the ideal queue
         for (unsigned int idealQueueIdx = 0; idealQueueIdx < strLstSize(idealQueue); idealQueueIdx++)
         {
-            if (!strLstExists(keepQueue, strLstGet(idealQueue, idealQueueIdx)))
+            if (!strSetExists(keepQueue, strLstGet(idealQueue, idealQueueIdx)))
                 strLstAdd(result, strLstGet(idealQueue, idealQueueIdx));
         }
     }
@@ -142,7 +140,8 @@ cmdArchiveGet(void)
             bool confessOnError = false;                                // Should we confess errors?
 
             // Loop and wait for the WAL segment to be pushed
-            Wait *wait = waitNew((TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
+            ArchiveAsyncWatch *watch = archiveAsyncWatchNew(
+                archiveModeGet, (TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
 
             do
             {
@@ -258,7 +257,7 @@ cmdArchiveGet(void)
                 // Now that the async process has been launched, confess any errors that are found
                 confessOnError = true;
             }
-            while (waitMore(wait));
+            while (archiveAsyncWatchMore(watch, !forked));
         }
         // Else perform synchronous get
         else
@@ -0,0 +1,540 @@
+/***********************************************************************************************************************************
+Archive Index
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/archive/common.h"
+#include "command/archive/index.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/regExp.h"
+#include "common/type/json.h"
+#include "info/infoArchive.h"
+
+/***********************************************************************************************************************************
+Index format and keys
+***********************************************************************************************************************************/
+#define ARCHIVE_INDEX_FORMAT                                        1
+
+#define ARCHIVE_INDEX_KEY_FORMAT                                    "format"
+    VARIANT_STRDEF_STATIC(ARCHIVE_INDEX_KEY_FORMAT_VAR,             ARCHIVE_INDEX_KEY_FORMAT);
+#define ARCHIVE_INDEX_KEY_MAX                                       "max"
+    VARIANT_STRDEF_STATIC(ARCHIVE_INDEX_KEY_MAX_VAR,                ARCHIVE_INDEX_KEY_MAX);
+#define ARCHIVE_INDEX_KEY_MIN                                       "min"
+    VARIANT_STRDEF_STATIC(ARCHIVE_INDEX_KEY_MIN_VAR,                ARCHIVE_INDEX_KEY_MIN);
+#define ARCHIVE_INDEX_KEY_TIMELINE                                  "timeline"
+    VARIANT_STRDEF_STATIC(ARCHIVE_INDEX_KEY_TIMELINE_VAR,           ARCHIVE_INDEX_KEY_TIMELINE);
+
+// Size of the timeline at the beginning of a WAL segment or path
+#define ARCHIVE_INDEX_TIMELINE_SIZE                                 8
+
+/***********************************************************************************************************************************
+Create a new empty index
+***********************************************************************************************************************************/
+static KeyValue *
+archiveIndexNew(void)
+{
+    FUNCTION_TEST_VOID();
+
+    KeyValue *result = kvNew();
+
+    kvPut(result, ARCHIVE_INDEX_KEY_FORMAT_VAR, VARUINT(ARCHIVE_INDEX_FORMAT));
+    kvPutKv(result, ARCHIVE_INDEX_KEY_TIMELINE_VAR);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Get the timeline ranges from the index
+***********************************************************************************************************************************/
+static KeyValue *
+archiveIndexTimeline(const KeyValue *index)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, index);
+    FUNCTION_TEST_END();
+
+    ASSERT(index != NULL);
+
+    FUNCTION_TEST_RETURN(varKv(kvGet(index, ARCHIVE_INDEX_KEY_TIMELINE_VAR)));
+}
+
+/**********************************************************************************************************************************/
+KeyValue *
+archiveIndexLoad(const Storage *storage, const String *archivePath)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archivePath != NULL);
+
+    KeyValue *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *indexFile = strNewFmt("%s/" INFO_ARCHIVE_INDEX_FILE, strPtr(archivePath));
+        Buffer *index = storageGetNP(storageNewReadP(storage, indexFile, .ignoreMissing = true));
+
+        if (index != NULL)
+        {
+            // An index that cannot be parsed is ignored since it will be replaced the next time the index is updated
+            TRY_BEGIN()
+            {
+                KeyValue *indexKv = jsonToKv(strNewBuf(index));
+
+                if (varUIntForce(kvGet(indexKv, ARCHIVE_INDEX_KEY_FORMAT_VAR)) != ARCHIVE_INDEX_FORMAT)
+                    THROW_FMT(FormatError, "expected format %d", ARCHIVE_INDEX_FORMAT);
+
+                // Make sure the timeline ranges are valid
+                const KeyValue *timelineKv = archiveIndexTimeline(indexKv);
+                const VariantList *timelineList = kvKeyList(timelineKv);
+
+                for (unsigned int timelineIdx = 0; timelineIdx < varLstSize(timelineList); timelineIdx++)
+                {
+                    const KeyValue *rangeKv = varKv(kvGet(timelineKv, varLstGet(timelineList, timelineIdx)));
+                    const Variant *min = kvGet(rangeKv, ARCHIVE_INDEX_KEY_MIN_VAR);
+                    const Variant *max = kvGet(rangeKv, ARCHIVE_INDEX_KEY_MAX_VAR);
+
+                    if (min == NULL || max == NULL || !regExpMatchOne(WAL_SEGMENT_REGEXP_STR, varStr(min)) ||
+                        !regExpMatchOne(WAL_SEGMENT_REGEXP_STR, varStr(max)))
+                    {
+                        THROW(FormatError, "invalid timeline range");
+                    }
+                }
+
+                result = kvMove(indexKv, MEM_CONTEXT_OLD());
+            }
+            CATCH_ANY()
+            {
+                LOG_DETAIL("ignore invalid archive index '%s': %s", strPtr(storagePath(storage, indexFile)), errorMessage());
+            }
+            TRY_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(KEY_VALUE, result);
+}
+
+/***********************************************************************************************************************************
+List WAL segments in a WAL path from oldest to newest
+***********************************************************************************************************************************/
+static StringList *
+archiveIndexPathList(const Storage *storage, const String *archivePath, const String *walPath)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(
+        STRING_LIST,
+        strLstSort(
+            storageListP(
+                storage, strNewFmt("%s/%s", strPtr(archivePath), strPtr(walPath)), .expression = WAL_SEGMENT_FILE_REGEXP_STR),
+            sortOrderAsc));
+}
+
+/**********************************************************************************************************************************/
+KeyValue *
+archiveIndexBuild(const Storage *storage, const String *archivePath)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archivePath != NULL);
+
+    KeyValue *result = archiveIndexNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Get a list of WAL paths from oldest to newest
+        const StringList *walPathList = strLstSort(
+            storageListP(storage, archivePath, .expression = WAL_SEGMENT_DIR_REGEXP_STR), sortOrderAsc);
+
+        unsigned int walPathIdx = 0;
+
+        while (walPathIdx < strLstSize(walPathList))
+        {
+            // Find the last WAL path on this timeline
+            const String *timeline = strSubN(strLstGet(walPathList, walPathIdx), 0, ARCHIVE_INDEX_TIMELINE_SIZE);
+            unsigned int walPathLastIdx = walPathIdx;
+
+            while (
+                walPathLastIdx + 1 < strLstSize(walPathList) &&
+                strBeginsWith(strLstGet(walPathList, walPathLastIdx + 1), timeline))
+            {
+                walPathLastIdx++;
+            }
+
+            // Not every WAL path has WAL segments so search forward from the oldest path for the oldest segment
+            unsigned int walPathMinIdx = walPathIdx;
+            const StringList *walSegmentMinList = NULL;
+
+            for (; walPathMinIdx <= walPathLastIdx; walPathMinIdx++)
+            {
+                walSegmentMinList = archiveIndexPathList(storage, archivePath, strLstGet(walPathList, walPathMinIdx));
+
+                if (strLstSize(walSegmentMinList) > 0)
+                {
+                    archiveIndexAdd(result, strLstGet(walSegmentMinList, 0));
+                    break;
+                }
+            }
+
+            // Search backward from the newest path for the newest segment.  The search always ends at the path that contains the
+            // oldest segment, which has already been listed.
+            if (walPathMinIdx <= walPathLastIdx)
+            {
+                unsigned int walPathMaxIdx = walPathLastIdx;
+                const StringList *walSegmentMaxList = walSegmentMinList;
+
+                for (; walPathMaxIdx > walPathMinIdx; walPathMaxIdx--)
+                {
+                    walSegmentMaxList = archiveIndexPathList(storage, archivePath, strLstGet(walPathList, walPathMaxIdx));
+
+                    if (strLstSize(walSegmentMaxList) > 0)
+                        break;
+                }
+
+                if (walPathMaxIdx == walPathMinIdx)
+                    walSegmentMaxList = walSegmentMinList;
+
+                archiveIndexAdd(result, strLstGet(walSegmentMaxList, strLstSize(walSegmentMaxList) - 1));
+            }
+
+            walPathIdx = walPathLastIdx + 1;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(KEY_VALUE, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+archiveIndexAdd(KeyValue *index, const String *walSegment)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(KEY_VALUE, index);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+    FUNCTION_LOG_END();
+
+    ASSERT(index != NULL);
+    ASSERT(walSegment != NULL);
+    ASSERT(strSize(walSegment) >= WAL_SEGMENT_NAME_SIZE);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *segment = strSubN(walSegment, 0, WAL_SEGMENT_NAME_SIZE);
+        const Variant *timeline = VARSTR(strSubN(segment, 0, ARCHIVE_INDEX_TIMELINE_SIZE));
+        KeyValue *timelineKv = archiveIndexTimeline(index);
+
+        const Variant *range = kvGet(timelineKv, timeline);
+        KeyValue *rangeKv = range == NULL ? kvPutKv(timelineKv, timeline) : varKv(range);
+        const Variant *min = kvGet(rangeKv, ARCHIVE_INDEX_KEY_MIN_VAR);
+        const Variant *max = kvGet(rangeKv, ARCHIVE_INDEX_KEY_MAX_VAR);
+
+        if (min == NULL || strCmp(segment, varStr(min)) < 0)
+        {
+            kvPut(rangeKv, ARCHIVE_INDEX_KEY_MIN_VAR, VARSTR(segment));
+            result = true;
+        }
+
+        if (max == NULL || strCmp(segment, varStr(max)) > 0)
+        {
+            kvPut(rangeKv, ARCHIVE_INDEX_KEY_MAX_VAR, VARSTR(segment));
+            result = true;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+void
+archiveIndexSave(const Storage *storage, const String *archivePath, const KeyValue *index)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+        FUNCTION_LOG_PARAM(KEY_VALUE, index);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archivePath != NULL);
+    ASSERT(index != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // The write is atomic so readers never see a partial index
+        storagePutNP(
+            storageNewWriteNP(storage, strNewFmt("%s/" INFO_ARCHIVE_INDEX_FILE, strPtr(archivePath))),
+            BUFSTR(jsonFromKv(index, 0)));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+archiveIndexUpdate(const Storage *storage, const String *archivePath, const StringList *walSegmentList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+        FUNCTION_LOG_PARAM(STRING_LIST, walSegmentList);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archivePath != NULL);
+    ASSERT(walSegmentList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TRY_BEGIN()
+        {
+            KeyValue *index = archiveIndexLoad(storage, archivePath);
+            bool save = index == NULL;
+
+            // Build the index if it does not exist or a segment is on a timeline that is not in the index.  A failed or lost update
+            // for the first segments on a timeline would otherwise leave the oldest segment too new, which readers cannot detect.
+            // The pushed segments are already in the archive so they will be found.
+            for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList) && !save; walSegmentIdx++)
+            {
+                if (!kvKeyExists(
+                        archiveIndexTimeline(index),
+                        VARSTR(strSubN(strLstGet(walSegmentList, walSegmentIdx), 0, ARCHIVE_INDEX_TIMELINE_SIZE))))
+                {
+                    save = true;
+                }
+            }
+
+            if (save)
+                index = archiveIndexBuild(storage, archivePath);
+
+            for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
+            {
+                if (archiveIndexAdd(index, strLstGet(walSegmentList, walSegmentIdx)))
+                    save = true;
+            }
+
+            if (save)
+                archiveIndexSave(storage, archivePath, index);
+        }
+        CATCH_ANY()
+        {
+            LOG_WARN("unable to update archive index in '%s': %s", strPtr(storagePath(storage, archivePath)), errorMessage());
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+archiveIndexExpire(const Storage *storage, const String *archivePath)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archivePath != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TRY_BEGIN()
+        {
+            KeyValue *index = archiveIndexBuild(storage, archivePath);
+            const KeyValue *indexCurrent = archiveIndexLoad(storage, archivePath);
+
+            // Add newest segments from the current index that were pushed after the listing
+            if (indexCurrent != NULL)
+            {
+                const String *indexMax = strDup(archiveIndexMax(index));
+                const KeyValue *timelineKv = archiveIndexTimeline(indexCurrent);
+                const VariantList *timelineList = kvKeyList(timelineKv);
+
+                for (unsigned int timelineIdx = 0; timelineIdx < varLstSize(timelineList); timelineIdx++)
+                {
+                    const String *walSegmentMax = varStr(
+                        kvGet(varKv(kvGet(timelineKv, varLstGet(timelineList, timelineIdx))), ARCHIVE_INDEX_KEY_MAX_VAR));
+
+                    // Timelines that are not in the listing were expired unless they are newer than anything listed
+                    if (kvKeyExists(archiveIndexTimeline(index), varLstGet(timelineList, timelineIdx)) ||
+                        (indexMax != NULL && strCmp(walSegmentMax, indexMax) > 0))
+                    {
+                        archiveIndexAdd(index, walSegmentMax);
+                    }
+                }
+            }
+
+            archiveIndexSave(storage, archivePath, index);
+        }
+        CATCH_ANY()
+        {
+            LOG_WARN("unable to update archive index in '%s': %s", strPtr(storagePath(storage, archivePath)), errorMessage());
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the oldest or newest segment on any timeline
+***********************************************************************************************************************************/
+static const String *
+archiveIndexRange(const KeyValue *index, const Variant *key, int compare)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, index);
+        FUNCTION_TEST_PARAM(VARIANT, key);
+        FUNCTION_TEST_PARAM(INT, compare);
+    FUNCTION_TEST_END();
+
+    ASSERT(index != NULL);
+    ASSERT(key != NULL);
+
+    const String *result = NULL;
+    const KeyValue *timelineKv = archiveIndexTimeline(index);
+    const VariantList *timelineList = kvKeyList(timelineKv);
+
+    for (unsigned int timelineIdx = 0; timelineIdx < varLstSize(timelineList); timelineIdx++)
+    {
+        const String *walSegment = varStr(kvGet(varKv(kvGet(timelineKv, varLstGet(timelineList, timelineIdx))), key));
+
+        if (result == NULL || strCmp(walSegment, result) * compare > 0)
+            result = walSegment;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+const String *
+archiveIndexMin(const KeyValue *index)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, index);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(archiveIndexRange(index, ARCHIVE_INDEX_KEY_MIN_VAR, -1));
+}
+
+const String *
+archiveIndexMax(const KeyValue *index)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, index);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(archiveIndexRange(index, ARCHIVE_INDEX_KEY_MAX_VAR, 1));
+}
+
+/**********************************************************************************************************************************/
+bool
+archiveIndexCurrent(const Storage *storage, const String *archivePath, const KeyValue *index)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archivePath);
+        FUNCTION_LOG_PARAM(KEY_VALUE, index);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archivePath != NULL);
+
+    bool result = index != NULL;
+
+    if (result)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Search backward from the newest WAL path for the newest segment, stopping at the WAL path containing the newest
+            // indexed segment.  This finds segments pushed but not yet indexed, segments dropped by a failed or lost index update,
+            // and segments on a newer timeline, while usually listing no more than one or two WAL paths.  Every WAL path is
+            // searched when the index is empty.
+            const String *indexMax = archiveIndexMax(index);
+            const String *indexMaxPath = indexMax == NULL ? NULL : strSubN(indexMax, 0, 16);
+            StringList *walPathList = strLstSort(
+                storageListP(storage, archivePath, .expression = WAL_SEGMENT_DIR_REGEXP_STR), sortOrderDesc);
+
+            const String *walSegmentNewest = NULL;
+
+            for (unsigned int walPathIdx = 0; walPathIdx < strLstSize(walPathList) && walSegmentNewest == NULL; walPathIdx++)
+            {
+                const String *walPath = strLstGet(walPathList, walPathIdx);
+
+                if (indexMaxPath != NULL && strCmp(walPath, indexMaxPath) < 0)
+                    break;
+
+                const StringList *walSegmentList = archiveIndexPathList(storage, archivePath, walPath);
+
+                if (strLstSize(walSegmentList) > 0)
+                {
+                    walSegmentNewest = strSubN(
+                        strLstGet(walSegmentList, strLstSize(walSegmentList) - 1), 0, WAL_SEGMENT_NAME_SIZE);
+                }
+            }
+
+            // The index is not current if a newer segment has been archived.  This happens briefly between a segment being pushed
+            // and the index being updated, when an update failed, or when expire saved the index over a concurrent update from
+            // archive-push.
+            if (walSegmentNewest != NULL && (indexMax == NULL || strCmp(indexMax, walSegmentNewest) < 0))
+            {
+                LOG_DETAIL("archive index does not include newest WAL segment %s and will not be used", strPtr(walSegmentNewest));
+                result = false;
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+archiveIndexValid(const KeyValue *index, const String *archiveStart, const String *archiveStop)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(KEY_VALUE, index);
+        FUNCTION_LOG_PARAM(STRING, archiveStart);
+        FUNCTION_LOG_PARAM(STRING, archiveStop);
+    FUNCTION_LOG_END();
+
+    bool result = index != NULL;
+
+    if (result)
+    {
+        const String *indexMin = archiveIndexMin(index);
+        const String *indexMax = archiveIndexMax(index);
+
+        if (archiveStart != NULL && (indexMin == NULL || strCmp(indexMin, archiveStart) > 0))
+            result = false;
+
+        if (archiveStop != NULL && (indexMax == NULL || strCmp(indexMax, archiveStop) < 0))
+            result = false;
+
+        if (!result)
+            LOG_DETAIL("archive index is stale and will not be used");
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
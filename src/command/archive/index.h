@@ -0,0 +1,56 @@
+/***********************************************************************************************************************************
+Archive Index
+
+Each archive id path (e.g. 9.6-1) contains a small index that stores the oldest and newest WAL segment archived on each timeline.
+The index allows info, expire, and check to find the archive range without listing every WAL path in the repository, which can take
+many requests on object stores with years of WAL.
+
+archive-push adds segments to the index after they are pushed (once per batch when async, once per segment otherwise) while holding
+the archive lock, and expire rebuilds the oldest segments after archive is removed.  The index is only an optimization so errors
+updating it are logged as warnings, and readers fall back to listing when the index is missing, invalid, does not agree with the
+archive range of the backups that depend on it, or does not include the newest segment.
+***********************************************************************************************************************************/
+#ifndef COMMAND_ARCHIVE_INDEX_H
+#define COMMAND_ARCHIVE_INDEX_H
+
+#include "common/type/keyValue.h"
+#include "common/type/stringList.h"
+#include "storage/storage.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Load the index from an archive id path.  Returns NULL when the index is missing or invalid.
+KeyValue *archiveIndexLoad(const Storage *storage, const String *archivePath);
+
+// Build the index by listing the archive id path
+KeyValue *archiveIndexBuild(const Storage *storage, const String *archivePath);
+
+// Add a WAL segment to the index.  Returns true if the index changed.
+bool archiveIndexAdd(KeyValue *index, const String *walSegment);
+
+// Save the index to an archive id path
+void archiveIndexSave(const Storage *storage, const String *archivePath, const KeyValue *index);
+
+// Add pushed WAL segments to the index.  The index is built first if it does not exist.
+void archiveIndexUpdate(const Storage *storage, const String *archivePath, const StringList *walSegmentList);
+
+// Rebuild the index after archive has been expired.  The newest segments in the current index are kept if they are newer than the
+// listing since archive-push may have updated the index while the archive was being listed.
+void archiveIndexExpire(const Storage *storage, const String *archivePath);
+
+// Oldest and newest WAL segment on any timeline, or NULL when the index is empty
+const String *archiveIndexMin(const KeyValue *index);
+const String *archiveIndexMax(const KeyValue *index);
+
+// Does the index include the newest WAL segment in the archive?  WAL paths are listed newest first down to the path containing the
+// newest indexed segment (or every WAL path when the index is empty), so segments missed by a failed update or on a newer timeline
+// are found.  Expire rebuilds the index without the archive lock so an index saved by expire may miss a segment pushed while it was
+// rebuilding, which is also found here.
+bool archiveIndexCurrent(const Storage *storage, const String *archivePath, const KeyValue *index);
+
+// Does the index agree with the archive range required by backups?  The index is stale if the oldest segment is newer than
+// archiveStart or the newest segment is older than archiveStop.  Either may be NULL when there are no backups to check.
+bool archiveIndexValid(const KeyValue *index, const String *archiveStart, const String *archiveStop);
+
+#endif
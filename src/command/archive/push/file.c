@@ -14,10 +14,16 @@ Archive Push File
 #include "common/io/filter/group.h"
 #include "common/io/io.h"
 #include "common/log.h"
+#include "common/stat.h"
 #include "config/config.h"
 #include "postgres/interface.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Statistics
+***********************************************************************************************************************************/
+STRING_STATIC(ARCHIVE_PUSH_STAT_FILE_MS_STR,                        "archive.push.file.ms");
+
 /***********************************************************************************************************************************
 Copy a file from the source to the archive
 ***********************************************************************************************************************************/
@@ -129,11 +135,15 @@ archivePushFile(
             }
 
             // Copy the file
+            TimeMSec timeBegin = timeMSec();
+
             storageCopyNP(
                 source,
                 storageNewWriteP(
                     storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(archiveDestination)),
                 .compressible = compressible));
+
+            statTimeAdd(ARCHIVE_PUSH_STAT_FILE_MS_STR, timeBegin);
         }
     }
     MEM_CONTEXT_TEMP_END();
@@ -7,6 +7,7 @@ Archive Push Command
 #include <unistd.h>
 
 #include "command/archive/common.h"
+#include "command/archive/index.h"
 #include "command/archive/push/file.h"
 #include "command/archive/push/protocol.h"
 #include "command/command.h"
@@ -15,7 +16,6 @@ Archive Push Command
 #include "common/fork.h"
 #include "common/log.h"
 #include "common/memContext.h"
-#include "common/wait.h"
 #include "config/config.h"
 #include "config/exec.h"
 #include "info/infoArchive.h"
@@ -24,6 +24,12 @@ Archive Push Command
 #include "protocol/parallel.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Time to wait for the archive lock before skipping the archive index update.  Other pushes hold the lock only while updating the
+index.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_INDEX_LOCK_TIMEOUT                             ((TimeMSec)(5 * MSEC_PER_SEC))
+
 /***********************************************************************************************************************************
 Ready file extension constants
 ***********************************************************************************************************************************/
@@ -75,6 +81,37 @@ archivePushDrop(const String *walPath, const StringList *const processList)
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/***********************************************************************************************************************************
+Get the compression level for a WAL file based on the number of WAL files waiting to be pushed
+
+When the backlog exceeds archive-push-compress-backlog the level is lowered in proportion to the excess so the backlog clears
+faster, reaching zero (no compression) at twice the limit.  The level returns to compress-level as the backlog clears.
+
+Only the backlog is used, not the measured push rate.  The rate depends on the level that is being chosen, so a level based on the
+rate would oscillate, while a backlog that is falling already shows that the archive is keeping up.
+***********************************************************************************************************************************/
+static int
+archivePushCompressLevel(unsigned int backlog)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, backlog);
+    FUNCTION_TEST_END();
+
+    int result = cfgOptionInt(cfgOptCompressLevel);
+
+    if (cfgOptionTest(cfgOptArchivePushCompressBacklog))
+    {
+        const unsigned int backlogMax = cfgOptionUInt(cfgOptArchivePushCompressBacklog);
+
+        if (backlog >= backlogMax * 2)
+            result = 0;
+        else if (backlog > backlogMax)
+            result = (int)((unsigned int)result * (backlogMax * 2 - backlog) / backlogMax);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Get the list of WAL files ready to be pushed according to PostgreSQL
 ***********************************************************************************************************************************/
@@ -278,7 +315,8 @@ cmdArchivePush(void)
             bool confessOnError = false;                                // Should we confess errors?
 
             // Loop and wait for the WAL segment to be pushed
-            Wait *wait = waitNew((TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
+            ArchiveAsyncWatch *watch = archiveAsyncWatchNew(
+                archiveModePush, (TimeMSec)(cfgOptionDbl(cfgOptArchiveTimeout) * MSEC_PER_SEC));
 
             do
             {
@@ -329,7 +367,7 @@ cmdArchivePush(void)
                 // Now that the async process has been launched, confess any errors that are found
                 confessOnError = true;
             }
-            while (!pushed && waitMore(wait));
+            while (!pushed && archiveAsyncWatchMore(watch, !forked));
 
             // If the WAL segment was not pushed then error
             if (!pushed)
@@ -370,6 +408,29 @@ cmdArchivePush(void)
                 if (warning != NULL)
                     LOG_WARN(strPtr(warning));
 
+                // Update the archive index so info and expire do not need to list the archive.  This costs an index read and write
+                // per segment, which async avoids by updating once per batch.  The archive lock serializes the update with other
+                // pushes so a concurrent save cannot drop this segment.  If the lock is not acquired in time the update is skipped
+                // since readers find the segment in the newest WAL paths and fall back to listing until the next update.
+                if (walIsSegment(archiveFile) && !walIsPartial(archiveFile))
+                {
+                    if (lockAcquire(
+                            cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgLockType(),
+                            ARCHIVE_PUSH_INDEX_LOCK_TIMEOUT, false))
+                    {
+                        StringList *walSegmentList = strLstNew();
+                        strLstAdd(walSegmentList, archiveFile);
+
+                        archiveIndexUpdate(
+                            storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strPtr(archiveInfo.archiveId)),
+                            walSegmentList);
+
+                        lockRelease(true);
+                    }
+                    else
+                        LOG_DETAIL("unable to acquire archive lock so archive index was not updated");
+                }
+
                 // Log success
                 LOG_INFO("pushed WAL file '%s' to the archive", strPtr(archiveFile));
             }
@@ -446,12 +507,25 @@ cmdArchivePushAsync(void)
                 for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
                     protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, processIdx));
 
-                // Queue jobs in executor
+                // Queue jobs in executor.  Jobs are started in order so the backlog when a job starts is the number of WAL files
+                // that have not been started yet, which determines the compression level.
+                int compressLevelLast = cfgOptionInt(cfgOptCompressLevel);
+
                 for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(walFileList); walFileIdx++)
                 {
                     protocolKeepAlive();
 
                     const String *walFile = strLstGet(walFileList, walFileIdx);
+                    const unsigned int backlog = strLstSize(walFileList) - walFileIdx;
+                    const int compressLevel = archivePushCompressLevel(backlog);
+
+                    if (cfgOptionBool(cfgOptCompress) && compressLevel != compressLevelLast)
+                    {
+                        LOG_DETAIL(
+                            "compress level %d for WAL file '%s' with backlog of %u WAL file(s)", compressLevel, strPtr(walFile),
+                            backlog);
+                        compressLevelLast = compressLevel;
+                    }
 
                     ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_STR);
                     protocolCommandParamAdd(command, VARSTR(strNewFmt("%s/%s", strPtr(walPath), strPtr(walFile))));
@@ -462,12 +536,14 @@ cmdArchivePushAsync(void)
                     protocolCommandParamAdd(command, VARUINT(cipherType(cfgOptionStr(cfgOptRepoCipherType))));
                     protocolCommandParamAdd(command, VARSTR(archiveInfo.archiveCipherPass));
                     protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptCompress)));
-                    protocolCommandParamAdd(command, VARINT(cfgOptionInt(cfgOptCompressLevel)));
+                    protocolCommandParamAdd(command, VARINT(compressLevel));
 
                     protocolParallelJobAdd(parallelExec, protocolParallelJobNew(VARSTR(walFile), command));
                 }
 
                 // Process jobs
+                StringList *walSegmentList = strLstNew();
+
                 do
                 {
                     unsigned int completed = protocolParallelProcess(parallelExec);
@@ -486,6 +562,9 @@ cmdArchivePushAsync(void)
                         {
                             LOG_DETAIL_PID(processId, "pushed WAL file '%s' to the archive", strPtr(walFile));
                             archiveAsyncStatusOkWrite(archiveModePush, walFile, varStr(protocolParallelJobResult(job)));
+
+                            if (walIsSegment(walFile) && !walIsPartial(walFile))
+                                strLstAdd(walSegmentList, walFile);
                         }
                         // Else the job errored
                         else
@@ -501,6 +580,13 @@ cmdArchivePushAsync(void)
                     }
                 }
                 while (!protocolParallelDone(parallelExec));
+
+                // Update the archive index once for all pushed segments
+                if (strLstSize(walSegmentList) > 0)
+                {
+                    archiveIndexUpdate(
+                        storageRepoWrite(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strPtr(archiveInfo.archiveId)), walSegmentList);
+                }
             }
         }
         // On any global error write a single error file to cover all unprocessed files
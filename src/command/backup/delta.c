@@ -0,0 +1,154 @@
+/***********************************************************************************************************************************
+Backup Delta
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/backup/delta.h"
+#include "common/debug.h"
+#include "common/log.h"
+
+/***********************************************************************************************************************************
+Find the prior file with the same name as the current file.  Both lists are sorted so the prior index only moves forward and each
+prior file is compared at most once in addition to the matches.
+***********************************************************************************************************************************/
+static const BackupDeltaFile *
+backupDeltaPrior(const List *priorList, unsigned int *priorIdx, const BackupDeltaFile *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, priorList);
+        FUNCTION_TEST_PARAM_P(UINT, priorIdx);
+        FUNCTION_TEST_PARAM_P(VOID, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(priorIdx != NULL);
+    ASSERT(file != NULL);
+
+    const BackupDeltaFile *result = NULL;
+
+    if (priorList != NULL)
+    {
+        while (*priorIdx < lstSize(priorList))
+        {
+            const BackupDeltaFile *prior = lstGet(priorList, *priorIdx);
+            int compare = strCmp(prior->name, file->name);
+
+            if (compare == 0)
+            {
+                result = prior;
+                break;
+            }
+
+            // The prior file is after the current file so the current file is not in the prior backup
+            if (compare > 0)
+                break;
+
+            (*priorIdx)++;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Check whether delta should be enabled because a timestamp is in the future or the timestamp and size of a file do not agree with the
+prior backup.  Stops at the first file found.
+***********************************************************************************************************************************/
+static void
+backupDeltaCheck(const List *fileList, const List *priorList, time_t timeBegin, BackupDeltaResult *result)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, fileList);
+        FUNCTION_TEST_PARAM(LIST, priorList);
+        FUNCTION_TEST_PARAM(INT64, timeBegin);
+        FUNCTION_TEST_PARAM_P(VOID, result);
+    FUNCTION_TEST_END();
+
+    ASSERT(fileList != NULL);
+    ASSERT(result != NULL);
+
+    unsigned int priorIdx = 0;
+
+    for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+    {
+        const BackupDeltaFile *file = lstGet(fileList, fileIdx);
+        const BackupDeltaFile *prior = backupDeltaPrior(priorList, &priorIdx, file);
+
+        if (file->timestamp > timeBegin || (prior != NULL && prior->future))
+            result->deltaReason = backupDeltaReasonFuture;
+        else if (
+            prior != NULL &&
+            (file->timestamp < prior->timestamp || (file->size != prior->size && file->timestamp == prior->timestamp)))
+        {
+            result->deltaReason = backupDeltaReasonChange;
+        }
+
+        if (result->deltaReason != backupDeltaReasonNone)
+        {
+            result->delta = true;
+            result->deltaFile = file->name;
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+BackupDeltaResult
+backupDelta(List *fileList, List *priorList, time_t timeBegin, bool delta, BackupDeltaCallback *callback, void *callbackData)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(LIST, fileList);
+        FUNCTION_LOG_PARAM(LIST, priorList);
+        FUNCTION_LOG_PARAM(INT64, timeBegin);
+        FUNCTION_LOG_PARAM(BOOL, delta);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(fileList != NULL);
+    ASSERT(callback != NULL);
+
+    BackupDeltaResult result = {.delta = delta};
+
+    // Sort both lists so they can be merged
+    lstSort(fileList, sortOrderAsc);
+
+    if (priorList != NULL)
+        lstSort(priorList, sortOrderAsc);
+
+    // Delta must be determined before any file can be referenced since it changes which files can be referenced
+    if (!result.delta)
+        backupDeltaCheck(fileList, priorList, timeBegin, &result);
+
+    // Decide whether each file will be copied or referenced
+    unsigned int priorIdx = 0;
+
+    for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+    {
+        const BackupDeltaFile *file = lstGet(fileList, fileIdx);
+        const BackupDeltaFile *prior = backupDeltaPrior(priorList, &priorIdx, file);
+        bool future = file->timestamp > timeBegin;
+        bool reference = false;
+
+        // If the timestamp is in the future (in this backup or the prior backup) then the file must be copied to prevent possible
+        // race conditions
+        if (future || (prior != NULL && prior->future))
+        {
+            result.timeInFuture = true;
+        }
+        // Else reference the file if the size and timestamp match or the size matches and delta is enabled.  In the latter case
+        // the file will be checksummed during the backup and copied if the checksum does not match.  Zero-length files can always
+        // be referenced if they exist in the prior backup.
+        else if (
+            prior != NULL && file->size == prior->size &&
+            (result.delta || file->size == 0 || file->timestamp == prior->timestamp))
+        {
+            reference = true;
+        }
+
+        callback(callbackData, file, prior, reference, future);
+    }
+
+    FUNCTION_LOG_RETURN(BACKUP_DELTA_RESULT, result);
+}
@@ -0,0 +1,73 @@
+/***********************************************************************************************************************************
+Backup Delta
+
+Compare the files found in the cluster against the files in the prior backup to determine which files can be referenced from the
+prior backup rather than copied.  Both lists are sorted by name so they can be compared with a merge-join in a linear pass rather
+than by looking up each file in the prior backup.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_DELTA_H
+#define COMMAND_BACKUP_DELTA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "common/type/list.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+File to be compared
+***********************************************************************************************************************************/
+typedef struct BackupDeltaFile
+{
+    const String *name;                                             // File name (must be first for sorting)
+    uint64_t size;                                                  // Original size
+    time_t timestamp;                                               // Original modification time
+    bool future;                                                    // Was the timestamp in the future? (prior backup only)
+} BackupDeltaFile;
+
+/***********************************************************************************************************************************
+Result of the comparison
+***********************************************************************************************************************************/
+typedef enum
+{
+    backupDeltaReasonNone,                                          // Delta was not enabled by a file
+    backupDeltaReasonFuture,                                        // File has a timestamp in the future
+    backupDeltaReasonChange,                                        // Timestamp in the past or size changed but timestamp did not
+} BackupDeltaReason;
+
+typedef struct BackupDeltaResult
+{
+    bool delta;                                                     // Is delta enabled?
+    BackupDeltaReason deltaReason;                                  // Reason delta was enabled by a file
+    const String *deltaFile;                                        // File that enabled delta
+    bool timeInFuture;                                              // Do any files have a timestamp in the future?
+} BackupDeltaResult;
+
+/***********************************************************************************************************************************
+Called for each file in name order as soon as it has been decided whether the file will be copied or referenced.  prior is the same
+file in the prior backup or NULL if there is no such file.  If reference is true then the reference, checksum, and other attributes
+should be carried forward from the prior file, otherwise the file must be copied.  future is true if the timestamp of the file is
+in the future.
+***********************************************************************************************************************************/
+typedef void BackupDeltaCallback(
+    void *data, const BackupDeltaFile *file, const BackupDeltaFile *prior, bool reference, bool future);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Compare files against the prior backup.  Both lists are sorted by name before they are compared.  priorList may be NULL when
+// there is no prior backup.  If delta is false then it will be enabled when the timestamps and sizes indicate that they cannot be
+// trusted.
+BackupDeltaResult backupDelta(
+    List *fileList, List *priorList, time_t timeBegin, bool delta, BackupDeltaCallback *callback, void *callbackData);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_BACKUP_DELTA_RESULT_TYPE                                                                                      \
+    BackupDeltaResult
+#define FUNCTION_LOG_BACKUP_DELTA_RESULT_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(&value, "BackupDeltaResult", buffer, bufferSize)
+
+#endif
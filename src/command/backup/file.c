@@ -17,11 +17,18 @@ Backup File
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
-#include "common/regExp.h"
+#include "common/stat.h"
 #include "common/type/convert.h"
 #include "postgres/interface.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Statistics
+***********************************************************************************************************************************/
+STRING_STATIC(BACKUP_STAT_FILE_COPY_BYTE_STR,                       "backup.file.copy.byte");
+STRING_STATIC(BACKUP_STAT_FILE_COPY_MS_STR,                         "backup.file.copy.ms");
+STRING_STATIC(BACKUP_STAT_FILE_REPO_BYTE_STR,                       "backup.file.repo.byte");
+
 /***********************************************************************************************************************************
 Helper functions
 ***********************************************************************************************************************************/
@@ -32,8 +39,15 @@ segmentNumber(const String *pgFile)
         FUNCTION_TEST_PARAM(STRING, pgFile);
     FUNCTION_TEST_END();
 
-    // Determine which segment number this is by checking for a numeric extension.  No extension means segment 0.
-    FUNCTION_TEST_RETURN(regExpMatchOne(STRDEF("\\.[0-9]+$"), pgFile) ? cvtZToUInt(strrchr(strPtr(pgFile), '.') + 1) : 0);
+    // Determine which segment number this is by checking for a numeric extension.  No extension means segment 0.  This is checked
+    // directly rather than with a regular expression since it is done for every file.
+    const char *extension = strrchr(strPtr(pgFile), '.');
+    unsigned int result = 0;
+
+    if (extension != NULL && extension[1] != '\0' && strspn(extension + 1, "0123456789") == strlen(extension + 1))
+        result = cvtZToUInt(extension + 1);
+
+    FUNCTION_TEST_RETURN(result);
 }
 
 /***********************************************************************************************************************************
@@ -43,7 +57,8 @@ BackupFileResult
 backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, const String *pgFileChecksum, bool pgFileChecksumPage,
     uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference, bool repoFileCompress,
-    unsigned int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType, const String *cipherPass)
+    unsigned int repoFileCompressLevel, const String *backupLabel, bool delta, BackupFilterSide compressSide,
+    BackupFilterSide cipherSide, CipherType cipherType, const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, pgFile);                         // Database file to copy to the repo
@@ -58,6 +73,8 @@ backupFile(
         FUNCTION_LOG_PARAM(UINT, repoFileCompressLevel);            // Compression level for destination file
         FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
         FUNCTION_LOG_PARAM(BOOL, delta);                            // Is the delta option on?
+        FUNCTION_LOG_PARAM(ENUM, compressSide);                     // Side of the copy where compression is done
+        FUNCTION_LOG_PARAM(ENUM, cipherSide);                       // Side of the copy where encryption is done
         FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
     FUNCTION_LOG_END();
@@ -174,8 +191,13 @@ backupFile(
         // Copy the file
         if (result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy)
         {
-            // Is the file compressible during the copy?
-            bool compressible = !repoFileCompress && cipherType == cipherTypeNone;
+            // Compression/encryption is done on the side requested, except that encryption must be done on the repo side when
+            // compression is since the file must be compressed before it is encrypted.
+            bool compressRepoSide = compressSide == backupFilterSideRepo;
+            bool cipherRepoSide = cipherSide == backupFilterSideRepo || (repoFileCompress && compressRepoSide);
+
+            // Is the file compressible during the copy? Only if it has not been compressed or encrypted on the db side.
+            bool compressible = (!repoFileCompress || compressRepoSide) && (cipherType == cipherTypeNone || cipherRepoSide);
 
             // Setup pg file for read
             StorageRead *read = storageNewReadP(
@@ -191,23 +213,30 @@ backupFile(
                     PG_PAGE_SIZE_DEFAULT, pgFileChecksumPageLsnLimit));
             }
 
+            // Setup the repo file for write
+            StorageWrite *write = storageNewWriteP(storageRepoWrite(), repoPathFile, .compressible = compressible);
+
             // Add compression
             if (repoFileCompress)
-                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), gzipCompressNew((int)repoFileCompressLevel, false));
+            {
+                ioFilterGroupAdd(
+                    compressRepoSide ? ioWriteFilterGroup(storageWriteIo(write)) : ioReadFilterGroup(storageReadIo(read)),
+                    gzipCompressNew((int)repoFileCompressLevel, false));
+            }
 
             // If there is a cipher then add the encrypt filter
             if (cipherType != cipherTypeNone)
             {
                 ioFilterGroupAdd(
-                    ioReadFilterGroup(
-                        storageReadIo(read)), cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
+                    cipherRepoSide ? ioWriteFilterGroup(storageWriteIo(write)) : ioReadFilterGroup(storageReadIo(read)),
+                    cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
             }
 
-            // Setup the repo file for write
-            StorageWrite *write = storageNewWriteP(storageRepoWrite(), repoPathFile, .compressible = compressible);
             ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), ioSizeNew());
 
             // Open the source and destination and copy the file
+            TimeMSec timeBegin = timeMSec();
+
             if (storageCopy(read, write))
             {
                 memContextSwitch(MEM_CONTEXT_OLD());
@@ -228,6 +257,11 @@ backupFile(
                 }
 
                 memContextSwitch(MEM_CONTEXT_TEMP());
+
+                // Update statistics
+                statTimeAdd(BACKUP_STAT_FILE_COPY_MS_STR, timeBegin);
+                statAdd(BACKUP_STAT_FILE_COPY_BYTE_STR, result.copySize);
+                statAdd(BACKUP_STAT_FILE_REPO_BYTE_STR, result.repoSize);
             }
             // Else if source file is missing and the read setup indicated ignore a missing file, the database removed it so skip it
             else
@@ -19,6 +19,14 @@ typedef enum
     backupCopyResultNoOp,
 } BackupCopyResult;
 
+// Side of the copy where a filter runs.  Db side filters run where the pg file is read, i.e. on the pg host when pg is remote.
+// Repo side filters run where the repo file is written, i.e. on the repo host when the repo is remote.
+typedef enum
+{
+    backupFilterSideDb,
+    backupFilterSideRepo,
+} BackupFilterSide;
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -31,10 +39,13 @@ typedef struct BackupFileResult
     KeyValue *pageChecksumResult;
 } BackupFileResult;
 
+// Checksums are always calculated on the db side.  Encryption is done on the repo side when compression is since the file is
+// compressed before it is encrypted.
 BackupFileResult backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, const String *pgFileChecksum, bool pgFileChecksumPage,
     uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference, bool repoFileCompress,
-    unsigned int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType, const String *cipherPass);
+    unsigned int repoFileCompressLevel, const String *backupLabel, bool delta, BackupFilterSide compressSide,
+    BackupFilterSide cipherSide, CipherType cipherType, const String *cipherPass);
 
 /***********************************************************************************************************************************
 Macros for function logging
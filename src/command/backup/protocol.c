@@ -45,8 +45,10 @@ backupProtocol(const String *command, const VariantList *paramList, ProtocolServ
                 varUInt64(varLstGet(paramList, 5)) << 32 | varUInt64(varLstGet(paramList, 6)), varStr(varLstGet(paramList, 7)),
                 varBoolForce(varLstGet(paramList, 8)), varBoolForce(varLstGet(paramList, 9)),
                 varUIntForce(varLstGet(paramList, 10)), varStr(varLstGet(paramList, 11)), varBoolForce(varLstGet(paramList, 12)),
-                varLstSize(paramList) == 14 ? cipherTypeAes256Cbc : cipherTypeNone,
-                varLstSize(paramList) == 14 ? varStr(varLstGet(paramList, 13)) : NULL);
+                varBoolForce(varLstGet(paramList, 13)) ? backupFilterSideRepo : backupFilterSideDb,
+                varBoolForce(varLstGet(paramList, 14)) ? backupFilterSideRepo : backupFilterSideDb,
+                varLstSize(paramList) == 16 ? cipherTypeAes256Cbc : cipherTypeNone,
+                varLstSize(paramList) == 16 ? varStr(varLstGet(paramList, 15)) : NULL);
 
             // Return backup result
             VariantList *resultList = varLstNew();
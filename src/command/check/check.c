@@ -4,6 +4,7 @@ Check Command
 #include "build.auto.h"
 
 #include "command/archive/common.h"
+#include "command/archive/index.h"
 #include "command/check/check.h"
 #include "common/debug.h"
 #include "common/log.h"
@@ -56,6 +57,18 @@ cmdCheck(void)
                     strPtr(
                         storagePath(
                             storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(walSegmentFile)))));
+
+                // The archive index should include the WAL segment since archive-push updates it after each push
+                const KeyValue *archiveIndex = archiveIndexLoad(
+                    storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strPtr(archiveId)));
+
+                if (!archiveIndexValid(archiveIndex, NULL, walSegment))
+                {
+                    LOG_WARN(
+                        "archive index does not include WAL segment %s\n"
+                            "HINT: info and expire will list the archive until archive-push updates the index.",
+                        strPtr(walSegment));
+                }
             }
             else
             {
@@ -11,15 +11,139 @@ Common Command Routines
 #include "common/io/tls/client.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/profile.h"
+#include "common/stat.h"
 #include "common/time.h"
+#include "common/type/json.h"
 #include "config/config.h"
+#include "storage/helper.h"
 #include "version.h"
 
+/***********************************************************************************************************************************
+Number of contexts to report in the memory statistics at the end of the command
+***********************************************************************************************************************************/
+#define CMD_MEM_CONTEXT_STAT_NAME_MAX                               5
+
+/***********************************************************************************************************************************
+Minimum time between metric snapshots while the command is running
+***********************************************************************************************************************************/
+#define CMD_STAT_WRITE_INTERVAL                                     10000
+
 /***********************************************************************************************************************************
 Track time command started
 ***********************************************************************************************************************************/
 static TimeMSec timeBegin;
 
+/***********************************************************************************************************************************
+Name (without extension) of a file written by this process to the specified path
+
+Each process writes its own files since local processes do most of the work for commands that run in parallel.  The files are named
+the same way as the log files.
+***********************************************************************************************************************************/
+static String *
+cmdProcessFile(const String *path)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, path);
+    FUNCTION_TEST_END();
+
+    ASSERT(path != NULL);
+
+    String *result = strNewFmt(
+        "%s/%s-", strPtr(path), cfgOptionTest(cfgOptStanza) ? strPtr(cfgOptionStr(cfgOptStanza)) : "all");
+
+    // If local or remote command add command name and process id
+    if (cfgCommand() == cfgCmdLocal || cfgCommand() == cfgCmdRemote)
+    {
+        strCatFmt(
+            result, "%s-%s-%03u", strPtr(cfgOptionStr(cfgOptCommand)), cfgCommandName(cfgCommand()),
+            cfgOptionUInt(cfgOptProcess));
+    }
+    // Else add command name
+    else
+        strCat(result, cfgCommandName(cfgCommand()));
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Write metric snapshots to the metric path
+
+Errors are only logged as warnings since metrics are not important enough to fail the command.
+***********************************************************************************************************************************/
+static void
+cmdStatWrite(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    TRY_BEGIN()
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const String *stanza = cfgOptionTest(cfgOptStanza) ? cfgOptionStr(cfgOptStanza) : NULL;
+            const String *file = cmdProcessFile(cfgOptionStr(cfgOptMetricPath));
+            unsigned int process =
+                cfgCommand() == cfgCmdLocal || cfgCommand() == cfgCmdRemote ? cfgOptionUInt(cfgOptProcess) : 0;
+
+            // Write JSON snapshot
+            String *json = strNewFmt(
+                "{\"command\":\"%s\",\"process\":%u,\"stanza\":%s,\"time\":%" PRIu64 ",\"stat\":%s}\n",
+                cfgCommandName(cfgCommand()), process, stanza == NULL ? "null" : strPtr(jsonFromStr(stanza)),
+                timeMSec() - timeBegin, strPtr(statToJson()));
+
+            storagePutNP(storageNewWriteNP(storageLocalWrite(), strNewFmt("%s.json", strPtr(file))), BUFSTR(json));
+
+            // Write Prometheus snapshot
+            String *label = strNewFmt(
+                "command=\"%s\",process=\"%u\",stanza=\"%s\"", cfgCommandName(cfgCommand()), process,
+                stanza == NULL ? "" : strPtr(stanza));
+
+            storagePutNP(
+                storageNewWriteNP(storageLocalWrite(), strNewFmt("%s.prom", strPtr(file))), BUFSTR(statToPrometheus(label)));
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN("unable to write metrics: %s", errorMessage());
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Stop the profiler and write samples to the log path
+
+Errors are only logged as warnings since the profile is not important enough to fail the command.
+***********************************************************************************************************************************/
+static void
+cmdProfileWrite(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    profileStop();
+
+    TRY_BEGIN()
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            storagePutNP(
+                storageNewWriteNP(
+                    storageLocalWrite(), strNewFmt("%s.profile", strPtr(cmdProcessFile(cfgOptionStr(cfgOptLogPath))))),
+                BUFSTR(profileToFolded()));
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN("unable to write profile: %s", errorMessage());
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Capture time at the very start of main so total time is more accurate
 ***********************************************************************************************************************************/
@@ -45,6 +169,9 @@ cmdBegin(bool logOption)
 
     ASSERT(cfgCommand() != cfgCmdNone);
 
+    // Collect memory statistics only when they will be logged at the end of the command
+    memContextStatEnable(logAny(logLevelDebug));
+
     // This is fairly expensive log message to generate so skip it if it won't be output
     if (logAny(cfgLogLevelDefault()))
     {
@@ -160,6 +287,14 @@ cmdBegin(bool logOption)
         MEM_CONTEXT_TEMP_END();
     }
 
+    // Write metric snapshots periodically while the command is running
+    if (cfgOptionValid(cfgOptMetricPath) && cfgOptionTest(cfgOptMetricPath))
+        statCallbackSet(cmdStatWrite, CMD_STAT_WRITE_INTERVAL);
+
+    // Start sampling where the process spends time
+    if (cfgOptionValid(cfgOptProfile) && cfgOptionBool(cfgOptProfile))
+        profileStart();
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -176,6 +311,17 @@ cmdEnd(int code, const String *errorMessage)
 
     ASSERT(cfgCommand() != cfgCmdNone);
 
+    // Write final metric snapshots
+    if (cfgOptionValid(cfgOptMetricPath) && cfgOptionTest(cfgOptMetricPath))
+    {
+        statCallbackSet(NULL, 0);
+        cmdStatWrite();
+    }
+
+    // Write profile samples
+    if (cfgOptionValid(cfgOptProfile) && cfgOptionBool(cfgOptProfile))
+        cmdProfileWrite();
+
     // Skip this log message if it won't be output.  It's not too expensive but since we skipped cmdBegin(), may as well.
     if (logAny(cfgLogLevelDefault()))
     {
@@ -193,6 +339,25 @@ cmdEnd(int code, const String *errorMessage)
             if (httpClientStat != NULL)
                 LOG_INFO(strPtr(httpClientStat));
 
+            // Log memory statistics.  This is only done at debug level since the values vary from run to run.
+            if (logAny(logLevelDebug))
+            {
+                MemContextStatName statNameList[CMD_MEM_CONTEXT_STAT_NAME_MAX];
+                unsigned int statNameTotal = memContextStatNameTop(statNameList, CMD_MEM_CONTEXT_STAT_NAME_MAX);
+
+                String *memStat = strNewFmt(
+                    "memory statistics: peak %s, largest contexts:", strPtr(strSizeFormat(memContextStat(memContextTop()).peak)));
+
+                for (unsigned int statNameIdx = 0; statNameIdx < statNameTotal; statNameIdx++)
+                {
+                    strCatFmt(
+                        memStat, "%s %s %s (%u)", statNameIdx == 0 ? "" : ",", statNameList[statNameIdx].name,
+                        strPtr(strSizeFormat(statNameList[statNameIdx].peak)), statNameList[statNameIdx].total);
+                }
+
+                LOG_DEBUG(strPtr(memStat));
+            }
+
             // Basic info on command end
             String *info = strNewFmt("%s command end: ", cfgCommandName(cfgCommand()));
 
@@ -4,8 +4,10 @@ Expire Command
 #include "build.auto.h"
 
 #include "command/archive/common.h"
+#include "command/archive/index.h"
 #include "command/backup/common.h"
 #include "common/type/list.h"
+#include "common/type/stringSet.h"
 #include "common/debug.h"
 #include "common/regExp.h"
 #include "config/config.h"
@@ -281,6 +283,9 @@ removeExpiredArchive(InfoBackup *infoBackup)
 
                 StringList *globalBackupArchiveRetentionList = strLstNew();
 
+                // Set of all backups to retain so backups associated with each archiveId can be found without a nested search
+                StringSet *globalBackupRetentionSet = strSetNewStrLst(globalBackupRetentionList);
+
                 // globalBackupRetentionList is ordered newest to oldest backup, so create globalBackupArchiveRetentionList of the
                 // newest backups whose archives will be retained
                 for (unsigned int idx = 0;
@@ -332,21 +337,19 @@ removeExpiredArchive(InfoBackup *infoBackup)
                         // From the global list of backups to retain, create a list of backups, oldest to newest, associated with
                         // this archiveId (e.g. 9.4-1), e.g. If globalBackupRetention has 4F, 3F, 2F, 1F then
                         // localBackupRetentionList will have 1F, 2F, 3F, 4F (assuming they all have same history id)
-                        for (unsigned int retentionIdx = strLstSize(globalBackupRetentionList) - 1;
-                             (int)retentionIdx >=0; retentionIdx--)
+                        for (unsigned int backupIdx = 0; backupIdx < infoBackupDataTotal(infoBackup); backupIdx++)
                         {
-                            for (unsigned int backupIdx = 0; backupIdx < infoBackupDataTotal(infoBackup); backupIdx++)
-                            {
-                                InfoBackupData backupData = infoBackupData(infoBackup, backupIdx);
+                            InfoBackupData backupData = infoBackupData(infoBackup, backupIdx);
 
-                                if (strCmp(backupData.backupLabel, strLstGet(globalBackupRetentionList, retentionIdx)) == 0 &&
-                                    backupData.backupPgId == archivePgId)
-                                {
-                                    strLstAdd(localBackupRetentionList, backupData.backupLabel);
-                                }
+                            if (backupData.backupPgId == archivePgId &&
+                                strSetExists(globalBackupRetentionSet, backupData.backupLabel))
+                            {
+                                strLstAdd(localBackupRetentionList, backupData.backupLabel);
                             }
                         }
 
+                        strLstSort(localBackupRetentionList, sortOrderAsc);
+
                         // If no backup to retain was found
                         if (strLstSize(localBackupRetentionList) == 0)
                         {
@@ -375,17 +378,15 @@ removeExpiredArchive(InfoBackup *infoBackup)
                         {
                             // From the full list of backups in archive retention, find the intersection of local backups to retain
                             // from oldest to newest
+                            StringSet *localBackupRetentionSet = strSetNewStrLst(localBackupRetentionList);
+
                             for (unsigned int globalIdx = strLstSize(globalBackupArchiveRetentionList) - 1;
                                  (int)globalIdx >= 0; globalIdx--)
                             {
-                                for (unsigned int localIdx = 0; localIdx < strLstSize(localBackupRetentionList); localIdx++)
+                                if (strSetExists(localBackupRetentionSet, strLstGet(globalBackupArchiveRetentionList, globalIdx)))
                                 {
-                                    if (strCmp(
-                                            strLstGet(globalBackupArchiveRetentionList, globalIdx),
-                                            strLstGet(localBackupRetentionList, localIdx)) == 0)
-                                    {
-                                        strLstAdd(localBackupArchiveRetentionList, strLstGet(localBackupRetentionList, localIdx));
-                                    }
+                                    strLstAdd(
+                                        localBackupArchiveRetentionList, strLstGet(globalBackupArchiveRetentionList, globalIdx));
                                 }
                             }
                         }
@@ -473,13 +474,25 @@ removeExpiredArchive(InfoBackup *infoBackup)
                                 }
                             }
 
-                            // Get all major archive paths (timeline and first 32 bits of LSN)
-                            StringList *walPathList =
-                                strLstSort(
-                                    storageListP(
-                                        storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strPtr(archiveId)),
-                                        .expression = STRDEF(WAL_SEGMENT_DIR_REGEXP)),
+                            // If the archive index is current and the oldest WAL is not older than the retention backup then there
+                            // is nothing to expire and listing the archive can be skipped
+                            const String *archivePath = strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strPtr(archiveId));
+                            const KeyValue *archiveIndex = archiveIndexLoad(storageRepo(), archivePath);
+                            StringList *walPathList = NULL;
+
+                            if (archiveIndexValid(archiveIndex, NULL, archiveRetentionBackup.backupArchiveStop) &&
+                                archiveIndexMin(archiveIndex) != NULL &&
+                                strCmp(archiveIndexMin(archiveIndex), archiveExpireMax) >= 0)
+                            {
+                                walPathList = strLstNew();
+                            }
+                            // Else get all major archive paths (timeline and first 32 bits of LSN)
+                            else
+                            {
+                                walPathList = strLstSort(
+                                    storageListP(storageRepo(), archivePath, .expression = STRDEF(WAL_SEGMENT_DIR_REGEXP)),
                                     sortOrderAsc);
+                            }
 
                             for (unsigned int walIdx = 0; walIdx < strLstSize(walPathList); walIdx++)
                             {
@@ -568,9 +581,12 @@ removeExpiredArchive(InfoBackup *infoBackup)
                             {
                                 LOG_DETAIL("no archive to remove, archiveId = %s", strPtr(archiveId));
                             }
-                            // Log if there is more to log
+                            // Else log if there is more to log and update the archive index with the new oldest WAL
                             else
+                            {
                                 logExpire(&archiveExpire, archiveId);
+                                archiveIndexExpire(storageRepoWrite(), archivePath);
+                            }
                         }
                     }
                 }
@@ -9,6 +9,7 @@ Info Command
 #include <unistd.h>
 
 #include "command/archive/common.h"
+#include "command/archive/index.h"
 #include "command/info/info.h"
 #include "common/debug.h"
 #include "common/io/handleWrite.h"
@@ -100,12 +101,15 @@ stanzaStatus(const int code, const String *message, Variant *stanzaInfo)
 Set the data for the archive section of the stanza for the database info from the backup.info file.
 ***********************************************************************************************************************************/
 static void
-archiveDbList(const String *stanza, const InfoPgData *pgData, VariantList *archiveSection, const InfoArchive *info, bool currentDb)
+archiveDbList(
+    const String *stanza, const InfoPgData *pgData, VariantList *archiveSection, const InfoArchive *info,
+    const InfoBackup *infoBackup, bool currentDb)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(STRING, stanza);
         FUNCTION_TEST_PARAM_P(INFO_PG_DATA, pgData);
         FUNCTION_TEST_PARAM(VARIANT, archiveSection);
+        FUNCTION_TEST_PARAM(INFO_BACKUP, infoBackup);
         FUNCTION_TEST_PARAM(BOOL, currentDb);
     FUNCTION_TEST_END();
 
@@ -119,53 +123,39 @@ archiveDbList(const String *stanza, const InfoPgData *pgData, VariantList *archi
     const String *archiveId = infoArchiveIdHistoryMatch(info, pgData->id, pgData->version, pgData->systemId);
 
     String *archivePath = strNewFmt(STORAGE_PATH_ARCHIVE "/%s/%s", strPtr(stanza), strPtr(archiveId));
-    String *archiveStart = NULL;
-    String *archiveStop = NULL;
+    const String *archiveStart = NULL;
+    const String *archiveStop = NULL;
     Variant *archiveInfo = varNewKv(kvNew());
 
-    // Get a list of WAL directories in the archive repo from oldest to newest, if any exist
-    StringList *walDir = strLstSort(
-        storageListP(storageRepo(), archivePath, .expression = WAL_SEGMENT_DIR_REGEXP_STR), sortOrderAsc);
+    // Get the oldest and newest WAL required by backups of this DB.  The archive index is stale if it does not cover this range.
+    const String *backupArchiveStart = NULL;
+    const String *backupArchiveStop = NULL;
 
-    if (strLstSize(walDir) > 0)
+    for (unsigned int backupIdx = 0; backupIdx < infoBackupDataTotal(infoBackup); backupIdx++)
     {
-        // Not every WAL dir has WAL files so check each
-        for (unsigned int idx = 0; idx < strLstSize(walDir); idx++)
-        {
-            // Get a list of all WAL in this WAL dir
-            StringList *list = storageListP(
-                storageRepo(), strNewFmt("%s/%s", strPtr(archivePath), strPtr(strLstGet(walDir, idx))),
-                .expression = WAL_SEGMENT_FILE_REGEXP_STR);
-
-            // If wal segments are found, get the oldest one as the archive start
-            if (strLstSize(list) > 0)
-            {
-                // Sort the list from oldest to newest to get the oldest starting WAL archived for this DB
-                list = strLstSort(list, sortOrderAsc);
-                archiveStart = strSubN(strLstGet(list, 0), 0, 24);
-                break;
-            }
-        }
+        InfoBackupData backupData = infoBackupData(infoBackup, backupIdx);
 
-        // Iterate through the directory list in the reverse so processing newest first. Cast comparison to an int for readability.
-        for (unsigned int idx = strLstSize(walDir) - 1; (int)idx >= 0; idx--)
+        if (backupData.backupPgId == pgData->id && backupData.backupArchiveStart != NULL)
         {
-            // Get a list of all WAL in this WAL dir
-            StringList *list = storageListP(
-                storageRepo(), strNewFmt("%s/%s", strPtr(archivePath), strPtr(strLstGet(walDir, idx))),
-                .expression = WAL_SEGMENT_FILE_REGEXP_STR);
+            if (backupArchiveStart == NULL || strCmp(backupData.backupArchiveStart, backupArchiveStart) < 0)
+                backupArchiveStart = backupData.backupArchiveStart;
 
-            // If wal segments are found, get the newest one as the archive stop
-            if (strLstSize(list) > 0)
-            {
-                // Sort the list from newest to oldest to get the newest ending WAL archived for this DB
-                list = strLstSort(list, sortOrderDesc);
-                archiveStop = strSubN(strLstGet(list, 0), 0, 24);
-                break;
-            }
+            if (backupArchiveStop == NULL || strCmp(backupData.backupArchiveStop, backupArchiveStop) > 0)
+                backupArchiveStop = backupData.backupArchiveStop;
         }
     }
 
+    // Use the archive index maintained by archive-push when it is valid and current, else list the archive to get the oldest and
+    // newest WAL
+    KeyValue *archiveIndex = archiveIndexLoad(storageRepo(), archivePath);
+
+    if (!archiveIndexValid(archiveIndex, backupArchiveStart, backupArchiveStop) ||
+        !archiveIndexCurrent(storageRepo(), archivePath, archiveIndex))
+        archiveIndex = archiveIndexBuild(storageRepo(), archivePath);
+
+    archiveStart = archiveIndexMin(archiveIndex);
+    archiveStop = archiveIndexMax(archiveIndex);
+
     // If there is an archive or the database is the current database then store it
     if (currentDb || archiveStart != NULL)
     {
@@ -352,10 +342,10 @@ stanzaInfoList(const String *stanza, StringList *stanzaList)
                 varLstAdd(dbSection, pgInfo);
 
                 // Get the archive info for the DB from the archive.info file
-                InfoArchive *info = infoArchiveLoadFile(
+                InfoArchive *infoArchive = infoArchiveLoadFile(
                     storageRepo(), strNewFmt(STORAGE_PATH_ARCHIVE "/%s/%s", strPtr(stanzaListName), INFO_ARCHIVE_FILE),
                     cipherType(cfgOptionStr(cfgOptRepoCipherType)), cfgOptionStr(cfgOptRepoCipherPass));
-                archiveDbList(stanzaListName, &pgData, archiveSection, info, (pgIdx == 0 ? true : false));
+                archiveDbList(stanzaListName, &pgData, archiveSection, infoArchive, info, (pgIdx == 0 ? true : false));
             }
 
             // Get data for all existing backups for this stanza
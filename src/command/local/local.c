@@ -7,6 +7,7 @@ Local Command
 #include "command/archive/push/protocol.h"
 #include "command/backup/protocol.h"
 #include "command/restore/protocol.h"
+#include "command/verify/protocol.h"
 #include "common/debug.h"
 #include "common/io/handleRead.h"
 #include "common/io/handleWrite.h"
@@ -37,6 +38,7 @@ cmdLocal(int handleRead, int handleWrite)
         protocolServerHandlerAdd(server, archivePushProtocol);
         protocolServerHandlerAdd(server, backupProtocol);
         protocolServerHandlerAdd(server, restoreProtocol);
+        protocolServerHandlerAdd(server, verifyProtocol);
         protocolServerProcess(server);
     }
     MEM_CONTEXT_TEMP_END();
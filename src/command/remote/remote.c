@@ -20,18 +20,19 @@ Remote Command
 Remote command
 ***********************************************************************************************************************************/
 void
-cmdRemote(int handleRead, int handleWrite)
+cmdRemoteIo(IoRead *read, IoWrite *write)
 {
-    FUNCTION_LOG_VOID(logLevelDebug);
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+    ASSERT(write != NULL);
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
         String *name = strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u", cfgOptionUInt(cfgOptProcess));
-        IoRead *read = ioHandleReadNew(name, handleRead, (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
-        ioReadOpen(read);
-        IoWrite *write = ioHandleWriteNew(name, handleWrite);
-        ioWriteOpen(write);
-
         ProtocolServer *server = protocolServerNew(name, PROTOCOL_SERVICE_REMOTE_STR, read, write);
         protocolServerHandlerAdd(server, storageRemoteProtocol);
         protocolServerHandlerAdd(server, dbProtocol);
@@ -73,3 +74,27 @@ cmdRemote(int handleRead, int handleWrite)
 
     FUNCTION_LOG_RETURN_VOID();
 }
+
+/**********************************************************************************************************************************/
+void
+cmdRemote(int handleRead, int handleWrite)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(INT, handleRead);
+        FUNCTION_LOG_PARAM(INT, handleWrite);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        String *name = strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u", cfgOptionUInt(cfgOptProcess));
+        IoRead *read = ioHandleReadNew(name, handleRead, (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
+        ioReadOpen(read);
+        IoWrite *write = ioHandleWriteNew(name, handleWrite);
+        ioWriteOpen(write);
+
+        cmdRemoteIo(read, write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
@@ -4,9 +4,16 @@ Remote Command
 #ifndef COMMAND_REMOTE_REMOTE_H
 #define COMMAND_REMOTE_REMOTE_H
 
+#include "common/io/read.h"
+#include "common/io/write.h"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+// Run the remote protocol server on the handles passed, i.e. stdin/stdout when started via SSH
 void cmdRemote(int handleRead, int handleWrite);
 
+// Run the remote protocol server on an already open read/write pair, e.g. a session accepted by the TLS server
+void cmdRemoteIo(IoRead *read, IoWrite *write);
+
 #endif
@@ -17,9 +17,16 @@ Restore File
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
+#include "common/stat.h"
 #include "config/config.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Statistics
+***********************************************************************************************************************************/
+STRING_STATIC(RESTORE_STAT_FILE_COPY_BYTE_STR,                      "restore.file.copy.byte");
+STRING_STATIC(RESTORE_STAT_FILE_COPY_MS_STR,                        "restore.file.copy.ms");
+
 /***********************************************************************************************************************************
 Copy a file from the backup to the specified destination
 ***********************************************************************************************************************************/
@@ -166,6 +173,8 @@ restoreFile(
                 ioFilterGroupAdd(filterGroup, ioSizeNew());
 
                 // Copy file
+                TimeMSec timeBegin = timeMSec();
+
                 storageCopyNP(
                     storageNewReadP(
                         storageRepo(),
@@ -183,6 +192,10 @@ restoreFile(
                         "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strPtr(pgFile),
                         strPtr(varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))), strPtr(pgFileChecksum));
                 }
+
+                // Update statistics
+                statTimeAdd(RESTORE_STAT_FILE_COPY_MS_STR, timeBegin);
+                statAdd(RESTORE_STAT_FILE_COPY_BYTE_STR, varUInt64Force(ioFilterGroupResult(filterGroup, SIZE_FILTER_TYPE_STR)));
             }
         }
     }
@@ -0,0 +1,369 @@
+/***********************************************************************************************************************************
+Restore Path
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "command/restore/path.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/convert.h"
+#include "common/type/list.h"
+#include "common/user.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+VARIANT_STRDEF_STATIC(RESTORE_PATH_KEY_DESTINATION_VAR,             RESTORE_PATH_KEY_DESTINATION);
+VARIANT_STRDEF_STATIC(RESTORE_PATH_KEY_GROUP_VAR,                   RESTORE_PATH_KEY_GROUP);
+VARIANT_STRDEF_STATIC(RESTORE_PATH_KEY_MODE_VAR,                    RESTORE_PATH_KEY_MODE);
+VARIANT_STRDEF_STATIC(RESTORE_PATH_KEY_TYPE_VAR,                    RESTORE_PATH_KEY_TYPE);
+VARIANT_STRDEF_STATIC(RESTORE_PATH_KEY_USER_VAR,                    RESTORE_PATH_KEY_USER);
+
+/***********************************************************************************************************************************
+Entry found in the path
+***********************************************************************************************************************************/
+typedef struct RestorePathEntry
+{
+    String *name;                                                   // Name of the file/path/link
+    StorageType type;                                               // Type of the file/path/link
+    String *user;                                                   // User that owns the file/path/link
+    String *group;                                                  // Group that owns the file/path/link
+    mode_t mode;                                                    // Mode of the file/path
+    String *linkDestination;                                        // Destination if this is a link
+} RestorePathEntry;
+
+// Callback to collect entries so the path is not modified while it is being read
+static void
+restorePathEntryCallback(void *entryList, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, entryList);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, *info);
+    FUNCTION_TEST_END();
+
+    if (!strEqZ(info->name, "."))
+    {
+        MEM_CONTEXT_BEGIN(lstMemContext(entryList))
+        {
+            RestorePathEntry entry =
+            {
+                .name = strDup(info->name),
+                .type = info->type,
+                .user = strDup(info->user),
+                .group = strDup(info->group),
+                .mode = info->mode,
+                .linkDestination = strDup(info->linkDestination),
+            };
+
+            lstAdd(entryList, &entry);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Record and count the contents of a path that will be removed.  The path is listed in descending order so the contents of each path
+are recorded before the path itself.
+***********************************************************************************************************************************/
+typedef struct RestorePathRemoveData
+{
+    const String *pathAbsolute;                                     // Absolute path being removed
+    RestorePathResult *result;                                      // Result to update with the removed entries
+} RestorePathRemoveData;
+
+static void
+restorePathRemoveCallback(void *data, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, *info);
+    FUNCTION_TEST_END();
+
+    RestorePathRemoveData *removeData = data;
+
+    const char *entryPathAbsolute = strEqZ(info->name, ".") ?
+        strPtr(removeData->pathAbsolute) : strPtr(strNewFmt("%s/%s", strPtr(removeData->pathAbsolute), strPtr(info->name)));
+
+    if (info->type == storageTypePath)
+    {
+        strLstAdd(removeData->result->messageList, strNewFmt("remove path %s", entryPathAbsolute));
+        removeData->result->pathRemoved++;
+    }
+    else if (info->type == storageTypeLink)
+    {
+        strLstAdd(removeData->result->messageList, strNewFmt("remove link %s", entryPathAbsolute));
+        removeData->result->linkRemoved++;
+    }
+    else
+    {
+        strLstAdd(removeData->result->messageList, strNewFmt("remove file %s", entryPathAbsolute));
+        removeData->result->fileRemoved++;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Set ownership when it does not match.  The actual user/group may be NULL when the entry is new or the id has no name mapping.
+***********************************************************************************************************************************/
+static void
+restorePathOwner(
+    StringList *messageList, const String *pgPath, const String *actualUser, const String *actualGroup, const String *user,
+    const String *group)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, messageList);
+        FUNCTION_TEST_PARAM(STRING, pgPath);
+        FUNCTION_TEST_PARAM(STRING, actualUser);
+        FUNCTION_TEST_PARAM(STRING, actualGroup);
+        FUNCTION_TEST_PARAM(STRING, user);
+        FUNCTION_TEST_PARAM(STRING, group);
+    FUNCTION_TEST_END();
+
+    ASSERT(messageList != NULL);
+    ASSERT(pgPath != NULL);
+    ASSERT(user != NULL);
+    ASSERT(group != NULL);
+
+    if (actualUser == NULL || actualGroup == NULL || !strEq(actualUser, user) || !strEq(actualGroup, group))
+    {
+        const String *pgPathAbsolute = storagePathNP(storagePg(), pgPath);
+
+        strLstAdd(messageList, strNewFmt("set ownership %s:%s on %s", strPtr(user), strPtr(group), strPtr(pgPathAbsolute)));
+
+        THROW_ON_SYS_ERROR_FMT(
+            chown(strPtr(pgPathAbsolute), userIdFromName(user), groupIdFromName(group)) == -1, FileOwnerError,
+            "unable to set ownership for '%s'", strPtr(pgPathAbsolute));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Set mode when it does not match
+***********************************************************************************************************************************/
+static void
+restorePathMode(StringList *messageList, const String *pgPath, mode_t actualMode, mode_t mode)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, messageList);
+        FUNCTION_TEST_PARAM(STRING, pgPath);
+        FUNCTION_TEST_PARAM(MODE, actualMode);
+        FUNCTION_TEST_PARAM(MODE, mode);
+    FUNCTION_TEST_END();
+
+    ASSERT(messageList != NULL);
+    ASSERT(pgPath != NULL);
+
+    if (actualMode != mode)
+    {
+        const String *pgPathAbsolute = storagePathNP(storagePg(), pgPath);
+
+        strLstAdd(messageList, strNewFmt("set mode %04o on %s", (unsigned int)mode, strPtr(pgPathAbsolute)));
+
+        THROW_ON_SYS_ERROR_FMT(
+            chmod(strPtr(pgPathAbsolute), mode) == -1, FileModeError, "unable to set mode for '%s'", strPtr(pgPathAbsolute));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Clean and build a path in the cluster
+
+The path is created if it is missing (or replaced if it is not a path) and its ownership/mode fixed if requested.  When clean is
+requested, entries in the path that are not in entryKv (or are of the wrong type) are removed and the ownership/mode of files is
+fixed.  Links in entryKv are created if missing or recreated if the destination has changed.  Paths in entryKv are left for their
+own restorePath() call.  Files are created by restoreFile().
+
+entryKv maps entry names to a KeyValue that describes the expected type, mode, user, group, and destination (for links).  An entry
+with a NULL value is preserved as is.
+
+Actions are not logged here since this runs in a local process, which does not log to the console.  Instead they are returned in
+the message list so the caller can log them.
+***********************************************************************************************************************************/
+RestorePathResult
+restorePath(
+    const String *pgPath, mode_t pgPathMode, const String *pgPathUser, const String *pgPathGroup, bool pgPathFix, bool clean,
+    const KeyValue *entryKv)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, pgPath);
+        FUNCTION_LOG_PARAM(MODE, pgPathMode);
+        FUNCTION_LOG_PARAM(STRING, pgPathUser);
+        FUNCTION_LOG_PARAM(STRING, pgPathGroup);
+        FUNCTION_LOG_PARAM(BOOL, pgPathFix);
+        FUNCTION_LOG_PARAM(BOOL, clean);
+        FUNCTION_LOG_PARAM(KEY_VALUE, entryKv);
+    FUNCTION_LOG_END();
+
+    ASSERT(pgPath != NULL);
+    ASSERT(pgPathUser != NULL);
+    ASSERT(pgPathGroup != NULL);
+    ASSERT(entryKv != NULL);
+
+    RestorePathResult result = {.messageList = strLstNew()};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        userInit();
+
+        // Create the path if it is missing or replace it if it is not a path
+        // -------------------------------------------------------------------------------------------------------------------------
+        StorageInfo info = storageInfoP(storagePg(), pgPath, .ignoreMissing = true, .followLink = true);
+
+        if (info.exists && info.type != storageTypePath)
+        {
+            strLstAdd(result.messageList, strNewFmt("remove file %s - path expected", strPtr(storagePathNP(storagePg(), pgPath))));
+            storageRemoveP(storagePgWrite(), pgPath, .errorOnMissing = true);
+
+            result.fileRemoved++;
+            info.exists = false;
+        }
+
+        if (!info.exists)
+        {
+            storagePathCreateP(storagePgWrite(), pgPath, .mode = pgPathMode);
+            restorePathOwner(result.messageList, pgPath, userName(), groupName(), pgPathUser, pgPathGroup);
+        }
+        else if (pgPathFix)
+        {
+            restorePathOwner(result.messageList, pgPath, info.user, info.group, pgPathUser, pgPathGroup);
+            restorePathMode(result.messageList, pgPath, info.mode, pgPathMode);
+        }
+
+        // Remove entries that are not expected and fix ownership/mode on the rest
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (clean)
+        {
+            List *entryList = lstNew(sizeof(RestorePathEntry));
+            storageInfoListP(storagePg(), pgPath, restorePathEntryCallback, entryList, .sortOrder = sortOrderDesc);
+
+            for (unsigned int entryIdx = 0; entryIdx < lstSize(entryList); entryIdx++)
+            {
+                RestorePathEntry *entry = lstGet(entryList, entryIdx);
+                const String *entryPath = strNewFmt("%s/%s", strPtr(pgPath), strPtr(entry->name));
+
+                // Preserve entries without a description
+                if (kvKeyExists(entryKv, VARSTR(entry->name)) && kvGet(entryKv, VARSTR(entry->name)) == NULL)
+                {
+                    strLstAdd(
+                        result.messageList,
+                        strNewFmt(
+                            "preserve %s %s",
+                            entry->type == storageTypePath ? "path" : (entry->type == storageTypeLink ? "link" : "file"),
+                            strPtr(storagePathNP(storagePg(), entryPath))));
+                    continue;
+                }
+
+                // Determine if the entry is expected and has the same type
+                const KeyValue *expected = NULL;
+
+                if (kvKeyExists(entryKv, VARSTR(entry->name)))
+                {
+                    expected = varKv(kvGet(entryKv, VARSTR(entry->name)));
+                    const String *expectedType = varStr(kvGet(expected, RESTORE_PATH_KEY_TYPE_VAR));
+
+                    if (!((entry->type == storageTypeFile && strEqZ(expectedType, RESTORE_PATH_TYPE_FILE)) ||
+                          (entry->type == storageTypePath && strEqZ(expectedType, RESTORE_PATH_TYPE_PATH)) ||
+                          (entry->type == storageTypeLink && strEqZ(expectedType, RESTORE_PATH_TYPE_LINK))))
+                    {
+                        expected = NULL;
+                    }
+                }
+
+                // Remove the entry if it is not expected
+                if (expected == NULL)
+                {
+                    const String *entryPathAbsolute = storagePathNP(storagePg(), entryPath);
+
+                    if (entry->type == storageTypePath)
+                    {
+                        RestorePathRemoveData removeData = {.pathAbsolute = entryPathAbsolute, .result = &result};
+
+                        storageInfoListP(
+                            storagePg(), entryPath, restorePathRemoveCallback, &removeData, .recurse = true,
+                            .sortOrder = sortOrderDesc);
+                        storagePathRemoveP(storagePgWrite(), entryPath, .recurse = true);
+                    }
+                    else if (entry->type == storageTypeLink)
+                    {
+                        strLstAdd(result.messageList, strNewFmt("remove link %s", strPtr(entryPathAbsolute)));
+                        storageRemoveP(storagePgWrite(), entryPath, .errorOnMissing = true);
+
+                        result.linkRemoved++;
+                    }
+                    else
+                    {
+                        strLstAdd(result.messageList, strNewFmt("remove file %s", strPtr(entryPathAbsolute)));
+                        storageRemoveP(storagePgWrite(), entryPath, .errorOnMissing = true);
+
+                        result.fileRemoved++;
+                    }
+                }
+                // Else remove links with a changed destination so they will be recreated
+                else if (entry->type == storageTypeLink)
+                {
+                    if (!strEq(entry->linkDestination, varStr(kvGet(expected, RESTORE_PATH_KEY_DESTINATION_VAR))))
+                    {
+                        strLstAdd(
+                            result.messageList,
+                            strNewFmt("remove link %s - destination changed", strPtr(storagePathNP(storagePg(), entryPath))));
+                        storageRemoveP(storagePgWrite(), entryPath, .errorOnMissing = true);
+                    }
+                }
+                // Else fix file ownership/mode.  Paths are fixed by their own restorePath() call.
+                else if (entry->type == storageTypeFile)
+                {
+                    restorePathOwner(
+                        result.messageList, entryPath, entry->user, entry->group,
+                        varStr(kvGet(expected, RESTORE_PATH_KEY_USER_VAR)), varStr(kvGet(expected, RESTORE_PATH_KEY_GROUP_VAR)));
+                    restorePathMode(
+                        result.messageList, entryPath, entry->mode,
+                        cvtZToUIntBase(strPtr(varStr(kvGet(expected, RESTORE_PATH_KEY_MODE_VAR))), 8));
+                }
+            }
+        }
+
+        // Create missing links
+        // -------------------------------------------------------------------------------------------------------------------------
+        const VariantList *entryNameList = kvKeyList(entryKv);
+
+        for (unsigned int entryIdx = 0; entryIdx < varLstSize(entryNameList); entryIdx++)
+        {
+            const Variant *entryName = varLstGet(entryNameList, entryIdx);
+            const Variant *expected = kvGet(entryKv, entryName);
+
+            if (expected != NULL && strEqZ(varStr(kvGet(varKv(expected), RESTORE_PATH_KEY_TYPE_VAR)), RESTORE_PATH_TYPE_LINK))
+            {
+                const String *entryPath = strNewFmt("%s/%s", strPtr(pgPath), strPtr(varStr(entryName)));
+
+                if (!storageInfoP(storagePg(), entryPath, .ignoreMissing = true).exists)
+                {
+                    const String *entryPathAbsolute = storagePathNP(storagePg(), entryPath);
+                    const String *destination = varStr(kvGet(varKv(expected), RESTORE_PATH_KEY_DESTINATION_VAR));
+
+                    THROW_ON_SYS_ERROR_FMT(
+                        symlink(strPtr(destination), strPtr(entryPathAbsolute)) == -1, LinkOpenError,
+                        "unable to create link '%s' to '%s'", strPtr(entryPathAbsolute), strPtr(destination));
+
+                    // Ownership is set on the destination since the link ownership cannot be set portably
+                    restorePathOwner(
+                        result.messageList, entryPath, userName(), groupName(),
+                        varStr(kvGet(varKv(expected), RESTORE_PATH_KEY_USER_VAR)),
+                        varStr(kvGet(varKv(expected), RESTORE_PATH_KEY_GROUP_VAR)));
+                }
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(RESTORE_PATH_RESULT, result);
+}
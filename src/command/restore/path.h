@@ -0,0 +1,53 @@
+/***********************************************************************************************************************************
+Restore Path
+***********************************************************************************************************************************/
+#ifndef COMMAND_RESTORE_PATH_H
+#define COMMAND_RESTORE_PATH_H
+
+#include <sys/types.h>
+
+#include "common/type/keyValue.h"
+#include "common/type/string.h"
+#include "common/type/stringList.h"
+
+/***********************************************************************************************************************************
+Entry types and keys used to describe the expected contents of a path
+***********************************************************************************************************************************/
+#define RESTORE_PATH_KEY_DESTINATION                                "destination"
+#define RESTORE_PATH_KEY_GROUP                                      "group"
+#define RESTORE_PATH_KEY_MODE                                       "mode"
+#define RESTORE_PATH_KEY_TYPE                                       "type"
+#define RESTORE_PATH_KEY_USER                                       "user"
+
+#define RESTORE_PATH_TYPE_FILE                                      "f"
+#define RESTORE_PATH_TYPE_LINK                                      "l"
+#define RESTORE_PATH_TYPE_PATH                                      "d"
+
+/***********************************************************************************************************************************
+Result of cleaning a path
+***********************************************************************************************************************************/
+typedef struct RestorePathResult
+{
+    unsigned int fileRemoved;                                       // Files removed from the path
+    unsigned int linkRemoved;                                       // Links removed from the path
+    unsigned int pathRemoved;                                       // Paths removed from the path
+    StringList *messageList;                                        // Actions taken, logged by the caller since locals do not log
+                                                                    // to the console
+} RestorePathResult;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+RestorePathResult restorePath(
+    const String *pgPath, mode_t pgPathMode, const String *pgPathUser, const String *pgPathGroup, bool pgPathFix, bool clean,
+    const KeyValue *entryKv);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_RESTORE_PATH_RESULT_TYPE                                                                                      \
+    RestorePathResult
+#define FUNCTION_LOG_RESTORE_PATH_RESULT_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(&value, "RestorePathResult", buffer, bufferSize)
+
+#endif
@@ -4,6 +4,7 @@ Restore Protocol Handler
 #include "build.auto.h"
 
 #include "command/restore/file.h"
+#include "command/restore/path.h"
 #include "command/restore/protocol.h"
 #include "common/debug.h"
 #include "common/io/io.h"
@@ -16,6 +17,7 @@ Restore Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_FILE_STR,                    PROTOCOL_COMMAND_RESTORE_FILE);
+STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_PATH_STR,                    PROTOCOL_COMMAND_RESTORE_PATH);
 
 /***********************************************************************************************************************************
 Process protocol requests
@@ -54,6 +56,23 @@ restoreProtocol(const String *command, const VariantList *paramList, ProtocolSer
                         varBoolForce(varLstGet(paramList, 5)),
                         varLstSize(paramList) == 16 ? varStr(varLstGet(paramList, 15)) : NULL)));
         }
+        else if (strEq(command, PROTOCOL_COMMAND_RESTORE_PATH_STR))
+        {
+            // Clean and build the path
+            RestorePathResult result = restorePath(
+                varStr(varLstGet(paramList, 0)), cvtZToUIntBase(strPtr(varStr(varLstGet(paramList, 1))), 8),
+                varStr(varLstGet(paramList, 2)), varStr(varLstGet(paramList, 3)), varBoolForce(varLstGet(paramList, 4)),
+                varBoolForce(varLstGet(paramList, 5)), varKv(varLstGet(paramList, 6)));
+
+            // Return the number of files, links, and paths removed and the actions taken so they can be logged by the main process
+            VariantList *resultList = varLstNew();
+            varLstAdd(resultList, varNewUInt(result.fileRemoved));
+            varLstAdd(resultList, varNewUInt(result.linkRemoved));
+            varLstAdd(resultList, varNewUInt(result.pathRemoved));
+            varLstAdd(resultList, varNewVarLst(varLstNewStrLst(result.messageList)));
+
+            protocolServerResponse(server, varNewVarLst(resultList));
+        }
         else
             found = false;
     }
@@ -13,6 +13,8 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_RESTORE_FILE                               "restoreFile"
     STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_FILE_STR);
+#define PROTOCOL_COMMAND_RESTORE_PATH                               "restorePath"
+    STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_PATH_STR);
 
 /***********************************************************************************************************************************
 Functions
@@ -0,0 +1,342 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "command/remote/remote.h"
+#include "command/server/server.h"
+#include "common/debug.h"
+#include "common/fork.h"
+#include "common/io/tls/server.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/json.h"
+#include "config/config.h"
+#include "config/load.h"
+#include "config/parse.h"
+#include "protocol/client.h"
+#include "protocol/helper.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+#define SERVER_AUTH_ALL                                             "*"
+
+/***********************************************************************************************************************************
+Check that the client is authorized for the stanza.  Commands that do not have a stanza require access to all stanzas.
+***********************************************************************************************************************************/
+static void
+serverAuth(const KeyValue *authKv, const String *client, const String *stanza)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(KEY_VALUE, authKv);
+        FUNCTION_LOG_PARAM(STRING, client);
+        FUNCTION_LOG_PARAM(STRING, stanza);
+    FUNCTION_LOG_END();
+
+    ASSERT(authKv != NULL);
+    ASSERT(client != NULL);
+
+    bool authorized = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Variant *auth = kvGet(authKv, VARSTR(client));
+
+        if (auth != NULL)
+        {
+            StringList *stanzaList = strLstNewSplitZ(varStr(auth), ",");
+
+            authorized =
+                strLstExists(stanzaList, STRDEF(SERVER_AUTH_ALL)) || (stanza != NULL && strLstExists(stanzaList, stanza));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    if (!authorized)
+    {
+        THROW_FMT(
+            HostInvalidError, "client '%s' is not authorized for %s", strPtr(client),
+            stanza == NULL ? "all stanzas" : strPtr(strNewFmt("stanza '%s'", strPtr(stanza))));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Is the option a path or host that must come from the server configuration?
+
+The client is authorized by stanza, so it must not be able to point the remote at a repository, cluster, or host that the server did
+not configure for the stanza.
+***********************************************************************************************************************************/
+static bool
+serverOptionLocal(ConfigOption optionId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, optionId);
+    FUNCTION_TEST_END();
+
+    ConfigDefineOption optionDefId = cfgOptionDefIdFromId(optionId);
+
+    FUNCTION_TEST_RETURN(
+        optionDefId == cfgDefOptLockPath || optionDefId == cfgDefOptLogPath || optionDefId == cfgDefOptMetricPath ||
+        optionDefId == cfgDefOptPgHost || optionDefId == cfgDefOptPgPath || optionDefId == cfgDefOptPgSocketPath ||
+        optionDefId == cfgDefOptRepoCachePath || optionDefId == cfgDefOptRepoHost || optionDefId == cfgDefOptRepoPath ||
+        optionDefId == cfgDefOptRepoS3Host || optionDefId == cfgDefOptSpoolPath);
+}
+
+/***********************************************************************************************************************************
+Load the remote configuration from the parameters sent by the client
+
+The server configuration file options are always used so the client cannot redirect the remote to another configuration.  Path and
+host options sent by the client are ignored so the values in the server configuration are used.  The client quotes parameters that
+contain spaces so the quotes are removed since parameters are passed directly to the parser rather than via a shell.
+***********************************************************************************************************************************/
+static void
+serverConfigLoad(const StringList *serverParam, const VariantList *clientParam, const KeyValue *authKv, const String *client)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_LIST, serverParam);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, clientParam);
+        FUNCTION_LOG_PARAM(KEY_VALUE, authKv);
+        FUNCTION_LOG_PARAM(STRING, client);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StringList *paramList = strLstDup(serverParam);
+        const String *stanza = NULL;
+
+        for (unsigned int paramIdx = 0; paramIdx < varLstSize(clientParam); paramIdx++)
+        {
+            String *param = strDup(varStr(varLstGet(clientParam, paramIdx)));
+
+            // The last parameter is the command, which must be remote
+            if (paramIdx == varLstSize(clientParam) - 1)
+            {
+                if (!strEqZ(param, CFGCMD_REMOTE))
+                    THROW_FMT(CommandInvalidError, "command '%s' is not allowed, expected '" CFGCMD_REMOTE "'", strPtr(param));
+            }
+            // Else check the option
+            else
+            {
+                if (!strBeginsWithZ(param, "--"))
+                    THROW_FMT(OptionInvalidError, "invalid parameter '%s'", strPtr(param));
+
+                // Find the option by its exact name.  Abbreviations are rejected because the parser would otherwise expand them,
+                // e.g. --no-conf, and bypass the checks below.
+                int valueIdx = strChr(param, '=');
+                int optionId = configParseOptionId(strSubN(param, 2, (valueIdx == -1 ? strSize(param) : (size_t)valueIdx) - 2));
+
+                if (optionId == -1)
+                    THROW_FMT(OptionInvalidError, "invalid option '%s'", strPtr(param));
+
+                if (optionId == cfgOptConfig || optionId == cfgOptConfigPath || optionId == cfgOptConfigIncludePath)
+                    THROW_FMT(OptionInvalidError, "option '%s' is not allowed", strPtr(param));
+
+                // Clients send their own path and host options, e.g. repo1-path, so skip them rather than erroring
+                if (serverOptionLocal((ConfigOption)optionId))
+                    continue;
+
+                // Remove the quotes added by the client for the shell
+
+                if (valueIdx != -1 && strSize(param) - (size_t)valueIdx >= 3 && strPtr(param)[valueIdx + 1] == '"' &&
+                    strEndsWithZ(param, "\""))
+                {
+                    param = strNewFmt(
+                        "%s%s", strPtr(strSubN(param, 0, (size_t)valueIdx + 1)),
+                        strPtr(strSubN(param, (size_t)valueIdx + 2, strSize(param) - (size_t)valueIdx - 3)));
+                }
+
+                if (optionId == cfgOptStanza && valueIdx != -1)
+                    stanza = strSub(param, (size_t)valueIdx + 1);
+            }
+
+            strLstAdd(paramList, param);
+        }
+
+        if (varLstSize(clientParam) == 0)
+            THROW(ParamRequiredError, "remote parameters are required");
+
+        // Check authorization before loading the configuration
+        serverAuth(authKv, client, stanza);
+
+        cfgLoad(strLstSize(paramList), strLstPtr(paramList));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Start a remote on a session accepted by the server (runs in the forked process)
+***********************************************************************************************************************************/
+static void
+serverSession(TlsSession *session, const StringList *serverParam, const KeyValue *authKv)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(TLS_SESSION, session);
+        FUNCTION_LOG_PARAM(STRING_LIST, serverParam);
+        FUNCTION_LOG_PARAM(KEY_VALUE, authKv);
+    FUNCTION_LOG_END();
+
+    IoRead *read = tlsSessionIoRead(session);
+    IoWrite *write = tlsSessionIoWrite(session);
+
+    // Load the configuration and report any errors to the client
+    volatile bool started = false;
+
+    TRY_BEGIN()
+    {
+        serverConfigLoad(serverParam, jsonToVarLst(ioReadLine(read)), authKv, tlsSessionPeerName(session));
+
+        ioWriteStrLine(write, jsonFromKv(kvNew(), 0));
+        ioWriteFlush(write);
+
+        started = true;
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN("unable to start remote: %s", errorMessage());
+
+        KeyValue *error = kvNew();
+        kvPut(error, VARSTR(PROTOCOL_ERROR_STR), VARINT(errorCode()));
+        kvPut(error, VARSTR(PROTOCOL_OUTPUT_STR), VARSTRZ(errorMessage()));
+
+        ioWriteStrLine(write, jsonFromKv(error, 0));
+        ioWriteFlush(write);
+    }
+    TRY_END();
+
+    if (started)
+        cmdRemoteIo(read, write);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Accept connections and fork a remote for each one
+***********************************************************************************************************************************/
+static void
+serverProcess(TlsServer *server, const StringList *serverParam, const KeyValue *authKv, uint64_t connectionMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(TLS_SERVER, server);
+        FUNCTION_LOG_PARAM(STRING_LIST, serverParam);
+        FUNCTION_LOG_PARAM(KEY_VALUE, authKv);
+        FUNCTION_LOG_PARAM(UINT64, connectionMax);
+    FUNCTION_LOG_END();
+
+    // Let the kernel reap the remotes since the server does not need their exit status
+    signal(SIGCHLD, SIG_IGN);
+
+    MEM_CONTEXT_TEMP_RESET_BEGIN()
+    {
+        uint64_t connectionTotal = 0;
+
+        do
+        {
+            int fd = -1;
+
+            // A client that fails to connect should not stop the server
+            TRY_BEGIN()
+            {
+                fd = tlsServerAccept(server);
+            }
+            CATCH_ANY()
+            {
+                LOG_WARN("unable to accept connection: %s", errorMessage());
+            }
+            TRY_END();
+
+            if (fd != -1)
+            {
+                // Negotiate TLS and start the remote in a child process so a slow or stalled client does not block the server
+                if (forkSafe() == 0)
+                {
+                    signal(SIGCHLD, SIG_DFL);
+
+                    TlsSession *session = NULL;
+
+                    TRY_BEGIN()
+                    {
+                        session = tlsServerSession(server, fd);
+                    }
+                    CATCH_ANY()
+                    {
+                        LOG_WARN("unable to accept connection: %s", errorMessage());
+                    }
+                    TRY_END();
+
+                    // Close the listen socket.  The session holds its own reference to the TLS context.
+                    tlsServerFree(server);
+
+                    if (session != NULL)
+                        serverSession(session, serverParam, authKv);
+
+                    break;
+                }
+
+                // The child now owns the socket
+                close(fd);
+                connectionTotal++;
+            }
+
+            // Free memory used by failed connections
+            MEM_CONTEXT_TEMP_RESET(1);
+        }
+        while (connectionMax == 0 || connectionTotal < connectionMax);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+cmdServer(uint64_t connectionMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT64, connectionMax);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // The configuration is replaced when the remote is loaded so copy the server settings needed by the remote
+        StringList *serverParam = strLstNew();
+        strLstAdd(serverParam, cfgExe());
+
+        if (cfgOptionNegate(cfgOptConfig))
+            strLstAddZ(serverParam, "--no-" CFGOPT_CONFIG);
+        else if (cfgOptionSource(cfgOptConfig) != cfgSourceDefault)
+            strLstAdd(serverParam, strNewFmt("--" CFGOPT_CONFIG "=%s", strPtr(cfgOptionStr(cfgOptConfig))));
+
+        if (cfgOptionSource(cfgOptConfigPath) != cfgSourceDefault)
+            strLstAdd(serverParam, strNewFmt("--" CFGOPT_CONFIG_PATH "=%s", strPtr(cfgOptionStr(cfgOptConfigPath))));
+
+        if (cfgOptionSource(cfgOptConfigIncludePath) != cfgSourceDefault)
+        {
+            strLstAdd(
+                serverParam, strNewFmt("--" CFGOPT_CONFIG_INCLUDE_PATH "=%s", strPtr(cfgOptionStr(cfgOptConfigIncludePath))));
+        }
+
+        const KeyValue *authKv = cfgOptionTest(cfgOptTlsServerAuth) ? kvDup(cfgOptionKv(cfgOptTlsServerAuth)) : kvNew();
+
+        TlsServer *server = tlsServerNew(
+            cfgOptionStr(cfgOptTlsServerAddress), cfgOptionUInt(cfgOptTlsServerPort), cfgOptionStr(cfgOptTlsServerCertFile),
+            cfgOptionStr(cfgOptTlsServerKeyFile), cfgOptionStr(cfgOptTlsServerCaFile),
+            (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
+
+        LOG_INFO(
+            "listening on '%s:%u'", strPtr(cfgOptionStr(cfgOptTlsServerAddress)), cfgOptionUInt(cfgOptTlsServerPort));
+
+        serverProcess(server, serverParam, authKv, connectionMax);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
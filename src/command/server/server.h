@@ -0,0 +1,16 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#ifndef COMMAND_SERVER_SERVER_H
+#define COMMAND_SERVER_SERVER_H
+
+#include <stdint.h>
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Accept TLS connections and fork a remote for each one.  The server runs until terminated unless connectionMax is non-zero, which
+// is useful for testing.  Returns in the forked remote process after the remote has completed.
+void cmdServer(uint64_t connectionMax);
+
+#endif
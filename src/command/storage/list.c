@@ -14,14 +14,22 @@ Storage List Command
 #include "common/type/string.h"
 #include "config/config.h"
 #include "storage/helper.h"
+#include "storage/posix/storage.h"
 
 /***********************************************************************************************************************************
 Render storage list
 ***********************************************************************************************************************************/
+typedef enum
+{
+    storageListOutputText,
+    storageListOutputJson,
+    storageListOutputJsonLines,
+} StorageListOutput;
+
 typedef struct StorageListRenderCallbackData
 {
     IoWrite *write;                                                 // Where to write output
-    bool json;                                                      // Is this json output?
+    StorageListOutput output;                                       // Output format
     bool first;                                                     // Is this the first item?
 } StorageListRenderCallbackData;
 
@@ -39,16 +47,16 @@ storageListRenderCallback(void *data, const StorageInfo *info)
     StorageListRenderCallbackData *listData = (StorageListRenderCallbackData *)data;
 
     // Skip . path when output is text
-    if (info->type == storageTypePath && strEq(info->name, DOT_STR) && !listData->json)
+    if (info->type == storageTypePath && strEq(info->name, DOT_STR) && listData->output == storageListOutputText)
     {
         FUNCTION_TEST_RETURN_VOID();
         return;
     }
 
-    // Add seperator character
+    // Add seperator character.  Json lines uses the same separator as text so each item can be parsed as soon as it is output.
     if (!listData->first)
     {
-        if (listData->json)
+        if (listData->output == storageListOutputJson)
             ioWrite(listData->write, COMMA_BUF);
         else
             ioWrite(listData->write, LF_BUF);
@@ -57,10 +65,20 @@ storageListRenderCallback(void *data, const StorageInfo *info)
         listData->first = false;
 
     // Render in json
-    if (listData->json)
+    if (listData->output != storageListOutputText)
     {
-        ioWriteStr(listData->write, jsonFromStr(info->name));
-        ioWrite(listData->write, BUFSTRDEF(":{\"type\":\""));
+        // Json lines output is a complete object on each line so the name is included in the object
+        if (listData->output == storageListOutputJsonLines)
+        {
+            ioWrite(listData->write, BUFSTRDEF("{\"name\":"));
+            ioWriteStr(listData->write, jsonFromStr(info->name));
+            ioWrite(listData->write, BUFSTRDEF(",\"type\":\""));
+        }
+        else
+        {
+            ioWriteStr(listData->write, jsonFromStr(info->name));
+            ioWrite(listData->write, BUFSTRDEF(":{\"type\":\""));
+        }
 
         switch (info->type)
         {
@@ -134,26 +152,52 @@ storageListRender(IoWrite *write)
         THROW(ParamInvalidError, "only one path may be specified");
 
     // Get output
-    bool json = strEqZ(cfgOptionStr(cfgOptOutput), "json") ? true : false;
+    StorageListOutput output = storageListOutputText;
+
+    if (strEqZ(cfgOptionStr(cfgOptOutput), "json"))
+        output = storageListOutputJson;
+    else if (strEqZ(cfgOptionStr(cfgOptOutput), "json-lines"))
+        output = storageListOutputJsonLines;
 
     // Render the info list
     StorageListRenderCallbackData data =
     {
         .write = write,
-        .json = json,
+        .output = output,
         .first = true,
     };
 
     ioWriteOpen(data.write);
 
-    if (data.json)
+    if (data.output == storageListOutputJson)
         ioWrite(data.write, BRACEL_BUF);
 
-    storageInfoListP(
-        storageRepo(), path, storageListRenderCallback, &data, .sortOrder = sortOrder, .expression = cfgOptionStr(cfgOptFilter),
-        .recurse = cfgOptionBool(cfgOptRecurse));
+    // When sorting, paths with more than sort-max entries are sorted in runs that are written to the spool path and then merged.
+    // When not sorting, info is rendered as it is returned from storage so memory usage does not depend on the number of entries.
+    const Storage *sortStorage = NULL;
+
+    if (sortOrder != sortOrderNone)
+    {
+        sortStorage = storagePosixNew(
+            strNewFmt("%s/ls-%d", strPtr(cfgOptionStr(cfgOptSpoolPath)), getpid()), STORAGE_MODE_FILE_DEFAULT,
+            STORAGE_MODE_PATH_DEFAULT, true, NULL);
+    }
+
+    TRY_BEGIN()
+    {
+        storageInfoListP(
+            storageRepo(), path, storageListRenderCallback, &data, .sortOrder = sortOrder,
+            .expression = cfgOptionStr(cfgOptFilter), .recurse = cfgOptionBool(cfgOptRecurse), .sortStorage = sortStorage,
+            .sortMax = cfgOptionUInt(cfgOptSortMax));
+    }
+    FINALLY()
+    {
+        if (sortStorage != NULL)
+            storagePathRemoveP(sortStorage, NULL, .recurse = true);
+    }
+    TRY_END();
 
-    if (data.json)
+    if (data.output == storageListOutputJson)
         ioWrite(data.write, BRACER_BUF);
 
     ioWriteClose(data.write);
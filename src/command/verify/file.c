@@ -0,0 +1,76 @@
+/***********************************************************************************************************************************
+Verify File
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/verify/file.h"
+#include "common/compress/gzip/decompress.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
+#include "common/debug.h"
+#include "common/io/filter/group.h"
+#include "common/io/filter/size.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Verify a file in the repository by reading it through decryption and decompression and comparing the checksum and size of the
+result with the expected values.  Nothing is written so the file can be verified without any scratch space.
+***********************************************************************************************************************************/
+VerifyFileResult
+verifyFile(
+    const String *repoFile, const String *fileChecksum, bool fileSizeCheck, uint64_t fileSize, bool repoFileCompressed,
+    CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, repoFile);                       // Repo file to verify
+        FUNCTION_LOG_PARAM(STRING, fileChecksum);                   // Expected checksum of the file
+        FUNCTION_LOG_PARAM(BOOL, fileSizeCheck);                    // Should the size be checked?
+        FUNCTION_LOG_PARAM(UINT64, fileSize);                       // Expected size of the file
+        FUNCTION_LOG_PARAM(BOOL, repoFileCompressed);               // Is the file compressed in the repo?
+        FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
+        FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to decrypt the file
+    FUNCTION_LOG_END();
+
+    ASSERT(repoFile != NULL);
+    ASSERT(fileChecksum != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+
+    VerifyFileResult result = {.fileResult = verifyOk};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Files that are already compressed or encrypted will not benefit from network compression
+        StorageRead *read = storageNewReadP(
+            storageRepo(), repoFile, .ignoreMissing = true, .compressible = cipherType == cipherTypeNone && !repoFileCompressed);
+        IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(read));
+
+        // Add decryption filter
+        cipherBlockFilterGroupAdd(filterGroup, cipherType, cipherModeDecrypt, cipherPass);
+
+        // Add decompression filter
+        if (repoFileCompressed)
+            ioFilterGroupAdd(filterGroup, gzipDecompressNew(false));
+
+        // Add sha1 and size filters
+        ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
+        ioFilterGroupAdd(filterGroup, ioSizeNew());
+
+        // Read the file and compare the results
+        if (ioReadDrain(storageReadIo(read)))
+        {
+            result.fileSize = varUInt64Force(ioFilterGroupResult(filterGroup, SIZE_FILTER_TYPE_STR));
+
+            if (!strEq(fileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
+                result.fileResult = verifyChecksumMismatch;
+            else if (fileSizeCheck && result.fileSize != fileSize)
+                result.fileResult = verifySizeInvalid;
+        }
+        else
+            result.fileResult = verifyFileMissing;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(VERIFY_FILE_RESULT, result);
+}
@@ -0,0 +1,42 @@
+/***********************************************************************************************************************************
+Verify File
+***********************************************************************************************************************************/
+#ifndef COMMAND_VERIFY_FILE_H
+#define COMMAND_VERIFY_FILE_H
+
+#include "common/crypto/common.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+File verification results
+***********************************************************************************************************************************/
+typedef enum
+{
+    verifyOk,                                                       // File matches the checksum (and size when checked)
+    verifyFileMissing,                                              // File is missing from the repository
+    verifyChecksumMismatch,                                         // File checksum does not match the expected checksum
+    verifySizeInvalid,                                              // File size does not match the expected size
+} VerifyResult;
+
+typedef struct VerifyFileResult
+{
+    VerifyResult fileResult;                                        // Result of the verification
+    uint64_t fileSize;                                              // Size of the file after decryption/decompression
+} VerifyFileResult;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+VerifyFileResult verifyFile(
+    const String *repoFile, const String *fileChecksum, bool fileSizeCheck, uint64_t fileSize, bool repoFileCompressed,
+    CipherType cipherType, const String *cipherPass);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_VERIFY_FILE_RESULT_TYPE                                                                                       \
+    VerifyFileResult
+#define FUNCTION_LOG_VERIFY_FILE_RESULT_FORMAT(value, buffer, bufferSize)                                                          \
+    objToLog(&value, "VerifyFileResult", buffer, bufferSize)
+
+#endif
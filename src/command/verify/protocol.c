@@ -0,0 +1,62 @@
+/***********************************************************************************************************************************
+Verify Protocol Handler
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/verify/file.h"
+#include "command/verify/protocol.h"
+#include "common/debug.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "config/config.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+STRING_EXTERN(PROTOCOL_COMMAND_VERIFY_FILE_STR,                     PROTOCOL_COMMAND_VERIFY_FILE);
+
+/***********************************************************************************************************************************
+Process protocol requests
+***********************************************************************************************************************************/
+bool
+verifyProtocol(const String *command, const VariantList *paramList, ProtocolServer *server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, command);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, paramList);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(command != NULL);
+
+    // Get the repo storage in case it is remote and encryption settings need to be pulled down
+    storageRepo();
+
+    // Attempt to satisfy the request -- we may get requests that are meant for other handlers
+    bool found = true;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        if (strEq(command, PROTOCOL_COMMAND_VERIFY_FILE_STR))
+        {
+            VerifyFileResult result = verifyFile(
+                varStr(varLstGet(paramList, 0)), varStr(varLstGet(paramList, 1)), varBoolForce(varLstGet(paramList, 2)),
+                varUInt64Force(varLstGet(paramList, 3)), varBoolForce(varLstGet(paramList, 4)),
+                (CipherType)varUIntForce(varLstGet(paramList, 5)), varStr(varLstGet(paramList, 6)));
+
+            // Return the result and the size of the file that was read
+            VariantList *resultList = varLstNew();
+            varLstAdd(resultList, varNewUInt(result.fileResult));
+            varLstAdd(resultList, varNewUInt64(result.fileSize));
+
+            protocolServerResponse(server, varNewVarLst(resultList));
+        }
+        else
+            found = false;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, found);
+}
@@ -0,0 +1,844 @@
+/***********************************************************************************************************************************
+Verify Command
+
+Read every file in the repository through decryption and decompression (without writing it anywhere) and compare the result with
+the checksum recorded when the file was stored.  Backup files are checked against their manifest and WAL segments are checked
+against the checksum embedded in their file name.  The archive is also checked to make sure that all WAL required to make each
+backup consistent is present.
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include "command/archive/common.h"
+#include "command/verify/file.h"
+#include "command/verify/protocol.h"
+#include "command/verify/verify.h"
+#include "common/compress/gzip/common.h"
+#include "common/compress/gzip/decompress.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
+#include "common/debug.h"
+#include "common/io/filter/group.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/time.h"
+#include "common/type/json.h"
+#include "common/type/list.h"
+#include "common/type/stringSet.h"
+#include "config/config.h"
+#include "info/infoArchive.h"
+#include "info/infoBackup.h"
+#include "info/manifest.h"
+#include "info/manifestBin.h"
+#include "postgres/interface.h"
+#include "postgres/version.h"
+#include "protocol/helper.h"
+#include "protocol/parallel.h"
+#include "storage/helper.h"
+#include "storage/posix/storage.h"
+
+/***********************************************************************************************************************************
+Number of jobs to queue per local process.  When the queue is full, results are collected as jobs complete and new jobs are added
+as space frees up, so memory usage does not grow with the size of the repository and the local processes are never left idle
+waiting for the queue to drain.
+***********************************************************************************************************************************/
+#define VERIFY_JOB_QUEUE_PER_PROCESS                                2
+
+/***********************************************************************************************************************************
+WAL segment size for PostgreSQL < 11 and the default for later versions
+***********************************************************************************************************************************/
+#define VERIFY_WAL_SEGMENT_SIZE_DEFAULT                             ((size_t)(16 * 1024 * 1024))
+
+/***********************************************************************************************************************************
+Manifest sections and keys required to verify backup files
+***********************************************************************************************************************************/
+STRING_STATIC(MANIFEST_SECTION_TARGET_FILE_STR,                     "target:file");
+STRING_STATIC(MANIFEST_KEY_CHECKSUM_STR,                            "checksum");
+STRING_STATIC(MANIFEST_KEY_REFERENCE_STR,                           "reference");
+STRING_STATIC(MANIFEST_KEY_SIZE_STR,                                "size");
+
+/***********************************************************************************************************************************
+Verify state shared by all the verify functions
+***********************************************************************************************************************************/
+typedef struct VerifyState
+{
+    MemContext *memContext;                                         // Mem context for the state
+    ProtocolParallel *parallelExec;                                 // Parallel executor for queued jobs
+    unsigned int jobTotal;                                          // Jobs queued and not yet collected
+    unsigned int jobMax;                                            // Maximum jobs to queue
+
+    unsigned int fileTotal;                                         // Files verified
+    uint64_t sizeTotal;                                             // Bytes verified (after decryption/decompression)
+    unsigned int errorTotal;                                        // Problems found
+} VerifyState;
+
+/***********************************************************************************************************************************
+Segments found in an archive id.  Used to check that the WAL required by each backup is present.
+***********************************************************************************************************************************/
+typedef struct VerifyArchive
+{
+    const String *archiveId;                                        // Archive id, e.g. 9.4-1
+    unsigned int pgVersion;                                         // PostgreSQL version
+    uint64_t pgSystemId;                                            // PostgreSQL system id
+    size_t walSegmentSize;                                          // WAL segment size (from a WAL header for PostgreSQL >= 11)
+    StringSet *walSegmentSet;                                       // WAL segments in the archive id (without checksum/extension)
+} VerifyArchive;
+
+/***********************************************************************************************************************************
+Process jobs and collect results until no more than jobMax jobs remain queued
+***********************************************************************************************************************************/
+static void
+verifyJobProcess(VerifyState *state, unsigned int jobMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, state);
+        FUNCTION_LOG_PARAM(UINT, jobMax);
+    FUNCTION_LOG_END();
+
+    ASSERT(state != NULL);
+
+    if (state->parallelExec != NULL)
+    {
+        do
+        {
+            unsigned int completed = protocolParallelProcess(state->parallelExec);
+
+            for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+            {
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    // Get the job and job key
+                    ProtocolParallelJob *job = protocolParallelResult(state->parallelExec);
+                    unsigned int processId = protocolParallelJobProcessId(job);
+                    const String *file = varStr(protocolParallelJobKey(job));
+
+                    // The job errored, e.g. the file could not be decrypted or decompressed
+                    if (protocolParallelJobErrorCode(job) != 0)
+                    {
+                        LOG_WARN_PID(
+                            processId, "unable to verify '%s': [%d] %s", strPtr(file), protocolParallelJobErrorCode(job),
+                            strPtr(protocolParallelJobErrorMessage(job)));
+
+                        state->errorTotal++;
+                    }
+                    // Else check the result
+                    else
+                    {
+                        const VariantList *resultList = varVarLst(protocolParallelJobResult(job));
+                        VerifyResult fileResult = (VerifyResult)varUIntForce(varLstGet(resultList, 0));
+                        uint64_t fileSize = varUInt64Force(varLstGet(resultList, 1));
+
+                        switch (fileResult)
+                        {
+                            case verifyOk:
+                            {
+                                LOG_DETAIL_PID(processId, "verified '%s' (%s)", strPtr(file), strPtr(strSizeFormat(fileSize)));
+                                break;
+                            }
+
+                            case verifyFileMissing:
+                            {
+                                LOG_WARN_PID(processId, "'%s' is missing", strPtr(file));
+                                break;
+                            }
+
+                            case verifyChecksumMismatch:
+                            {
+                                LOG_WARN_PID(processId, "'%s' has an invalid checksum", strPtr(file));
+                                break;
+                            }
+
+                            case verifySizeInvalid:
+                            {
+                                LOG_WARN_PID(processId, "'%s' has an invalid size", strPtr(file));
+                                break;
+                            }
+                        }
+
+                        if (fileResult != verifyOk)
+                            state->errorTotal++;
+
+                        state->fileTotal++;
+                        state->sizeTotal += fileSize;
+                    }
+
+                    state->jobTotal--;
+                    protocolKeepAlive();
+                }
+                MEM_CONTEXT_TEMP_END();
+            }
+        }
+        while (state->jobTotal > jobMax);
+
+        // The executor is done once all of its jobs have been collected so a new one is required for any further jobs
+        if (protocolParallelDone(state->parallelExec))
+        {
+            protocolParallelFree(state->parallelExec);
+            state->parallelExec = NULL;
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Queue a file to be verified.  When the queue is full, wait for a job to complete before returning.
+***********************************************************************************************************************************/
+static void
+verifyJobAdd(
+    VerifyState *state, const String *file, const String *repoFile, const String *fileChecksum, bool fileSizeCheck,
+    uint64_t fileSize, bool repoFileCompressed, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, state);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(STRING, fileChecksum);
+        FUNCTION_LOG_PARAM(BOOL, fileSizeCheck);
+        FUNCTION_LOG_PARAM(UINT64, fileSize);
+        FUNCTION_LOG_PARAM(BOOL, repoFileCompressed);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(state != NULL);
+    ASSERT(file != NULL);
+    ASSERT(repoFile != NULL);
+    ASSERT(fileChecksum != NULL);
+
+    // Create the parallel executor if there are no jobs queued
+    if (state->parallelExec == NULL)
+    {
+        MEM_CONTEXT_BEGIN(state->memContext)
+        {
+            state->parallelExec = protocolParallelNew((TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * MSEC_PER_SEC) / 2);
+
+            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                protocolParallelClientAdd(state->parallelExec, protocolLocalGet(protocolStorageTypeRepo, processIdx));
+        }
+        MEM_CONTEXT_END();
+    }
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_VERIFY_FILE_STR);
+        protocolCommandParamAdd(command, VARSTR(repoFile));
+        protocolCommandParamAdd(command, VARSTR(fileChecksum));
+        protocolCommandParamAdd(command, VARBOOL(fileSizeCheck));
+        protocolCommandParamAdd(command, VARUINT64(fileSize));
+        protocolCommandParamAdd(command, VARBOOL(repoFileCompressed));
+        protocolCommandParamAdd(command, VARUINT(cipherType));
+        protocolCommandParamAdd(command, VARSTR(cipherPass));
+
+        protocolParallelJobAdd(state->parallelExec, protocolParallelJobNew(VARSTR(file), command));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    // When the queue is full collect results until there is room for another job
+    if (++state->jobTotal >= state->jobMax)
+        verifyJobProcess(state, state->jobMax - 1);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the WAL segment size from the header of a segment in the archive.  PostgreSQL >= 11 allows the segment size to be set at initdb
+time so it must be read rather than assumed.  If the header cannot be read then the default is returned and an error is counted.
+***********************************************************************************************************************************/
+static size_t
+verifyWalSegmentSize(
+    VerifyState *state, const String *repoFile, bool repoFileCompressed, CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, state);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(BOOL, repoFileCompressed);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(state != NULL);
+    ASSERT(repoFile != NULL);
+
+    size_t result = VERIFY_WAL_SEGMENT_SIZE_DEFAULT;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TRY_BEGIN()
+        {
+            StorageRead *read = storageNewReadP(
+                storageRepo(), repoFile, .compressible = cipherType == cipherTypeNone && !repoFileCompressed);
+            IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(read));
+
+            cipherBlockFilterGroupAdd(filterGroup, cipherType, cipherModeDecrypt, cipherPass);
+
+            if (repoFileCompressed)
+                ioFilterGroupAdd(filterGroup, gzipDecompressNew(false));
+
+            unsigned int walSegmentSize = pgWalFromBuffer(storageGetP(read, .exactSize = PG_WAL_HEADER_SIZE)).walSegmentSize;
+
+            // The segment size must be a power of two or the next segment cannot be calculated
+            if (walSegmentSize == 0 || (walSegmentSize & (walSegmentSize - 1)) != 0)
+                THROW_FMT(FormatError, "invalid WAL segment size %u", walSegmentSize);
+
+            result = walSegmentSize;
+        }
+        CATCH_ANY()
+        {
+            LOG_WARN("unable to read WAL segment size from '%s': [%d] %s", strPtr(repoFile), errorCode(), errorMessage());
+            state->errorTotal++;
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
+/***********************************************************************************************************************************
+Verify WAL segments in the archive and return the segments found in each archive id
+***********************************************************************************************************************************/
+static List *
+verifyArchive(VerifyState *state, const InfoArchive *infoArchive, CipherType cipherType)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, state);
+        FUNCTION_LOG_PARAM(INFO_ARCHIVE, infoArchive);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+    FUNCTION_LOG_END();
+
+    ASSERT(state != NULL);
+    ASSERT(infoArchive != NULL);
+
+    List *result = lstNew(sizeof(VerifyArchive));
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const InfoPg *infoPg = infoArchivePg(infoArchive);
+
+        for (unsigned int pgIdx = 0; pgIdx < infoPgDataTotal(infoPg); pgIdx++)
+        {
+            InfoPgData pgData = infoPgData(infoPg, pgIdx);
+            const String *archiveId = infoPgArchiveId(infoPg, pgIdx);
+
+            VerifyArchive archive =
+            {
+                .pgVersion = pgData.version,
+                .pgSystemId = pgData.systemId,
+                .walSegmentSize = VERIFY_WAL_SEGMENT_SIZE_DEFAULT,
+            };
+
+            MEM_CONTEXT_BEGIN(lstMemContext(result))
+            {
+                archive.archiveId = strDup(archiveId);
+                archive.walSegmentSet = strSetNew();
+            }
+            MEM_CONTEXT_END();
+
+            // Get a sorted list of WAL directories in the archive id.  It is fine if the archive id does not exist -- no WAL has
+            // been pushed to it yet.
+            StringList *walDirList = strLstSort(
+                storageListP(
+                    storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strPtr(archiveId)),
+                    .expression = STRDEF(WAL_SEGMENT_DIR_REGEXP)),
+                sortOrderAsc);
+
+            // Has the WAL segment size been read from a segment yet?
+            bool walSegmentSizeFound = false;
+
+            for (unsigned int walDirIdx = 0; walDirIdx < strLstSize(walDirList); walDirIdx++)
+            {
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    const String *walDir = strLstGet(walDirList, walDirIdx);
+
+                    StringList *walFileList = strLstSort(
+                        storageListP(
+                            storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strPtr(archiveId), strPtr(walDir)),
+                            .expression = STRDEF(WAL_SEGMENT_FILE_REGEXP)),
+                        sortOrderAsc);
+
+                    for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(walFileList); walFileIdx++)
+                    {
+                        const String *walFile = strLstGet(walFileList, walFileIdx);
+                        const String *walSegment = strSubN(walFile, 0, WAL_SEGMENT_NAME_SIZE);
+                        const String *file = strNewFmt("%s/%s", strPtr(archiveId), strPtr(walFile));
+
+                        // The same segment should never be stored more than once
+                        if (!strSetAdd(archive.walSegmentSet, walSegment))
+                        {
+                            LOG_WARN("duplicate WAL segment '%s' in archive '%s'", strPtr(walSegment), strPtr(archiveId));
+                            state->errorTotal++;
+                        }
+
+                        const String *repoFile = strNewFmt(
+                            STORAGE_REPO_ARCHIVE "/%s/%s/%s", strPtr(archiveId), strPtr(walDir), strPtr(walFile));
+                        bool repoFileCompressed = strEndsWithZ(walFile, "." GZIP_EXT);
+
+                        // Get the WAL segment size from the first segment in the archive id
+                        if (archive.pgVersion >= PG_VERSION_11 && !walSegmentSizeFound)
+                        {
+                            archive.walSegmentSize = verifyWalSegmentSize(
+                                state, repoFile, repoFileCompressed, cipherType, infoArchiveCipherPass(infoArchive));
+                            walSegmentSizeFound = true;
+                        }
+
+                        // Verify the contents against the checksum embedded in the file name
+                        verifyJobAdd(
+                            state, file, repoFile, strSubN(walFile, WAL_SEGMENT_NAME_SIZE + 1, HASH_TYPE_SHA1_SIZE_HEX), false, 0,
+                            repoFileCompressed, cipherType, infoArchiveCipherPass(infoArchive));
+                    }
+                }
+                MEM_CONTEXT_TEMP_END();
+            }
+
+            LOG_INFO("verify archive '%s' (%u WAL segment(s))", strPtr(archiveId), strSetSize(archive.walSegmentSet));
+
+            lstAdd(result, &archive);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
+/***********************************************************************************************************************************
+Check that all the WAL required to make a backup consistent is in the archive
+***********************************************************************************************************************************/
+static void
+verifyBackupArchive(VerifyState *state, const InfoBackup *infoBackup, const InfoBackupData *backupData, const List *archiveList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, state);
+        FUNCTION_LOG_PARAM(INFO_BACKUP, infoBackup);
+        FUNCTION_LOG_PARAM_P(VOID, backupData);
+        FUNCTION_LOG_PARAM(LIST, archiveList);
+    FUNCTION_LOG_END();
+
+    ASSERT(state != NULL);
+    ASSERT(infoBackup != NULL);
+    ASSERT(backupData != NULL);
+    ASSERT(archiveList != NULL);
+
+    // Offline backups do not require WAL
+    if (backupData->backupArchiveStart != NULL && backupData->backupArchiveStop != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Get the archive id of the database the backup was taken from.  The archive and backup history share the same ids so
+            // the archive id must match exactly -- matching on version and system id could pick the wrong archive id when the
+            // same database appears more than once in the history, e.g. after a stanza upgrade is reverted.
+            const InfoPg *infoPg = infoBackupPg(infoBackup);
+            const String *archiveId = NULL;
+            const VerifyArchive *archive = NULL;
+
+            for (unsigned int pgIdx = 0; pgIdx < infoPgDataTotal(infoPg); pgIdx++)
+            {
+                if (infoPgData(infoPg, pgIdx).id == backupData->backupPgId)
+                {
+                    archiveId = infoPgArchiveId(infoPg, pgIdx);
+                    break;
+                }
+            }
+
+            for (unsigned int archiveIdx = 0; archiveIdx < lstSize(archiveList); archiveIdx++)
+            {
+                const VerifyArchive *archiveFind = lstGet(archiveList, archiveIdx);
+
+                if (strEq(archiveFind->archiveId, archiveId))
+                {
+                    archive = archiveFind;
+                    break;
+                }
+            }
+
+            if (archive == NULL)
+            {
+                LOG_WARN(
+                    "archive '%s' required by backup '%s' not found", archiveId == NULL ? "<unknown>" : strPtr(archiveId),
+                    strPtr(backupData->backupLabel));
+                state->errorTotal++;
+            }
+            else
+            {
+                // Check every segment from archive start to archive stop
+                unsigned int missingTotal = 0;
+                const String *walSegment = backupData->backupArchiveStart;
+
+                while (strCmp(walSegment, backupData->backupArchiveStop) <= 0)
+                {
+                    if (!strSetExists(archive->walSegmentSet, walSegment))
+                    {
+                        LOG_WARN(
+                            "WAL segment '%s' required by backup '%s' is missing from archive '%s'", strPtr(walSegment),
+                            strPtr(backupData->backupLabel), strPtr(archive->archiveId));
+                        missingTotal++;
+                    }
+
+                    walSegment = walSegmentNext(walSegment, archive->walSegmentSize, archive->pgVersion);
+                }
+
+                state->errorTotal += missingTotal;
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Load a text backup manifest and collect the files that are stored in the backup.  This is only required for backups that do not have
+a binary manifest, e.g. backups made before the binary manifest was added.
+***********************************************************************************************************************************/
+typedef struct VerifyManifestFile
+{
+    const String *name;                                             // File name in the manifest, e.g. pg_data/PG_VERSION
+    const String *checksum;                                         // Expected checksum
+    uint64_t size;                                                  // Expected size
+} VerifyManifestFile;
+
+typedef struct VerifyManifestLoadData
+{
+    const String *fileName;                                         // Manifest file name
+    const String *cipherPass;                                       // Passphrase to decrypt the manifest
+    List *fileList;                                                 // Files stored in this backup
+    const String *cipherPassFile;                                   // Passphrase to decrypt the backup files
+} VerifyManifestLoadData;
+
+static void
+verifyManifestLoadFileCallback(void *data, const String *section, const String *key, const String *value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, section);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(STRING, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(section != NULL);
+    ASSERT(key != NULL);
+    ASSERT(value != NULL);
+
+    VerifyManifestLoadData *loadData = (VerifyManifestLoadData *)data;
+
+    if (strEq(section, MANIFEST_SECTION_TARGET_FILE_STR))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const KeyValue *fileKv = jsonToKv(value);
+
+            // Files with a reference are stored in a prior backup and will be verified with that backup
+            if (kvGet(fileKv, VARSTR(MANIFEST_KEY_REFERENCE_STR)) == NULL)
+            {
+                VerifyManifestFile file = {.size = varUInt64Force(kvGet(fileKv, VARSTR(MANIFEST_KEY_SIZE_STR)))};
+                const Variant *checksum = kvGet(fileKv, VARSTR(MANIFEST_KEY_CHECKSUM_STR));
+
+                MEM_CONTEXT_BEGIN(lstMemContext(loadData->fileList))
+                {
+                    file.name = strDup(key);
+
+                    // Zero-length files do not have a checksum stored in the manifest
+                    file.checksum = checksum != NULL ? strDup(varStr(checksum)) : NULL;
+                }
+                MEM_CONTEXT_END();
+
+                lstAdd(loadData->fileList, &file);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static bool
+verifyManifestLoadCallback(void *data, unsigned int try)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(UINT, try);
+    FUNCTION_LOG_END();
+
+    ASSERT(data != NULL);
+
+    VerifyManifestLoadData *loadData = (VerifyManifestLoadData *)data;
+    bool result = false;
+
+    if (try < 2)
+    {
+        // Construct filename based on try
+        const String *fileName = try == 0 ? loadData->fileName : strNewFmt("%s" INFO_COPY_EXT, strPtr(loadData->fileName));
+
+        // Start with an empty file list in case a prior try loaded some files before failing
+        lstClear(loadData->fileList);
+
+        // Attempt to load the file
+        IoRead *read = storageReadIo(storageNewReadNP(storageRepo(), fileName));
+        cipherBlockFilterGroupAdd(
+            ioReadFilterGroup(read), cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeDecrypt, loadData->cipherPass);
+
+        MEM_CONTEXT_BEGIN(lstMemContext(loadData->fileList))
+        {
+            const String *cipherPassFile = infoCipherPass(infoNewLoad(read, verifyManifestLoadFileCallback, loadData));
+            loadData->cipherPassFile = cipherPassFile != NULL ? strDup(cipherPassFile) : NULL;
+        }
+        MEM_CONTEXT_END();
+
+        result = true;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/***********************************************************************************************************************************
+Load the binary manifest written by backup.  Returns NULL when the backup has no binary manifest or it was written on a host with a
+different byte order or record layout, in which case the text manifest must be loaded instead.
+***********************************************************************************************************************************/
+static ManifestBin *
+verifyManifestBinLoad(const String *fileName, const String *cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(fileName != NULL);
+
+    ManifestBin *result = NULL;
+
+    TRY_BEGIN()
+    {
+        // Map the manifest when the repo is local and not encrypted so it is not copied into memory
+        if (cipherPass == NULL && strEq(storageType(storageRepo()), STORAGE_POSIX_TYPE_STR))
+        {
+            if (storageExistsNP(storageRepo(), fileName))
+                result = manifestBinNewMap(storagePathNP(storageRepo(), fileName), true);
+        }
+        // Else read the manifest through decryption.  The buffer is not copied so it must remain in the calling context.
+        else
+        {
+            StorageRead *read = storageNewReadP(storageRepo(), fileName, .ignoreMissing = true);
+            cipherBlockFilterGroupAdd(
+                ioReadFilterGroup(storageReadIo(read)), cipherType(cfgOptionStr(cfgOptRepoCipherType)), cipherModeDecrypt,
+                cipherPass);
+
+            Buffer *buffer = storageGetNP(read);
+
+            if (buffer != NULL)
+                result = manifestBinNew(buffer);
+        }
+    }
+    CATCH(VersionNotSupportedError)
+    {
+        LOG_DETAIL("unable to use binary manifest '%s': %s", strPtr(storagePathNP(storageRepo(), fileName)), errorMessage());
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST_BIN, result);
+}
+
+/***********************************************************************************************************************************
+Add a job to verify a file stored in a backup
+***********************************************************************************************************************************/
+static void
+verifyBackupFile(
+    VerifyState *state, const InfoBackupData *backupData, const char *name, const String *checksum, uint64_t size,
+    CipherType cipherType, const String *cipherPass)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, state);
+        FUNCTION_TEST_PARAM_P(VOID, backupData);
+        FUNCTION_TEST_PARAM(STRINGZ, name);
+        FUNCTION_TEST_PARAM(STRING, checksum);
+        FUNCTION_TEST_PARAM(UINT64, size);
+        FUNCTION_TEST_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_TEST_END();
+
+    ASSERT(state != NULL);
+    ASSERT(backupData != NULL);
+    ASSERT(name != NULL);
+
+    // A file with contents must have a checksum
+    if (checksum == NULL && size != 0)
+    {
+        LOG_WARN("'%s/%s' has no checksum in the manifest", strPtr(backupData->backupLabel), name);
+        state->errorTotal++;
+    }
+    else
+    {
+        verifyJobAdd(
+            state, strNewFmt("%s/%s", strPtr(backupData->backupLabel), name),
+            strNewFmt(
+                STORAGE_REPO_BACKUP "/%s/%s%s", strPtr(backupData->backupLabel), name,
+                backupData->optionCompress ? "." GZIP_EXT : ""),
+            checksum != NULL ? checksum : HASH_TYPE_SHA1_ZERO_STR, true, size, backupData->optionCompress,
+            cipherPass != NULL ? cipherType : cipherTypeNone, cipherPass);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Verify the files stored in a backup
+***********************************************************************************************************************************/
+static void
+verifyBackup(VerifyState *state, const InfoBackup *infoBackup, const InfoBackupData *backupData, CipherType cipherType)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, state);
+        FUNCTION_LOG_PARAM(INFO_BACKUP, infoBackup);
+        FUNCTION_LOG_PARAM_P(VOID, backupData);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+    FUNCTION_LOG_END();
+
+    ASSERT(state != NULL);
+    ASSERT(infoBackup != NULL);
+    ASSERT(backupData != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *backupLabel = backupData->backupLabel;
+        const String *manifestFileName = strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_FILE, strPtr(backupLabel));
+
+        VerifyManifestLoadData loadData =
+        {
+            .fileName = manifestFileName,
+            .cipherPass = infoBackupCipherPass(infoBackup),
+            .fileList = lstNew(sizeof(VerifyManifestFile)),
+        };
+
+        // A missing or corrupt manifest is reported but does not stop the remaining backups from being verified
+        ManifestBin *manifest = NULL;
+        bool loaded = false;
+
+        TRY_BEGIN()
+        {
+            manifest = verifyManifestBinLoad(
+                strNewFmt(STORAGE_REPO_BACKUP "/%s/" MANIFEST_BIN_FILE, strPtr(backupLabel)), loadData.cipherPass);
+
+            if (manifest == NULL)
+            {
+                infoLoad(
+                    strNewFmt(
+                        "unable to load manifest '%s' or '%s" INFO_COPY_EXT "'",
+                        strPtr(storagePathNP(storageRepo(), manifestFileName)),
+                        strPtr(storagePathNP(storageRepo(), manifestFileName))),
+                    verifyManifestLoadCallback, &loadData);
+            }
+
+            loaded = true;
+        }
+        CATCH_ANY()
+        {
+            LOG_WARN("unable to verify backup '%s': %s", strPtr(backupLabel), errorMessage());
+            state->errorTotal++;
+        }
+        TRY_END();
+
+        // Files with a reference are stored in a prior backup and will be verified with that backup
+        if (manifest != NULL)
+        {
+            const String *cipherPassFile = manifestBinCipherPass(manifest) != NULL ? STR(manifestBinCipherPass(manifest)) : NULL;
+            unsigned int fileTotal = 0;
+
+            for (unsigned int fileIdx = 0; fileIdx < manifestBinFileTotal(manifest); fileIdx++)
+            {
+                if (manifestBinFile(manifest, fileIdx).reference == NULL)
+                    fileTotal++;
+            }
+
+            LOG_INFO("verify backup '%s' (%u file(s))", strPtr(backupLabel), fileTotal);
+
+            for (unsigned int fileIdx = 0; fileIdx < manifestBinFileTotal(manifest); fileIdx++)
+            {
+                const ManifestBinFile file = manifestBinFile(manifest, fileIdx);
+
+                if (file.reference == NULL)
+                {
+                    verifyBackupFile(
+                        state, backupData, file.name, file.checksum != NULL ? STR(file.checksum) : NULL, file.size, cipherType,
+                        cipherPassFile);
+                }
+            }
+        }
+        else if (loaded)
+        {
+            LOG_INFO("verify backup '%s' (%u file(s))", strPtr(backupLabel), lstSize(loadData.fileList));
+
+            for (unsigned int fileIdx = 0; fileIdx < lstSize(loadData.fileList); fileIdx++)
+            {
+                const VerifyManifestFile *file = lstGet(loadData.fileList, fileIdx);
+
+                verifyBackupFile(
+                    state, backupData, strPtr(file->name), file->checksum, file->size, cipherType, loadData.cipherPassFile);
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Verify the repository
+***********************************************************************************************************************************/
+void
+cmdVerify(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TimeMSec timeBegin = timeMSec();
+
+        // Get the repo storage in case it is remote and encryption settings need to be pulled down
+        storageRepo();
+
+        CipherType repoCipherType = cipherType(cfgOptionStr(cfgOptRepoCipherType));
+
+        // Load the info files
+        InfoArchive *infoArchive = infoArchiveLoadFile(
+            storageRepo(), INFO_ARCHIVE_PATH_FILE_STR, repoCipherType, cfgOptionStr(cfgOptRepoCipherPass));
+        InfoBackup *infoBackup = infoBackupLoadFile(
+            storageRepo(), INFO_BACKUP_PATH_FILE_STR, repoCipherType, cfgOptionStr(cfgOptRepoCipherPass));
+
+        VerifyState state =
+        {
+            .memContext = MEM_CONTEXT_TEMP(),
+            .jobMax = cfgOptionUInt(cfgOptProcessMax) * VERIFY_JOB_QUEUE_PER_PROCESS,
+        };
+
+        // Verify the archive first so the segments found can be used to check each backup
+        List *archiveList = verifyArchive(&state, infoArchive, repoCipherType);
+
+        // Verify backups
+        for (unsigned int backupIdx = 0; backupIdx < infoBackupDataTotal(infoBackup); backupIdx++)
+        {
+            InfoBackupData backupData = infoBackupData(infoBackup, backupIdx);
+
+            verifyBackupArchive(&state, infoBackup, &backupData, archiveList);
+            verifyBackup(&state, infoBackup, &backupData, repoCipherType);
+        }
+
+        // Process all remaining jobs
+        verifyJobProcess(&state, 0);
+
+        // Report results
+        TimeMSec timeElapsed = timeMSec() - timeBegin;
+
+        LOG_INFO(
+            "verified %u file(s), %s in %.3fs (%s/s)", state.fileTotal, strPtr(strSizeFormat(state.sizeTotal)),
+            (double)timeElapsed / MSEC_PER_SEC,
+            strPtr(strSizeFormat(timeElapsed == 0 ? state.sizeTotal : state.sizeTotal * MSEC_PER_SEC / timeElapsed)));
+
+        if (state.errorTotal > 0)
+            THROW_FMT(RepoInvalidError, "verify found %u error(s) in the repository", state.errorTotal);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
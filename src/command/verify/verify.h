@@ -0,0 +1,12 @@
+/***********************************************************************************************************************************
+Verify Command
+***********************************************************************************************************************************/
+#ifndef COMMAND_VERIFY_VERIFY_H
+#define COMMAND_VERIFY_VERIFY_H
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+void cmdVerify(void);
+
+#endif
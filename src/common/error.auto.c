@@ -84,6 +84,7 @@ ERROR_DEFINE( 99, JsonFormatError, RuntimeError);
 ERROR_DEFINE(100, KernelError, RuntimeError);
 ERROR_DEFINE(101, ServiceError, RuntimeError);
 ERROR_DEFINE(102, ExecuteError, RuntimeError);
+ERROR_DEFINE(103, RepoInvalidError, RuntimeError);
 ERROR_DEFINE(122, RuntimeError, RuntimeError);
 ERROR_DEFINE(123, InvalidError, RuntimeError);
 ERROR_DEFINE(124, UnhandledError, RuntimeError);
@@ -171,6 +172,7 @@ static const ErrorType *errorTypeList[] =
     &KernelError,
     &ServiceError,
     &ExecuteError,
+    &RepoInvalidError,
     &RuntimeError,
     &InvalidError,
     &UnhandledError,
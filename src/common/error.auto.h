@@ -86,6 +86,7 @@ ERROR_DECLARE(JsonFormatError);
 ERROR_DECLARE(KernelError);
 ERROR_DECLARE(ServiceError);
 ERROR_DECLARE(ExecuteError);
+ERROR_DECLARE(RepoInvalidError);
 ERROR_DECLARE(RuntimeError);
 ERROR_DECLARE(InvalidError);
 ERROR_DECLARE(UnhandledError);
@@ -3,6 +3,7 @@ Execute Process
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,6 +22,26 @@ Execute Process
 #include "common/object.h"
 #include "common/wait.h"
 
+/***********************************************************************************************************************************
+Size requested for the pipes that carry data to and from the process.  With the default size (64KiB on Linux) the processes take
+turns many more times to move the same data, which costs a context switch each time.  1MiB is the default maximum size for
+unprivileged processes on Linux.
+
+Enlarged pipes count against the pages of pipe buffer a user may have before new pipes are limited to a single page, which is shared
+with every other process of the user, e.g. PostgreSQL.  The size is scaled down so the pipes of all processes that may run at once
+use no more than half of the limit, and pipes are never made smaller than the default.
+***********************************************************************************************************************************/
+#define EXEC_PIPE_SIZE                                              (1024 * 1024)
+#define EXEC_PIPE_SIZE_DEFAULT                                      (64 * 1024)
+
+// File containing the per-user limit in pages.  It does not exist before Linux 4.5 and zero means there is no limit.
+#define EXEC_PIPE_USER_PAGES_SOFT_FILE                              "/proc/sys/fs/pipe-user-pages-soft"
+
+// Pipes enlarged for each process, i.e. read and write pipes to a local process and from the local process to its remote
+#define EXEC_PIPE_PROCESS_TOTAL                                     4
+
+static unsigned int execProcessMax = 1;
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -297,6 +318,57 @@ execHandleRead(const THIS_VOID)
     FUNCTION_TEST_RETURN(this->handleRead);
 }
 
+/***********************************************************************************************************************************
+Set the number of processes that may run at once
+***********************************************************************************************************************************/
+void
+execProcessMaxSet(unsigned int processMax)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, processMax);
+    FUNCTION_TEST_END();
+
+    ASSERT(processMax > 0);
+
+    execProcessMax = processMax;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the pipe size within the per-user limit.  The size is a power of two since the kernel rounds the requested size up to one.
+***********************************************************************************************************************************/
+static size_t
+execPipeSize(void)
+{
+    FUNCTION_TEST_VOID();
+
+    size_t result = EXEC_PIPE_SIZE;
+    int fd = open(EXEC_PIPE_USER_PAGES_SOFT_FILE, O_RDONLY);
+
+    if (fd != -1)
+    {
+        char buffer[32];
+        ssize_t size = read(fd, buffer, sizeof(buffer) - 1);
+
+        close(fd);
+
+        if (size > 0)
+        {
+            buffer[size] = '\0';
+
+            size_t limit =
+                (size_t)strtoull(buffer, NULL, 10) * (size_t)sysconf(_SC_PAGESIZE) / 2 /
+                (execProcessMax * EXEC_PIPE_PROCESS_TOTAL);
+
+            while (limit > 0 && result > limit)
+                result /= 2;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Execute command
 ***********************************************************************************************************************************/
@@ -319,6 +391,18 @@ execOpen(Exec *this)
     THROW_ON_SYS_ERROR(pipe(pipeWrite) == -1, KernelError, "unable to create write pipe");
     THROW_ON_SYS_ERROR(pipe(pipeError) == -1, KernelError, "unable to create error pipe");
 
+    // Enlarge the pipes that carry data where supported.  Errors are ignored since a pipe keeps its size when the request fails, e.g.
+    // when the user is already over the limit.
+#ifdef F_SETPIPE_SZ
+    size_t pipeSize = execPipeSize();
+
+    if (pipeSize > EXEC_PIPE_SIZE_DEFAULT)
+    {
+        fcntl(pipeRead[0], F_SETPIPE_SZ, (int)pipeSize);
+        fcntl(pipeWrite[0], F_SETPIPE_SZ, (int)pipeSize);
+    }
+#endif
+
     // Fork the subprocess
     this->processId = fork();
 
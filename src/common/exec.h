@@ -31,6 +31,9 @@ Functions
 ***********************************************************************************************************************************/
 void execOpen(Exec *this);
 
+// Set the number of processes that may run at once so the pipes can be sized to stay within the per-user limit
+void execProcessMaxSet(unsigned int processMax);
+
 /***********************************************************************************************************************************
 Getters
 ***********************************************************************************************************************************/
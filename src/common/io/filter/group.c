@@ -214,7 +214,7 @@ ioFilterGroupOpen(IoFilterGroup *this)
             // will be provided to the process function.
             if (ioFilterOutput(filterData->filter) && filterIdx < ioFilterGroupSize(this) - 1)
             {
-                filterData->output = bufNew(ioBufferSize());
+                filterData->output = ioBufferPoolGet();
                 lastOutputBuffer = &filterData->output;
             }
         }
@@ -391,7 +391,26 @@ ioFilterGroupClose(IoFilterGroup *this)
         MEM_CONTEXT_TEMP_END();
     }
 
-    // Filter group is open
+    // Return local buffers to the pool.  Consecutive filters share the same local input buffer when input filters follow an output
+    // filter so only return each buffer once.
+    Buffer *inputLocalLast = NULL;
+
+    for (unsigned int filterIdx = 0; filterIdx < ioFilterGroupSize(this); filterIdx++)
+    {
+        IoFilterData *filterData = ioFilterGroupGet(this, filterIdx);
+
+        if (filterData->inputLocal != NULL && filterData->inputLocal != inputLocalLast)
+        {
+            inputLocalLast = filterData->inputLocal;
+            ioBufferPoolPut(filterData->inputLocal);
+        }
+
+        filterData->input = NULL;
+        filterData->inputLocal = NULL;
+        filterData->output = NULL;
+    }
+
+    // Filter group is closed
 #ifdef DEBUG
     this->closed = true;
 #endif
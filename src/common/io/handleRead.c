@@ -3,7 +3,9 @@ Handle IO Read
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
-#include <sys/select.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 
 #include "common/debug.h"
@@ -33,6 +35,39 @@ Macros for function logging
 #define FUNCTION_LOG_IO_HANDLE_READ_FORMAT(value, buffer, bufferSize)                                                              \
     objToLog(value, "IoHandleRead", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Wait for data to be available on the handle
+***********************************************************************************************************************************/
+static void
+ioHandleReadWait(IoHandleRead *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_HANDLE_READ, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Use poll() since it does not limit the value of the handle like select() does.  Retry if interrupted by a signal, which may
+    // extend the timeout but is simpler than tracking the time remaining.
+    struct pollfd pollHandle = {.fd = this->handle, .events = POLLIN};
+    int result;
+
+    do
+    {
+        result = poll(&pollHandle, 1, (int)this->timeout);
+    }
+    while (result == -1 && errno == EINTR);
+
+    THROW_ON_SYS_ERROR_FMT(                                         // {uncoverable_branch - poll() does not fail on a valid handle}
+        result == -1, FileReadError, "unable to poll %s", strPtr(this->name));
+
+    // If no data read after time allotted then error
+    if (!result)
+        THROW_FMT(FileReadError, "unable to read data from %s after %" PRIu64 "ms", strPtr(this->name), this->timeout);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Read data from the handle
 ***********************************************************************************************************************************/
@@ -58,30 +93,12 @@ ioHandleRead(THIS_VOID, Buffer *buffer, bool block)
     {
         do
         {
-            // Initialize the file descriptor set used for select
-            fd_set selectSet;
-            FD_ZERO(&selectSet);
-
-            // We know the handle is not negative because it passed error handling, so it is safe to cast to unsigned
-            FD_SET((unsigned int)this->handle, &selectSet);
+            // The handle is non-blocking so read before waiting.  This saves a system call per read when data is streaming.
+            while ((actualBytes = read(this->handle, bufRemainsPtr(buffer), bufRemains(buffer))) == -1 && errno == EAGAIN)
+                ioHandleReadWait(this);
 
-            // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
-            struct timeval timeoutSelect;
-            timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
-            timeoutSelect.tv_usec = (time_t)(this->timeout % MSEC_PER_SEC * 1000);
-
-            // Determine if there is data to be read
-            int result = select(this->handle + 1, &selectSet, NULL, NULL, &timeoutSelect);
-            THROW_ON_SYS_ERROR_FMT(result == -1, FileReadError, "unable to select from %s", strPtr(this->name));
-
-            // If no data read after time allotted then error
-            if (!result)
-                THROW_FMT(FileReadError, "unable to read data from %s after %" PRIu64 "ms", strPtr(this->name), this->timeout);
-
-            // Read and handle errors
-            THROW_ON_SYS_ERROR_FMT(
-                (actualBytes = read(this->handle, bufRemainsPtr(buffer), bufRemains(buffer))) == -1, FileReadError,
-                "unable to read from %s", strPtr(this->name));
+            // Handle read errors
+            THROW_ON_SYS_ERROR_FMT(actualBytes == -1, FileReadError, "unable to read from %s", strPtr(this->name));
 
             // Update amount of buffer used
             bufUsedInc(buffer, (size_t)actualBytes);
@@ -152,6 +169,13 @@ ioHandleReadNew(const String *name, int handle, TimeMSec timeout)
         driver->handle = handle;
         driver->timeout = timeout;
 
+        // Make the handle non-blocking so a read can be attempted before waiting for data
+        int flags = fcntl(handle, F_GETFL);
+
+        THROW_ON_SYS_ERROR_FMT(
+            flags == -1 || fcntl(handle, F_SETFL, flags | O_NONBLOCK) == -1, FileOpenError, "unable to set %s non-blocking",
+            strPtr(name));
+
         this = ioReadNewP(driver, .block = true, .eof = ioHandleReadEof, .handle = ioHandleReadHandle, .read = ioHandleRead);
     }
     MEM_CONTEXT_NEW_END();
@@ -3,6 +3,8 @@ Handle IO Write
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <errno.h>
+#include <poll.h>
 #include <unistd.h>
 
 #include "common/debug.h"
@@ -46,8 +48,36 @@ ioHandleWrite(THIS_VOID, const Buffer *buffer)
     ASSERT(this != NULL);
     ASSERT(buffer != NULL);
 
-    THROW_ON_SYS_ERROR_FMT(
-        write(this->handle, bufPtr(buffer), bufUsed(buffer)) == -1, FileWriteError, "unable to write to %s", strPtr(this->name));
+    // Write until all bytes have been written.  A write may be partial when the handle is non-blocking, which happens when the
+    // handle shares a file description with a read handle, e.g. a socket used for both stdin and stdout.
+    size_t written = 0;
+
+    do
+    {
+        ssize_t actualBytes = write(this->handle, bufPtr(buffer) + written, bufUsed(buffer) - written);
+
+        // Wait until the handle is writable.  Retry if interrupted by a signal.
+        if (actualBytes == -1 && errno == EAGAIN)
+        {
+            struct pollfd pollHandle = {.fd = this->handle, .events = POLLOUT};
+            int result;
+
+            do
+            {
+                result = poll(&pollHandle, 1, -1);
+            }
+            while (result == -1 && errno == EINTR);
+
+            THROW_ON_SYS_ERROR_FMT(                                 // {uncoverable_branch - poll() does not fail on a valid handle}
+                result == -1, FileWriteError, "unable to poll %s", strPtr(this->name));
+            continue;
+        }
+
+        THROW_ON_SYS_ERROR_FMT(actualBytes == -1, FileWriteError, "unable to write to %s", strPtr(this->name));
+
+        written += (size_t)actualBytes;
+    }
+    while (written < bufUsed(buffer));
 
     FUNCTION_LOG_RETURN_VOID();
 }
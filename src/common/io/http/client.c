@@ -11,6 +11,7 @@ Http Client
 #include "common/io/tls/client.h"
 #include "common/log.h"
 #include "common/object.h"
+#include "common/stat.h"
 #include "common/wait.h"
 
 /***********************************************************************************************************************************
@@ -46,6 +47,25 @@ Statistics
 ***********************************************************************************************************************************/
 static HttpClientStat httpClientStatLocal;
 
+STRING_STATIC(HTTP_STAT_REQUEST_MS_STR,                             "http.request.ms");
+STRING_STATIC(HTTP_STAT_RETRY_STR,                                  "http.retry");
+
+/***********************************************************************************************************************************
+Request written by httpClientRequestWrite() that is waiting for httpClientResponseRead().  A copy of the request is kept so it can
+be retried.
+***********************************************************************************************************************************/
+typedef struct HttpClientRequestPending
+{
+    MemContext *memContext;                                         // Mem context
+    const String *verb;                                             // Verb (GET, PUT, etc.)
+    const String *uri;                                              // Uri
+    const String *query;                                            // Rendered query (NULL when there is no query)
+    const HttpHeader *header;                                       // Request headers
+    const Buffer *body;                                             // Request body
+    bool error;                                                     // Did the write fail?
+    TimeMSec timeBegin;                                             // Time the request was written
+} HttpClientRequestPending;
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -56,6 +76,7 @@ struct HttpClient
 
     TlsClient *tls;                                                 // Tls client
     IoRead *ioRead;                                                 // Read io interface
+    HttpClientRequestPending *pending;                              // Request waiting for the response to be read
 
     unsigned int responseCode;                                      // Response code (e.g. 200, 404)
     String *responseMessage;                                        // Response message e.g. (OK, Not Found)
@@ -198,7 +219,7 @@ httpClientNew(
         this->memContext = MEM_CONTEXT_NEW();
 
         this->timeout = timeout;
-        this->tls = tlsClientNew(host, port, timeout, verifyPeer, caFile, caPath);
+        this->tls = tlsClientNew(host, port, timeout, verifyPeer, caFile, caPath, NULL, NULL);
 
         httpClientStatLocal.object++;
     }
@@ -208,224 +229,283 @@ httpClientNew(
 }
 
 /***********************************************************************************************************************************
-Perform a request
+Write a request
 ***********************************************************************************************************************************/
-Buffer *
-httpClientRequest(
-    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
-    const Buffer *body, bool returnContent)
+static void
+httpClientRequestWriteInternal(
+    HttpClient *this, const String *verb, const String *uri, const String *query, const HttpHeader *requestHeader,
+    const Buffer *body)
 {
-    FUNCTION_LOG_BEGIN(logLevelDebug)
+    FUNCTION_LOG_BEGIN(logLevelTrace)
         FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
         FUNCTION_LOG_PARAM(STRING, verb);
         FUNCTION_LOG_PARAM(STRING, uri);
-        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(STRING, query);
         FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
         FUNCTION_LOG_PARAM(BUFFER, body);
-        FUNCTION_LOG_PARAM(BOOL, returnContent);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(verb != NULL);
     ASSERT(uri != NULL);
+    ASSERT(this->ioRead == NULL);
 
-    // Buffer for returned content
-    Buffer *result = NULL;
+    // Free response status left over from the last request
+    httpHeaderFree(this->responseHeader);
+    this->responseHeader = NULL;
+    strFree(this->responseMessage);
+    this->responseMessage = NULL;
+
+    // Reset all content info
+    this->contentChunked = false;
+    this->contentSize = 0;
+    this->contentRemaining = 0;
+    this->closeOnContentEof = false;
+    this->contentEof = true;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        bool complete = false;
-        bool retry;
-        Wait *wait = this->timeout > 0 ? waitNew(this->timeout) : NULL;
-
-        do
+        if (tlsClientOpen(this->tls))
+            httpClientStatLocal.session++;
+
+        // Write the request
+        ioWriteStrLine(
+            tlsClientIoWrite(this->tls),
+            strNewFmt(
+                "%s %s%s%s " HTTP_VERSION "\r", strPtr(verb), strPtr(httpUriEncode(uri, true)), query == NULL ? "" : "?",
+                query == NULL ? "" : strPtr(query)));
+
+        // Write headers
+        if (requestHeader != NULL)
         {
-            // Assume there will be no retry
-            retry = false;
+            const StringList *headerList = httpHeaderList(requestHeader);
 
-            // Free the read interface
-            httpClientDone(this);
+            for (unsigned int headerIdx = 0; headerIdx < strLstSize(headerList); headerIdx++)
+            {
+                const String *headerKey = strLstGet(headerList, headerIdx);
+                ioWriteStrLine(
+                    tlsClientIoWrite(this->tls),
+                    strNewFmt("%s:%s\r", strPtr(headerKey), strPtr(httpHeaderGet(requestHeader, headerKey))));
+            }
+        }
 
-            // Free response status left over from the last request
-            httpHeaderFree(this->responseHeader);
-            this->responseHeader = NULL;
-            strFree(this->responseMessage);
-            this->responseMessage = NULL;
+        // Write out blank line to end the headers
+        ioWriteLine(tlsClientIoWrite(this->tls), CR_BUF);
 
-            // Reset all content info
-            this->contentChunked = false;
-            this->contentSize = 0;
-            this->contentRemaining = 0;
-            this->closeOnContentEof = false;
-            this->contentEof = true;
+        // Write out body if any
+        if (body != NULL)
+            ioWrite(tlsClientIoWrite(this->tls), body);
 
-            TRY_BEGIN()
-            {
-                if (tlsClientOpen(this->tls))
-                    httpClientStatLocal.session++;
+        // Flush all writes
+        ioWriteFlush(tlsClientIoWrite(this->tls));
+    }
+    MEM_CONTEXT_TEMP_END();
 
-                // Write the request
-                String *queryStr = httpQueryRender(query);
+    FUNCTION_LOG_RETURN_VOID();
+}
 
-                ioWriteStrLine(
-                    tlsClientIoWrite(this->tls),
-                    strNewFmt(
-                        "%s %s%s%s " HTTP_VERSION "\r", strPtr(verb), strPtr(httpUriEncode(uri, true)), queryStr == NULL ? "" : "?",
-                        queryStr == NULL ? "" : strPtr(queryStr)));
+/***********************************************************************************************************************************
+Read the response to a request
+***********************************************************************************************************************************/
+static Buffer *
+httpClientResponseReadInternal(HttpClient *this, const String *verb, bool returnContent)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+    FUNCTION_LOG_END();
 
-                // Write headers
-                if (requestHeader != NULL)
-                {
-                    const StringList *headerList = httpHeaderList(requestHeader);
-
-                    for (unsigned int headerIdx = 0; headerIdx < strLstSize(headerList); headerIdx++)
-                    {
-                        const String *headerKey = strLstGet(headerList, headerIdx);
-                        ioWriteStrLine(
-                            tlsClientIoWrite(this->tls),
-                            strNewFmt("%s:%s\r", strPtr(headerKey), strPtr(httpHeaderGet(requestHeader, headerKey))));
-                    }
-                }
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
 
-                // Write out blank line to end the headers
-                ioWriteLine(tlsClientIoWrite(this->tls), CR_BUF);
+    // Buffer for returned content
+    Buffer *result = NULL;
 
-                // Write out body if any
-                if (body != NULL)
-                    ioWrite(tlsClientIoWrite(this->tls), body);
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Read status and make sure it starts with the correct http version
+        String *status = strTrim(ioReadLine(tlsClientIoRead(this->tls)));
 
-                // Flush all writes
-                ioWriteFlush(tlsClientIoWrite(this->tls));
+        if (!strBeginsWith(status, HTTP_VERSION_STR))
+            THROW_FMT(FormatError, "http version of response '%s' must be " HTTP_VERSION, strPtr(status));
 
-                // Read status and make sure it starts with the correct http version
-                String *status = strTrim(ioReadLine(tlsClientIoRead(this->tls)));
+        // Now read the response code and message
+        status = strSub(status, sizeof(HTTP_VERSION));
 
-                if (!strBeginsWith(status, HTTP_VERSION_STR))
-                    THROW_FMT(FormatError, "http version of response '%s' must be " HTTP_VERSION, strPtr(status));
+        int spacePos = strChr(status, ' ');
 
-                // Now read the response code and message
-                status = strSub(status, sizeof(HTTP_VERSION));
+        if (spacePos < 0)
+            THROW_FMT(FormatError, "response status '%s' must have a space", strPtr(status));
 
-                int spacePos = strChr(status, ' ');
+        this->responseCode = cvtZToUInt(strPtr(strTrim(strSubN(status, 0, (size_t)spacePos))));
 
-                if (spacePos < 0)
-                    THROW_FMT(FormatError, "response status '%s' must have a space", strPtr(status));
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->responseMessage = strSub(status, (size_t)spacePos + 1);
+        }
+        MEM_CONTEXT_END();
 
-                this->responseCode = cvtZToUInt(strPtr(strTrim(strSubN(status, 0, (size_t)spacePos))));
+        // Read headers
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->responseHeader = httpHeaderNew(NULL);
+        }
+        MEM_CONTEXT_END();
 
-                MEM_CONTEXT_BEGIN(this->memContext)
-                {
-                    this->responseMessage = strSub(status, (size_t)spacePos + 1);
-                }
-                MEM_CONTEXT_END();
+        do
+        {
+            // Read the next header
+            String *header = strTrim(ioReadLine(tlsClientIoRead(this->tls)));
 
-                // Read headers
-                MEM_CONTEXT_BEGIN(this->memContext)
-                {
-                    this->responseHeader = httpHeaderNew(NULL);
-                }
-                MEM_CONTEXT_END();
+            // If the header is empty then we have reached the end of the headers
+            if (strSize(header) == 0)
+                break;
 
-                do
-                {
-                    // Read the next header
-                    String *header = strTrim(ioReadLine(tlsClientIoRead(this->tls)));
-
-                    // If the header is empty then we have reached the end of the headers
-                    if (strSize(header) == 0)
-                        break;
-
-                    // Split the header and store it
-                    int colonPos = strChr(header, ':');
-
-                    if (colonPos < 0)
-                        THROW_FMT(FormatError, "header '%s' missing colon", strPtr(strTrim(header)));
-
-                    String *headerKey = strLower(strTrim(strSubN(header, 0, (size_t)colonPos)));
-                    String *headerValue = strTrim(strSub(header, (size_t)colonPos + 1));
-
-                    httpHeaderAdd(this->responseHeader, headerKey, headerValue);
-
-                    // Read transfer encoding (only chunked is supported)
-                    if (strEq(headerKey, HTTP_HEADER_TRANSFER_ENCODING_STR))
-                    {
-                        // Error if transfer encoding is not chunked
-                        if (!strEq(headerValue, HTTP_VALUE_TRANSFER_ENCODING_CHUNKED_STR))
-                        {
-                            THROW_FMT(
-                                FormatError, "only '%s' is supported for '%s' header", HTTP_VALUE_TRANSFER_ENCODING_CHUNKED,
-                                HTTP_HEADER_TRANSFER_ENCODING);
-                        }
-
-                        this->contentChunked = true;
-                    }
-
-                    // Read content size
-                    if (strEq(headerKey, HTTP_HEADER_CONTENT_LENGTH_STR))
-                    {
-                        this->contentSize = cvtZToUInt64(strPtr(headerValue));
-                        this->contentRemaining = this->contentSize;
-                    }
-
-                    // If the server notified of a closed connection then close the client connection after reading content.  This
-                    // prevents doing a retry on the next request when using the closed connection.
-                    if (strEq(headerKey, HTTP_HEADER_CONNECTION_STR) && strEq(headerValue, HTTP_VALUE_CONNECTION_CLOSE_STR))
-                    {
-                        this->closeOnContentEof = true;
-                        httpClientStatLocal.close++;
-                    }
-                }
-                while (1);
+            // Split the header and store it
+            int colonPos = strChr(header, ':');
+
+            if (colonPos < 0)
+                THROW_FMT(FormatError, "header '%s' missing colon", strPtr(strTrim(header)));
+
+            String *headerKey = strLower(strTrim(strSubN(header, 0, (size_t)colonPos)));
+            String *headerValue = strTrim(strSub(header, (size_t)colonPos + 1));
 
-                // Error if transfer encoding and content length are both set
-                if (this->contentChunked && this->contentSize > 0)
+            httpHeaderAdd(this->responseHeader, headerKey, headerValue);
+
+            // Read transfer encoding (only chunked is supported)
+            if (strEq(headerKey, HTTP_HEADER_TRANSFER_ENCODING_STR))
+            {
+                // Error if transfer encoding is not chunked
+                if (!strEq(headerValue, HTTP_VALUE_TRANSFER_ENCODING_CHUNKED_STR))
                 {
                     THROW_FMT(
-                        FormatError,  "'%s' and '%s' headers are both set", HTTP_HEADER_TRANSFER_ENCODING,
-                        HTTP_HEADER_CONTENT_LENGTH);
+                        FormatError, "only '%s' is supported for '%s' header", HTTP_VALUE_TRANSFER_ENCODING_CHUNKED,
+                        HTTP_HEADER_TRANSFER_ENCODING);
                 }
 
-                // Was content returned in the response?  HEAD will report content but not actually return any.
-                bool contentExists = (this->contentChunked || this->contentSize > 0) && !strEq(verb, HTTP_VERB_HEAD_STR);
-                this->contentEof = !contentExists;
+                this->contentChunked = true;
+            }
 
-                // If all content should be returned from this function then read the buffer.  Also read the response if there has
-                // been an error.
-                if (returnContent || !httpClientResponseCodeOk(this))
-                {
-                    if (contentExists)
-                    {
-                        result = bufNew(0);
-
-                        do
-                        {
-                            bufResize(result, bufSize(result) + ioBufferSize());
-                            httpClientRead(this, result, true);
-                        }
-                        while (!httpClientEof(this));
-                    }
-                }
-                // Else create an io object, even if there is no content.  This makes the logic for readers easier -- they can just
-                // check eof rather than also checking if the io object exists.
-                else
+            // Read content size
+            if (strEq(headerKey, HTTP_HEADER_CONTENT_LENGTH_STR))
+            {
+                this->contentSize = cvtZToUInt64(strPtr(headerValue));
+                this->contentRemaining = this->contentSize;
+            }
+
+            // If the server notified of a closed connection then close the client connection after reading content.  This
+            // prevents doing a retry on the next request when using the closed connection.
+            if (strEq(headerKey, HTTP_HEADER_CONNECTION_STR) && strEq(headerValue, HTTP_VALUE_CONNECTION_CLOSE_STR))
+            {
+                this->closeOnContentEof = true;
+                httpClientStatLocal.close++;
+            }
+        }
+        while (1);
+
+        // Error if transfer encoding and content length are both set
+        if (this->contentChunked && this->contentSize > 0)
+        {
+            THROW_FMT(
+                FormatError,  "'%s' and '%s' headers are both set", HTTP_HEADER_TRANSFER_ENCODING,
+                HTTP_HEADER_CONTENT_LENGTH);
+        }
+
+        // Was content returned in the response?  HEAD will report content but not actually return any.
+        bool contentExists = (this->contentChunked || this->contentSize > 0) && !strEq(verb, HTTP_VERB_HEAD_STR);
+        this->contentEof = !contentExists;
+
+        // If all content should be returned from this function then read the buffer.  Also read the response if there has
+        // been an error.
+        if (returnContent || !httpClientResponseCodeOk(this))
+        {
+            if (contentExists)
+            {
+                result = bufNew(0);
+
+                do
                 {
-                    MEM_CONTEXT_BEGIN(this->memContext)
-                    {
-                        this->ioRead = ioReadNewP(this, .eof = httpClientEof, .read = httpClientRead);
-                        ioReadOpen(this->ioRead);
-                    }
-                    MEM_CONTEXT_END();
+                    bufResize(result, bufSize(result) + ioBufferSize());
+                    httpClientRead(this, result, true);
                 }
+                while (!httpClientEof(this));
+            }
+        }
+        // Else create an io object, even if there is no content.  This makes the logic for readers easier -- they can just
+        // check eof rather than also checking if the io object exists.
+        else
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->ioRead = ioReadNewP(this, .eof = httpClientEof, .read = httpClientRead);
+                ioReadOpen(this->ioRead);
+            }
+            MEM_CONTEXT_END();
+        }
+
+        // If the server notified that it would close the connection and there is no content then close the client side
+        if (this->closeOnContentEof && !contentExists)
+            tlsClientClose(this->tls);
+
+        // Retry when response code is 5xx.  These errors generally represent a server error for a request that looks valid.
+        // There are a few errors that might be permanently fatal but they are rare and it seems best not to try and pick
+        // and choose errors in this class to retry.
+        if (httpClientResponseCode(this) / 100 == HTTP_RESPONSE_CODE_RETRY_CLASS)
+            THROW_FMT(ServiceError, "[%u] %s", httpClientResponseCode(this), strPtr(httpClientResponseMessage(this)));
+
+        // Move the result buffer (if any) to the calling context
+        bufMove(result, MEM_CONTEXT_OLD());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/***********************************************************************************************************************************
+Perform a request with retries
+***********************************************************************************************************************************/
+static Buffer *
+httpClientRequestInternal(
+    HttpClient *this, const String *verb, const String *uri, const String *query, const HttpHeader *requestHeader,
+    const Buffer *body, bool returnContent, TimeMSec timeBegin)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(STRING, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeBegin);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+
+    // Buffer for returned content
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        bool complete = false;
+        bool retry;
+        Wait *wait = this->timeout > 0 ? waitNew(this->timeout) : NULL;
+
+        do
+        {
+            // Assume there will be no retry
+            retry = false;
 
-                // If the server notified that it would close the connection and there is no content then close the client side
-                if (this->closeOnContentEof && !contentExists)
-                    tlsClientClose(this->tls);
+            TRY_BEGIN()
+            {
+                // Free the read interface
+                httpClientDone(this);
 
-                // Retry when response code is 5xx.  These errors generally represent a server error for a request that looks valid.
-                // There are a few errors that might be permanently fatal but they are rare and it seems best not to try and pick
-                // and choose errors in this class to retry.
-                if (httpClientResponseCode(this) / 100 == HTTP_RESPONSE_CODE_RETRY_CLASS)
-                    THROW_FMT(ServiceError, "[%u] %s", httpClientResponseCode(this), strPtr(httpClientResponseMessage(this)));
+                httpClientRequestWriteInternal(this, verb, uri, query, requestHeader, body);
+                result = httpClientResponseReadInternal(this, verb, returnContent);
 
                 // Request was successful
                 complete = true;
@@ -439,6 +519,7 @@ httpClientRequest(
                     retry = true;
 
                     httpClientStatLocal.retry++;
+                    statInc(HTTP_STAT_RETRY_STR);
                 }
 
                 tlsClientClose(this->tls);
@@ -454,6 +535,175 @@ httpClientRequest(
         bufMove(result, MEM_CONTEXT_OLD());
 
         httpClientStatLocal.request++;
+        statTimeAdd(HTTP_STAT_REQUEST_MS_STR, timeBegin);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/***********************************************************************************************************************************
+Perform a request
+***********************************************************************************************************************************/
+Buffer *
+httpClientRequest(
+    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
+    const Buffer *body, bool returnContent)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+    ASSERT(this->pending == NULL);
+
+    // Buffer for returned content
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        result = httpClientRequestInternal(
+            this, verb, uri, httpQueryRender(query), requestHeader, body, returnContent, timeMSec());
+        bufMove(result, MEM_CONTEXT_OLD());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/***********************************************************************************************************************************
+Write a request without reading the response
+***********************************************************************************************************************************/
+void
+httpClientRequestWrite(
+    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
+    const Buffer *body)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+    ASSERT(this->pending == NULL);
+
+    // Free the read interface
+    httpClientDone(this);
+
+    // Copy the request so it can be retried
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        MEM_CONTEXT_NEW_BEGIN("HttpClientRequestPending")
+        {
+            this->pending = memNew(sizeof(HttpClientRequestPending));
+
+            *this->pending = (HttpClientRequestPending)
+            {
+                .memContext = MEM_CONTEXT_NEW(),
+                .verb = strDup(verb),
+                .uri = strDup(uri),
+                .query = httpQueryRender(query),
+                .header = httpHeaderDup(requestHeader, NULL),
+                .body = body == NULL ? NULL : bufDup(body),
+                .timeBegin = timeMSec(),
+            };
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+    MEM_CONTEXT_END();
+
+    // Errors are not reported until the response is read so the request can be retried then
+    TRY_BEGIN()
+    {
+        httpClientRequestWriteInternal(
+            this, this->pending->verb, this->pending->uri, this->pending->query, this->pending->header, this->pending->body);
+    }
+    CATCH_ANY()
+    {
+        LOG_DEBUG("retry %s: %s", errorTypeName(errorType()), errorMessage());
+        this->pending->error = true;
+
+        tlsClientClose(this->tls);
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read the response to a request written by httpClientRequestWrite()
+***********************************************************************************************************************************/
+Buffer *
+httpClientResponseRead(HttpClient *this, bool returnContent)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, this);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->pending != NULL);
+
+    // Buffer for returned content
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Detach the request from the client so it is not discarded by httpClientDone() on retry.  It will be freed with the temp
+        // context even if the retry fails.
+        HttpClientRequestPending *pending = this->pending;
+        memContextMove(pending->memContext, MEM_CONTEXT_TEMP());
+        this->pending = NULL;
+
+        bool retry = pending->error;
+
+        if (!retry)
+        {
+            TRY_BEGIN()
+            {
+                result = httpClientResponseReadInternal(this, pending->verb, returnContent);
+            }
+            CATCH_ANY()
+            {
+                LOG_DEBUG("retry %s: %s", errorTypeName(errorType()), errorMessage());
+                retry = true;
+
+                tlsClientClose(this->tls);
+            }
+            TRY_END();
+        }
+
+        // Retry the request if the write or read failed
+        if (retry)
+        {
+            httpClientStatLocal.retry++;
+            statInc(HTTP_STAT_RETRY_STR);
+
+            result = httpClientRequestInternal(
+                this, pending->verb, pending->uri, pending->query, pending->header, pending->body, returnContent,
+                pending->timeBegin);
+        }
+        else
+        {
+            httpClientStatLocal.request++;
+            statTimeAdd(HTTP_STAT_REQUEST_MS_STR, pending->timeBegin);
+        }
+
+        bufMove(result, MEM_CONTEXT_OLD());
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -503,6 +753,15 @@ httpClientDone(HttpClient *this)
         this->ioRead = NULL;
     }
 
+    // Discard a request whose response will not be read.  The connection must be closed since the response may still arrive.
+    if (this->pending != NULL)
+    {
+        tlsClientClose(this->tls);
+
+        memContextFree(this->pending->memContext);
+        this->pending = NULL;
+    }
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -518,7 +777,7 @@ httpClientBusy(const HttpClient *this)
 
     ASSERT(this != NULL);
 
-    FUNCTION_TEST_RETURN(this->ioRead);
+    FUNCTION_TEST_RETURN(this->ioRead != NULL || this->pending != NULL);
 }
 
 /***********************************************************************************************************************************
@@ -6,6 +6,9 @@ A robust HTTP client with connection reuse and automatic retries.
 Using a single object to make multiple requests is more efficient because connections are reused whenever possible.  Requests are
 automatically retried when the connection has been closed by the server.  Any 5xx response is also retried.
 
+A request can also be split with httpClientRequestWrite() and httpClientResponseRead() so requests on several clients are in flight
+at the same time.  The request is retried when the response is read if the write or the read fails.
+
 Only the HTTPS protocol is currently supported.
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_HTTP_CLIENT_H
@@ -74,6 +77,16 @@ void httpClientDone(HttpClient *this);
 Buffer *httpClientRequest(
     HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
     const Buffer *body, bool returnContent);
+
+// Write a request without waiting for the response.  The response must be read with httpClientResponseRead() before the client is
+// used for another request.
+void httpClientRequestWrite(
+    HttpClient *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader,
+    const Buffer *body);
+
+// Read the response to the request written by httpClientRequestWrite()
+Buffer *httpClientResponseRead(HttpClient *this, bool returnContent);
+
 String *httpClientStatStr(void);
 
 /***********************************************************************************************************************************
@@ -19,6 +19,22 @@ should set their buffer size using ioBufferSize() but there may be cases where a
 
 static size_t bufferSize = (8 * IO_BUFFER_BLOCK_SIZE);
 
+/***********************************************************************************************************************************
+Buffer pool
+
+Buffers of ioBufferSize() are borrowed from the pool and returned when done so they can be reused rather than being allocated and
+freed for each file.  Borrowed buffers are moved to the current mem context so they will be freed normally if they are never
+returned, e.g. when an error is thrown.
+***********************************************************************************************************************************/
+#define IO_BUFFER_POOL_MAX                                          16
+
+static struct IoBufferPool
+{
+    MemContext *memContext;                                         // Mem context for pooled buffers
+    Buffer *list[IO_BUFFER_POOL_MAX];                               // Pooled buffers
+    unsigned int size;                                              // Number of pooled buffers
+} ioBufferPool;
+
 /***********************************************************************************************************************************
 Get/set buffer size
 ***********************************************************************************************************************************/
@@ -41,6 +57,70 @@ ioBufferSizeSet(size_t bufferSizeParam)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Get a buffer from the pool or create a new one if the pool is empty
+***********************************************************************************************************************************/
+Buffer *
+ioBufferPoolGet(void)
+{
+    FUNCTION_TEST_VOID();
+
+    Buffer *result = NULL;
+
+    // Get the most recently returned buffer since it is the most likely to still be in cache.  Buffers that no longer match the
+    // buffer size are freed.
+    while (result == NULL && ioBufferPool.size > 0)
+    {
+        Buffer *buffer = ioBufferPool.list[--ioBufferPool.size];
+
+        if (bufSize(buffer) == bufferSize)
+            result = bufMove(buffer, memContextCurrent());
+        else
+            bufFree(buffer);
+    }
+
+    if (result == NULL)
+        result = bufNew(bufferSize);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Return a buffer to the pool.  The buffer is freed if it does not match the buffer size or the pool is full.
+***********************************************************************************************************************************/
+void
+ioBufferPoolPut(Buffer *buffer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+    FUNCTION_TEST_END();
+
+    ASSERT(buffer != NULL);
+
+    // Reset the buffer so it is ready to be used again
+    bufUsedZero(buffer);
+    bufLimitClear(buffer);
+
+    if (bufSize(buffer) == bufferSize && ioBufferPool.size < IO_BUFFER_POOL_MAX)
+    {
+        // Create the pool mem context if it does not exist
+        if (ioBufferPool.memContext == NULL)
+        {
+            MEM_CONTEXT_BEGIN(memContextTop())
+            {
+                ioBufferPool.memContext = memContextNew("IoBufferPool");
+            }
+            MEM_CONTEXT_END();
+        }
+
+        ioBufferPool.list[ioBufferPool.size++] = bufMove(buffer, ioBufferPool.memContext);
+    }
+    else
+        bufFree(buffer);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Read all IO into a buffer
 ***********************************************************************************************************************************/
@@ -16,6 +16,10 @@ Functions
 Buffer *ioReadBuf(IoRead *read);
 bool ioReadDrain(IoRead *read);
 
+// Borrow a buffer of ioBufferSize() from the pool and return it when done
+Buffer *ioBufferPoolGet(void);
+void ioBufferPoolPut(Buffer *buffer);
+
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
@@ -57,7 +57,7 @@ ioReadNew(void *driver, IoReadInterface interface)
         this->driver = driver;
         this->interface = interface;
         this->filterGroup = ioFilterGroupNew();
-        this->input = bufNew(ioBufferSize());
+        this->input = ioBufferPoolGet();
     }
     MEM_CONTEXT_NEW_END();
 
@@ -151,9 +151,12 @@ ioReadInternal(IoRead *this, Buffer *buffer, bool block)
                 this->interface.read(this->driver, this->input, block);
                 bufLimitClear(this->input);
             }
-            // Set input to NULL and flush (no need to actually free the buffer here as it will be freed with the mem context)
-            else
+            // Else return input to the pool (if it has not already been returned), set it to NULL, and flush
+            else if (this->input != NULL)
+            {
+                ioBufferPoolPut(this->input);
                 this->input = NULL;
+            }
 
             // Process the input buffer (or flush if NULL)
             if (this->input == NULL || bufUsed(this->input) > 0)
@@ -317,6 +320,13 @@ ioReadClose(IoRead *this)
     if (this->interface.close != NULL)
         this->interface.close(this->driver);
 
+    // Return the input buffer to the pool if it was not returned at EOF
+    if (this->input != NULL)
+    {
+        ioBufferPoolPut(this->input);
+        this->input = NULL;
+    }
+
 #ifdef DEBUG
     this->closed = true;
 #endif
@@ -24,9 +24,8 @@ TLS Client
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/io/tls/client.h"
+#include "common/io/tls/session.h"
 #include "common/io/io.h"
-#include "common/io/read.intern.h"
-#include "common/io/write.intern.h"
 #include "common/memContext.h"
 #include "common/object.h"
 #include "common/time.h"
@@ -50,13 +49,10 @@ struct TlsClient
     bool verifyPeer;                                                // Should the peer (server) certificate be verified?
 
     SSL_CTX *context;                                               // TLS context
-    int socket;                                                     // Client socket
-    SSL *session;                                                   // TLS session on the socket
-
-    IoRead *read;                                                   // Read interface
-    IoWrite *write;                                                 // Write interface
+    TlsSession *session;                                            // TLS session on the connected socket
 };
 
+OBJECT_DEFINE_MOVE(TLS_CLIENT);
 OBJECT_DEFINE_FREE(TLS_CLIENT);
 
 /***********************************************************************************************************************************
@@ -64,68 +60,18 @@ Free connection
 ***********************************************************************************************************************************/
 OBJECT_DEFINE_FREE_RESOURCE_BEGIN(TLS_CLIENT, LOG, logLevelTrace)
 {
-    tlsClientClose(this);
+    // The session is a child context so it has already been freed
     SSL_CTX_free(this->context);
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
 
-/***********************************************************************************************************************************
-Report TLS errors.  Returns true if the command should continue and false if it should exit.
-***********************************************************************************************************************************/
-static bool
-tlsError(TlsClient *this, int code)
-{
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
-        FUNCTION_LOG_PARAM(INT, code);
-    FUNCTION_LOG_END();
-
-    bool result = false;
-
-    switch (code)
-    {
-        // The connection was closed
-        case SSL_ERROR_ZERO_RETURN:
-        {
-            tlsClientClose(this);
-            break;
-        }
-
-        // Try the read/write again
-        case SSL_ERROR_WANT_READ:
-        case SSL_ERROR_WANT_WRITE:
-        {
-            result = true;
-            break;
-        }
-
-        // A syscall failed (this usually indicates eof)
-        case SSL_ERROR_SYSCALL:
-        {
-            // Get the error before closing so it is not cleared
-            int errNo = errno;
-            tlsClientClose(this);
-
-            // Throw the sys error if there is one
-            THROW_ON_SYS_ERROR(errNo, KernelError, "tls failed syscall");
-
-            break;
-        }
-
-        // Some other tls error that cannot be handled
-        default:
-            THROW_FMT(ServiceError, "tls error [%d]", code);
-    }
-
-    FUNCTION_LOG_RETURN(BOOL, result);
-}
-
 /***********************************************************************************************************************************
 New object
 ***********************************************************************************************************************************/
 TlsClient *
 tlsClientNew(
-    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath,
+    const String *certFile, const String *keyFile)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug)
         FUNCTION_LOG_PARAM(STRING, host);
@@ -134,9 +80,12 @@ tlsClientNew(
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
         FUNCTION_LOG_PARAM(STRING, caFile);
         FUNCTION_LOG_PARAM(STRING, caPath);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
     FUNCTION_LOG_END();
 
     ASSERT(host != NULL);
+    ASSERT((certFile == NULL && keyFile == NULL) || (certFile != NULL && keyFile != NULL));
 
     TlsClient *this = NULL;
 
@@ -150,9 +99,6 @@ tlsClientNew(
         this->timeout = timeout;
         this->verifyPeer = verifyPeer;
 
-        // Initialize socket to -1 so we know when it is disconnected
-        this->socket = -1;
-
         // Setup TLS context
         // -------------------------------------------------------------------------------------------------------------------------
         cryptoInit();
@@ -190,6 +136,20 @@ tlsClientNew(
                 cryptoError(SSL_CTX_set_default_verify_paths(this->context) != 1, "unable to set default CA certificate location");
         }
 
+        // Load the client certificate and key if the server requires client authentication
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (certFile != NULL)
+        {
+            cryptoError(
+                SSL_CTX_use_certificate_chain_file(this->context, strPtr(certFile)) != 1,
+                strPtr(strNewFmt("unable to load cert file '%s'", strPtr(certFile))));
+
+            // Loading the key also checks that it matches the cert
+            cryptoError(
+                SSL_CTX_use_PrivateKey_file(this->context, strPtr(keyFile), SSL_FILETYPE_PEM) != 1,
+                strPtr(strNewFmt("unable to load key file '%s'", strPtr(keyFile))));
+        }
+
         tlsClientStatLocal.object++;
     }
     MEM_CONTEXT_NEW_END();
@@ -332,165 +292,6 @@ tlsClientHostVerify(const String *host, X509 *certificate)
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
-/***********************************************************************************************************************************
-Wait for the socket to be readable
-***********************************************************************************************************************************/
-static void
-tlsClientReadWait(TlsClient *this)
-{
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
-    FUNCTION_LOG_END();
-
-    ASSERT(this != NULL);
-    ASSERT(this->session != NULL);
-
-    // Initialize the file descriptor set used for select
-    fd_set selectSet;
-    FD_ZERO(&selectSet);
-
-    // We know the socket is not negative because it passed error handling, so it is safe to cast to unsigned
-    FD_SET((unsigned int)this->socket, &selectSet);
-
-    // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
-    struct timeval timeoutSelect;
-    timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
-    timeoutSelect.tv_usec = (time_t)(this->timeout % MSEC_PER_SEC * 1000);
-
-    // Determine if there is data to be read
-    int result = select(this->socket + 1, &selectSet, NULL, NULL, &timeoutSelect);
-    THROW_ON_SYS_ERROR_FMT(result == -1, AssertError, "unable to select from '%s:%u'", strPtr(this->host), this->port);
-
-    // If no data read after time allotted then error
-    if (!result)
-    {
-        THROW_FMT(
-            FileReadError, "timeout after %" PRIu64 "ms waiting for read from '%s:%u'", this->timeout, strPtr(this->host),
-            this->port);
-    }
-
-    FUNCTION_LOG_RETURN_VOID();
-}
-
-/***********************************************************************************************************************************
-Read from the TLS session
-***********************************************************************************************************************************/
-size_t
-tlsClientRead(THIS_VOID, Buffer *buffer, bool block)
-{
-    THIS(TlsClient);
-
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
-        FUNCTION_LOG_PARAM(BUFFER, buffer);
-        FUNCTION_LOG_PARAM(BOOL, block);
-    FUNCTION_LOG_END();
-
-    ASSERT(this != NULL);
-    ASSERT(this->session != NULL);
-    ASSERT(buffer != NULL);
-    ASSERT(!bufFull(buffer));
-
-    ssize_t result = 0;
-
-    // If blocking read keep reading until buffer is full
-    do
-    {
-        // If no tls data pending then check the socket
-        if (!SSL_pending(this->session))
-            tlsClientReadWait(this);
-
-        // Read and handle errors
-        size_t expectedBytes = bufRemains(buffer);
-        result = SSL_read(this->session, bufRemainsPtr(buffer), (int)expectedBytes);
-
-        if (result <= 0)
-        {
-            // Break if the error indicates that we should not continue trying
-            if (!tlsError(this, SSL_get_error(this->session, (int)result)))
-                break;
-        }
-        // Update amount of buffer used
-        else
-            bufUsedInc(buffer, (size_t)result);
-    }
-    while (block && bufRemains(buffer) > 0);
-
-    FUNCTION_LOG_RETURN(SIZE, (size_t)result);
-}
-
-/***********************************************************************************************************************************
-Write to the tls session
-***********************************************************************************************************************************/
-static bool
-tlsWriteContinue(TlsClient *this, int writeResult, int writeError, size_t writeSize)
-{
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
-        FUNCTION_LOG_PARAM(INT, writeResult);
-        FUNCTION_LOG_PARAM(INT, writeError);
-        FUNCTION_LOG_PARAM(SIZE, writeSize);
-    FUNCTION_LOG_END();
-
-    ASSERT(this != NULL);
-    ASSERT(writeSize > 0);
-
-    bool result = true;
-
-    // Handle errors
-    if (writeResult <= 0)
-    {
-        // If error = SSL_ERROR_NONE then this is the first write attempt so continue
-        if (writeError != SSL_ERROR_NONE)
-        {
-            // Error if the error indicates that we should not continue trying
-            if (!tlsError(this, writeError))
-                THROW_FMT(FileWriteError, "unable to write to tls [%d]", writeError);
-
-            // Wait for the socket to be readable for tls renegotiation
-            tlsClientReadWait(this);
-        }
-    }
-    else
-    {
-        if ((size_t)writeResult != writeSize)
-        {
-            THROW_FMT(
-                FileWriteError, "unable to write to tls, write size %d does not match expected size %zu", writeResult, writeSize);
-        }
-
-        result = false;
-    }
-
-    FUNCTION_LOG_RETURN(BOOL, result);
-}
-
-void
-tlsClientWrite(THIS_VOID, const Buffer *buffer)
-{
-    THIS(TlsClient);
-
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
-        FUNCTION_LOG_PARAM(BUFFER, buffer);
-    FUNCTION_LOG_END();
-
-    ASSERT(this != NULL);
-    ASSERT(this->session != NULL);
-    ASSERT(buffer != NULL);
-
-    int result = 0;
-    int error = SSL_ERROR_NONE;
-
-    while (tlsWriteContinue(this, result, error, bufUsed(buffer)))
-    {
-        result = SSL_write(this->session, bufPtr(buffer), (int)bufUsed(buffer));
-        error = SSL_get_error(this->session, result);
-    }
-
-    FUNCTION_LOG_RETURN_VOID();
-}
-
 /***********************************************************************************************************************************
 Close the connection
 ***********************************************************************************************************************************/
@@ -503,40 +304,13 @@ tlsClientClose(TlsClient *this)
 
     ASSERT(this != NULL);
 
-    // Close the socket
-    if (this->socket != -1)
-    {
-        close(this->socket);
-        this->socket = -1;
-    }
-
-    // Free the TLS session
-    if (this->session != NULL)
-    {
-        SSL_free(this->session);
-        this->session = NULL;
-    }
+    // Free the TLS session, which also closes the socket
+    tlsSessionFree(this->session);
+    this->session = NULL;
 
     FUNCTION_LOG_RETURN_VOID();
 }
 
-/***********************************************************************************************************************************
-Has session been closed by the server?
-***********************************************************************************************************************************/
-bool
-tlsClientEof(THIS_VOID)
-{
-    THIS(TlsClient);
-
-    FUNCTION_LOG_BEGIN(logLevelTrace);
-        FUNCTION_LOG_PARAM(TLS_CLIENT, this);
-    FUNCTION_LOG_END();
-
-    ASSERT(this != NULL);
-
-    FUNCTION_LOG_RETURN(BOOL, this->session == NULL);
-}
-
 /***********************************************************************************************************************************
 Open connection if this is a new client or if the connection was closed by the server
 ***********************************************************************************************************************************/
@@ -551,13 +325,14 @@ tlsClientOpen(TlsClient *this)
 
     bool result = false;
 
-    if (this->session == NULL)
+    if (this->session == NULL || tlsSessionClosed(this->session))
     {
-        // Free the read/write interfaces
-        ioReadFree(this->read);
-        this->read = NULL;
-        ioWriteFree(this->write);
-        this->write = NULL;
+        // Free the session if it was closed by the server
+        tlsClientClose(this);
+
+        // These must be volatile so they can be cleaned up after an error
+        volatile int fd;
+        SSL *volatile session;
 
         MEM_CONTEXT_TEMP_BEGIN()
         {
@@ -569,6 +344,8 @@ tlsClientOpen(TlsClient *this)
             {
                 // Assume there will be no retry
                 retry = false;
+                fd = -1;
+                session = NULL;
 
                 TRY_BEGIN()
                 {
@@ -598,10 +375,10 @@ tlsClientOpen(TlsClient *this)
                     // Connect to the host
                     TRY_BEGIN()
                     {
-                        this->socket = socket(hostAddress->ai_family, hostAddress->ai_socktype, hostAddress->ai_protocol);
-                        THROW_ON_SYS_ERROR(this->socket == -1, HostConnectError, "unable to create socket");
+                        fd = socket(hostAddress->ai_family, hostAddress->ai_socktype, hostAddress->ai_protocol);
+                        THROW_ON_SYS_ERROR(fd == -1, HostConnectError, "unable to create socket");
 
-                        if (connect(this->socket, hostAddress->ai_addr, hostAddress->ai_addrlen) == -1)
+                        if (connect(fd, hostAddress->ai_addr, hostAddress->ai_addrlen) == -1)
                             THROW_SYS_ERROR_FMT(HostConnectError, "unable to connect to '%s:%u'", strPtr(this->host), this->port);
                     }
                     FINALLY()
@@ -614,7 +391,7 @@ tlsClientOpen(TlsClient *this)
                     int socketValue = 1;
 
                     THROW_ON_SYS_ERROR(
-                        setsockopt(this->socket, SOL_SOCKET, SO_KEEPALIVE, &socketValue, sizeof(int)) == -1, ProtocolError,
+                        setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &socketValue, sizeof(int)) == -1, ProtocolError,
                          "unable set SO_KEEPALIVE");
 
                     // Set per-connection keepalive options if they are available
@@ -622,26 +399,34 @@ tlsClientOpen(TlsClient *this)
                     socketValue = 3;
 
                     THROW_ON_SYS_ERROR(
-                        setsockopt(this->socket, SOL_SOCKET, TCP_KEEPIDLE, &socketValue, sizeof(int)) == -1, ProtocolError,
+                        setsockopt(fd, SOL_SOCKET, TCP_KEEPIDLE, &socketValue, sizeof(int)) == -1, ProtocolError,
                          "unable set SO_KEEPIDLE");
 
                     THROW_ON_SYS_ERROR(
-                        setsockopt(this->socket, SOL_SOCKET, TCP_KEEPINTVL, &socketValue, sizeof(int)) == -1, ProtocolError,
+                        setsockopt(fd, SOL_SOCKET, TCP_KEEPINTVL, &socketValue, sizeof(int)) == -1, ProtocolError,
                          "unable set SO_KEEPINTVL");
 
                     socketValue = this->timeout / socketValue;
 
                     THROW_ON_SYS_ERROR(
-                        setsockopt(this->socket, SOL_SOCKET, TCP_KEEPCNT, &socketValue, sizeof(int)) == -1, ProtocolError,
+                        setsockopt(fd, SOL_SOCKET, TCP_KEEPCNT, &socketValue, sizeof(int)) == -1, ProtocolError,
                          "unable set SO_KEEPCNT");
 #endif
 
                     // Negotiate TLS
-                    cryptoError((this->session = SSL_new(this->context)) == NULL, "unable to create TLS context");
+                    cryptoError((session = SSL_new(this->context)) == NULL, "unable to create TLS context");
+
+                    cryptoError(SSL_set_tlsext_host_name(session, strPtr(this->host)) != 1, "unable to set TLS host name");
+                    cryptoError(SSL_set_fd(session, fd) != 1, "unable to add socket to TLS context");
+                    cryptoError(SSL_connect(session) != 1, "unable to negotiate TLS connection");
 
-                    cryptoError(SSL_set_tlsext_host_name(this->session, strPtr(this->host)) != 1, "unable to set TLS host name");
-                    cryptoError(SSL_set_fd(this->session, this->socket) != 1, "unable to add socket to TLS context");
-                    cryptoError(SSL_connect(this->session) != 1, "unable to negotiate TLS connection");
+                    // The session now owns the socket and will close it
+                    MEM_CONTEXT_BEGIN(this->memContext)
+                    {
+                        this->session = tlsSessionNew(
+                            strNewFmt("%s:%u", strPtr(this->host), this->port), session, fd, this->timeout);
+                    }
+                    MEM_CONTEXT_END();
 
                     // Connection was successful
                     connected = true;
@@ -657,7 +442,11 @@ tlsClientOpen(TlsClient *this)
                         tlsClientStatLocal.retry++;
                     }
 
-                    tlsClientClose(this);
+                    if (session != NULL)
+                        SSL_free(session);
+
+                    if (fd != -1)
+                        close(fd);
                 }
                 TRY_END();
             }
@@ -672,7 +461,7 @@ tlsClientOpen(TlsClient *this)
         if (this->verifyPeer)
         {
             // Verify that the chain of trust leads to a valid CA
-            long int verifyResult = SSL_get_verify_result(this->session);
+            long int verifyResult = SSL_get_verify_result(session);
 
             if (verifyResult != X509_V_OK)
             {
@@ -682,7 +471,7 @@ tlsClientOpen(TlsClient *this)
             }
 
             // Verify that the hostname appears in the certificate
-            X509 *certificate = SSL_get_peer_certificate(this->session);
+            X509 *certificate = SSL_get_peer_certificate(session);
             bool nameResult = tlsClientHostVerify(this->host, certificate);
             X509_free(certificate);
 
@@ -694,16 +483,6 @@ tlsClientOpen(TlsClient *this)
             }
         }
 
-        MEM_CONTEXT_BEGIN(this->memContext)
-        {
-            // Create read and write interfaces
-            this->write = ioWriteNewP(this, .write = tlsClientWrite);
-            ioWriteOpen(this->write);
-            this->read = ioReadNewP(this, .block = true, .eof = tlsClientEof, .read = tlsClientRead);
-            ioReadOpen(this->read);
-        }
-        MEM_CONTEXT_END();
-
         tlsClientStatLocal.session++;
         result = true;
     }
@@ -745,7 +524,7 @@ tlsClientIoRead(const TlsClient *this)
 
     ASSERT(this != NULL);
 
-    FUNCTION_TEST_RETURN(this->read);
+    FUNCTION_TEST_RETURN(tlsSessionIoRead(this->session));
 }
 
 /***********************************************************************************************************************************
@@ -760,5 +539,5 @@ tlsClientIoWrite(const TlsClient *this)
 
     ASSERT(this != NULL);
 
-    FUNCTION_TEST_RETURN(this->write);
+    FUNCTION_TEST_RETURN(tlsSessionIoWrite(this->session));
 }
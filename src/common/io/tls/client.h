@@ -9,9 +9,10 @@ connection is needed.  By default, an open connection will be reused so the user
 read/write error if the server closes the connection before it is reused.  If this behavior is not desirable then tlsClientClose()
 may be used to ensure that the next call to tlsClientOpen() will create a new TLS session.
 
-Note that tlsClientRead() is non-blocking unless there are *zero* bytes to be read from the session in which case it will raise an
-error after the defined timeout.  In any case the tlsClientRead()/tlsClientWrite()/tlsClientEof() functions should not generally
-be called directly.  Instead use the read/write interfaces available from tlsClientIoRead()/tlsClientIoWrite().
+If certFile and keyFile are set then the client will present a certificate to the server, which is required by TlsServer.
+
+Reads and writes are done by the TlsSession created when the connection is opened so the read/write interfaces available from
+tlsClientIoRead()/tlsClientIoWrite() are only valid until the next call to tlsClientOpen() that creates a new session.
 ***********************************************************************************************************************************/
 #ifndef COMMON_IO_TLS_CLIENT_H
 #define COMMON_IO_TLS_CLIENT_H
@@ -26,6 +27,7 @@ typedef struct TlsClient TlsClient;
 
 #include "common/io/read.h"
 #include "common/io/write.h"
+#include "common/memContext.h"
 #include "common/time.h"
 #include "common/type/string.h"
 
@@ -44,11 +46,13 @@ typedef struct TlsClientStat
 Constructor
 ***********************************************************************************************************************************/
 TlsClient *tlsClientNew(
-    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+    const String *host, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath,
+    const String *certFile, const String *keyFile);
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+TlsClient *tlsClientMove(TlsClient *this, MemContext *parentNew);
 bool tlsClientOpen(TlsClient *this);
 void tlsClientClose(TlsClient *this);
 String *tlsClientStatStr(void);
@@ -0,0 +1,298 @@
+/***********************************************************************************************************************************
+TLS Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <netdb.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#ifdef __FreeBSD__
+#include <netinet/in.h>
+#endif
+
+#include <openssl/ssl.h>
+
+#include "common/crypto/common.h"
+#include "common/debug.h"
+#include "common/io/tls/server.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/convert.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct TlsServer
+{
+    MemContext *memContext;                                         // Mem context
+    String *address;                                                // Address to listen on
+    unsigned int port;                                              // Port to listen on
+    TimeMSec timeout;                                               // Timeout for any i/o operation (negotiate, read, etc.)
+
+    SSL_CTX *context;                                               // TLS context
+    int socket;                                                     // Listen socket
+};
+
+OBJECT_DEFINE_FREE(TLS_SERVER);
+
+/***********************************************************************************************************************************
+Free server
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(TLS_SERVER, LOG, logLevelTrace)
+{
+    if (this->socket != -1)
+        close(this->socket);
+
+    SSL_CTX_free(this->context);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+TlsServer *
+tlsServerNew(
+    const String *address, unsigned int port, const String *certFile, const String *keyFile, const String *caFile,
+    TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, address);
+        FUNCTION_LOG_PARAM(UINT, port);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
+        FUNCTION_LOG_PARAM(STRING, caFile);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(address != NULL);
+    ASSERT(port > 0);
+    ASSERT(certFile != NULL);
+    ASSERT(keyFile != NULL);
+    ASSERT(caFile != NULL);
+
+    TlsServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("TlsServer")
+    {
+        this = memNew(sizeof(TlsServer));
+        this->memContext = MEM_CONTEXT_NEW();
+
+        this->address = strDup(address);
+        this->port = port;
+        this->timeout = timeout;
+
+        // Initialize socket to -1 so we know when it is not listening
+        this->socket = -1;
+
+        // Setup TLS context
+        // -------------------------------------------------------------------------------------------------------------------------
+        cryptoInit();
+
+        // Select the TLS method to use.  SSL versions will be excluded in SSL_CTX_set_options().
+        const SSL_METHOD *method = SSLv23_method();
+        cryptoError(method == NULL, "unable to load TLS method");
+
+        this->context = SSL_CTX_new(method);
+        cryptoError(this->context == NULL, "unable to create TLS context");
+
+        memContextCallbackSet(this->memContext, tlsServerFreeResource, this);
+
+        // Exclude SSL versions to only allow TLS and also disable compression
+        SSL_CTX_set_options(this->context, (long)(SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_COMPRESSION));
+
+        // Disable auto-retry to prevent SSL_read() from hanging
+        SSL_CTX_clear_mode(this->context, SSL_MODE_AUTO_RETRY);
+
+        // Load the server certificate and key
+        cryptoError(
+            SSL_CTX_use_certificate_chain_file(this->context, strPtr(certFile)) != 1,
+            strPtr(strNewFmt("unable to load cert file '%s'", strPtr(certFile))));
+
+        // Loading the key also checks that it matches the cert
+        cryptoError(
+            SSL_CTX_use_PrivateKey_file(this->context, strPtr(keyFile), SSL_FILETYPE_PEM) != 1,
+            strPtr(strNewFmt("unable to load key file '%s'", strPtr(keyFile))));
+
+        // Require a client certificate signed by the CA
+        cryptoError(
+            SSL_CTX_load_verify_locations(this->context, strPtr(caFile), NULL) != 1,
+            strPtr(strNewFmt("unable to load CA file '%s'", strPtr(caFile))));
+        SSL_CTX_set_verify(this->context, SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT, NULL);
+
+        // Listen on the address
+        // -------------------------------------------------------------------------------------------------------------------------
+        struct addrinfo hints;
+
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+        hints.ai_flags = AI_PASSIVE;
+
+        // Convert the port to a zero-terminated string for use with getaddrinfo()
+        char portZ[CVT_BASE10_BUFFER_SIZE];
+        cvtUIntToZ(this->port, portZ, sizeof(portZ));
+
+        // Get an address to listen on.  We are only going to use the first address returned.
+        struct addrinfo *serverAddress;
+        int result;
+
+        if ((result = getaddrinfo(strPtr(this->address), portZ, &hints, &serverAddress)) != 0)
+        {
+            THROW_FMT(
+                HostConnectError, "unable to get address for '%s': [%d] %s", strPtr(this->address), result, gai_strerror(result));
+        }
+
+        TRY_BEGIN()
+        {
+            this->socket = socket(serverAddress->ai_family, serverAddress->ai_socktype, serverAddress->ai_protocol);
+            THROW_ON_SYS_ERROR(this->socket == -1, HostConnectError, "unable to create socket");
+
+            // Allow the address to be reused so the server can be restarted while old connections are in TIME_WAIT
+            int socketValue = 1;
+
+            THROW_ON_SYS_ERROR(
+                setsockopt(this->socket, SOL_SOCKET, SO_REUSEADDR, &socketValue, sizeof(int)) == -1, ProtocolError,
+                "unable set SO_REUSEADDR");
+
+            THROW_ON_SYS_ERROR_FMT(
+                bind(this->socket, serverAddress->ai_addr, serverAddress->ai_addrlen) == -1, HostConnectError,
+                "unable to bind to '%s:%u'", strPtr(this->address), this->port);
+        }
+        FINALLY()
+        {
+            freeaddrinfo(serverAddress);
+        }
+        TRY_END();
+
+        THROW_ON_SYS_ERROR_FMT(
+            listen(this->socket, SOMAXCONN) == -1, HostConnectError, "unable to listen on '%s:%u'", strPtr(this->address),
+            this->port);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(TLS_SERVER, this);
+}
+
+/***********************************************************************************************************************************
+Accept a connection
+***********************************************************************************************************************************/
+int
+tlsServerAccept(TlsServer *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(TLS_SERVER, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // This must be volatile so it can be cleaned up after an error
+    volatile int fd = -1;
+
+    TRY_BEGIN()
+    {
+        // Wait for a connection
+        fd = accept(this->socket, NULL, NULL);
+        THROW_ON_SYS_ERROR_FMT(fd == -1, HostConnectError, "unable to accept on '%s:%u'", strPtr(this->address), this->port);
+
+        // Enable TCP keepalives
+        int socketValue = 1;
+
+        THROW_ON_SYS_ERROR(
+            setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &socketValue, sizeof(int)) == -1, ProtocolError, "unable set SO_KEEPALIVE");
+
+        // Limit how long the client can take to negotiate so a stalled client does not hang the process negotiating with it
+        struct timeval timeoutSocket;
+        timeoutSocket.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
+        timeoutSocket.tv_usec = (time_t)(this->timeout % MSEC_PER_SEC * 1000);
+
+        THROW_ON_SYS_ERROR(
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeoutSocket, sizeof(timeoutSocket)) == -1, ProtocolError,
+            "unable set SO_RCVTIMEO");
+    }
+    CATCH_ANY()
+    {
+        if (fd != -1)
+            close(fd);
+
+        RETHROW();
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(INT, fd);
+}
+
+/***********************************************************************************************************************************
+Negotiate a TLS session on an accepted connection
+***********************************************************************************************************************************/
+TlsSession *
+tlsServerSession(TlsServer *this, int fd)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace)
+        FUNCTION_LOG_PARAM(TLS_SERVER, this);
+        FUNCTION_LOG_PARAM(INT, fd);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(fd != -1);
+
+    TlsSession *result = NULL;
+
+    // This must be volatile so it can be cleaned up after an error
+    SSL *volatile session = NULL;
+
+    TRY_BEGIN()
+    {
+        // Get the client address for error messages
+        struct sockaddr_storage clientAddress;
+        socklen_t clientAddressSize = sizeof(clientAddress);
+        char host[NI_MAXHOST];
+        char port[NI_MAXSERV];
+
+        if (getpeername(fd, (struct sockaddr *)&clientAddress, &clientAddressSize) != 0 ||
+            getnameinfo(
+                (struct sockaddr *)&clientAddress, clientAddressSize, host, sizeof(host), port, sizeof(port),
+                NI_NUMERICHOST | NI_NUMERICSERV) != 0)
+        {
+            strcpy(host, "unknown");
+            strcpy(port, "0");
+        }
+
+        // Negotiate TLS
+        cryptoError((session = SSL_new(this->context)) == NULL, "unable to create TLS context");
+        cryptoError(SSL_set_fd(session, fd) != 1, "unable to add socket to TLS context");
+
+        if (SSL_accept(session) != 1)
+        {
+            long int verifyResult = SSL_get_verify_result(session);
+
+            if (verifyResult != X509_V_OK)
+            {
+                THROW_FMT(
+                    CryptoError, "unable to verify certificate presented by '%s:%s': [%ld] %s", host, port, verifyResult,
+                    X509_verify_cert_error_string(verifyResult));
+            }
+
+            cryptoError(true, strPtr(strNewFmt("unable to negotiate TLS connection with '%s:%s'", host, port)));
+        }
+
+        // The session now owns the socket and will close it
+        result = tlsSessionNew(strNewFmt("%s:%s", host, port), session, fd, this->timeout);
+    }
+    CATCH_ANY()
+    {
+        if (session != NULL)
+            SSL_free(session);
+
+        close(fd);
+
+        RETHROW();
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(TLS_SESSION, result);
+}
@@ -0,0 +1,54 @@
+/***********************************************************************************************************************************
+TLS Server
+
+Listen for TLS connections and negotiate a TlsSession for each one accepted.  Clients are required to present a certificate signed by
+the configured CA so the server can authenticate them.  The common name of the client certificate is available from
+tlsSessionPeerName() for authorization.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_TLS_SERVER_H
+#define COMMON_IO_TLS_SERVER_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define TLS_SERVER_TYPE                                             TlsServer
+#define TLS_SERVER_PREFIX                                           tlsServer
+
+typedef struct TlsServer TlsServer;
+
+#include "common/io/tls/session.h"
+#include "common/time.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+TlsServer *tlsServerNew(
+    const String *address, unsigned int port, const String *certFile, const String *keyFile, const String *caFile,
+    TimeMSec timeout);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Wait for a connection and return the socket.  Negotiation is done separately by tlsServerSession() so it can be run in another
+// process while the server accepts new connections.
+int tlsServerAccept(TlsServer *this);
+
+// Negotiate a TLS session on a socket returned by tlsServerAccept().  The session takes ownership of the socket, which is closed on
+// error.  A client that fails to negotiate raises an error but the server can still accept new connections.
+TlsSession *tlsServerSession(TlsServer *this, int fd);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void tlsServerFree(TlsServer *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_TLS_SERVER_TYPE                                                                                               \
+    TlsServer *
+#define FUNCTION_LOG_TLS_SERVER_FORMAT(value, buffer, bufferSize)                                                                  \
+    objToLog(value, "TlsServer", buffer, bufferSize)
+
+#endif
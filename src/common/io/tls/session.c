@@ -0,0 +1,435 @@
+/***********************************************************************************************************************************
+TLS Session
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include <openssl/x509.h>
+
+#include "common/crypto/common.h"
+#include "common/debug.h"
+#include "common/io/io.h"
+#include "common/io/read.intern.h"
+#include "common/io/tls/session.h"
+#include "common/io/write.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct TlsSession
+{
+    MemContext *memContext;                                         // Mem context
+    String *name;                                                   // Name used in error messages, e.g. host:port
+    TimeMSec timeout;                                               // Timeout for any i/o operation (read, write, etc.)
+
+    int socket;                                                     // Socket
+    SSL *session;                                                   // TLS session on the socket
+
+    IoRead *read;                                                   // Read interface
+    IoWrite *write;                                                 // Write interface
+};
+
+OBJECT_DEFINE_FREE(TLS_SESSION);
+
+/***********************************************************************************************************************************
+Free session
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(TLS_SESSION, LOG, logLevelTrace)
+{
+    tlsSessionClose(this);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Report TLS errors.  Returns true if the command should continue and false if it should exit.
+***********************************************************************************************************************************/
+static bool
+tlsSessionError(TlsSession *this, int code)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+        FUNCTION_LOG_PARAM(INT, code);
+    FUNCTION_LOG_END();
+
+    bool result = false;
+
+    switch (code)
+    {
+        // The connection was closed
+        case SSL_ERROR_ZERO_RETURN:
+        {
+            tlsSessionClose(this);
+            break;
+        }
+
+        // Try the read/write again
+        case SSL_ERROR_WANT_READ:
+        case SSL_ERROR_WANT_WRITE:
+        {
+            result = true;
+            break;
+        }
+
+        // A syscall failed (this usually indicates eof)
+        case SSL_ERROR_SYSCALL:
+        {
+            // Get the error before closing so it is not cleared
+            int errNo = errno;
+            tlsSessionClose(this);
+
+            // Throw the sys error if there is one
+            THROW_ON_SYS_ERROR(errNo, KernelError, "tls failed syscall");
+
+            break;
+        }
+
+        // Some other tls error that cannot be handled
+        default:
+            THROW_FMT(ServiceError, "tls error [%d]", code);
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/***********************************************************************************************************************************
+Wait for the socket to be readable
+***********************************************************************************************************************************/
+static void
+tlsSessionReadWait(TlsSession *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->session != NULL);
+
+    // Initialize the file descriptor set used for select
+    fd_set selectSet;
+    FD_ZERO(&selectSet);
+
+    // We know the socket is not negative because it passed error handling, so it is safe to cast to unsigned
+    FD_SET((unsigned int)this->socket, &selectSet);
+
+    // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
+    struct timeval timeoutSelect;
+    timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
+    timeoutSelect.tv_usec = (time_t)(this->timeout % MSEC_PER_SEC * 1000);
+
+    // Determine if there is data to be read.  Retry if interrupted by a signal since Linux updates the timeout with the time
+    // remaining.
+    int result;
+
+    do
+    {
+        result = select(this->socket + 1, &selectSet, NULL, NULL, &timeoutSelect);
+    }
+    while (result == -1 && errno == EINTR);
+
+    THROW_ON_SYS_ERROR_FMT(result == -1, AssertError, "unable to select from '%s'", strPtr(this->name));
+
+    // If no data read after time allotted then error
+    if (!result)
+    {
+        THROW_FMT(
+            FileReadError, "timeout after %" PRIu64 "ms waiting for read from '%s'", this->timeout, strPtr(this->name));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read from the TLS session
+***********************************************************************************************************************************/
+static size_t
+tlsSessionRead(THIS_VOID, Buffer *buffer, bool block)
+{
+    THIS(TlsSession);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+        FUNCTION_LOG_PARAM(BOOL, block);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->session != NULL);
+    ASSERT(buffer != NULL);
+    ASSERT(!bufFull(buffer));
+
+    ssize_t result = 0;
+
+    // If blocking read keep reading until buffer is full
+    do
+    {
+        // If no tls data pending then check the socket
+        if (!SSL_pending(this->session))
+            tlsSessionReadWait(this);
+
+        // Read and handle errors
+        size_t expectedBytes = bufRemains(buffer);
+        result = SSL_read(this->session, bufRemainsPtr(buffer), (int)expectedBytes);
+
+        if (result <= 0)
+        {
+            // Break if the error indicates that we should not continue trying
+            if (!tlsSessionError(this, SSL_get_error(this->session, (int)result)))
+                break;
+        }
+        // Update amount of buffer used
+        else
+            bufUsedInc(buffer, (size_t)result);
+    }
+    while (block && bufRemains(buffer) > 0);
+
+    FUNCTION_LOG_RETURN(SIZE, (size_t)result);
+}
+
+/***********************************************************************************************************************************
+Write to the tls session
+***********************************************************************************************************************************/
+static bool
+tlsSessionWriteContinue(TlsSession *this, int writeResult, int writeError, size_t writeSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+        FUNCTION_LOG_PARAM(INT, writeResult);
+        FUNCTION_LOG_PARAM(INT, writeError);
+        FUNCTION_LOG_PARAM(SIZE, writeSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(writeSize > 0);
+
+    bool result = true;
+
+    // Handle errors
+    if (writeResult <= 0)
+    {
+        // If error = SSL_ERROR_NONE then this is the first write attempt so continue
+        if (writeError != SSL_ERROR_NONE)
+        {
+            // Error if the error indicates that we should not continue trying
+            if (!tlsSessionError(this, writeError))
+                THROW_FMT(FileWriteError, "unable to write to tls [%d]", writeError);
+
+            // Wait for the socket to be readable for tls renegotiation
+            tlsSessionReadWait(this);
+        }
+    }
+    else
+    {
+        if ((size_t)writeResult != writeSize)
+        {
+            THROW_FMT(
+                FileWriteError, "unable to write to tls, write size %d does not match expected size %zu", writeResult, writeSize);
+        }
+
+        result = false;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+static void
+tlsSessionWrite(THIS_VOID, const Buffer *buffer)
+{
+    THIS(TlsSession);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->session != NULL);
+    ASSERT(buffer != NULL);
+
+    int result = 0;
+    int error = SSL_ERROR_NONE;
+
+    while (tlsSessionWriteContinue(this, result, error, bufUsed(buffer)))
+    {
+        result = SSL_write(this->session, bufPtr(buffer), (int)bufUsed(buffer));
+        error = SSL_get_error(this->session, result);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Has session been closed by the peer?
+***********************************************************************************************************************************/
+static bool
+tlsSessionEof(THIS_VOID)
+{
+    THIS(TlsSession);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, this->session == NULL);
+}
+
+/***********************************************************************************************************************************
+New object
+***********************************************************************************************************************************/
+TlsSession *
+tlsSessionNew(const String *name, SSL *session, int socket, TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM_P(VOID, session);
+        FUNCTION_LOG_PARAM(INT, socket);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(name != NULL);
+    ASSERT(session != NULL);
+
+    TlsSession *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("TlsSession")
+    {
+        this = memNew(sizeof(TlsSession));
+        this->memContext = MEM_CONTEXT_NEW();
+
+        this->name = strDup(name);
+        this->session = session;
+        this->socket = socket;
+        this->timeout = timeout;
+
+        memContextCallbackSet(this->memContext, tlsSessionFreeResource, this);
+
+        // Create read and write interfaces
+        this->write = ioWriteNewP(this, .write = tlsSessionWrite);
+        ioWriteOpen(this->write);
+        this->read = ioReadNewP(this, .block = true, .eof = tlsSessionEof, .read = tlsSessionRead);
+        ioReadOpen(this->read);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(TLS_SESSION, this);
+}
+
+/***********************************************************************************************************************************
+Close the session
+***********************************************************************************************************************************/
+void
+tlsSessionClose(TlsSession *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Close the socket
+    if (this->socket != -1)
+    {
+        close(this->socket);
+        this->socket = -1;
+    }
+
+    // Free the TLS session
+    if (this->session != NULL)
+    {
+        SSL_free(this->session);
+        this->session = NULL;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Has the session been closed?
+***********************************************************************************************************************************/
+bool
+tlsSessionClosed(const TlsSession *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->session == NULL);
+}
+
+/***********************************************************************************************************************************
+Get read interface
+***********************************************************************************************************************************/
+IoRead *
+tlsSessionIoRead(const TlsSession *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->read);
+}
+
+/***********************************************************************************************************************************
+Get write interface
+***********************************************************************************************************************************/
+IoWrite *
+tlsSessionIoWrite(const TlsSession *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SESSION, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->write);
+}
+
+/***********************************************************************************************************************************
+Get the common name of the peer certificate
+***********************************************************************************************************************************/
+String *
+tlsSessionPeerName(const TlsSession *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SESSION, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->session != NULL);
+
+    String *result = NULL;
+    X509 *certificate = SSL_get_peer_certificate(this->session);
+
+    if (certificate != NULL)
+    {
+        char commonName[256];
+        int commonNameSize = X509_NAME_get_text_by_NID(
+            X509_get_subject_name(certificate), NID_commonName, commonName, sizeof(commonName));
+
+        X509_free(certificate);
+
+        // The common name should not be missing
+        if (commonNameSize < 0)
+            THROW(CryptoError, "TLS certificate name entry is missing");
+
+        // Reject embedded nulls in the common name to prevent attacks like CVE-2009-4034
+        if (strlen(commonName) != (size_t)commonNameSize)
+            THROW(CryptoError, "TLS certificate name contains embedded null");
+
+        result = strNew(commonName);
+    }
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
@@ -0,0 +1,66 @@
+/***********************************************************************************************************************************
+TLS Session
+
+A TLS session on a connected socket that has already been negotiated by TlsClient or TlsServer.  The session owns the socket and
+closes it when the session is closed or freed.
+
+Note that tlsSessionRead() is non-blocking unless there are *zero* bytes to be read from the session in which case it will raise an
+error after the defined timeout.  The read/write functions should not be called directly.  Instead use the read/write interfaces
+available from tlsSessionIoRead()/tlsSessionIoWrite().
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_TLS_SESSION_H
+#define COMMON_IO_TLS_SESSION_H
+
+#include <openssl/ssl.h>
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define TLS_SESSION_TYPE                                            TlsSession
+#define TLS_SESSION_PREFIX                                          tlsSession
+
+typedef struct TlsSession TlsSession;
+
+#include "common/io/read.h"
+#include "common/io/write.h"
+#include "common/time.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Constructor
+
+The name is used in error messages, e.g. host:port.
+***********************************************************************************************************************************/
+TlsSession *tlsSessionNew(const String *name, SSL *session, int socket, TimeMSec timeout);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+void tlsSessionClose(TlsSession *this);
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+// Has the session been closed, either by the peer or by tlsSessionClose()?
+bool tlsSessionClosed(const TlsSession *this);
+
+IoRead *tlsSessionIoRead(const TlsSession *this);
+IoWrite *tlsSessionIoWrite(const TlsSession *this);
+
+// Common name of the certificate presented by the peer or NULL if no certificate was presented
+String *tlsSessionPeerName(const TlsSession *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void tlsSessionFree(TlsSession *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_TLS_SESSION_TYPE                                                                                              \
+    TlsSession *
+#define FUNCTION_LOG_TLS_SESSION_FORMAT(value, buffer, bufferSize)                                                                 \
+    objToLog(value, "TlsSession", buffer, bufferSize)
+
+#endif
@@ -55,7 +55,7 @@ ioWriteNew(void *driver, IoWriteInterface interface)
         this->driver = driver;
         this->interface = interface;
         this->filterGroup = ioFilterGroupNew();
-        this->output = bufNew(ioBufferSize());
+        this->output = ioBufferPoolGet();
     }
     MEM_CONTEXT_NEW_END();
 
@@ -245,6 +245,10 @@ ioWriteClose(IoWrite *this)
     if (this->interface.close != NULL)
         this->interface.close(this->driver);
 
+    // Return the output buffer to the pool since no more writes will be done
+    ioBufferPoolPut(this->output);
+    this->output = NULL;
+
 #ifdef DEBUG
     this->closed = true;
 #endif
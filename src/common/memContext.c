@@ -46,6 +46,10 @@ struct MemContext
 
     void (*callbackFunction)(void *);                               // Function to call before the context is freed
     void *callbackArgument;                                         // Argument to pass to callback function
+
+    size_t statSize;                                                // Bytes allocated in this context and all child contexts
+    size_t statPeak;                                                // Highest value statSize has reached
+    unsigned int statAllocTotal;                                    // Allocations in this context and all child contexts
 };
 
 /***********************************************************************************************************************************
@@ -63,6 +67,23 @@ All memory allocations will be done from the current context.  Initialized to to
 ***********************************************************************************************************************************/
 MemContext *contextCurrent = &contextTop;
 
+/***********************************************************************************************************************************
+Are statistics being collected?
+***********************************************************************************************************************************/
+static bool memContextStatEnabled = false;
+
+/***********************************************************************************************************************************
+Peak memory usage by context name
+
+When a context is freed its peak is recorded here by name so the largest contexts can be reported at the end of a command, even
+though most of them are long gone by then.  Names are usually literals so the pointer is compared first and the name only when the
+pointer does not match.  When the list is full new names are ignored -- there are far fewer distinct names than this in practice.
+***********************************************************************************************************************************/
+#define MEM_CONTEXT_STAT_NAME_MAX                                   128
+
+static MemContextStatName memContextStatNameList[MEM_CONTEXT_STAT_NAME_MAX];
+static unsigned int memContextStatNameListSize = 0;
+
 /***********************************************************************************************************************************
 Wrapper around malloc()
 ***********************************************************************************************************************************/
@@ -136,6 +157,105 @@ memFreeInternal(void *buffer)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Add/subtract allocated bytes to/from a context and all its parents so totals are always available without walking the tree.  Callers
+only do this when statistics are enabled since walking the parents on every allocation is too expensive to do all the time.
+***********************************************************************************************************************************/
+static void
+memContextStatAdd(MemContext *this, size_t size, unsigned int allocTotal)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+        FUNCTION_TEST_PARAM(SIZE, size);
+        FUNCTION_TEST_PARAM(UINT, allocTotal);
+    FUNCTION_TEST_END();
+
+    for (MemContext *context = this; context != NULL; context = context->contextParent)
+    {
+        context->statSize += size;
+        context->statAllocTotal += allocTotal;
+
+        if (context->statSize > context->statPeak)
+            context->statPeak = context->statSize;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static void
+memContextStatSub(MemContext *this, size_t size, unsigned int allocTotal)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+        FUNCTION_TEST_PARAM(SIZE, size);
+        FUNCTION_TEST_PARAM(UINT, allocTotal);
+    FUNCTION_TEST_END();
+
+    for (MemContext *context = this; context != NULL; context = context->contextParent)
+    {
+        ASSERT(context->statSize >= size && context->statAllocTotal >= allocTotal);
+
+        context->statSize -= size;
+        context->statAllocTotal -= allocTotal;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Merge a context peak into a name list, keeping the highest peak for each name
+***********************************************************************************************************************************/
+static void
+memContextStatNameMerge(MemContextStatName *nameList, unsigned int *nameListSize, const char *name, size_t peak)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, nameList);
+        FUNCTION_TEST_PARAM_P(UINT, nameListSize);
+        FUNCTION_TEST_PARAM(STRINGZ, name);
+        FUNCTION_TEST_PARAM(SIZE, peak);
+    FUNCTION_TEST_END();
+
+    ASSERT(nameList != NULL);
+    ASSERT(nameListSize != NULL);
+    ASSERT(name != NULL);
+
+    // Find the name, first by pointer and then by value
+    unsigned int nameIdx = 0;
+
+    for (; nameIdx < *nameListSize; nameIdx++)
+    {
+        if (nameList[nameIdx].name == name)
+            break;
+    }
+
+    if (nameIdx == *nameListSize)
+    {
+        for (nameIdx = 0; nameIdx < *nameListSize; nameIdx++)
+        {
+            if (strcmp(nameList[nameIdx].name, name) == 0)
+                break;
+        }
+    }
+
+    // Add the name if it was not found and there is space
+    if (nameIdx == *nameListSize && *nameListSize < MEM_CONTEXT_STAT_NAME_MAX)
+    {
+        nameList[nameIdx] = (MemContextStatName){.name = name};
+        (*nameListSize)++;
+    }
+
+    // Update the name unless it could not be added
+    if (nameIdx < *nameListSize)
+    {
+        nameList[nameIdx].total++;
+
+        if (peak > nameList[nameIdx].peak)
+            nameList[nameIdx].peak = peak;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Find space for a new mem context
 ***********************************************************************************************************************************/
@@ -346,6 +466,9 @@ memContextAlloc(size_t size, bool zero)
     contextCurrent->allocList[contextCurrent->allocFreeIdx].buffer = memAllocInternal(size, zero);
     contextCurrent->allocFreeIdx++;
 
+    if (memContextStatEnabled)
+        memContextStatAdd(contextCurrent, size, 1);
+
     // Return buffer
     FUNCTION_TEST_RETURN(contextCurrent->allocList[contextCurrent->allocFreeIdx - 1].buffer);
 }
@@ -407,6 +530,15 @@ memGrowRaw(const void *buffer, size_t size)
 
     // Grow the buffer
     alloc->buffer = memReAllocInternal(alloc->buffer, alloc->size, size, false);
+
+    if (memContextStatEnabled)
+    {
+        if (size > alloc->size)
+            memContextStatAdd(contextCurrent, size - alloc->size, 0);
+        else
+            memContextStatSub(contextCurrent, alloc->size - size, 0);
+    }
+
     alloc->size = (unsigned int)size;
 
     FUNCTION_TEST_RETURN(alloc->buffer);
@@ -445,6 +577,9 @@ memFree(void *buffer)
     memFreeInternal(alloc->buffer);
     alloc->active = false;
 
+    if (memContextStatEnabled)
+        memContextStatSub(contextCurrent, alloc->size, 1);
+
     // If this allocation is before the current free allocation then make it the current free allocation
     if (allocIdx < contextCurrent->allocFreeIdx)
         contextCurrent->allocFreeIdx = allocIdx;
@@ -493,6 +628,13 @@ memContextMove(MemContext *this, MemContext *parentNew)
         ASSERT(parentNew->contextChildList[contextIdx] == NULL);
         parentNew->contextChildList[contextIdx] = this;
 
+        // Move allocation totals to the new parent
+        if (memContextStatEnabled)
+        {
+            memContextStatSub(parentOld, this->statSize, this->statAllocTotal);
+            memContextStatAdd(parentNew, this->statSize, this->statAllocTotal);
+        }
+
         // Assign new parent
         this->contextParent = parentNew;
     }
@@ -636,6 +778,21 @@ memContextFree(MemContext *this)
             this->allocListSize = 0;
         }
 
+        if (memContextStatEnabled)
+        {
+            // Child contexts have already removed their totals so only allocations in this context remain to be removed from
+            // parents
+            if (this->contextParent != NULL)
+                memContextStatSub(this->contextParent, this->statSize, this->statAllocTotal);
+
+            // Record the peak so it can be reported after the context is gone
+            if (this != &contextTop)
+                memContextStatNameMerge(memContextStatNameList, &memContextStatNameListSize, this->name, this->statPeak);
+        }
+
+        this->statSize = 0;
+        this->statAllocTotal = 0;
+
         // If the context index is lower than the current free index in the parent then replace it
         if (this->contextParent != NULL && this->contextParentIdx < this->contextParent->contextChildFreeIdx)
             this->contextParent->contextChildFreeIdx = this->contextParentIdx;
@@ -654,3 +811,158 @@ memContextFree(MemContext *this)
 
     FUNCTION_TEST_RETURN_VOID();
 }
+
+/***********************************************************************************************************************************
+Enable/disable statistics.  Totals are not maintained while disabled so they are recalculated for all active contexts when enabled.
+***********************************************************************************************************************************/
+// Recalculate the totals for a context and all its child contexts
+static void
+memContextStatCalculate(MemContext *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+    FUNCTION_TEST_END();
+
+    this->statSize = 0;
+    this->statAllocTotal = 0;
+
+    for (unsigned int allocIdx = 0; allocIdx < this->allocListSize; allocIdx++)
+    {
+        if (this->allocList[allocIdx].active)
+        {
+            this->statSize += this->allocList[allocIdx].size;
+            this->statAllocTotal++;
+        }
+    }
+
+    for (unsigned int contextIdx = 0; contextIdx < this->contextChildListSize; contextIdx++)
+    {
+        MemContext *child = this->contextChildList[contextIdx];
+
+        if (child != NULL && child->state == memContextStateActive)
+        {
+            memContextStatCalculate(child);
+
+            this->statSize += child->statSize;
+            this->statAllocTotal += child->statAllocTotal;
+        }
+    }
+
+    this->statPeak = this->statSize;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+memContextStatEnable(bool enable)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BOOL, enable);
+    FUNCTION_TEST_END();
+
+    if (enable && !memContextStatEnabled)
+        memContextStatCalculate(&contextTop);
+
+    memContextStatEnabled = enable;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get allocation statistics for a context, including all child contexts
+***********************************************************************************************************************************/
+MemContextStat
+memContextStat(const MemContext *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    MemContextStat result = {.size = this->statSize, .peak = this->statPeak, .allocTotal = this->statAllocTotal};
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Reset the peak for a context to the current size so the peak of the next operation can be measured
+***********************************************************************************************************************************/
+void
+memContextStatPeakReset(MemContext *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->statPeak = this->statSize;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the contexts with the highest peak by name.  Both freed and active contexts are included.  The result list is sorted by peak
+descending and the number of names stored is returned.
+***********************************************************************************************************************************/
+// Merge the peaks of all active contexts below a context
+static void
+memContextStatNameActive(const MemContext *this, MemContextStatName *nameList, unsigned int *nameListSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+        FUNCTION_TEST_PARAM_P(VOID, nameList);
+        FUNCTION_TEST_PARAM_P(UINT, nameListSize);
+    FUNCTION_TEST_END();
+
+    for (unsigned int contextIdx = 0; contextIdx < this->contextChildListSize; contextIdx++)
+    {
+        const MemContext *child = this->contextChildList[contextIdx];
+
+        if (child != NULL && child->state == memContextStateActive)
+        {
+            memContextStatNameMerge(nameList, nameListSize, child->name, child->statPeak);
+            memContextStatNameActive(child, nameList, nameListSize);
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+unsigned int
+memContextStatNameTop(MemContextStatName *result, unsigned int resultMax)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, result);
+        FUNCTION_TEST_PARAM(UINT, resultMax);
+    FUNCTION_TEST_END();
+
+    ASSERT(result != NULL);
+
+    // Combine freed contexts with active contexts
+    MemContextStatName nameList[MEM_CONTEXT_STAT_NAME_MAX];
+    unsigned int nameListSize = memContextStatNameListSize;
+
+    memcpy(nameList, memContextStatNameList, sizeof(MemContextStatName) * nameListSize);
+    memContextStatNameActive(&contextTop, nameList, &nameListSize);
+
+    // Select the highest peaks in order
+    unsigned int resultSize = 0;
+
+    for (; resultSize < resultMax && resultSize < nameListSize; resultSize++)
+    {
+        unsigned int nameIdxMax = resultSize;
+
+        for (unsigned int nameIdx = resultSize + 1; nameIdx < nameListSize; nameIdx++)
+        {
+            if (nameList[nameIdx].peak > nameList[nameIdxMax].peak)
+                nameIdxMax = nameIdx;
+        }
+
+        result[resultSize] = nameList[nameIdxMax];
+        nameList[nameIdxMax] = nameList[resultSize];
+    }
+
+    FUNCTION_TEST_RETURN(resultSize);
+}
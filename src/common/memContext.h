@@ -67,6 +67,42 @@ MemContext *memContextCurrent(void);
 MemContext *memContextTop(void);
 const char *memContextName(MemContext *this);
 
+/***********************************************************************************************************************************
+Memory context statistics
+
+Totals are maintained for each context and include all child contexts, so the memory used by an object (or a command) can be found
+without walking the tree.  Only memory allocated with memNew*() is counted, not the overhead of the contexts themselves.  The peak
+is the highest size the context has reached, which is useful for checking the memory used by an operation:
+
+MemContext *context = memContextNew("test");
+<Do something in the context>
+ASSERT(memContextStat(context).peak < limit);
+
+When a context is freed its peak is recorded by name so memContextStatNameTop() can report the largest contexts at the end of a
+command even when they have been freed.
+
+Statistics are disabled by default so allocations do not pay for updating the totals of every parent context.  Enable them with
+memContextStatEnable() before measuring -- the totals of existing contexts are calculated when statistics are enabled.
+***********************************************************************************************************************************/
+typedef struct MemContextStat
+{
+    size_t size;                                                    // Bytes currently allocated
+    size_t peak;                                                    // Highest bytes allocated at one time
+    unsigned int allocTotal;                                        // Allocations currently active
+} MemContextStat;
+
+typedef struct MemContextStatName
+{
+    const char *name;                                               // Context name
+    unsigned int total;                                             // Contexts with this name (freed and active)
+    size_t peak;                                                    // Highest peak of any context with this name
+} MemContextStatName;
+
+void memContextStatEnable(bool enable);
+MemContextStat memContextStat(const MemContext *this);
+void memContextStatPeakReset(MemContext *this);
+unsigned int memContextStatNameTop(MemContextStatName *result, unsigned int resultMax);
+
 /***********************************************************************************************************************************
 Memory management
 
@@ -126,7 +162,8 @@ MEM_CONTEXT_NEW_END();
 
 <Old memory context is restored>
 
-Note that memory context names are expected to live for the lifetime of the context -- no copy is made.
+Note that memory context names are expected to live for the lifetime of the process (i.e. be literals) -- no copy is made and the
+name is kept for statistics after the context is freed.
 ***********************************************************************************************************************************/
 #define MEM_CONTEXT_NEW()                                                                                                          \
     MEM_CONTEXT_NEW_memContext
@@ -0,0 +1,223 @@
+/***********************************************************************************************************************************
+Sampling Profiler
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <inttypes.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/profile.h"
+#include "common/stackTrace.h"
+#include "common/type/stringList.h"
+#include "version.h"
+
+/***********************************************************************************************************************************
+Sample 100 times per second of CPU time
+***********************************************************************************************************************************/
+#define PROFILE_INTERVAL_USEC                                       10000
+
+/***********************************************************************************************************************************
+Maximum functions recorded for a stack.  Deeper stacks are truncated so the first functions called are kept.
+***********************************************************************************************************************************/
+#define PROFILE_FRAME_MAX                                           64
+
+/***********************************************************************************************************************************
+Maximum distinct stacks.  Samples for new stacks are dropped when the table is full.
+***********************************************************************************************************************************/
+#define PROFILE_STACK_MAX                                           1024
+
+/***********************************************************************************************************************************
+Stack stored in the table.  A slot is empty when the count is zero.
+***********************************************************************************************************************************/
+typedef struct ProfileStack
+{
+    uint64_t count;                                                 // Number of samples with this stack
+    unsigned int frameTotal;                                        // Number of functions recorded
+    bool truncated;                                                 // Were functions omitted because the stack was too deep?
+    StackTraceFrame frameList[PROFILE_FRAME_MAX];                   // Functions, starting with the first function called
+} ProfileStack;
+
+/***********************************************************************************************************************************
+Local variables
+***********************************************************************************************************************************/
+static struct
+{
+    MemContext *memContext;                                         // Mem context for the stack table
+    ProfileStack *stackList;                                        // Stack table, PROFILE_STACK_MAX in size
+    uint64_t dropped;                                               // Samples dropped because the table was full
+} profileLocal;
+
+/***********************************************************************************************************************************
+Add a sample for the current stack
+
+This is called from the signal handler so it must not allocate memory, throw errors, or push onto the stack trace, which is why
+there are no function debug macros.  Stacks are hashed by the addresses of the function names, which are constant strings.
+***********************************************************************************************************************************/
+static void
+profileSample(void)
+{
+    StackTraceFrame frameList[PROFILE_FRAME_MAX];
+    unsigned int frameTotal = stackTraceFrame(frameList, PROFILE_FRAME_MAX);
+    bool truncated = frameTotal > PROFILE_FRAME_MAX;
+
+    if (truncated)
+        frameTotal = PROFILE_FRAME_MAX;
+
+    // FNV-1a hash of the function name addresses
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (unsigned int frameIdx = 0; frameIdx < frameTotal; frameIdx++)
+        hash = (hash ^ (uintptr_t)frameList[frameIdx].functionName) * 1099511628211ULL;
+
+    // Find the stack or an empty slot using linear probing
+    for (unsigned int probeIdx = 0; probeIdx < PROFILE_STACK_MAX; probeIdx++)
+    {
+        ProfileStack *stack = &profileLocal.stackList[(hash + probeIdx) % PROFILE_STACK_MAX];
+
+        if (stack->count == 0)
+        {
+            stack->frameTotal = frameTotal;
+            stack->truncated = truncated;
+            memcpy(stack->frameList, frameList, sizeof(StackTraceFrame) * frameTotal);
+            stack->count = 1;
+
+            return;
+        }
+
+        if (stack->frameTotal == frameTotal && stack->truncated == truncated &&
+            memcmp(stack->frameList, frameList, sizeof(StackTraceFrame) * frameTotal) == 0)
+        {
+            stack->count++;
+            return;
+        }
+    }
+
+    profileLocal.dropped++;
+}
+
+/***********************************************************************************************************************************
+Signal handler
+***********************************************************************************************************************************/
+static void
+profileSignal(int signalType)
+{
+    (void)signalType;
+    profileSample();
+}
+
+/**********************************************************************************************************************************/
+void
+profileStart(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    // Stop a prior run and free the samples.  The timer must be stopped first so the signal handler does not use the freed table.
+    if (profileLocal.memContext != NULL)
+    {
+        profileStop();
+        memContextFree(profileLocal.memContext);
+    }
+
+    MEM_CONTEXT_BEGIN(memContextTop())
+    {
+        MEM_CONTEXT_NEW_BEGIN("Profile")
+        {
+            profileLocal.memContext = MEM_CONTEXT_NEW();
+            profileLocal.stackList = memNew(sizeof(ProfileStack) * PROFILE_STACK_MAX);
+            profileLocal.dropped = 0;
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+    MEM_CONTEXT_END();
+
+    // Restart system calls interrupted by the signal where possible.  Calls that cannot be restarted, e.g. select(), must retry on
+    // EINTR.
+    struct sigaction action = {.sa_handler = profileSignal, .sa_flags = SA_RESTART};
+    sigemptyset(&action.sa_mask);
+
+    THROW_ON_SYS_ERROR(sigaction(SIGPROF, &action, NULL) == -1, KernelError, "unable to set profile signal handler");
+
+    struct itimerval timer =
+    {
+        .it_interval = {.tv_usec = PROFILE_INTERVAL_USEC},
+        .it_value = {.tv_usec = PROFILE_INTERVAL_USEC},
+    };
+
+    THROW_ON_SYS_ERROR(setitimer(ITIMER_PROF, &timer, NULL) == -1, KernelError, "unable to start profile timer");
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+profileStop(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    // Stop the timer and ignore any signal that is already pending
+    struct itimerval timer = {{0}};
+
+    THROW_ON_SYS_ERROR(setitimer(ITIMER_PROF, &timer, NULL) == -1, KernelError, "unable to stop profile timer");
+    signal(SIGPROF, SIG_IGN);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+String *
+profileToFolded(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    String *result = strNew("");
+
+    if (profileLocal.stackList != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            StringList *lineList = strLstNew();
+
+            // Each stack starts with the project so stacks that are empty or dropped still have a frame
+            for (unsigned int stackIdx = 0; stackIdx < PROFILE_STACK_MAX; stackIdx++)
+            {
+                const ProfileStack *stack = &profileLocal.stackList[stackIdx];
+
+                if (stack->count > 0)
+                {
+                    String *line = strNew(PROJECT_BIN);
+
+                    for (unsigned int frameIdx = 0; frameIdx < stack->frameTotal; frameIdx++)
+                    {
+                        const StackTraceFrame *frame = &stack->frameList[frameIdx];
+
+                        strCatFmt(
+                            line, ";%.*s:%s", (int)(strlen(frame->fileName) - 2), frame->fileName, frame->functionName);
+                    }
+
+                    if (stack->truncated)
+                        strCat(line, ";[truncated]");
+
+                    strLstAdd(lineList, strCatFmt(line, " %" PRIu64, stack->count));
+                }
+            }
+
+            if (profileLocal.dropped > 0)
+                strLstAdd(lineList, strNewFmt(PROJECT_BIN ";[dropped] %" PRIu64, profileLocal.dropped));
+
+            // Output stacks sorted so the output is stable
+            if (strLstSize(lineList) > 0)
+            {
+                strCat(result, strPtr(strLstJoin(strLstSort(lineList, sortOrderAsc), "\n")));
+                strCat(result, "\n");
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
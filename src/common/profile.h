@@ -0,0 +1,29 @@
+/***********************************************************************************************************************************
+Sampling Profiler
+
+Samples the functions on the stack trace (see common/stackTrace.h) each time the process receives SIGPROF.  The signal is raised by
+an ITIMER_PROF timer, which only counts CPU time used by the process, so time spent waiting on the network or storage is not
+sampled.  Samples with the same stack are counted together in a table that is allocated when the profiler starts so no memory is
+allocated in the signal handler.
+
+The counts are rendered in the folded stack format, i.e. one line per stack with the functions separated by semicolons followed by
+the count, which is accepted by flame graph tools such as flamegraph.pl.
+***********************************************************************************************************************************/
+#ifndef COMMON_PROFILE_H
+#define COMMON_PROFILE_H
+
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Start sampling.  Samples from a prior run are discarded.
+void profileStart(void);
+
+// Stop sampling
+void profileStop(void);
+
+// Render samples in the folded stack format.  Lines are sorted so the output is stable.
+String *profileToFolded(void);
+
+#endif
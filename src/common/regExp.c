@@ -4,12 +4,14 @@ Regular Expression Handler
 #include "build.auto.h"
 
 #include <regex.h>
+#include <string.h>
 #include <sys/types.h>
 
 #include "common/debug.h"
 #include "common/memContext.h"
 #include "common/object.h"
 #include "common/regExp.h"
+#include "common/type/list.h"
 
 /***********************************************************************************************************************************
 Contains information about the regular expression handler
@@ -18,8 +20,35 @@ struct RegExp
 {
     MemContext *memContext;
     regex_t regExp;
+
+    // Expressions that are a literal string with optional anchors are matched without the regex engine
+    bool literal;                                                   // Is the expression a literal?
+    String *literalValue;                                           // Literal string to match
+    bool literalBegin;                                              // Must the literal match at the beginning?
+    bool literalEnd;                                                // Must the literal match at the end?
 };
 
+/***********************************************************************************************************************************
+Cache of compiled expressions used by regExpMatchOne().  The cache is limited in size since some callers generate expressions that
+are only used once.
+
+regExpNew() does not use the cache.  Its callers keep the compiled expression for as long as they match with it and free it when
+done, so sharing a compiled expression would require reference counting to know when it could be evicted.
+***********************************************************************************************************************************/
+#define REGEXP_CACHE_MAX                                            64
+
+typedef struct RegExpCacheEntry
+{
+    const String *expression;                                       // Expression that was compiled
+    RegExp *regExp;                                                 // Compiled expression
+} RegExpCacheEntry;
+
+static struct RegExpCache
+{
+    MemContext *memContext;                                         // Mem context for the cache
+    List *list;                                                     // List of cached expressions, oldest first
+} regExpCache;
+
 OBJECT_DEFINE_FREE(REGEXP);
 
 /***********************************************************************************************************************************
@@ -27,7 +56,8 @@ Free regular expression
 ***********************************************************************************************************************************/
 OBJECT_DEFINE_FREE_RESOURCE_BEGIN(REGEXP, TEST, )
 {
-    regfree(&this->regExp);
+    if (!this->literal)
+        regfree(&this->regExp);
 }
 OBJECT_DEFINE_FREE_RESOURCE_END(TEST);
 
@@ -51,6 +81,76 @@ regExpError(int error)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Parse the expression to determine if it is a literal string with optional anchors, e.g. ^ABC, \.gz$, ^000000010000000100000001$
+
+Special characters escaped with a backslash are allowed in the literal.  Any other special character means the regex engine is
+required.
+***********************************************************************************************************************************/
+static bool
+regExpLiteral(RegExp *this, const String *expression)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(REGEXP, this);
+        FUNCTION_TEST_PARAM(STRING, expression);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(expression != NULL);
+
+    static const char *const special = ".[]()*+?{}|^$\\";
+
+    const char *expressionPtr = strPtr(expression);
+    size_t expressionSize = strSize(expression);
+    char *literal = memNew(expressionSize + 1);
+    size_t literalSize = 0;
+    bool result = true;
+
+    this->literalBegin = expressionSize > 0 && expressionPtr[0] == '^';
+
+    for (size_t expressionIdx = this->literalBegin ? 1 : 0; expressionIdx < expressionSize; expressionIdx++)
+    {
+        char expressionChr = expressionPtr[expressionIdx];
+
+        // Escaped special characters are part of the literal
+        if (expressionChr == '\\')
+        {
+            expressionIdx++;
+
+            if (expressionIdx == expressionSize || strchr(special, expressionPtr[expressionIdx]) == NULL)
+            {
+                result = false;
+                break;
+            }
+
+            literal[literalSize++] = expressionPtr[expressionIdx];
+        }
+        // An unescaped $ at the end is an anchor
+        else if (expressionChr == '$' && expressionIdx == expressionSize - 1)
+        {
+            this->literalEnd = true;
+        }
+        // Any other special character requires the regex engine
+        else if (strchr(special, expressionChr) != NULL)
+        {
+            result = false;
+            break;
+        }
+        else
+            literal[literalSize++] = expressionChr;
+    }
+
+    if (result)
+    {
+        literal[literalSize] = '\0';
+        this->literalValue = strNew(literal);
+    }
+
+    memFree(literal);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 New regular expression handler
 ***********************************************************************************************************************************/
@@ -70,16 +170,22 @@ regExpNew(const String *expression)
         this = memNew(sizeof(RegExp));
         this->memContext = MEM_CONTEXT_NEW();
 
-        // Compile the regexp and process errors
-        int result = 0;
+        // Literals do not need to be compiled
+        this->literal = regExpLiteral(this, expression);
 
-        if ((result = regcomp(&this->regExp, strPtr(expression), REG_NOSUB | REG_EXTENDED)) != 0)
+        if (!this->literal)
         {
-            memFree(this);
-            regExpError(result);
+            // Compile the regexp and process errors
+            int result = 0;
+
+            if ((result = regcomp(&this->regExp, strPtr(expression), REG_NOSUB | REG_EXTENDED)) != 0)
+            {
+                memFree(this);
+                regExpError(result);
+            }
         }
 
-        // Set free callback to ensure cipher context is freed
+        // Set free callback to ensure regexp is freed
         memContextCallbackSet(this->memContext, regExpFreeResource, this);
     }
     MEM_CONTEXT_NEW_END();
@@ -101,6 +207,23 @@ regExpMatch(RegExp *this, const String *string)
     ASSERT(this != NULL);
     ASSERT(string != NULL);
 
+    // Test for a literal match
+    if (this->literal)
+    {
+        bool result;
+
+        if (this->literalBegin && this->literalEnd)
+            result = strEq(string, this->literalValue);
+        else if (this->literalBegin)
+            result = strBeginsWith(string, this->literalValue);
+        else if (this->literalEnd)
+            result = strEndsWith(string, this->literalValue);
+        else
+            result = strstr(strPtr(string), strPtr(this->literalValue)) != NULL;
+
+        FUNCTION_TEST_RETURN(result);
+    }
+
     // Test for a match
     int result = regexec(&this->regExp, strPtr(string), 0, NULL, 0);
 
@@ -112,6 +235,9 @@ regExpMatch(RegExp *this, const String *string)
 
 /***********************************************************************************************************************************
 Match a regular expression in one call for brevity
+
+Compiled expressions are cached so callers that match the same expression repeatedly (e.g. once per file) only compile it once.
+Callers that create an expression with regExpNew() and match with regExpMatch() are not cached and compile on each regExpNew().
 ***********************************************************************************************************************************/
 bool
 regExpMatchOne(const String *expression, const String *string)
@@ -124,20 +250,57 @@ regExpMatchOne(const String *expression, const String *string)
     ASSERT(expression != NULL);
     ASSERT(string != NULL);
 
-    bool result = false;
-    RegExp *regExp = regExpNew(expression);
+    // Create the cache if it does not exist
+    if (regExpCache.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("RegExpCache")
+            {
+                regExpCache.memContext = MEM_CONTEXT_NEW();
+                regExpCache.list = lstNew(sizeof(RegExpCacheEntry));
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    // Search the cache for the expression
+    RegExp *regExp = NULL;
 
-    TRY_BEGIN()
+    for (unsigned int cacheIdx = 0; cacheIdx < lstSize(regExpCache.list); cacheIdx++)
     {
-        result = regExpMatch(regExp, string);
+        RegExpCacheEntry *entry = lstGet(regExpCache.list, cacheIdx);
+
+        if (strEq(entry->expression, expression))
+        {
+            regExp = entry->regExp;
+            break;
+        }
     }
-    FINALLY()
+
+    // If not found then compile the expression and add it to the cache, removing the oldest entry if the cache is full
+    if (regExp == NULL)
     {
-        regExpFree(regExp);
+        MEM_CONTEXT_BEGIN(regExpCache.memContext)
+        {
+            regExp = regExpNew(expression);
+
+            if (lstSize(regExpCache.list) == REGEXP_CACHE_MAX)
+            {
+                RegExpCacheEntry *entry = lstGet(regExpCache.list, 0);
+
+                strFree((String *)entry->expression);
+                regExpFree(entry->regExp);
+                lstRemoveIdx(regExpCache.list, 0);
+            }
+
+            lstAdd(regExpCache.list, &(RegExpCacheEntry){.expression = strDup(expression), .regExp = regExp});
+        }
+        MEM_CONTEXT_END();
     }
-    TRY_END();
 
-    FUNCTION_TEST_RETURN(result);
+    FUNCTION_TEST_RETURN(regExpMatch(regExp, string));
 }
 
 /***********************************************************************************************************************************
@@ -23,8 +23,10 @@ Max call stack depth
 
 /***********************************************************************************************************************************
 Track stack trace
+
+The stack size is volatile because it may be read by the profiler signal handler while a function is being pushed or popped.
 ***********************************************************************************************************************************/
-static int stackSize = 0;
+static volatile int stackSize = 0;
 
 typedef struct StackTraceData
 {
@@ -367,3 +369,22 @@ stackTraceClean(unsigned int tryDepth)
     while (stackSize > 0 && stackTrace[stackSize - 1].tryDepth >= tryDepth)
         stackSize--;
 }
+
+/***********************************************************************************************************************************
+Copy functions from the stack, starting with the first function called, and return the number of functions on the stack
+
+This is called from the profiler signal handler so it must not allocate memory, throw errors, or push onto the stack trace.
+***********************************************************************************************************************************/
+unsigned int
+stackTraceFrame(StackTraceFrame *frameList, unsigned int frameMax)
+{
+    unsigned int frameTotal = (unsigned int)stackSize;
+
+    for (unsigned int frameIdx = 0; frameIdx < frameTotal && frameIdx < frameMax; frameIdx++)
+    {
+        frameList[frameIdx].fileName = stackTrace[frameIdx].fileName;
+        frameList[frameIdx].functionName = stackTrace[frameIdx].functionName;
+    }
+
+    return frameTotal;
+}
@@ -14,6 +14,15 @@ Maximum size of a single parameter (including NULL terminator)
 ***********************************************************************************************************************************/
 #define STACK_TRACE_PARAM_MAX                                       4096
 
+/***********************************************************************************************************************************
+Function on the stack trace
+***********************************************************************************************************************************/
+typedef struct StackTraceFrame
+{
+    const char *fileName;                                           // File where the function is defined
+    const char *functionName;                                       // Function name
+} StackTraceFrame;
+
 /***********************************************************************************************************************************
 Macros to access internal functions
 ***********************************************************************************************************************************/
@@ -57,4 +66,6 @@ void stackTraceParamAdd(size_t bufferSize);
 
 void stackTraceClean(unsigned int tryDepth);
 
+unsigned int stackTraceFrame(StackTraceFrame *frameList, unsigned int frameMax);
+
 #endif
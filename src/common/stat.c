@@ -0,0 +1,270 @@
+/***********************************************************************************************************************************
+Statistics Collector
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <inttypes.h>
+
+#include "common/debug.h"
+#include "common/memContext.h"
+#include "common/stat.h"
+#include "common/type/json.h"
+#include "common/type/list.h"
+#include "version.h"
+
+/***********************************************************************************************************************************
+Prefix for Prometheus metric names
+***********************************************************************************************************************************/
+#define STAT_PROMETHEUS_PREFIX                                      PROJECT_BIN "_"
+
+/***********************************************************************************************************************************
+Statistic stored in the list.  The key must be the first member so the list can be searched with lstComparatorStr().
+***********************************************************************************************************************************/
+typedef struct StatItem
+{
+    const String *key;                                              // Statistic key
+    StatValue value;                                                // Statistic values
+} StatItem;
+
+/***********************************************************************************************************************************
+Local variables
+***********************************************************************************************************************************/
+static struct
+{
+    MemContext *memContext;                                         // Mem context for statistics
+    List *statList;                                                 // Statistics sorted by key
+
+    void (*callback)(void);                                         // Callback to write snapshots
+    TimeMSec callbackInterval;                                      // Minimum time between callbacks
+    TimeMSec callbackLast;                                          // Time of the last callback
+    bool callbackActive;                                            // Is the callback running? (to prevent recursion)
+} statLocal;
+
+/***********************************************************************************************************************************
+Init local mem context and data structure
+***********************************************************************************************************************************/
+static void
+statInit(void)
+{
+    FUNCTION_TEST_VOID();
+
+    if (statLocal.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            statLocal.memContext = memContextNew("Stat");
+
+            MEM_CONTEXT_BEGIN(statLocal.memContext)
+            {
+                statLocal.statList = lstNewP(sizeof(StatItem), .comparator = lstComparatorStr, .sortOrder = sortOrderAsc);
+            }
+            MEM_CONTEXT_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Add a value to a statistic
+***********************************************************************************************************************************/
+void
+statAdd(const String *key, uint64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(UINT64, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(key != NULL);
+
+    statInit();
+
+    // Find the statistic or add it in sorted order
+    StatItem *item = lstFind(statLocal.statList, &key);
+
+    if (item == NULL)
+    {
+        unsigned int listIdx = 0;
+
+        while (listIdx < lstSize(statLocal.statList) && strCmp(((StatItem *)lstGet(statLocal.statList, listIdx))->key, key) < 0)
+            listIdx++;
+
+        MEM_CONTEXT_BEGIN(lstMemContext(statLocal.statList))
+        {
+            item = lstInsert(statLocal.statList, listIdx, &(StatItem){.key = strDup(key)});
+        }
+        MEM_CONTEXT_END();
+    }
+
+    // Update values
+    item->value.count++;
+    item->value.total += value;
+
+    if (value > item->value.max)
+        item->value.max = value;
+
+    // Call the callback if the interval has elapsed
+    if (statLocal.callback != NULL && !statLocal.callbackActive)
+    {
+        TimeMSec timeCurrent = timeMSec();
+
+        if (timeCurrent - statLocal.callbackLast >= statLocal.callbackInterval)
+        {
+            statLocal.callbackLast = timeCurrent;
+            statLocal.callbackActive = true;
+
+            TRY_BEGIN()
+            {
+                statLocal.callback();
+            }
+            FINALLY()
+            {
+                statLocal.callbackActive = false;
+            }
+            TRY_END();
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Add the time elapsed since timeBegin to a statistic
+***********************************************************************************************************************************/
+void
+statTimeAdd(const String *key, TimeMSec timeBegin)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(UINT64, timeBegin);
+    FUNCTION_TEST_END();
+
+    ASSERT(key != NULL);
+
+    TimeMSec timeCurrent = timeMSec();
+
+    // Guard against the clock going backwards
+    statAdd(key, timeCurrent > timeBegin ? timeCurrent - timeBegin : 0);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the values for a statistic
+***********************************************************************************************************************************/
+StatValue
+statGet(const String *key)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, key);
+    FUNCTION_TEST_END();
+
+    ASSERT(key != NULL);
+
+    StatValue result = {0};
+
+    if (statLocal.statList != NULL)
+    {
+        StatItem *item = lstFind(statLocal.statList, &key);
+
+        if (item != NULL)
+            result = item->value;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Set a callback to write snapshots periodically
+***********************************************************************************************************************************/
+void
+statCallbackSet(void (*callback)(void), TimeMSec interval)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM(UINT64, interval);
+    FUNCTION_TEST_END();
+
+    statLocal.callback = callback;
+    statLocal.callbackInterval = interval;
+    statLocal.callbackLast = timeMSec();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Render all statistics as JSON
+***********************************************************************************************************************************/
+String *
+statToJson(void)
+{
+    FUNCTION_TEST_VOID();
+
+    String *result = strNew("{");
+
+    for (unsigned int statIdx = 0; statLocal.statList != NULL && statIdx < lstSize(statLocal.statList); statIdx++)
+    {
+        const StatItem *item = lstGet(statLocal.statList, statIdx);
+
+        strCatFmt(
+            result, "%s%s:{\"count\":%" PRIu64 ",\"max\":%" PRIu64 ",\"total\":%" PRIu64 "}", statIdx == 0 ? "" : ",",
+            strPtr(jsonFromStr(item->key)), item->value.count, item->value.max, item->value.total);
+    }
+
+    strCat(result, "}");
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Render all statistics in the Prometheus text format
+
+Characters that are not valid in a metric name are replaced with underscores.  Each statistic is rendered as a _count_total counter
+with the number of values added, a _max gauge, and a _total counter with the sum of the values.  Counts and sums only increase
+during a process so they are counters, which lets rate() be used on them.
+***********************************************************************************************************************************/
+String *
+statToPrometheus(const String *label)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, label);
+    FUNCTION_TEST_END();
+
+    String *result = strNew("");
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const char *labelZ = label == NULL ? "" : strPtr(strNewFmt("{%s}", strPtr(label)));
+
+        for (unsigned int statIdx = 0; statLocal.statList != NULL && statIdx < lstSize(statLocal.statList); statIdx++)
+        {
+            const StatItem *item = lstGet(statLocal.statList, statIdx);
+
+            // Build a valid metric name
+            String *name = strNew(STAT_PROMETHEUS_PREFIX);
+
+            for (size_t keyIdx = 0; keyIdx < strSize(item->key); keyIdx++)
+            {
+                char keyChar = strPtr(item->key)[keyIdx];
+
+                strCatChr(
+                    name,
+                    (keyChar >= 'a' && keyChar <= 'z') || (keyChar >= 'A' && keyChar <= 'Z') || (keyChar >= '0' && keyChar <= '9') ?
+                        keyChar : '_');
+            }
+
+            strCatFmt(
+                result,
+                "# TYPE %s_count_total counter\n%s_count_total%s %" PRIu64 "\n"
+                "# TYPE %s_max gauge\n%s_max%s %" PRIu64 "\n"
+                "# TYPE %s_total counter\n%s_total%s %" PRIu64 "\n",
+                strPtr(name), strPtr(name), labelZ, item->value.count, strPtr(name), strPtr(name), labelZ, item->value.max,
+                strPtr(name), strPtr(name), labelZ, item->value.total);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
@@ -0,0 +1,55 @@
+/***********************************************************************************************************************************
+Statistics Collector
+
+Collects statistics about the work done by a process so throughput and latency can be monitored.  Each statistic is identified by a
+key, e.g. backup.file.byte, and tracks the number of values added, their total, and the largest value, so a single statistic can
+report the number of files copied, the bytes copied, and the largest file.  Keys should end in the unit of the value (byte, ms) or
+be a plain count.
+
+Snapshots can be rendered as JSON or in the Prometheus text format.  A callback can be registered to write snapshots periodically
+while long running commands are in progress -- the callback is checked whenever a statistic is added so no timer is required.
+***********************************************************************************************************************************/
+#ifndef COMMON_STAT_H
+#define COMMON_STAT_H
+
+#include <stdint.h>
+
+#include "common/time.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Statistic values
+***********************************************************************************************************************************/
+typedef struct StatValue
+{
+    uint64_t count;                                                 // Number of values added
+    uint64_t total;                                                 // Total of all values added
+    uint64_t max;                                                   // Largest value added
+} StatValue;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Add a value to a statistic
+void statAdd(const String *key, uint64_t value);
+
+// Increment the count of a statistic
+#define statInc(key)                                                                                                               \
+    statAdd(key, 1)
+
+// Add the time elapsed since timeBegin to a statistic
+void statTimeAdd(const String *key, TimeMSec timeBegin);
+
+// Get the values for a statistic (all values are zero if the statistic does not exist)
+StatValue statGet(const String *key);
+
+// Set a callback that will be called no more often than the interval while statistics are being added
+void statCallbackSet(void (*callback)(void), TimeMSec interval);
+
+// Render all statistics as JSON
+String *statToJson(void);
+
+// Render all statistics in the Prometheus text format.  The label (if not NULL) is added to each metric, e.g. stanza="demo".
+String *statToPrometheus(const String *label);
+
+#endif
@@ -23,11 +23,23 @@ struct List
     unsigned int listSizeMax;
     unsigned char *list;
     ListComparator *comparator;
+    SortOrder sortOrder;                                            // Current sort order of the list (none if unknown)
 };
 
 OBJECT_DEFINE_MOVE(LIST);
 OBJECT_DEFINE_FREE(LIST);
 
+/***********************************************************************************************************************************
+List used by the descending comparator since qsort() and bsearch() do not allow a context to be passed
+***********************************************************************************************************************************/
+static const List *lstSortList = NULL;
+
+static int
+lstSortDescComparator(const void *item1, const void *item2)
+{
+    return lstSortList->comparator(item2, item1);
+}
+
 /***********************************************************************************************************************************
 Create a new list
 ***********************************************************************************************************************************/
@@ -47,8 +59,11 @@ lstNewParam(size_t itemSize, ListParam param)
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(SIZE, itemSize);
         FUNCTION_TEST_PARAM(FUNCTIONP, param.comparator);
+        FUNCTION_TEST_PARAM(ENUM, param.sortOrder);
     FUNCTION_TEST_END();
 
+    ASSERT(param.sortOrder == sortOrderNone || param.comparator != NULL);
+
     List *this = NULL;
 
     MEM_CONTEXT_NEW_BEGIN("List")
@@ -58,6 +73,7 @@ lstNewParam(size_t itemSize, ListParam param)
         this->memContext = MEM_CONTEXT_NEW();
         this->itemSize = itemSize;
         this->comparator = param.comparator;
+        this->sortOrder = param.sortOrder;
     }
     MEM_CONTEXT_NEW_END();
 
@@ -162,12 +178,34 @@ lstFindIdx(const List *this, const void *item)
 
     unsigned int result = LIST_NOT_FOUND;
 
-    for (unsigned int listIdx = 0; listIdx < lstSize(this); listIdx++)
+    // If the list is sorted then use a binary search
+    if (this->sortOrder != sortOrderNone)
     {
-        if (this->comparator(item, lstGet(this, listIdx)) == 0)
+        lstSortList = this;
+
+        const unsigned char *found = bsearch(
+            item, this->list, this->listSize, this->itemSize,
+            this->sortOrder == sortOrderAsc ? this->comparator : lstSortDescComparator);
+
+        if (found != NULL)
         {
-            result = listIdx;
-            break;
+            result = (unsigned int)((size_t)(found - this->list) / this->itemSize);
+
+            // Return the first matching item to be consistent with the linear search when there are duplicates
+            while (result > 0 && this->comparator(item, this->list + ((result - 1) * this->itemSize)) == 0)
+                result--;
+        }
+    }
+    // Else search the entire list
+    else
+    {
+        for (unsigned int listIdx = 0; listIdx < lstSize(this); listIdx++)
+        {
+            if (this->comparator(item, lstGet(this, listIdx)) == 0)
+            {
+                result = listIdx;
+                break;
+            }
         }
     }
 
@@ -241,6 +279,20 @@ lstInsert(List *this, unsigned int listIdx, const void *item)
         MEM_CONTEXT_END();
     }
 
+    // If the list is sorted then make sure the new item does not break the sort order.  If it does then the list is no longer
+    // considered sorted.
+    if (this->sortOrder != sortOrderNone)
+    {
+        ListComparator *comparator = this->sortOrder == sortOrderAsc ? this->comparator : lstSortDescComparator;
+        lstSortList = this;
+
+        if ((listIdx > 0 && comparator(this->list + ((listIdx - 1) * this->itemSize), item) > 0) ||
+            (listIdx < lstSize(this) && comparator(item, this->list + (listIdx * this->itemSize)) > 0))
+        {
+            this->sortOrder = sortOrderNone;
+        }
+    }
+
     // If not inserting at the end then move items down to make space
     void *itemPtr = this->list + (listIdx * this->itemSize);
 
@@ -332,14 +384,6 @@ lstSize(const List *this)
 /***********************************************************************************************************************************
 List sort
 ***********************************************************************************************************************************/
-static List *lstSortList = NULL;
-
-static int
-lstSortDescComparator(const void *item1, const void *item2)
-{
-    return lstSortList->comparator(item2, item1);
-}
-
 List *
 lstSort(List *this, SortOrder sortOrder)
 {
@@ -371,9 +415,44 @@ lstSort(List *this, SortOrder sortOrder)
             break;
     }
 
+    // Store the sort order so searches can take advantage of it.  If no sort was done then the current sort order is retained.
+    if (sortOrder != sortOrderNone)
+        this->sortOrder = sortOrder;
+
     FUNCTION_TEST_RETURN(this);
 }
 
+/***********************************************************************************************************************************
+Get the comparator
+***********************************************************************************************************************************/
+ListComparator *
+lstComparator(const List *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->comparator);
+}
+
+/***********************************************************************************************************************************
+Get the sort order.  The sort order is set by lstSort() and reset to none when an item is inserted out of order or the comparator
+is changed.
+***********************************************************************************************************************************/
+SortOrder
+lstSortOrder(const List *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->sortOrder);
+}
+
 /***********************************************************************************************************************************
 Set a new comparator
 ***********************************************************************************************************************************/
@@ -387,6 +466,10 @@ lstComparatorSet(List *this, ListComparator *comparator)
 
     ASSERT(this != NULL);
 
+    // The list is not known to be sorted by a different comparator
+    if (comparator != this->comparator)
+        this->sortOrder = sortOrderNone;
+
     this->comparator = comparator;
 
     FUNCTION_TEST_RETURN(this);
@@ -55,6 +55,7 @@ List *lstNew(size_t itemSize);
 typedef struct ListParam
 {
     ListComparator *comparator;
+    SortOrder sortOrder;
 } ListParam;
 
 #define lstNewP(itemSize, ...)                                                                                                     \
@@ -79,6 +80,12 @@ List *lstMove(List *this, MemContext *parentNew);
 unsigned int lstSize(const List *this);
 List *lstSort(List *this, SortOrder sortOrder);
 
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+ListComparator *lstComparator(const List *this);
+SortOrder lstSortOrder(const List *this);
+
 /***********************************************************************************************************************************
 Setters
 ***********************************************************************************************************************************/
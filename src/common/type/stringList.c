@@ -253,8 +253,9 @@ strLstDup(const StringList *sourceList)
 
     if (sourceList != NULL)
     {
-        // Create the list
-        this = strLstNew();
+        // Create the list with the same comparator and sort order as the source list
+        this = (StringList *)lstNewP(
+            sizeof(String *), .comparator = lstComparator((List *)sourceList), .sortOrder = lstSortOrder((List *)sourceList));
 
         // Copy strings
         MEM_CONTEXT_BEGIN(lstMemContext((List *)this))
@@ -268,6 +269,22 @@ strLstDup(const StringList *sourceList)
     FUNCTION_TEST_RETURN(this);
 }
 
+/***********************************************************************************************************************************
+Is the list sorted with the default string comparator?  If so, a binary search will give the same results as a linear search.
+***********************************************************************************************************************************/
+static bool
+strLstSortedStr(const StringList *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(
+        lstSortOrder((const List *)this) != sortOrderNone && lstComparator((const List *)this) == lstComparatorStr);
+}
+
 /***********************************************************************************************************************************
 Does the specified string exist in the list?
 ***********************************************************************************************************************************/
@@ -283,12 +300,21 @@ strLstExists(const StringList *this, const String *string)
 
     bool result = false;
 
-    for (unsigned int listIdx = 0; listIdx < strLstSize(this); listIdx++)
+    // If the list is sorted by string then use a binary search
+    if (strLstSortedStr(this))
+    {
+        result = lstFindIdx((List *)this, &string) != LIST_NOT_FOUND;
+    }
+    // Else search the entire list
+    else
     {
-        if (strEq(strLstGet(this, listIdx), string))
+        for (unsigned int listIdx = 0; listIdx < strLstSize(this); listIdx++)
         {
-            result = true;
-            break;
+            if (strEq(strLstGet(this, listIdx), string))
+            {
+                result = true;
+                break;
+            }
         }
     }
 
@@ -307,12 +333,22 @@ strLstExistsZ(const StringList *this, const char *cstring)
 
     bool result = false;
 
-    for (unsigned int listIdx = 0; listIdx < strLstSize(this); listIdx++)
+    // If the list is sorted by string then use a binary search
+    if (strLstSortedStr(this))
+    {
+        const String *string = STR(cstring);
+        result = lstFindIdx((List *)this, &string) != LIST_NOT_FOUND;
+    }
+    // Else search the entire list
+    else
     {
-        if (strEqZ(strLstGet(this, listIdx), cstring))
+        for (unsigned int listIdx = 0; listIdx < strLstSize(this); listIdx++)
         {
-            result = true;
-            break;
+            if (strEqZ(strLstGet(this, listIdx), cstring))
+            {
+                result = true;
+                break;
+            }
         }
     }
 
@@ -0,0 +1,217 @@
+/***********************************************************************************************************************************
+String Set Handler
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/debug.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/stringSet.h"
+
+/***********************************************************************************************************************************
+Initial number of buckets.  The number of buckets is always a power of two so the bucket can be found by masking the hash.
+***********************************************************************************************************************************/
+#define STRING_SET_BUCKET_INITIAL                                   16
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct StringSet
+{
+    MemContext *memContext;                                         // Mem context for the set
+    unsigned int size;                                              // Number of strings in the set
+    unsigned int bucketTotal;                                       // Number of buckets (always a power of two)
+    String **bucket;                                                // Buckets using open addressing (NULL when empty)
+};
+
+OBJECT_DEFINE_MOVE(STRING_SET);
+OBJECT_DEFINE_FREE(STRING_SET);
+
+/***********************************************************************************************************************************
+Hash a string using FNV-1a, which is fast and distributes well for the short strings (e.g. file names) stored in a set
+***********************************************************************************************************************************/
+static uint32_t
+strSetHash(const String *string)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, string);
+    FUNCTION_TEST_END();
+
+    ASSERT(string != NULL);
+
+    uint32_t result = 2166136261U;
+    const unsigned char *buffer = (const unsigned char *)strPtr(string);
+
+    for (size_t bufferIdx = 0; bufferIdx < strSize(string); bufferIdx++)
+    {
+        result ^= buffer[bufferIdx];
+        result *= 16777619U;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Find the bucket for a string.  If the string is not in the set then the empty bucket where it would be stored is returned.
+***********************************************************************************************************************************/
+static unsigned int
+strSetBucket(String *const *bucket, unsigned int bucketTotal, const String *string)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, bucket);
+        FUNCTION_TEST_PARAM(UINT, bucketTotal);
+        FUNCTION_TEST_PARAM(STRING, string);
+    FUNCTION_TEST_END();
+
+    ASSERT(bucket != NULL);
+    ASSERT(string != NULL);
+
+    // Probe linearly from the hashed bucket.  There is always at least one empty bucket so this loop will terminate.
+    unsigned int result = strSetHash(string) & (bucketTotal - 1);
+
+    while (bucket[result] != NULL && !strEq(bucket[result], string))
+        result = (result + 1) & (bucketTotal - 1);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Create a new string set
+***********************************************************************************************************************************/
+StringSet *
+strSetNew(void)
+{
+    FUNCTION_TEST_VOID();
+
+    StringSet *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StringSet")
+    {
+        this = memNew(sizeof(StringSet));
+        this->memContext = MEM_CONTEXT_NEW();
+        this->bucketTotal = STRING_SET_BUCKET_INITIAL;
+        this->bucket = memNew(this->bucketTotal * sizeof(String *));
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/***********************************************************************************************************************************
+Create a new string set from a string list.  Duplicates in the list are only added once.
+***********************************************************************************************************************************/
+StringSet *
+strSetNewStrLst(const StringList *sourceList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, sourceList);
+    FUNCTION_TEST_END();
+
+    ASSERT(sourceList != NULL);
+
+    StringSet *this = strSetNew();
+
+    for (unsigned int listIdx = 0; listIdx < strLstSize(sourceList); listIdx++)
+        strSetAdd(this, strLstGet(sourceList, listIdx));
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/***********************************************************************************************************************************
+Add a string to the set.  Returns true if the string was added or false if it already existed.
+***********************************************************************************************************************************/
+bool
+strSetAdd(StringSet *this, const String *string)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_SET, this);
+        FUNCTION_TEST_PARAM(STRING, string);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(string != NULL);
+
+    bool result = false;
+    unsigned int bucketIdx = strSetBucket(this->bucket, this->bucketTotal, string);
+
+    if (this->bucket[bucketIdx] == NULL)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            // Keep the set no more than half full so probe sequences stay short.  When the set is grown all strings are rehashed
+            // into the new buckets.
+            if ((this->size + 1) * 2 > this->bucketTotal)
+            {
+                unsigned int bucketTotal = this->bucketTotal * 2;
+                String **bucket = memNew(bucketTotal * sizeof(String *));
+
+                for (unsigned int bucketOldIdx = 0; bucketOldIdx < this->bucketTotal; bucketOldIdx++)
+                {
+                    if (this->bucket[bucketOldIdx] != NULL)
+                    {
+                        bucket[strSetBucket(bucket, bucketTotal, this->bucket[bucketOldIdx])] = this->bucket[bucketOldIdx];
+                    }
+                }
+
+                memFree(this->bucket);
+
+                this->bucket = bucket;
+                this->bucketTotal = bucketTotal;
+
+                bucketIdx = strSetBucket(this->bucket, this->bucketTotal, string);
+            }
+
+            this->bucket[bucketIdx] = strDup(string);
+            this->size++;
+        }
+        MEM_CONTEXT_END();
+
+        result = true;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Does the string exist in the set?
+***********************************************************************************************************************************/
+bool
+strSetExists(const StringSet *this, const String *string)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_SET, this);
+        FUNCTION_TEST_PARAM(STRING, string);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(string != NULL);
+
+    FUNCTION_TEST_RETURN(this->bucket[strSetBucket(this->bucket, this->bucketTotal, string)] != NULL);
+}
+
+/***********************************************************************************************************************************
+Number of strings in the set
+***********************************************************************************************************************************/
+unsigned int
+strSetSize(const StringSet *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_SET, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->size);
+}
+
+/***********************************************************************************************************************************
+Render as string for logging
+***********************************************************************************************************************************/
+String *
+strSetToLog(const StringSet *this)
+{
+    return strNewFmt("{size: %u}", this->size);
+}
@@ -0,0 +1,52 @@
+/***********************************************************************************************************************************
+String Set Handler
+
+A set of unique strings stored in a hash table so adding and checking for existence are constant time operations rather than linear
+(or logarithmic when sorted) as they are for a StringList.  Use a StringSet when checking for existence in a large set of strings,
+especially when the checks are done in a loop.  Strings are copied into the set's mem context when they are added.
+***********************************************************************************************************************************/
+#ifndef COMMON_TYPE_STRINGSET_H
+#define COMMON_TYPE_STRINGSET_H
+
+/***********************************************************************************************************************************
+StringSet object
+***********************************************************************************************************************************/
+#define STRING_SET_TYPE                                             StringSet
+#define STRING_SET_PREFIX                                           strSet
+
+typedef struct StringSet StringSet;
+
+#include "common/memContext.h"
+#include "common/type/string.h"
+#include "common/type/stringList.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+StringSet *strSetNew(void);
+StringSet *strSetNewStrLst(const StringList *sourceList);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+bool strSetAdd(StringSet *this, const String *string);
+bool strSetExists(const StringSet *this, const String *string);
+StringSet *strSetMove(StringSet *this, MemContext *parentNew);
+unsigned int strSetSize(const StringSet *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+void strSetFree(StringSet *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+String *strSetToLog(const StringSet *this);
+
+#define FUNCTION_LOG_STRING_SET_TYPE                                                                                               \
+    StringSet *
+#define FUNCTION_LOG_STRING_SET_FORMAT(value, buffer, bufferSize)                                                                  \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, strSetToLog, buffer, bufferSize)
+
+#endif
@@ -20,11 +20,13 @@ STRING_EXTERN(CFGCMD_LOCAL_STR,                                     CFGCMD_LOCAL
 STRING_EXTERN(CFGCMD_LS_STR,                                        CFGCMD_LS);
 STRING_EXTERN(CFGCMD_REMOTE_STR,                                    CFGCMD_REMOTE);
 STRING_EXTERN(CFGCMD_RESTORE_STR,                                   CFGCMD_RESTORE);
+STRING_EXTERN(CFGCMD_SERVER_STR,                                    CFGCMD_SERVER);
 STRING_EXTERN(CFGCMD_STANZA_CREATE_STR,                             CFGCMD_STANZA_CREATE);
 STRING_EXTERN(CFGCMD_STANZA_DELETE_STR,                             CFGCMD_STANZA_DELETE);
 STRING_EXTERN(CFGCMD_STANZA_UPGRADE_STR,                            CFGCMD_STANZA_UPGRADE);
 STRING_EXTERN(CFGCMD_START_STR,                                     CFGCMD_START);
 STRING_EXTERN(CFGCMD_STOP_STR,                                      CFGCMD_STOP);
+STRING_EXTERN(CFGCMD_VERIFY_STR,                                    CFGCMD_VERIFY);
 STRING_EXTERN(CFGCMD_VERSION_STR,                                   CFGCMD_VERSION);
 
 /***********************************************************************************************************************************
@@ -214,6 +216,20 @@ static ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COMMAND_L
         CONFIG_COMMAND_PARAMETER_ALLOWED(false)
     )
 
+    CONFIG_COMMAND
+    (
+        CONFIG_COMMAND_NAME(CFGCMD_SERVER)
+
+        CONFIG_COMMAND_INTERNAL(false)
+        CONFIG_COMMAND_LOG_FILE(true)
+        CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
+        CONFIG_COMMAND_LOG_LEVEL_STDERR_MAX(logLevelTrace)
+        CONFIG_COMMAND_LOCK_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
+        CONFIG_COMMAND_PARAMETER_ALLOWED(false)
+    )
+
     CONFIG_COMMAND
     (
         CONFIG_COMMAND_NAME(CFGCMD_STANZA_CREATE)
@@ -284,6 +300,20 @@ static ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COMMAND_L
         CONFIG_COMMAND_PARAMETER_ALLOWED(false)
     )
 
+    CONFIG_COMMAND
+    (
+        CONFIG_COMMAND_NAME(CFGCMD_VERIFY)
+
+        CONFIG_COMMAND_INTERNAL(false)
+        CONFIG_COMMAND_LOG_FILE(true)
+        CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
+        CONFIG_COMMAND_LOG_LEVEL_STDERR_MAX(logLevelTrace)
+        CONFIG_COMMAND_LOCK_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
+        CONFIG_COMMAND_PARAMETER_ALLOWED(false)
+    )
+
     CONFIG_COMMAND
     (
         CONFIG_COMMAND_NAME(CFGCMD_VERSION)
@@ -306,8 +336,11 @@ STRING_EXTERN(CFGOPT_ARCHIVE_ASYNC_STR,                             CFGOPT_ARCHI
 STRING_EXTERN(CFGOPT_ARCHIVE_CHECK_STR,                             CFGOPT_ARCHIVE_CHECK);
 STRING_EXTERN(CFGOPT_ARCHIVE_COPY_STR,                              CFGOPT_ARCHIVE_COPY);
 STRING_EXTERN(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR,                     CFGOPT_ARCHIVE_GET_QUEUE_MAX);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG_STR,             CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG);
 STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR,                    CFGOPT_ARCHIVE_PUSH_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_TIMEOUT_STR,                           CFGOPT_ARCHIVE_TIMEOUT);
+STRING_EXTERN(CFGOPT_BACKUP_CIPHER_SIDE_STR,                        CFGOPT_BACKUP_CIPHER_SIDE);
+STRING_EXTERN(CFGOPT_BACKUP_COMPRESS_SIDE_STR,                      CFGOPT_BACKUP_COMPRESS_SIDE);
 STRING_EXTERN(CFGOPT_BACKUP_STANDBY_STR,                            CFGOPT_BACKUP_STANDBY);
 STRING_EXTERN(CFGOPT_BUFFER_SIZE_STR,                               CFGOPT_BUFFER_SIZE);
 STRING_EXTERN(CFGOPT_C_STR,                                         CFGOPT_C);
@@ -337,6 +370,7 @@ STRING_EXTERN(CFGOPT_LOG_PATH_STR,                                  CFGOPT_LOG_P
 STRING_EXTERN(CFGOPT_LOG_SUBPROCESS_STR,                            CFGOPT_LOG_SUBPROCESS);
 STRING_EXTERN(CFGOPT_LOG_TIMESTAMP_STR,                             CFGOPT_LOG_TIMESTAMP);
 STRING_EXTERN(CFGOPT_MANIFEST_SAVE_THRESHOLD_STR,                   CFGOPT_MANIFEST_SAVE_THRESHOLD);
+STRING_EXTERN(CFGOPT_METRIC_PATH_STR,                               CFGOPT_METRIC_PATH);
 STRING_EXTERN(CFGOPT_NEUTRAL_UMASK_STR,                             CFGOPT_NEUTRAL_UMASK);
 STRING_EXTERN(CFGOPT_ONLINE_STR,                                    CFGOPT_ONLINE);
 STRING_EXTERN(CFGOPT_OUTPUT_STR,                                    CFGOPT_OUTPUT);
@@ -349,6 +383,30 @@ STRING_EXTERN(CFGOPT_PG5_HOST_STR,                                  CFGOPT_PG5_H
 STRING_EXTERN(CFGOPT_PG6_HOST_STR,                                  CFGOPT_PG6_HOST);
 STRING_EXTERN(CFGOPT_PG7_HOST_STR,                                  CFGOPT_PG7_HOST);
 STRING_EXTERN(CFGOPT_PG8_HOST_STR,                                  CFGOPT_PG8_HOST);
+STRING_EXTERN(CFGOPT_PG1_HOST_CA_FILE_STR,                          CFGOPT_PG1_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG2_HOST_CA_FILE_STR,                          CFGOPT_PG2_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG3_HOST_CA_FILE_STR,                          CFGOPT_PG3_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG4_HOST_CA_FILE_STR,                          CFGOPT_PG4_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG5_HOST_CA_FILE_STR,                          CFGOPT_PG5_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG6_HOST_CA_FILE_STR,                          CFGOPT_PG6_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG7_HOST_CA_FILE_STR,                          CFGOPT_PG7_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG8_HOST_CA_FILE_STR,                          CFGOPT_PG8_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_PG1_HOST_CA_PATH_STR,                          CFGOPT_PG1_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG2_HOST_CA_PATH_STR,                          CFGOPT_PG2_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG3_HOST_CA_PATH_STR,                          CFGOPT_PG3_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG4_HOST_CA_PATH_STR,                          CFGOPT_PG4_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG5_HOST_CA_PATH_STR,                          CFGOPT_PG5_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG6_HOST_CA_PATH_STR,                          CFGOPT_PG6_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG7_HOST_CA_PATH_STR,                          CFGOPT_PG7_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG8_HOST_CA_PATH_STR,                          CFGOPT_PG8_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_PG1_HOST_CERT_FILE_STR,                        CFGOPT_PG1_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG2_HOST_CERT_FILE_STR,                        CFGOPT_PG2_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG3_HOST_CERT_FILE_STR,                        CFGOPT_PG3_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG4_HOST_CERT_FILE_STR,                        CFGOPT_PG4_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG5_HOST_CERT_FILE_STR,                        CFGOPT_PG5_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG6_HOST_CERT_FILE_STR,                        CFGOPT_PG6_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG7_HOST_CERT_FILE_STR,                        CFGOPT_PG7_HOST_CERT_FILE);
+STRING_EXTERN(CFGOPT_PG8_HOST_CERT_FILE_STR,                        CFGOPT_PG8_HOST_CERT_FILE);
 STRING_EXTERN(CFGOPT_PG1_HOST_CMD_STR,                              CFGOPT_PG1_HOST_CMD);
 STRING_EXTERN(CFGOPT_PG2_HOST_CMD_STR,                              CFGOPT_PG2_HOST_CMD);
 STRING_EXTERN(CFGOPT_PG3_HOST_CMD_STR,                              CFGOPT_PG3_HOST_CMD);
@@ -381,6 +439,14 @@ STRING_EXTERN(CFGOPT_PG5_HOST_CONFIG_PATH_STR,                      CFGOPT_PG5_H
 STRING_EXTERN(CFGOPT_PG6_HOST_CONFIG_PATH_STR,                      CFGOPT_PG6_HOST_CONFIG_PATH);
 STRING_EXTERN(CFGOPT_PG7_HOST_CONFIG_PATH_STR,                      CFGOPT_PG7_HOST_CONFIG_PATH);
 STRING_EXTERN(CFGOPT_PG8_HOST_CONFIG_PATH_STR,                      CFGOPT_PG8_HOST_CONFIG_PATH);
+STRING_EXTERN(CFGOPT_PG1_HOST_KEY_FILE_STR,                         CFGOPT_PG1_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG2_HOST_KEY_FILE_STR,                         CFGOPT_PG2_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG3_HOST_KEY_FILE_STR,                         CFGOPT_PG3_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG4_HOST_KEY_FILE_STR,                         CFGOPT_PG4_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG5_HOST_KEY_FILE_STR,                         CFGOPT_PG5_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG6_HOST_KEY_FILE_STR,                         CFGOPT_PG6_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG7_HOST_KEY_FILE_STR,                         CFGOPT_PG7_HOST_KEY_FILE);
+STRING_EXTERN(CFGOPT_PG8_HOST_KEY_FILE_STR,                         CFGOPT_PG8_HOST_KEY_FILE);
 STRING_EXTERN(CFGOPT_PG1_HOST_PORT_STR,                             CFGOPT_PG1_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG2_HOST_PORT_STR,                             CFGOPT_PG2_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG3_HOST_PORT_STR,                             CFGOPT_PG3_HOST_PORT);
@@ -389,6 +455,14 @@ STRING_EXTERN(CFGOPT_PG5_HOST_PORT_STR,                             CFGOPT_PG5_H
 STRING_EXTERN(CFGOPT_PG6_HOST_PORT_STR,                             CFGOPT_PG6_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG7_HOST_PORT_STR,                             CFGOPT_PG7_HOST_PORT);
 STRING_EXTERN(CFGOPT_PG8_HOST_PORT_STR,                             CFGOPT_PG8_HOST_PORT);
+STRING_EXTERN(CFGOPT_PG1_HOST_TYPE_STR,                             CFGOPT_PG1_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG2_HOST_TYPE_STR,                             CFGOPT_PG2_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG3_HOST_TYPE_STR,                             CFGOPT_PG3_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG4_HOST_TYPE_STR,                             CFGOPT_PG4_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG5_HOST_TYPE_STR,                             CFGOPT_PG5_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG6_HOST_TYPE_STR,                             CFGOPT_PG6_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG7_HOST_TYPE_STR,                             CFGOPT_PG7_HOST_TYPE);
+STRING_EXTERN(CFGOPT_PG8_HOST_TYPE_STR,                             CFGOPT_PG8_HOST_TYPE);
 STRING_EXTERN(CFGOPT_PG1_HOST_USER_STR,                             CFGOPT_PG1_HOST_USER);
 STRING_EXTERN(CFGOPT_PG2_HOST_USER_STR,                             CFGOPT_PG2_HOST_USER);
 STRING_EXTERN(CFGOPT_PG3_HOST_USER_STR,                             CFGOPT_PG3_HOST_USER);
@@ -423,18 +497,26 @@ STRING_EXTERN(CFGOPT_PG7_SOCKET_PATH_STR,                           CFGOPT_PG7_S
 STRING_EXTERN(CFGOPT_PG8_SOCKET_PATH_STR,                           CFGOPT_PG8_SOCKET_PATH);
 STRING_EXTERN(CFGOPT_PROCESS_STR,                                   CFGOPT_PROCESS);
 STRING_EXTERN(CFGOPT_PROCESS_MAX_STR,                               CFGOPT_PROCESS_MAX);
+STRING_EXTERN(CFGOPT_PROFILE_STR,                                   CFGOPT_PROFILE);
 STRING_EXTERN(CFGOPT_PROTOCOL_TIMEOUT_STR,                          CFGOPT_PROTOCOL_TIMEOUT);
 STRING_EXTERN(CFGOPT_RECOVERY_OPTION_STR,                           CFGOPT_RECOVERY_OPTION);
 STRING_EXTERN(CFGOPT_RECURSE_STR,                                   CFGOPT_RECURSE);
+STRING_EXTERN(CFGOPT_REPO1_CACHE_PATH_STR,                          CFGOPT_REPO1_CACHE_PATH);
+STRING_EXTERN(CFGOPT_REPO1_CACHE_SIZE_STR,                          CFGOPT_REPO1_CACHE_SIZE);
 STRING_EXTERN(CFGOPT_REPO1_CIPHER_PASS_STR,                         CFGOPT_REPO1_CIPHER_PASS);
 STRING_EXTERN(CFGOPT_REPO1_CIPHER_TYPE_STR,                         CFGOPT_REPO1_CIPHER_TYPE);
 STRING_EXTERN(CFGOPT_REPO1_HARDLINK_STR,                            CFGOPT_REPO1_HARDLINK);
 STRING_EXTERN(CFGOPT_REPO1_HOST_STR,                                CFGOPT_REPO1_HOST);
+STRING_EXTERN(CFGOPT_REPO1_HOST_CA_FILE_STR,                        CFGOPT_REPO1_HOST_CA_FILE);
+STRING_EXTERN(CFGOPT_REPO1_HOST_CA_PATH_STR,                        CFGOPT_REPO1_HOST_CA_PATH);
+STRING_EXTERN(CFGOPT_REPO1_HOST_CERT_FILE_STR,                      CFGOPT_REPO1_HOST_CERT_FILE);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CMD_STR,                            CFGOPT_REPO1_HOST_CMD);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CONFIG_STR,                         CFGOPT_REPO1_HOST_CONFIG);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CONFIG_INCLUDE_PATH_STR,            CFGOPT_REPO1_HOST_CONFIG_INCLUDE_PATH);
 STRING_EXTERN(CFGOPT_REPO1_HOST_CONFIG_PATH_STR,                    CFGOPT_REPO1_HOST_CONFIG_PATH);
+STRING_EXTERN(CFGOPT_REPO1_HOST_KEY_FILE_STR,                       CFGOPT_REPO1_HOST_KEY_FILE);
 STRING_EXTERN(CFGOPT_REPO1_HOST_PORT_STR,                           CFGOPT_REPO1_HOST_PORT);
+STRING_EXTERN(CFGOPT_REPO1_HOST_TYPE_STR,                           CFGOPT_REPO1_HOST_TYPE);
 STRING_EXTERN(CFGOPT_REPO1_HOST_USER_STR,                           CFGOPT_REPO1_HOST_USER);
 STRING_EXTERN(CFGOPT_REPO1_PATH_STR,                                CFGOPT_REPO1_PATH);
 STRING_EXTERN(CFGOPT_REPO1_RETENTION_ARCHIVE_STR,                   CFGOPT_REPO1_RETENTION_ARCHIVE);
@@ -448,6 +530,7 @@ STRING_EXTERN(CFGOPT_REPO1_S3_ENDPOINT_STR,                         CFGOPT_REPO1
 STRING_EXTERN(CFGOPT_REPO1_S3_HOST_STR,                             CFGOPT_REPO1_S3_HOST);
 STRING_EXTERN(CFGOPT_REPO1_S3_KEY_STR,                              CFGOPT_REPO1_S3_KEY);
 STRING_EXTERN(CFGOPT_REPO1_S3_KEY_SECRET_STR,                       CFGOPT_REPO1_S3_KEY_SECRET);
+STRING_EXTERN(CFGOPT_REPO1_S3_LIST_PARALLEL_STR,                    CFGOPT_REPO1_S3_LIST_PARALLEL);
 STRING_EXTERN(CFGOPT_REPO1_S3_PORT_STR,                             CFGOPT_REPO1_S3_PORT);
 STRING_EXTERN(CFGOPT_REPO1_S3_REGION_STR,                           CFGOPT_REPO1_S3_REGION);
 STRING_EXTERN(CFGOPT_REPO1_S3_TOKEN_STR,                            CFGOPT_REPO1_S3_TOKEN);
@@ -456,6 +539,7 @@ STRING_EXTERN(CFGOPT_REPO1_TYPE_STR,                                CFGOPT_REPO1
 STRING_EXTERN(CFGOPT_RESUME_STR,                                    CFGOPT_RESUME);
 STRING_EXTERN(CFGOPT_SET_STR,                                       CFGOPT_SET);
 STRING_EXTERN(CFGOPT_SORT_STR,                                      CFGOPT_SORT);
+STRING_EXTERN(CFGOPT_SORT_MAX_STR,                                  CFGOPT_SORT_MAX);
 STRING_EXTERN(CFGOPT_SPOOL_PATH_STR,                                CFGOPT_SPOOL_PATH);
 STRING_EXTERN(CFGOPT_STANZA_STR,                                    CFGOPT_STANZA);
 STRING_EXTERN(CFGOPT_START_FAST_STR,                                CFGOPT_START_FAST);
@@ -469,6 +553,12 @@ STRING_EXTERN(CFGOPT_TARGET_TIMELINE_STR,                           CFGOPT_TARGE
 STRING_EXTERN(CFGOPT_TEST_STR,                                      CFGOPT_TEST);
 STRING_EXTERN(CFGOPT_TEST_DELAY_STR,                                CFGOPT_TEST_DELAY);
 STRING_EXTERN(CFGOPT_TEST_POINT_STR,                                CFGOPT_TEST_POINT);
+STRING_EXTERN(CFGOPT_TLS_SERVER_ADDRESS_STR,                        CFGOPT_TLS_SERVER_ADDRESS);
+STRING_EXTERN(CFGOPT_TLS_SERVER_AUTH_STR,                           CFGOPT_TLS_SERVER_AUTH);
+STRING_EXTERN(CFGOPT_TLS_SERVER_CA_FILE_STR,                        CFGOPT_TLS_SERVER_CA_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_CERT_FILE_STR,                      CFGOPT_TLS_SERVER_CERT_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_KEY_FILE_STR,                       CFGOPT_TLS_SERVER_KEY_FILE);
+STRING_EXTERN(CFGOPT_TLS_SERVER_PORT_STR,                           CFGOPT_TLS_SERVER_PORT);
 STRING_EXTERN(CFGOPT_TYPE_STR,                                      CFGOPT_TYPE);
 
 /***********************************************************************************************************************************
@@ -508,6 +598,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptArchiveGetQueueMax)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptArchivePushCompressBacklog)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -524,6 +622,22 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptArchiveTimeout)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_BACKUP_CIPHER_SIDE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptBackupCipherSide)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_BACKUP_COMPRESS_SIDE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptBackupCompressSide)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -756,6 +870,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptManifestSaveThreshold)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_METRIC_PATH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptMetricPath)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -852,6 +974,198 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHost)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostCertFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1108,6 +1422,70 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostConfigPath)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostKeyFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1172,6 +1550,70 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostPort)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG1_HOST_TYPE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG2_HOST_TYPE)
+        CONFIG_OPTION_INDEX(1)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG3_HOST_TYPE)
+        CONFIG_OPTION_INDEX(2)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG4_HOST_TYPE)
+        CONFIG_OPTION_INDEX(3)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG5_HOST_TYPE)
+        CONFIG_OPTION_INDEX(4)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG6_HOST_TYPE)
+        CONFIG_OPTION_INDEX(5)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG7_HOST_TYPE)
+        CONFIG_OPTION_INDEX(6)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PG8_HOST_TYPE)
+        CONFIG_OPTION_INDEX(7)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptPgHostType)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1444,6 +1886,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptProcessMax)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_PROFILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptProfile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1468,6 +1918,22 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRecurse)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_CACHE_PATH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoCachePath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_CACHE_SIZE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoCacheSize)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1500,6 +1966,30 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHost)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_CA_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_CA_PATH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostCaPath)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_CERT_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostCertFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1532,6 +2022,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostConfigPath)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_KEY_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostKeyFile)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1540,6 +2038,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostPort)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_HOST_TYPE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoHostType)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1644,6 +2150,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3KeySecret)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_REPO1_S3_LIST_PARALLEL)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptRepoS3ListParallel)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1708,6 +2222,14 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptSort)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_SORT_MAX)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptSortMax)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -1812,6 +2334,54 @@ static ConfigOptionData configOptionData[CFG_OPTION_TOTAL] = CONFIG_OPTION_LIST
         CONFIG_OPTION_DEFINE_ID(cfgDefOptTestPoint)
     )
 
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_ADDRESS)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerAddress)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_AUTH)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerAuth)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_CA_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerCaFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_CERT_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerCertFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_KEY_FILE)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerKeyFile)
+    )
+
+    //------------------------------------------------------------------------------------------------------------------------------
+    CONFIG_OPTION
+    (
+        CONFIG_OPTION_NAME(CFGOPT_TLS_SERVER_PORT)
+        CONFIG_OPTION_INDEX(0)
+        CONFIG_OPTION_DEFINE_ID(cfgDefOptTlsServerPort)
+    )
+
     //------------------------------------------------------------------------------------------------------------------------------
     CONFIG_OPTION
     (
@@ -35,6 +35,8 @@ Command constants
     STRING_DECLARE(CFGCMD_REMOTE_STR);
 #define CFGCMD_RESTORE                                              "restore"
     STRING_DECLARE(CFGCMD_RESTORE_STR);
+#define CFGCMD_SERVER                                               "server"
+    STRING_DECLARE(CFGCMD_SERVER_STR);
 #define CFGCMD_STANZA_CREATE                                        "stanza-create"
     STRING_DECLARE(CFGCMD_STANZA_CREATE_STR);
 #define CFGCMD_STANZA_DELETE                                        "stanza-delete"
@@ -45,10 +47,12 @@ Command constants
     STRING_DECLARE(CFGCMD_START_STR);
 #define CFGCMD_STOP                                                 "stop"
     STRING_DECLARE(CFGCMD_STOP_STR);
+#define CFGCMD_VERIFY                                               "verify"
+    STRING_DECLARE(CFGCMD_VERIFY_STR);
 #define CFGCMD_VERSION                                              "version"
     STRING_DECLARE(CFGCMD_VERSION_STR);
 
-#define CFG_COMMAND_TOTAL                                           20
+#define CFG_COMMAND_TOTAL                                           22
 
 /***********************************************************************************************************************************
 Option constants
@@ -61,10 +65,16 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_COPY_STR);
 #define CFGOPT_ARCHIVE_GET_QUEUE_MAX                                "archive-get-queue-max"
     STRING_DECLARE(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR);
+#define CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG                        "archive-push-compress-backlog"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG_STR);
 #define CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                               "archive-push-queue-max"
     STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR);
 #define CFGOPT_ARCHIVE_TIMEOUT                                      "archive-timeout"
     STRING_DECLARE(CFGOPT_ARCHIVE_TIMEOUT_STR);
+#define CFGOPT_BACKUP_CIPHER_SIDE                                   "backup-cipher-side"
+    STRING_DECLARE(CFGOPT_BACKUP_CIPHER_SIDE_STR);
+#define CFGOPT_BACKUP_COMPRESS_SIDE                                 "backup-compress-side"
+    STRING_DECLARE(CFGOPT_BACKUP_COMPRESS_SIDE_STR);
 #define CFGOPT_BACKUP_STANDBY                                       "backup-standby"
     STRING_DECLARE(CFGOPT_BACKUP_STANDBY_STR);
 #define CFGOPT_BUFFER_SIZE                                          "buffer-size"
@@ -123,6 +133,8 @@ Option constants
     STRING_DECLARE(CFGOPT_LOG_TIMESTAMP_STR);
 #define CFGOPT_MANIFEST_SAVE_THRESHOLD                              "manifest-save-threshold"
     STRING_DECLARE(CFGOPT_MANIFEST_SAVE_THRESHOLD_STR);
+#define CFGOPT_METRIC_PATH                                          "metric-path"
+    STRING_DECLARE(CFGOPT_METRIC_PATH_STR);
 #define CFGOPT_NEUTRAL_UMASK                                        "neutral-umask"
     STRING_DECLARE(CFGOPT_NEUTRAL_UMASK_STR);
 #define CFGOPT_ONLINE                                               "online"
@@ -133,6 +145,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PERL_OPTION_STR);
 #define CFGOPT_PG1_HOST                                             "pg1-host"
     STRING_DECLARE(CFGOPT_PG1_HOST_STR);
+#define CFGOPT_PG1_HOST_CA_FILE                                     "pg1-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG1_HOST_CA_FILE_STR);
+#define CFGOPT_PG1_HOST_CA_PATH                                     "pg1-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG1_HOST_CA_PATH_STR);
+#define CFGOPT_PG1_HOST_CERT_FILE                                   "pg1-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG1_HOST_CERT_FILE_STR);
 #define CFGOPT_PG1_HOST_CMD                                         "pg1-host-cmd"
     STRING_DECLARE(CFGOPT_PG1_HOST_CMD_STR);
 #define CFGOPT_PG1_HOST_CONFIG                                      "pg1-host-config"
@@ -141,8 +159,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG1_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG1_HOST_CONFIG_PATH                                 "pg1-host-config-path"
     STRING_DECLARE(CFGOPT_PG1_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG1_HOST_KEY_FILE                                    "pg1-host-key-file"
+    STRING_DECLARE(CFGOPT_PG1_HOST_KEY_FILE_STR);
 #define CFGOPT_PG1_HOST_PORT                                        "pg1-host-port"
     STRING_DECLARE(CFGOPT_PG1_HOST_PORT_STR);
+#define CFGOPT_PG1_HOST_TYPE                                        "pg1-host-type"
+    STRING_DECLARE(CFGOPT_PG1_HOST_TYPE_STR);
 #define CFGOPT_PG1_HOST_USER                                        "pg1-host-user"
     STRING_DECLARE(CFGOPT_PG1_HOST_USER_STR);
 #define CFGOPT_PG1_PATH                                             "pg1-path"
@@ -153,6 +175,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG1_SOCKET_PATH_STR);
 #define CFGOPT_PG2_HOST                                             "pg2-host"
     STRING_DECLARE(CFGOPT_PG2_HOST_STR);
+#define CFGOPT_PG2_HOST_CA_FILE                                     "pg2-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG2_HOST_CA_FILE_STR);
+#define CFGOPT_PG2_HOST_CA_PATH                                     "pg2-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG2_HOST_CA_PATH_STR);
+#define CFGOPT_PG2_HOST_CERT_FILE                                   "pg2-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG2_HOST_CERT_FILE_STR);
 #define CFGOPT_PG2_HOST_CMD                                         "pg2-host-cmd"
     STRING_DECLARE(CFGOPT_PG2_HOST_CMD_STR);
 #define CFGOPT_PG2_HOST_CONFIG                                      "pg2-host-config"
@@ -161,8 +189,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG2_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG2_HOST_CONFIG_PATH                                 "pg2-host-config-path"
     STRING_DECLARE(CFGOPT_PG2_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG2_HOST_KEY_FILE                                    "pg2-host-key-file"
+    STRING_DECLARE(CFGOPT_PG2_HOST_KEY_FILE_STR);
 #define CFGOPT_PG2_HOST_PORT                                        "pg2-host-port"
     STRING_DECLARE(CFGOPT_PG2_HOST_PORT_STR);
+#define CFGOPT_PG2_HOST_TYPE                                        "pg2-host-type"
+    STRING_DECLARE(CFGOPT_PG2_HOST_TYPE_STR);
 #define CFGOPT_PG2_HOST_USER                                        "pg2-host-user"
     STRING_DECLARE(CFGOPT_PG2_HOST_USER_STR);
 #define CFGOPT_PG2_PATH                                             "pg2-path"
@@ -173,6 +205,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG2_SOCKET_PATH_STR);
 #define CFGOPT_PG3_HOST                                             "pg3-host"
     STRING_DECLARE(CFGOPT_PG3_HOST_STR);
+#define CFGOPT_PG3_HOST_CA_FILE                                     "pg3-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG3_HOST_CA_FILE_STR);
+#define CFGOPT_PG3_HOST_CA_PATH                                     "pg3-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG3_HOST_CA_PATH_STR);
+#define CFGOPT_PG3_HOST_CERT_FILE                                   "pg3-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG3_HOST_CERT_FILE_STR);
 #define CFGOPT_PG3_HOST_CMD                                         "pg3-host-cmd"
     STRING_DECLARE(CFGOPT_PG3_HOST_CMD_STR);
 #define CFGOPT_PG3_HOST_CONFIG                                      "pg3-host-config"
@@ -181,8 +219,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG3_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG3_HOST_CONFIG_PATH                                 "pg3-host-config-path"
     STRING_DECLARE(CFGOPT_PG3_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG3_HOST_KEY_FILE                                    "pg3-host-key-file"
+    STRING_DECLARE(CFGOPT_PG3_HOST_KEY_FILE_STR);
 #define CFGOPT_PG3_HOST_PORT                                        "pg3-host-port"
     STRING_DECLARE(CFGOPT_PG3_HOST_PORT_STR);
+#define CFGOPT_PG3_HOST_TYPE                                        "pg3-host-type"
+    STRING_DECLARE(CFGOPT_PG3_HOST_TYPE_STR);
 #define CFGOPT_PG3_HOST_USER                                        "pg3-host-user"
     STRING_DECLARE(CFGOPT_PG3_HOST_USER_STR);
 #define CFGOPT_PG3_PATH                                             "pg3-path"
@@ -193,6 +235,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG3_SOCKET_PATH_STR);
 #define CFGOPT_PG4_HOST                                             "pg4-host"
     STRING_DECLARE(CFGOPT_PG4_HOST_STR);
+#define CFGOPT_PG4_HOST_CA_FILE                                     "pg4-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG4_HOST_CA_FILE_STR);
+#define CFGOPT_PG4_HOST_CA_PATH                                     "pg4-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG4_HOST_CA_PATH_STR);
+#define CFGOPT_PG4_HOST_CERT_FILE                                   "pg4-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG4_HOST_CERT_FILE_STR);
 #define CFGOPT_PG4_HOST_CMD                                         "pg4-host-cmd"
     STRING_DECLARE(CFGOPT_PG4_HOST_CMD_STR);
 #define CFGOPT_PG4_HOST_CONFIG                                      "pg4-host-config"
@@ -201,8 +249,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG4_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG4_HOST_CONFIG_PATH                                 "pg4-host-config-path"
     STRING_DECLARE(CFGOPT_PG4_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG4_HOST_KEY_FILE                                    "pg4-host-key-file"
+    STRING_DECLARE(CFGOPT_PG4_HOST_KEY_FILE_STR);
 #define CFGOPT_PG4_HOST_PORT                                        "pg4-host-port"
     STRING_DECLARE(CFGOPT_PG4_HOST_PORT_STR);
+#define CFGOPT_PG4_HOST_TYPE                                        "pg4-host-type"
+    STRING_DECLARE(CFGOPT_PG4_HOST_TYPE_STR);
 #define CFGOPT_PG4_HOST_USER                                        "pg4-host-user"
     STRING_DECLARE(CFGOPT_PG4_HOST_USER_STR);
 #define CFGOPT_PG4_PATH                                             "pg4-path"
@@ -213,6 +265,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG4_SOCKET_PATH_STR);
 #define CFGOPT_PG5_HOST                                             "pg5-host"
     STRING_DECLARE(CFGOPT_PG5_HOST_STR);
+#define CFGOPT_PG5_HOST_CA_FILE                                     "pg5-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG5_HOST_CA_FILE_STR);
+#define CFGOPT_PG5_HOST_CA_PATH                                     "pg5-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG5_HOST_CA_PATH_STR);
+#define CFGOPT_PG5_HOST_CERT_FILE                                   "pg5-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG5_HOST_CERT_FILE_STR);
 #define CFGOPT_PG5_HOST_CMD                                         "pg5-host-cmd"
     STRING_DECLARE(CFGOPT_PG5_HOST_CMD_STR);
 #define CFGOPT_PG5_HOST_CONFIG                                      "pg5-host-config"
@@ -221,8 +279,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG5_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG5_HOST_CONFIG_PATH                                 "pg5-host-config-path"
     STRING_DECLARE(CFGOPT_PG5_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG5_HOST_KEY_FILE                                    "pg5-host-key-file"
+    STRING_DECLARE(CFGOPT_PG5_HOST_KEY_FILE_STR);
 #define CFGOPT_PG5_HOST_PORT                                        "pg5-host-port"
     STRING_DECLARE(CFGOPT_PG5_HOST_PORT_STR);
+#define CFGOPT_PG5_HOST_TYPE                                        "pg5-host-type"
+    STRING_DECLARE(CFGOPT_PG5_HOST_TYPE_STR);
 #define CFGOPT_PG5_HOST_USER                                        "pg5-host-user"
     STRING_DECLARE(CFGOPT_PG5_HOST_USER_STR);
 #define CFGOPT_PG5_PATH                                             "pg5-path"
@@ -233,6 +295,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG5_SOCKET_PATH_STR);
 #define CFGOPT_PG6_HOST                                             "pg6-host"
     STRING_DECLARE(CFGOPT_PG6_HOST_STR);
+#define CFGOPT_PG6_HOST_CA_FILE                                     "pg6-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG6_HOST_CA_FILE_STR);
+#define CFGOPT_PG6_HOST_CA_PATH                                     "pg6-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG6_HOST_CA_PATH_STR);
+#define CFGOPT_PG6_HOST_CERT_FILE                                   "pg6-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG6_HOST_CERT_FILE_STR);
 #define CFGOPT_PG6_HOST_CMD                                         "pg6-host-cmd"
     STRING_DECLARE(CFGOPT_PG6_HOST_CMD_STR);
 #define CFGOPT_PG6_HOST_CONFIG                                      "pg6-host-config"
@@ -241,8 +309,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG6_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG6_HOST_CONFIG_PATH                                 "pg6-host-config-path"
     STRING_DECLARE(CFGOPT_PG6_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG6_HOST_KEY_FILE                                    "pg6-host-key-file"
+    STRING_DECLARE(CFGOPT_PG6_HOST_KEY_FILE_STR);
 #define CFGOPT_PG6_HOST_PORT                                        "pg6-host-port"
     STRING_DECLARE(CFGOPT_PG6_HOST_PORT_STR);
+#define CFGOPT_PG6_HOST_TYPE                                        "pg6-host-type"
+    STRING_DECLARE(CFGOPT_PG6_HOST_TYPE_STR);
 #define CFGOPT_PG6_HOST_USER                                        "pg6-host-user"
     STRING_DECLARE(CFGOPT_PG6_HOST_USER_STR);
 #define CFGOPT_PG6_PATH                                             "pg6-path"
@@ -253,6 +325,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG6_SOCKET_PATH_STR);
 #define CFGOPT_PG7_HOST                                             "pg7-host"
     STRING_DECLARE(CFGOPT_PG7_HOST_STR);
+#define CFGOPT_PG7_HOST_CA_FILE                                     "pg7-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG7_HOST_CA_FILE_STR);
+#define CFGOPT_PG7_HOST_CA_PATH                                     "pg7-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG7_HOST_CA_PATH_STR);
+#define CFGOPT_PG7_HOST_CERT_FILE                                   "pg7-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG7_HOST_CERT_FILE_STR);
 #define CFGOPT_PG7_HOST_CMD                                         "pg7-host-cmd"
     STRING_DECLARE(CFGOPT_PG7_HOST_CMD_STR);
 #define CFGOPT_PG7_HOST_CONFIG                                      "pg7-host-config"
@@ -261,8 +339,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG7_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG7_HOST_CONFIG_PATH                                 "pg7-host-config-path"
     STRING_DECLARE(CFGOPT_PG7_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG7_HOST_KEY_FILE                                    "pg7-host-key-file"
+    STRING_DECLARE(CFGOPT_PG7_HOST_KEY_FILE_STR);
 #define CFGOPT_PG7_HOST_PORT                                        "pg7-host-port"
     STRING_DECLARE(CFGOPT_PG7_HOST_PORT_STR);
+#define CFGOPT_PG7_HOST_TYPE                                        "pg7-host-type"
+    STRING_DECLARE(CFGOPT_PG7_HOST_TYPE_STR);
 #define CFGOPT_PG7_HOST_USER                                        "pg7-host-user"
     STRING_DECLARE(CFGOPT_PG7_HOST_USER_STR);
 #define CFGOPT_PG7_PATH                                             "pg7-path"
@@ -273,6 +355,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG7_SOCKET_PATH_STR);
 #define CFGOPT_PG8_HOST                                             "pg8-host"
     STRING_DECLARE(CFGOPT_PG8_HOST_STR);
+#define CFGOPT_PG8_HOST_CA_FILE                                     "pg8-host-ca-file"
+    STRING_DECLARE(CFGOPT_PG8_HOST_CA_FILE_STR);
+#define CFGOPT_PG8_HOST_CA_PATH                                     "pg8-host-ca-path"
+    STRING_DECLARE(CFGOPT_PG8_HOST_CA_PATH_STR);
+#define CFGOPT_PG8_HOST_CERT_FILE                                   "pg8-host-cert-file"
+    STRING_DECLARE(CFGOPT_PG8_HOST_CERT_FILE_STR);
 #define CFGOPT_PG8_HOST_CMD                                         "pg8-host-cmd"
     STRING_DECLARE(CFGOPT_PG8_HOST_CMD_STR);
 #define CFGOPT_PG8_HOST_CONFIG                                      "pg8-host-config"
@@ -281,8 +369,12 @@ Option constants
     STRING_DECLARE(CFGOPT_PG8_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_PG8_HOST_CONFIG_PATH                                 "pg8-host-config-path"
     STRING_DECLARE(CFGOPT_PG8_HOST_CONFIG_PATH_STR);
+#define CFGOPT_PG8_HOST_KEY_FILE                                    "pg8-host-key-file"
+    STRING_DECLARE(CFGOPT_PG8_HOST_KEY_FILE_STR);
 #define CFGOPT_PG8_HOST_PORT                                        "pg8-host-port"
     STRING_DECLARE(CFGOPT_PG8_HOST_PORT_STR);
+#define CFGOPT_PG8_HOST_TYPE                                        "pg8-host-type"
+    STRING_DECLARE(CFGOPT_PG8_HOST_TYPE_STR);
 #define CFGOPT_PG8_HOST_USER                                        "pg8-host-user"
     STRING_DECLARE(CFGOPT_PG8_HOST_USER_STR);
 #define CFGOPT_PG8_PATH                                             "pg8-path"
@@ -295,12 +387,18 @@ Option constants
     STRING_DECLARE(CFGOPT_PROCESS_STR);
 #define CFGOPT_PROCESS_MAX                                          "process-max"
     STRING_DECLARE(CFGOPT_PROCESS_MAX_STR);
+#define CFGOPT_PROFILE                                              "profile"
+    STRING_DECLARE(CFGOPT_PROFILE_STR);
 #define CFGOPT_PROTOCOL_TIMEOUT                                     "protocol-timeout"
     STRING_DECLARE(CFGOPT_PROTOCOL_TIMEOUT_STR);
 #define CFGOPT_RECOVERY_OPTION                                      "recovery-option"
     STRING_DECLARE(CFGOPT_RECOVERY_OPTION_STR);
 #define CFGOPT_RECURSE                                              "recurse"
     STRING_DECLARE(CFGOPT_RECURSE_STR);
+#define CFGOPT_REPO1_CACHE_PATH                                     "repo1-cache-path"
+    STRING_DECLARE(CFGOPT_REPO1_CACHE_PATH_STR);
+#define CFGOPT_REPO1_CACHE_SIZE                                     "repo1-cache-size"
+    STRING_DECLARE(CFGOPT_REPO1_CACHE_SIZE_STR);
 #define CFGOPT_REPO1_CIPHER_PASS                                    "repo1-cipher-pass"
     STRING_DECLARE(CFGOPT_REPO1_CIPHER_PASS_STR);
 #define CFGOPT_REPO1_CIPHER_TYPE                                    "repo1-cipher-type"
@@ -309,6 +407,12 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_HARDLINK_STR);
 #define CFGOPT_REPO1_HOST                                           "repo1-host"
     STRING_DECLARE(CFGOPT_REPO1_HOST_STR);
+#define CFGOPT_REPO1_HOST_CA_FILE                                   "repo1-host-ca-file"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_CA_FILE_STR);
+#define CFGOPT_REPO1_HOST_CA_PATH                                   "repo1-host-ca-path"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_CA_PATH_STR);
+#define CFGOPT_REPO1_HOST_CERT_FILE                                 "repo1-host-cert-file"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_CERT_FILE_STR);
 #define CFGOPT_REPO1_HOST_CMD                                       "repo1-host-cmd"
     STRING_DECLARE(CFGOPT_REPO1_HOST_CMD_STR);
 #define CFGOPT_REPO1_HOST_CONFIG                                    "repo1-host-config"
@@ -317,8 +421,12 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_HOST_CONFIG_INCLUDE_PATH_STR);
 #define CFGOPT_REPO1_HOST_CONFIG_PATH                               "repo1-host-config-path"
     STRING_DECLARE(CFGOPT_REPO1_HOST_CONFIG_PATH_STR);
+#define CFGOPT_REPO1_HOST_KEY_FILE                                  "repo1-host-key-file"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_KEY_FILE_STR);
 #define CFGOPT_REPO1_HOST_PORT                                      "repo1-host-port"
     STRING_DECLARE(CFGOPT_REPO1_HOST_PORT_STR);
+#define CFGOPT_REPO1_HOST_TYPE                                      "repo1-host-type"
+    STRING_DECLARE(CFGOPT_REPO1_HOST_TYPE_STR);
 #define CFGOPT_REPO1_HOST_USER                                      "repo1-host-user"
     STRING_DECLARE(CFGOPT_REPO1_HOST_USER_STR);
 #define CFGOPT_REPO1_PATH                                           "repo1-path"
@@ -345,6 +453,8 @@ Option constants
     STRING_DECLARE(CFGOPT_REPO1_S3_KEY_STR);
 #define CFGOPT_REPO1_S3_KEY_SECRET                                  "repo1-s3-key-secret"
     STRING_DECLARE(CFGOPT_REPO1_S3_KEY_SECRET_STR);
+#define CFGOPT_REPO1_S3_LIST_PARALLEL                               "repo1-s3-list-parallel"
+    STRING_DECLARE(CFGOPT_REPO1_S3_LIST_PARALLEL_STR);
 #define CFGOPT_REPO1_S3_PORT                                        "repo1-s3-port"
     STRING_DECLARE(CFGOPT_REPO1_S3_PORT_STR);
 #define CFGOPT_REPO1_S3_REGION                                      "repo1-s3-region"
@@ -361,6 +471,8 @@ Option constants
     STRING_DECLARE(CFGOPT_SET_STR);
 #define CFGOPT_SORT                                                 "sort"
     STRING_DECLARE(CFGOPT_SORT_STR);
+#define CFGOPT_SORT_MAX                                             "sort-max"
+    STRING_DECLARE(CFGOPT_SORT_MAX_STR);
 #define CFGOPT_SPOOL_PATH                                           "spool-path"
     STRING_DECLARE(CFGOPT_SPOOL_PATH_STR);
 #define CFGOPT_STANZA                                               "stanza"
@@ -387,10 +499,22 @@ Option constants
     STRING_DECLARE(CFGOPT_TEST_DELAY_STR);
 #define CFGOPT_TEST_POINT                                           "test-point"
     STRING_DECLARE(CFGOPT_TEST_POINT_STR);
+#define CFGOPT_TLS_SERVER_ADDRESS                                   "tls-server-address"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_ADDRESS_STR);
+#define CFGOPT_TLS_SERVER_AUTH                                      "tls-server-auth"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_AUTH_STR);
+#define CFGOPT_TLS_SERVER_CA_FILE                                   "tls-server-ca-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_CA_FILE_STR);
+#define CFGOPT_TLS_SERVER_CERT_FILE                                 "tls-server-cert-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_CERT_FILE_STR);
+#define CFGOPT_TLS_SERVER_KEY_FILE                                  "tls-server-key-file"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_KEY_FILE_STR);
+#define CFGOPT_TLS_SERVER_PORT                                      "tls-server-port"
+    STRING_DECLARE(CFGOPT_TLS_SERVER_PORT_STR);
 #define CFGOPT_TYPE                                                 "type"
     STRING_DECLARE(CFGOPT_TYPE_STR);
 
-#define CFG_OPTION_TOTAL                                            168
+#define CFG_OPTION_TOTAL                                            228
 
 /***********************************************************************************************************************************
 Command enum
@@ -410,11 +534,13 @@ typedef enum
     cfgCmdLs,
     cfgCmdRemote,
     cfgCmdRestore,
+    cfgCmdServer,
     cfgCmdStanzaCreate,
     cfgCmdStanzaDelete,
     cfgCmdStanzaUpgrade,
     cfgCmdStart,
     cfgCmdStop,
+    cfgCmdVerify,
     cfgCmdVersion,
     cfgCmdNone,
 } ConfigCommand;
@@ -428,8 +554,11 @@ typedef enum
     cfgOptArchiveCheck,
     cfgOptArchiveCopy,
     cfgOptArchiveGetQueueMax,
+    cfgOptArchivePushCompressBacklog,
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
+    cfgOptBackupCipherSide,
+    cfgOptBackupCompressSide,
     cfgOptBackupStandby,
     cfgOptBufferSize,
     cfgOptC,
@@ -459,6 +588,7 @@ typedef enum
     cfgOptLogSubprocess,
     cfgOptLogTimestamp,
     cfgOptManifestSaveThreshold,
+    cfgOptMetricPath,
     cfgOptNeutralUmask,
     cfgOptOnline,
     cfgOptOutput,
@@ -471,6 +601,30 @@ typedef enum
     cfgOptPgHost6,
     cfgOptPgHost7,
     cfgOptPgHost8,
+    cfgOptPgHostCaFile,
+    cfgOptPgHostCaFile2,
+    cfgOptPgHostCaFile3,
+    cfgOptPgHostCaFile4,
+    cfgOptPgHostCaFile5,
+    cfgOptPgHostCaFile6,
+    cfgOptPgHostCaFile7,
+    cfgOptPgHostCaFile8,
+    cfgOptPgHostCaPath,
+    cfgOptPgHostCaPath2,
+    cfgOptPgHostCaPath3,
+    cfgOptPgHostCaPath4,
+    cfgOptPgHostCaPath5,
+    cfgOptPgHostCaPath6,
+    cfgOptPgHostCaPath7,
+    cfgOptPgHostCaPath8,
+    cfgOptPgHostCertFile,
+    cfgOptPgHostCertFile2,
+    cfgOptPgHostCertFile3,
+    cfgOptPgHostCertFile4,
+    cfgOptPgHostCertFile5,
+    cfgOptPgHostCertFile6,
+    cfgOptPgHostCertFile7,
+    cfgOptPgHostCertFile8,
     cfgOptPgHostCmd,
     cfgOptPgHostCmd2,
     cfgOptPgHostCmd3,
@@ -503,6 +657,14 @@ typedef enum
     cfgOptPgHostConfigPath6,
     cfgOptPgHostConfigPath7,
     cfgOptPgHostConfigPath8,
+    cfgOptPgHostKeyFile,
+    cfgOptPgHostKeyFile2,
+    cfgOptPgHostKeyFile3,
+    cfgOptPgHostKeyFile4,
+    cfgOptPgHostKeyFile5,
+    cfgOptPgHostKeyFile6,
+    cfgOptPgHostKeyFile7,
+    cfgOptPgHostKeyFile8,
     cfgOptPgHostPort,
     cfgOptPgHostPort2,
     cfgOptPgHostPort3,
@@ -511,6 +673,14 @@ typedef enum
     cfgOptPgHostPort6,
     cfgOptPgHostPort7,
     cfgOptPgHostPort8,
+    cfgOptPgHostType,
+    cfgOptPgHostType2,
+    cfgOptPgHostType3,
+    cfgOptPgHostType4,
+    cfgOptPgHostType5,
+    cfgOptPgHostType6,
+    cfgOptPgHostType7,
+    cfgOptPgHostType8,
     cfgOptPgHostUser,
     cfgOptPgHostUser2,
     cfgOptPgHostUser3,
@@ -545,18 +715,26 @@ typedef enum
     cfgOptPgSocketPath8,
     cfgOptProcess,
     cfgOptProcessMax,
+    cfgOptProfile,
     cfgOptProtocolTimeout,
     cfgOptRecoveryOption,
     cfgOptRecurse,
+    cfgOptRepoCachePath,
+    cfgOptRepoCacheSize,
     cfgOptRepoCipherPass,
     cfgOptRepoCipherType,
     cfgOptRepoHardlink,
     cfgOptRepoHost,
+    cfgOptRepoHostCaFile,
+    cfgOptRepoHostCaPath,
+    cfgOptRepoHostCertFile,
     cfgOptRepoHostCmd,
     cfgOptRepoHostConfig,
     cfgOptRepoHostConfigIncludePath,
     cfgOptRepoHostConfigPath,
+    cfgOptRepoHostKeyFile,
     cfgOptRepoHostPort,
+    cfgOptRepoHostType,
     cfgOptRepoHostUser,
     cfgOptRepoPath,
     cfgOptRepoRetentionArchive,
@@ -570,6 +748,7 @@ typedef enum
     cfgOptRepoS3Host,
     cfgOptRepoS3Key,
     cfgOptRepoS3KeySecret,
+    cfgOptRepoS3ListParallel,
     cfgOptRepoS3Port,
     cfgOptRepoS3Region,
     cfgOptRepoS3Token,
@@ -578,6 +757,7 @@ typedef enum
     cfgOptResume,
     cfgOptSet,
     cfgOptSort,
+    cfgOptSortMax,
     cfgOptSpoolPath,
     cfgOptStanza,
     cfgOptStartFast,
@@ -591,6 +771,12 @@ typedef enum
     cfgOptTest,
     cfgOptTestDelay,
     cfgOptTestPoint,
+    cfgOptTlsServerAddress,
+    cfgOptTlsServerAuth,
+    cfgOptTlsServerCaFile,
+    cfgOptTlsServerCertFile,
+    cfgOptTlsServerKeyFile,
+    cfgOptTlsServerPort,
     cfgOptType,
 } ConfigOption;
 
@@ -24,11 +24,13 @@ typedef enum
     cfgDefCmdLs,
     cfgDefCmdRemote,
     cfgDefCmdRestore,
+    cfgDefCmdServer,
     cfgDefCmdStanzaCreate,
     cfgDefCmdStanzaDelete,
     cfgDefCmdStanzaUpgrade,
     cfgDefCmdStart,
     cfgDefCmdStop,
+    cfgDefCmdVerify,
     cfgDefCmdVersion,
 } ConfigDefineCommand;
 
@@ -56,8 +58,11 @@ typedef enum
     cfgDefOptArchiveCheck,
     cfgDefOptArchiveCopy,
     cfgDefOptArchiveGetQueueMax,
+    cfgDefOptArchivePushCompressBacklog,
     cfgDefOptArchivePushQueueMax,
     cfgDefOptArchiveTimeout,
+    cfgDefOptBackupCipherSide,
+    cfgDefOptBackupCompressSide,
     cfgDefOptBackupStandby,
     cfgDefOptBufferSize,
     cfgDefOptC,
@@ -87,34 +92,48 @@ typedef enum
     cfgDefOptLogSubprocess,
     cfgDefOptLogTimestamp,
     cfgDefOptManifestSaveThreshold,
+    cfgDefOptMetricPath,
     cfgDefOptNeutralUmask,
     cfgDefOptOnline,
     cfgDefOptOutput,
     cfgDefOptPerlOption,
     cfgDefOptPgHost,
+    cfgDefOptPgHostCaFile,
+    cfgDefOptPgHostCaPath,
+    cfgDefOptPgHostCertFile,
     cfgDefOptPgHostCmd,
     cfgDefOptPgHostConfig,
     cfgDefOptPgHostConfigIncludePath,
     cfgDefOptPgHostConfigPath,
+    cfgDefOptPgHostKeyFile,
     cfgDefOptPgHostPort,
+    cfgDefOptPgHostType,
     cfgDefOptPgHostUser,
     cfgDefOptPgPath,
     cfgDefOptPgPort,
     cfgDefOptPgSocketPath,
     cfgDefOptProcess,
     cfgDefOptProcessMax,
+    cfgDefOptProfile,
     cfgDefOptProtocolTimeout,
     cfgDefOptRecoveryOption,
     cfgDefOptRecurse,
+    cfgDefOptRepoCachePath,
+    cfgDefOptRepoCacheSize,
     cfgDefOptRepoCipherPass,
     cfgDefOptRepoCipherType,
     cfgDefOptRepoHardlink,
     cfgDefOptRepoHost,
+    cfgDefOptRepoHostCaFile,
+    cfgDefOptRepoHostCaPath,
+    cfgDefOptRepoHostCertFile,
     cfgDefOptRepoHostCmd,
     cfgDefOptRepoHostConfig,
     cfgDefOptRepoHostConfigIncludePath,
     cfgDefOptRepoHostConfigPath,
+    cfgDefOptRepoHostKeyFile,
     cfgDefOptRepoHostPort,
+    cfgDefOptRepoHostType,
     cfgDefOptRepoHostUser,
     cfgDefOptRepoPath,
     cfgDefOptRepoRetentionArchive,
@@ -128,6 +147,7 @@ typedef enum
     cfgDefOptRepoS3Host,
     cfgDefOptRepoS3Key,
     cfgDefOptRepoS3KeySecret,
+    cfgDefOptRepoS3ListParallel,
     cfgDefOptRepoS3Port,
     cfgDefOptRepoS3Region,
     cfgDefOptRepoS3Token,
@@ -136,6 +156,7 @@ typedef enum
     cfgDefOptResume,
     cfgDefOptSet,
     cfgDefOptSort,
+    cfgDefOptSortMax,
     cfgDefOptSpoolPath,
     cfgDefOptStanza,
     cfgDefOptStartFast,
@@ -149,6 +170,12 @@ typedef enum
     cfgDefOptTest,
     cfgDefOptTestDelay,
     cfgDefOptTestPoint,
+    cfgDefOptTlsServerAddress,
+    cfgDefOptTlsServerAuth,
+    cfgDefOptTlsServerCaFile,
+    cfgDefOptTlsServerCertFile,
+    cfgDefOptTlsServerKeyFile,
+    cfgDefOptTlsServerPort,
     cfgDefOptType,
 } ConfigDefineOption;
 
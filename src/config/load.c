@@ -9,6 +9,7 @@ Configuration Load
 #include "command/command.h"
 #include "common/memContext.h"
 #include "common/debug.h"
+#include "common/exec.h"
 #include "common/io/io.h"
 #include "common/lock.h"
 #include "common/log.h"
@@ -299,6 +300,10 @@ cfgLoad(unsigned int argListSize, const char *argList[])
             if (cfgOptionValid(cfgOptBufferSize))
                 ioBufferSizeSet(cfgOptionUInt(cfgOptBufferSize));
 
+            // Set process max so exec can size pipes
+            if (cfgOptionValid(cfgOptProcessMax))
+                execProcessMaxSet(cfgOptionUInt(cfgOptProcessMax));
+
             // Open the log file if this command logs to a file
             cfgLoadLogFile();
 
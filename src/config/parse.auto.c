@@ -66,6 +66,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptArchiveGetQueueMax,
     },
 
+    // archive-push-compress-backlog option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptArchivePushCompressBacklog,
+    },
+    {
+        .name = "reset-" CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptArchivePushCompressBacklog,
+    },
+
     // archive-push-queue-max option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -99,6 +111,30 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptArchiveTimeout,
     },
 
+    // backup-cipher-side option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_BACKUP_CIPHER_SIDE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptBackupCipherSide,
+    },
+    {
+        .name = "reset-" CFGOPT_BACKUP_CIPHER_SIDE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptBackupCipherSide,
+    },
+
+    // backup-compress-side option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_BACKUP_COMPRESS_SIDE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptBackupCompressSide,
+    },
+    {
+        .name = "reset-" CFGOPT_BACKUP_COMPRESS_SIDE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptBackupCompressSide,
+    },
+
     // backup-standby option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -438,6 +474,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptManifestSaveThreshold,
     },
 
+    // metric-path option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_METRIC_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptMetricPath,
+    },
+    {
+        .name = "reset-" CFGOPT_METRIC_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptMetricPath,
+    },
+
     // neutral-umask option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -604,6 +652,231 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | (cfgOptPgHost + 7),
     },
 
+    // pg-host-ca-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostCaFile,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostCaFile,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaFile + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaFile + 7),
+    },
+
+    // pg-host-ca-path option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostCaPath,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostCaPath,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCaPath + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCaPath + 7),
+    },
+
+    // pg-host-cert-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostCertFile,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostCertFile,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostCertFile + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostCertFile + 7),
+    },
+
     // pg-host-cmd option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -994,6 +1267,81 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostConfigPath + 7),
     },
 
+    // pg-host-key-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostKeyFile,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostKeyFile,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostKeyFile + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostKeyFile + 7),
+    },
+
     // pg-host-port option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1114,6 +1462,81 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | (cfgOptPgHostPort + 7),
     },
 
+    // pg-host-type option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PG1_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptPgHostType,
+    },
+    {
+        .name = "reset-" CFGOPT_PG1_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptPgHostType,
+    },
+    {
+        .name = CFGOPT_PG2_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 1),
+    },
+    {
+        .name = "reset-" CFGOPT_PG2_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 1),
+    },
+    {
+        .name = CFGOPT_PG3_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 2),
+    },
+    {
+        .name = "reset-" CFGOPT_PG3_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 2),
+    },
+    {
+        .name = CFGOPT_PG4_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 3),
+    },
+    {
+        .name = "reset-" CFGOPT_PG4_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 3),
+    },
+    {
+        .name = CFGOPT_PG5_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 4),
+    },
+    {
+        .name = "reset-" CFGOPT_PG5_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 4),
+    },
+    {
+        .name = CFGOPT_PG6_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 5),
+    },
+    {
+        .name = "reset-" CFGOPT_PG6_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 5),
+    },
+    {
+        .name = CFGOPT_PG7_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 6),
+    },
+    {
+        .name = "reset-" CFGOPT_PG7_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 6),
+    },
+    {
+        .name = CFGOPT_PG8_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | (cfgOptPgHostType + 7),
+    },
+    {
+        .name = "reset-" CFGOPT_PG8_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | (cfgOptPgHostType + 7),
+    },
+
     // pg-host-user option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1614,6 +2037,21 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptProcessMax,
     },
 
+    // profile option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_PROFILE,
+        .val = PARSE_OPTION_FLAG | cfgOptProfile,
+    },
+    {
+        .name = "no-" CFGOPT_PROFILE,
+        .val = PARSE_OPTION_FLAG | PARSE_NEGATE_FLAG | cfgOptProfile,
+    },
+    {
+        .name = "reset-" CFGOPT_PROFILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptProfile,
+    },
+
     // protocol-timeout option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1645,6 +2083,30 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | cfgOptRecurse,
     },
 
+    // repo-cache-path option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_CACHE_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoCachePath,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_CACHE_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoCachePath,
+    },
+
+    // repo-cache-size option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_CACHE_SIZE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoCacheSize,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_CACHE_SIZE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoCacheSize,
+    },
+
     // repo-cipher-pass option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1719,6 +2181,42 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoHost,
     },
 
+    // repo-host-ca-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostCaFile,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostCaFile,
+    },
+
+    // repo-host-ca-path option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_CA_PATH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostCaPath,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_CA_PATH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostCaPath,
+    },
+
+    // repo-host-cert-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostCertFile,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostCertFile,
+    },
+
     // repo-host-cmd option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1777,6 +2275,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostConfigPath,
     },
 
+    // repo-host-key-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostKeyFile,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostKeyFile,
+    },
+
     // repo-host-port option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -1794,6 +2304,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoHostPort,
     },
 
+    // repo-host-type option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_HOST_TYPE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoHostType,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_HOST_TYPE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoHostType,
+    },
+
     // repo-host-user option and deprecations
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2015,6 +2537,18 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | PARSE_DEPRECATE_FLAG | cfgOptRepoS3KeySecret,
     },
 
+    // repo-s3-list-parallel option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_REPO1_S3_LIST_PARALLEL,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptRepoS3ListParallel,
+    },
+    {
+        .name = "reset-" CFGOPT_REPO1_S3_LIST_PARALLEL,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptRepoS3ListParallel,
+    },
+
     // repo-s3-port option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2135,6 +2669,14 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | cfgOptSort,
     },
 
+    // sort-max option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_SORT_MAX,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptSortMax,
+    },
+
     // spool-path option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2263,6 +2805,78 @@ static const struct option optionList[] =
         .val = PARSE_OPTION_FLAG | cfgOptTestPoint,
     },
 
+    // tls-server-address option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_ADDRESS,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerAddress,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_ADDRESS,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerAddress,
+    },
+
+    // tls-server-auth option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_AUTH,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerAuth,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_AUTH,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerAuth,
+    },
+
+    // tls-server-ca-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_CA_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerCaFile,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_CA_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerCaFile,
+    },
+
+    // tls-server-cert-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_CERT_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerCertFile,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_CERT_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerCertFile,
+    },
+
+    // tls-server-key-file option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_KEY_FILE,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerKeyFile,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_KEY_FILE,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerKeyFile,
+    },
+
+    // tls-server-port option
+    // -----------------------------------------------------------------------------------------------------------------------------
+    {
+        .name = CFGOPT_TLS_SERVER_PORT,
+        .has_arg = required_argument,
+        .val = PARSE_OPTION_FLAG | cfgOptTlsServerPort,
+    },
+    {
+        .name = "reset-" CFGOPT_TLS_SERVER_PORT,
+        .val = PARSE_OPTION_FLAG | PARSE_RESET_FLAG | cfgOptTlsServerPort,
+    },
+
     // type option
     // -----------------------------------------------------------------------------------------------------------------------------
     {
@@ -2284,8 +2898,11 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptStanza,
     cfgOptArchiveAsync,
     cfgOptArchiveGetQueueMax,
+    cfgOptArchivePushCompressBacklog,
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
+    cfgOptBackupCipherSide,
+    cfgOptBackupCompressSide,
     cfgOptBackupStandby,
     cfgOptBufferSize,
     cfgOptC,
@@ -2314,6 +2931,7 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptLogSubprocess,
     cfgOptLogTimestamp,
     cfgOptManifestSaveThreshold,
+    cfgOptMetricPath,
     cfgOptNeutralUmask,
     cfgOptOnline,
     cfgOptOutput,
@@ -2366,6 +2984,14 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptPgHostPort + 5,
     cfgOptPgHostPort + 6,
     cfgOptPgHostPort + 7,
+    cfgOptPgHostType,
+    cfgOptPgHostType + 1,
+    cfgOptPgHostType + 2,
+    cfgOptPgHostType + 3,
+    cfgOptPgHostType + 4,
+    cfgOptPgHostType + 5,
+    cfgOptPgHostType + 6,
+    cfgOptPgHostType + 7,
     cfgOptPgHostUser,
     cfgOptPgHostUser + 1,
     cfgOptPgHostUser + 2,
@@ -2400,8 +3026,11 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptPgSocketPath + 7,
     cfgOptProcess,
     cfgOptProcessMax,
+    cfgOptProfile,
     cfgOptProtocolTimeout,
     cfgOptRecurse,
+    cfgOptRepoCachePath,
+    cfgOptRepoCacheSize,
     cfgOptRepoCipherType,
     cfgOptRepoHardlink,
     cfgOptRepoHost,
@@ -2410,6 +3039,7 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptRepoHostConfigIncludePath,
     cfgOptRepoHostConfigPath,
     cfgOptRepoHostPort,
+    cfgOptRepoHostType,
     cfgOptRepoHostUser,
     cfgOptRepoPath,
     cfgOptRepoRetentionArchive,
@@ -2420,6 +3050,7 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptResume,
     cfgOptSet,
     cfgOptSort,
+    cfgOptSortMax,
     cfgOptSpoolPath,
     cfgOptStartFast,
     cfgOptStopAuto,
@@ -2428,12 +3059,54 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptTest,
     cfgOptTestDelay,
     cfgOptTestPoint,
+    cfgOptTlsServerAddress,
+    cfgOptTlsServerAuth,
+    cfgOptTlsServerCaFile,
+    cfgOptTlsServerCertFile,
+    cfgOptTlsServerKeyFile,
+    cfgOptTlsServerPort,
     cfgOptType,
     cfgOptArchiveCheck,
     cfgOptArchiveCopy,
     cfgOptForce,
+    cfgOptPgHostCaFile,
+    cfgOptPgHostCaFile + 1,
+    cfgOptPgHostCaFile + 2,
+    cfgOptPgHostCaFile + 3,
+    cfgOptPgHostCaFile + 4,
+    cfgOptPgHostCaFile + 5,
+    cfgOptPgHostCaFile + 6,
+    cfgOptPgHostCaFile + 7,
+    cfgOptPgHostCaPath,
+    cfgOptPgHostCaPath + 1,
+    cfgOptPgHostCaPath + 2,
+    cfgOptPgHostCaPath + 3,
+    cfgOptPgHostCaPath + 4,
+    cfgOptPgHostCaPath + 5,
+    cfgOptPgHostCaPath + 6,
+    cfgOptPgHostCaPath + 7,
+    cfgOptPgHostCertFile,
+    cfgOptPgHostCertFile + 1,
+    cfgOptPgHostCertFile + 2,
+    cfgOptPgHostCertFile + 3,
+    cfgOptPgHostCertFile + 4,
+    cfgOptPgHostCertFile + 5,
+    cfgOptPgHostCertFile + 6,
+    cfgOptPgHostCertFile + 7,
+    cfgOptPgHostKeyFile,
+    cfgOptPgHostKeyFile + 1,
+    cfgOptPgHostKeyFile + 2,
+    cfgOptPgHostKeyFile + 3,
+    cfgOptPgHostKeyFile + 4,
+    cfgOptPgHostKeyFile + 5,
+    cfgOptPgHostKeyFile + 6,
+    cfgOptPgHostKeyFile + 7,
     cfgOptRecoveryOption,
     cfgOptRepoCipherPass,
+    cfgOptRepoHostCaFile,
+    cfgOptRepoHostCaPath,
+    cfgOptRepoHostCertFile,
+    cfgOptRepoHostKeyFile,
     cfgOptRepoS3Bucket,
     cfgOptRepoS3CaFile,
     cfgOptRepoS3CaPath,
@@ -2441,6 +3114,7 @@ static const ConfigOption optionResolveOrder[] =
     cfgOptRepoS3Host,
     cfgOptRepoS3Key,
     cfgOptRepoS3KeySecret,
+    cfgOptRepoS3ListParallel,
     cfgOptRepoS3Port,
     cfgOptRepoS3Region,
     cfgOptRepoS3Token,
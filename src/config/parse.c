@@ -102,6 +102,25 @@ optionFind(const String *option)
     return optionIdx;
 }
 
+/**********************************************************************************************************************************/
+int
+configParseOptionId(const String *optionName)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, optionName);
+    FUNCTION_TEST_END();
+
+    ASSERT(optionName != NULL);
+
+    int result = -1;
+    unsigned int optionIdx = optionFind(optionName);
+
+    if (optionList[optionIdx].name != NULL)
+        result = (int)(optionList[optionIdx].val & PARSE_OPTION_MASK);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Convert the value passed into bytes and update valueDbl for range checking
 ***********************************************************************************************************************************/
@@ -11,4 +11,8 @@ Functions
 ***********************************************************************************************************************************/
 void configParse(unsigned int argListSize, const char *argList[], bool resetLogLevel);
 
+// Get the option id for a command-line option name without the leading dashes, e.g. no-config.  Only exact names are found, unlike
+// getopt_long() which also accepts unambiguous abbreviations.  Returns -1 if the option is not found.
+int configParseOptionId(const String *optionName);
+
 #endif
@@ -21,6 +21,9 @@ typedef struct InfoArchive InfoArchive;
 Archive info filename
 ***********************************************************************************************************************************/
 #define INFO_ARCHIVE_FILE                                           "archive.info"
+
+// Index of the WAL range in each archive id path, see command/archive/index.h
+#define INFO_ARCHIVE_INDEX_FILE                                     "archive.index"
 #define REGEX_ARCHIVE_DIR_DB_VERSION                                "^[0-9]+(\\.[0-9]+)*-[0-9]+$"
 
 #define INFO_ARCHIVE_PATH_FILE                                      STORAGE_REPO_ARCHIVE "/" INFO_ARCHIVE_FILE
@@ -8,5 +8,6 @@ Manifest Handler
 Constants
 ***********************************************************************************************************************************/
 #define MANIFEST_FILE                                               "backup.manifest"
+#define MANIFEST_BIN_FILE                                           MANIFEST_FILE ".bin"
 
 #endif
@@ -0,0 +1,752 @@
+/***********************************************************************************************************************************
+Binary Manifest
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/crypto/hash.h"
+#include "common/debug.h"
+#include "common/io/bufferRead.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/type/json.h"
+#include "common/type/list.h"
+#include "common/type/stringList.h"
+#include "info/info.h"
+#include "info/manifestBin.h"
+
+/***********************************************************************************************************************************
+Manifest sections and keys
+***********************************************************************************************************************************/
+STRING_STATIC(MANIFEST_SECTION_TARGET_FILE_STR,                     "target:file");
+STRING_STATIC(MANIFEST_SECTION_TARGET_FILE_DEFAULT_STR,             "target:file:default");
+
+STRING_STATIC(MANIFEST_KEY_CHECKSUM_STR,                            "checksum");
+STRING_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_STR,                       "checksum-page");
+STRING_STATIC(MANIFEST_KEY_GROUP_STR,                               "group");
+STRING_STATIC(MANIFEST_KEY_MASTER_STR,                              "master");
+STRING_STATIC(MANIFEST_KEY_MODE_STR,                                "mode");
+STRING_STATIC(MANIFEST_KEY_REFERENCE_STR,                           "reference");
+STRING_STATIC(MANIFEST_KEY_SIZE_STR,                                "size");
+STRING_STATIC(MANIFEST_KEY_SIZE_REPO_STR,                           "repo-size");
+STRING_STATIC(MANIFEST_KEY_TIMESTAMP_STR,                           "timestamp");
+STRING_STATIC(MANIFEST_KEY_USER_STR,                                "user");
+
+/***********************************************************************************************************************************
+Binary format.  The version must be incremented whenever the header or record layout changes.
+***********************************************************************************************************************************/
+#define MANIFEST_BIN_MAGIC                                          "PGBRMANB"
+#define MANIFEST_BIN_VERSION                                        1
+
+typedef struct ManifestBinHeader
+{
+    char magic[sizeof(MANIFEST_BIN_MAGIC) - 1];                     // Identifies the file as a binary manifest
+    uint32_t version;                                               // Format version
+    uint32_t recordSize;                                            // Size of each record, which also detects layout changes
+    uint64_t fileTotal;                                             // Total file records
+    uint64_t stringSize;                                            // Size of the string table
+    uint64_t cipherPass;                                            // Passphrase for the backup files or zero for none
+} ManifestBinHeader;
+
+// Record flags
+#define MANIFEST_BIN_FLAG_MASTER                                    1
+#define MANIFEST_BIN_FLAG_CHECKSUM_PAGE                             2
+#define MANIFEST_BIN_FLAG_CHECKSUM_PAGE_ERROR                       4
+
+// Strings are stored as offsets into the string table.  Offset zero is reserved to indicate no string.
+typedef struct ManifestBinRecord
+{
+    uint64_t size;                                                  // Original size
+    uint64_t sizeRepo;                                              // Size in the repo
+    int64_t timestamp;                                              // Original modification time
+    uint32_t name;                                                  // File name
+    uint32_t reference;                                             // Reference to a prior backup
+    uint32_t user;                                                  // User name
+    uint32_t group;                                                 // Group name
+    uint32_t mode;                                                  // Mode
+    uint32_t flag;                                                  // MANIFEST_BIN_FLAG_* flags
+    char checksum[HASH_TYPE_SHA1_SIZE_HEX + 1];                     // Zero-terminated SHA-1 checksum or empty for none
+} ManifestBinRecord;
+
+/***********************************************************************************************************************************
+Object types
+***********************************************************************************************************************************/
+struct ManifestBin
+{
+    MemContext *memContext;                                         // Mem context
+    void *map;                                                      // Mapped memory when loaded from a file
+    size_t mapSize;                                                 // Size of mapped memory
+    unsigned int fileTotal;                                         // Total files
+    const ManifestBinRecord *recordList;                            // File records sorted by name
+    const char *stringTable;                                        // String table
+    uint64_t stringSize;                                            // Size of the string table
+    bool recordValid;                                               // Have all records been validated on load?
+    const char *cipherPass;                                         // Passphrase for the backup files
+};
+
+// Value of a string in a file before defaults are applied
+#define MANIFEST_BIN_WRITE_DEFAULT                                  0
+#define MANIFEST_BIN_WRITE_NONE                                     UINT_MAX
+
+typedef struct ManifestBinWriteFile
+{
+    const String *name;                                             // File name (must be first for sorting)
+    unsigned int reference;                                         // Index + 1 in the value list, default, or none
+    unsigned int user;
+    unsigned int group;
+    unsigned int mode;
+    int master;                                                     // -1 when not set so the default is used
+    ManifestBinRecord record;                                       // Values that do not need to be resolved
+} ManifestBinWriteFile;
+
+struct ManifestBinWrite
+{
+    MemContext *memContext;                                         // Mem context
+    List *fileList;                                                 // Files added from the text manifest
+    StringList *valueList;                                          // Distinct strings other than names, e.g. user and group
+    unsigned int cipherPass;                                        // Passphrase for the backup files
+    unsigned int userDefault;                                       // Defaults for values not set in the file
+    unsigned int groupDefault;
+    unsigned int modeDefault;
+    bool masterDefault;
+};
+
+OBJECT_DEFINE_FREE(MANIFEST_BIN);
+OBJECT_DEFINE_FREE(MANIFEST_BIN_WRITE);
+
+/***********************************************************************************************************************************
+Unmap memory when the manifest is freed
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(MANIFEST_BIN, LOG, logLevelTrace)
+{
+    munmap(this->map, this->mapSize);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Validate a record
+
+The checksum detects corruption but it is not keyed so it cannot detect a manifest that was modified deliberately.  Every offset is
+checked against the string table, which must end in a terminator, so a modified manifest cannot cause a read outside of the data.
+***********************************************************************************************************************************/
+static const ManifestBinRecord *
+manifestBinRecord(const ManifestBin *this, unsigned int fileIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN, this);
+        FUNCTION_TEST_PARAM(UINT, fileIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(fileIdx < this->fileTotal);
+
+    const ManifestBinRecord *result = &this->recordList[fileIdx];
+
+    // Records are validated when they are fetched unless they were all validated on load
+    if (!this->recordValid &&
+        (result->name == 0 || result->name >= this->stringSize || result->reference >= this->stringSize ||
+         result->user >= this->stringSize || result->group >= this->stringSize || result->mode >= this->stringSize ||
+         result->checksum[HASH_TYPE_SHA1_SIZE_HEX] != '\0'))
+    {
+        THROW_FMT(FormatError, "binary manifest record %u is invalid", fileIdx);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Validate the binary manifest and set the record list and string table
+***********************************************************************************************************************************/
+static void
+manifestBinLoad(ManifestBin *this, const unsigned char *data, size_t size, bool checksum)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(MANIFEST_BIN, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(BOOL, checksum);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(data != NULL || size == 0);
+
+    if (size < sizeof(ManifestBinHeader) + HASH_TYPE_SHA1_SIZE ||
+        memcmp(data, MANIFEST_BIN_MAGIC, sizeof(MANIFEST_BIN_MAGIC) - 1) != 0)
+    {
+        THROW(FormatError, "invalid binary manifest header");
+    }
+
+    // Copy the header since the data may not be aligned
+    ManifestBinHeader header;
+    memcpy(&header, data, sizeof(ManifestBinHeader));
+
+    if (header.version != MANIFEST_BIN_VERSION || header.recordSize != sizeof(ManifestBinRecord))
+    {
+        THROW_FMT(
+            VersionNotSupportedError, "binary manifest version %u with record size %u is not supported", header.version,
+            header.recordSize);
+    }
+
+    // Check the size before the checksum so the checksum is not calculated on a truncated manifest
+    if (header.fileTotal > UINT_MAX || header.stringSize == 0 || header.stringSize > UINT32_MAX ||
+        size != sizeof(ManifestBinHeader) + header.fileTotal * sizeof(ManifestBinRecord) + header.stringSize + HASH_TYPE_SHA1_SIZE)
+    {
+        THROW(FormatError, "binary manifest size does not match header");
+    }
+
+    // The checksum requires a read of the entire manifest so it is optional for a mapped local copy
+    const size_t checksumOffset = size - HASH_TYPE_SHA1_SIZE;
+
+    if (checksum)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            if (memcmp(
+                    bufPtr(cryptoHashOne(HASH_TYPE_SHA1_STR, BUF((unsigned char *)data, checksumOffset))), data + checksumOffset,
+                    HASH_TYPE_SHA1_SIZE) != 0)
+            {
+                THROW(ChecksumError, "binary manifest checksum does not match");
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    this->fileTotal = (unsigned int)header.fileTotal;
+    this->recordList = (const ManifestBinRecord *)(data + sizeof(ManifestBinHeader));
+    this->stringTable = (const char *)(this->recordList + this->fileTotal);
+
+    // Check that all strings are terminated and all offsets are in the string table
+    if (this->stringTable[header.stringSize - 1] != '\0' || header.cipherPass >= header.stringSize)
+        THROW(FormatError, "binary manifest string table is invalid");
+
+    this->stringSize = header.stringSize;
+    this->cipherPass = header.cipherPass != 0 ? this->stringTable + header.cipherPass : NULL;
+
+    // When the checksum was calculated the entire manifest has already been read so validate all records now.  Otherwise validate
+    // each record when it is fetched so only the pages that are accessed are read.
+    if (checksum)
+    {
+        for (unsigned int fileIdx = 0; fileIdx < this->fileTotal; fileIdx++)
+            manifestBinRecord(this, fileIdx);
+
+        this->recordValid = true;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+ManifestBin *
+manifestBinNew(const Buffer *buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(buffer != NULL);
+
+    ManifestBin *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ManifestBin")
+    {
+        this = memNew(sizeof(ManifestBin));
+        this->memContext = MEM_CONTEXT_NEW();
+
+        manifestBinLoad(this, bufPtr(buffer), bufUsed(buffer), true);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST_BIN, this);
+}
+
+/**********************************************************************************************************************************/
+ManifestBin *
+manifestBinNewMap(const String *fileName, bool checksum)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(BOOL, checksum);
+    FUNCTION_LOG_END();
+
+    ASSERT(fileName != NULL);
+
+    ManifestBin *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ManifestBin")
+    {
+        this = memNew(sizeof(ManifestBin));
+        this->memContext = MEM_CONTEXT_NEW();
+
+        // The handle is not needed once the file is mapped
+        int handle = open(strPtr(fileName), O_RDONLY, 0);
+        THROW_ON_SYS_ERROR_FMT(handle == -1, FileOpenError, "unable to open '%s' for read", strPtr(fileName));
+
+        TRY_BEGIN()
+        {
+            struct stat statFile;
+            THROW_ON_SYS_ERROR_FMT(                                 // {uncoverable_branch - fstat does not fail on an open handle}
+                fstat(handle, &statFile) == -1, FileOpenError, "unable to get info for '%s'", strPtr(fileName));
+
+            // An empty file cannot be mapped but is still reported as an invalid manifest
+            if (statFile.st_size > 0)
+            {
+                void *map = mmap(NULL, (size_t)statFile.st_size, PROT_READ, MAP_PRIVATE, handle, 0);
+                THROW_ON_SYS_ERROR_FMT(map == MAP_FAILED, FileReadError, "unable to map '%s'", strPtr(fileName));
+
+                this->map = map;
+                this->mapSize = (size_t)statFile.st_size;
+                memContextCallbackSet(this->memContext, manifestBinFreeResource, this);
+            }
+        }
+        FINALLY()
+        {
+            close(handle);
+        }
+        TRY_END();
+
+        manifestBinLoad(this, this->map, this->mapSize, checksum);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST_BIN, this);
+}
+
+/***********************************************************************************************************************************
+Convert a record to a file
+***********************************************************************************************************************************/
+static ManifestBinFile
+manifestBinFileFromRecord(const ManifestBin *this, const ManifestBinRecord *record)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN, this);
+        FUNCTION_TEST_PARAM_P(VOID, record);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(record != NULL);
+
+    ManifestBinFile result =
+    {
+        .name = this->stringTable + record->name,
+        .checksum = record->checksum[0] != '\0' ? record->checksum : NULL,
+        .reference = record->reference != 0 ? this->stringTable + record->reference : NULL,
+        .user = record->user != 0 ? this->stringTable + record->user : NULL,
+        .group = record->group != 0 ? this->stringTable + record->group : NULL,
+        .mode = record->mode != 0 ? this->stringTable + record->mode : NULL,
+        .size = record->size,
+        .sizeRepo = record->sizeRepo,
+        .timestamp = (time_t)record->timestamp,
+        .master = record->flag & MANIFEST_BIN_FLAG_MASTER,
+        .checksumPage = record->flag & MANIFEST_BIN_FLAG_CHECKSUM_PAGE,
+        .checksumPageError = record->flag & MANIFEST_BIN_FLAG_CHECKSUM_PAGE_ERROR,
+    };
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+ManifestBinFile
+manifestBinFile(const ManifestBin *this, unsigned int fileIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN, this);
+        FUNCTION_TEST_PARAM(UINT, fileIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(fileIdx < this->fileTotal);
+
+    FUNCTION_TEST_RETURN(manifestBinFileFromRecord(this, manifestBinRecord(this, fileIdx)));
+}
+
+/**********************************************************************************************************************************/
+bool
+manifestBinFileFind(const ManifestBin *this, const char *name, ManifestBinFile *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN, this);
+        FUNCTION_TEST_PARAM(STRINGZ, name);
+        FUNCTION_TEST_PARAM_P(VOID, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(name != NULL);
+    ASSERT(file != NULL);
+
+    bool result = false;
+    unsigned int low = 0;
+    unsigned int high = this->fileTotal;
+
+    // Binary search on the records, which are sorted by name
+    while (low < high)
+    {
+        unsigned int middle = low + (high - low) / 2;
+        const ManifestBinRecord *record = manifestBinRecord(this, middle);
+        int compare = strcmp(name, this->stringTable + record->name);
+
+        if (compare == 0)
+        {
+            *file = manifestBinFileFromRecord(this, record);
+            result = true;
+            break;
+        }
+
+        if (compare < 0)
+            high = middle;
+        else
+            low = middle + 1;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+const char *
+manifestBinCipherPass(const ManifestBin *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->cipherPass);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+manifestBinFileTotal(const ManifestBin *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->fileTotal);
+}
+
+/**********************************************************************************************************************************/
+ManifestBinWrite *
+manifestBinWriteNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    ManifestBinWrite *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ManifestBinWrite")
+    {
+        this = memNew(sizeof(ManifestBinWrite));
+        this->memContext = MEM_CONTEXT_NEW();
+        this->fileList = lstNewParam(sizeof(ManifestBinWriteFile), (ListParam){.comparator = lstComparatorStr});
+        this->valueList = strLstNew();
+        this->userDefault = MANIFEST_BIN_WRITE_NONE;
+        this->groupDefault = MANIFEST_BIN_WRITE_NONE;
+        this->modeDefault = MANIFEST_BIN_WRITE_NONE;
+        this->cipherPass = MANIFEST_BIN_WRITE_NONE;
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST_BIN_WRITE, this);
+}
+
+/***********************************************************************************************************************************
+Get the index of a value, adding it if it does not exist.  There are few distinct values, e.g. one user and group and a reference
+for each prior backup, so a linear search is fast enough.
+***********************************************************************************************************************************/
+static unsigned int
+manifestBinWriteValue(ManifestBinWrite *this, const Variant *value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST_BIN_WRITE, this);
+        FUNCTION_TEST_PARAM(VARIANT, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    unsigned int result = MANIFEST_BIN_WRITE_DEFAULT;
+
+    if (value != NULL)
+    {
+        // User and group are false when they have no name
+        if (varType(value) == varTypeBool)
+            result = MANIFEST_BIN_WRITE_NONE;
+        else
+        {
+            const String *valueStr = varStr(value);
+            unsigned int valueIdx = 0;
+
+            for (; valueIdx < strLstSize(this->valueList); valueIdx++)
+            {
+                if (strEq(strLstGet(this->valueList, valueIdx), valueStr))
+                    break;
+            }
+
+            if (valueIdx == strLstSize(this->valueList))
+                strLstAdd(this->valueList, valueStr);
+
+            result = valueIdx + 1;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+manifestBinWriteCallback(void *data, const String *section, const String *key, const String *value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, section);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(STRING, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(section != NULL);
+    ASSERT(key != NULL);
+    ASSERT(value != NULL);
+
+    ManifestBinWrite *this = (ManifestBinWrite *)data;
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        if (strEq(section, MANIFEST_SECTION_TARGET_FILE_STR))
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                const KeyValue *fileKv = jsonToKv(value);
+
+                ManifestBinWriteFile file =
+                {
+                    .reference = manifestBinWriteValue(this, kvGet(fileKv, VARSTR(MANIFEST_KEY_REFERENCE_STR))),
+                    .user = manifestBinWriteValue(this, kvGet(fileKv, VARSTR(MANIFEST_KEY_USER_STR))),
+                    .group = manifestBinWriteValue(this, kvGet(fileKv, VARSTR(MANIFEST_KEY_GROUP_STR))),
+                    .mode = manifestBinWriteValue(this, kvGet(fileKv, VARSTR(MANIFEST_KEY_MODE_STR))),
+                    .master = -1,
+                    .record =
+                    {
+                        .size = varUInt64Force(kvGet(fileKv, VARSTR(MANIFEST_KEY_SIZE_STR))),
+                        .timestamp = varInt64Force(kvGet(fileKv, VARSTR(MANIFEST_KEY_TIMESTAMP_STR))),
+                    },
+                };
+
+                // Repo size is only stored when it differs from the original size
+                const Variant *sizeRepo = kvGet(fileKv, VARSTR(MANIFEST_KEY_SIZE_REPO_STR));
+                file.record.sizeRepo = sizeRepo != NULL ? varUInt64Force(sizeRepo) : file.record.size;
+
+                const Variant *master = kvGet(fileKv, VARSTR(MANIFEST_KEY_MASTER_STR));
+
+                if (master != NULL)
+                    file.master = varBool(master);
+
+                // Page checksum is true when no errors were found and false when errors were found
+                const Variant *checksumPage = kvGet(fileKv, VARSTR(MANIFEST_KEY_CHECKSUM_PAGE_STR));
+
+                if (checksumPage != NULL)
+                {
+                    file.record.flag |= MANIFEST_BIN_FLAG_CHECKSUM_PAGE;
+
+                    if (!varBool(checksumPage))
+                        file.record.flag |= MANIFEST_BIN_FLAG_CHECKSUM_PAGE_ERROR;
+                }
+
+                // Zero-length files do not have a checksum
+                const Variant *checksum = kvGet(fileKv, VARSTR(MANIFEST_KEY_CHECKSUM_STR));
+
+                if (checksum != NULL)
+                {
+                    if (strSize(varStr(checksum)) != HASH_TYPE_SHA1_SIZE_HEX)
+                        THROW_FMT(FormatError, "invalid checksum '%s' for '%s'", strPtr(varStr(checksum)), strPtr(key));
+
+                    memcpy(file.record.checksum, strPtr(varStr(checksum)), HASH_TYPE_SHA1_SIZE_HEX);
+                }
+
+                MEM_CONTEXT_BEGIN(lstMemContext(this->fileList))
+                {
+                    file.name = strDup(key);
+                }
+                MEM_CONTEXT_END();
+
+                lstAdd(this->fileList, &file);
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+        else if (strEq(section, MANIFEST_SECTION_TARGET_FILE_DEFAULT_STR))
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                const Variant *defaultValue = jsonToVar(value);
+
+                if (strEq(key, MANIFEST_KEY_USER_STR))
+                    this->userDefault = manifestBinWriteValue(this, defaultValue);
+                else if (strEq(key, MANIFEST_KEY_GROUP_STR))
+                    this->groupDefault = manifestBinWriteValue(this, defaultValue);
+                else if (strEq(key, MANIFEST_KEY_MODE_STR))
+                    this->modeDefault = manifestBinWriteValue(this, defaultValue);
+                else if (strEq(key, MANIFEST_KEY_MASTER_STR))
+                    this->masterDefault = varBool(defaultValue);
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Resolve a value to an offset in the string table
+***********************************************************************************************************************************/
+static uint32_t
+manifestBinWriteOffset(const uint32_t *valueOffsetList, unsigned int value, unsigned int valueDefault)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, valueOffsetList);
+        FUNCTION_TEST_PARAM(UINT, value);
+        FUNCTION_TEST_PARAM(UINT, valueDefault);
+    FUNCTION_TEST_END();
+
+    ASSERT(valueOffsetList != NULL);
+
+    if (value == MANIFEST_BIN_WRITE_DEFAULT)
+        value = valueDefault;
+
+    FUNCTION_TEST_RETURN(value == MANIFEST_BIN_WRITE_NONE ? 0 : valueOffsetList[value - 1]);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+manifestBinWriteResult(ManifestBinWrite *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST_BIN_WRITE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Files are usually already sorted since the text manifest is written in sorted order
+        lstSort(this->fileList, sortOrderAsc);
+
+        // Determine the size of the string table.  The first byte is reserved so offset zero can indicate no string.
+        uint64_t stringSize = 1;
+
+        for (unsigned int valueIdx = 0; valueIdx < strLstSize(this->valueList); valueIdx++)
+            stringSize += strSize(strLstGet(this->valueList, valueIdx)) + 1;
+
+        for (unsigned int fileIdx = 0; fileIdx < lstSize(this->fileList); fileIdx++)
+            stringSize += strSize(((const ManifestBinWriteFile *)lstGet(this->fileList, fileIdx))->name) + 1;
+
+        // Strings are referenced by 32-bit offsets
+        CHECK(stringSize <= UINT32_MAX);
+
+        // Allocate the manifest and write the header
+        const size_t recordSize = sizeof(ManifestBinRecord) * lstSize(this->fileList);
+        const size_t size = sizeof(ManifestBinHeader) + recordSize + (size_t)stringSize + HASH_TYPE_SHA1_SIZE;
+
+        result = bufNew(size);
+        memset(bufPtr(result), 0, size);
+
+        ManifestBinHeader header =
+        {
+            .version = MANIFEST_BIN_VERSION,
+            .recordSize = sizeof(ManifestBinRecord),
+            .fileTotal = lstSize(this->fileList),
+            .stringSize = stringSize,
+        };
+
+        memcpy(header.magic, MANIFEST_BIN_MAGIC, sizeof(header.magic));
+
+        // Write values to the string table
+        ManifestBinRecord *recordList = (ManifestBinRecord *)(bufPtr(result) + sizeof(ManifestBinHeader));
+        char *stringTable = (char *)recordList + recordSize;
+        uint32_t stringOffset = 1;
+        uint32_t *valueOffsetList = memNew(sizeof(uint32_t) * (strLstSize(this->valueList) + 1));
+
+        for (unsigned int valueIdx = 0; valueIdx < strLstSize(this->valueList); valueIdx++)
+        {
+            const String *value = strLstGet(this->valueList, valueIdx);
+
+            memcpy(stringTable + stringOffset, strPtr(value), strSize(value));
+            valueOffsetList[valueIdx] = stringOffset;
+            stringOffset += (uint32_t)strSize(value) + 1;
+        }
+
+        header.cipherPass = manifestBinWriteOffset(valueOffsetList, this->cipherPass, MANIFEST_BIN_WRITE_NONE);
+        memcpy(bufPtr(result), &header, sizeof(ManifestBinHeader));
+
+        // Write records and names in sorted order so names that are near each other in the search are near each other in memory
+        for (unsigned int fileIdx = 0; fileIdx < lstSize(this->fileList); fileIdx++)
+        {
+            const ManifestBinWriteFile *file = lstGet(this->fileList, fileIdx);
+            ManifestBinRecord *record = &recordList[fileIdx];
+
+            *record = file->record;
+            record->name = stringOffset;
+            record->reference = manifestBinWriteOffset(valueOffsetList, file->reference, MANIFEST_BIN_WRITE_NONE);
+            record->user = manifestBinWriteOffset(valueOffsetList, file->user, this->userDefault);
+            record->group = manifestBinWriteOffset(valueOffsetList, file->group, this->groupDefault);
+            record->mode = manifestBinWriteOffset(valueOffsetList, file->mode, this->modeDefault);
+
+            if (file->master == -1 ? this->masterDefault : file->master)
+                record->flag |= MANIFEST_BIN_FLAG_MASTER;
+
+            memcpy(stringTable + stringOffset, strPtr(file->name), strSize(file->name));
+            stringOffset += (uint32_t)strSize(file->name) + 1;
+        }
+
+        // Write the checksum of everything before it
+        const size_t checksumOffset = size - HASH_TYPE_SHA1_SIZE;
+
+        memcpy(
+            bufPtr(result) + checksumOffset,
+            bufPtr(cryptoHashOne(HASH_TYPE_SHA1_STR, BUF(bufPtr(result), checksumOffset))), HASH_TYPE_SHA1_SIZE);
+        bufUsedSet(result, size);
+
+        bufMove(result, MEM_CONTEXT_OLD());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+manifestBinFromText(const Buffer *manifest)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BUFFER, manifest);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        ManifestBinWrite *manifestWrite = manifestBinWriteNew();
+        const String *cipherPass = infoCipherPass(infoNewLoad(ioBufferReadNew(manifest), manifestBinWriteCallback, manifestWrite));
+
+        // Store the passphrase for the backup files so the text manifest is not needed to read them
+        if (cipherPass != NULL)
+            manifestWrite->cipherPass = manifestBinWriteValue(manifestWrite, VARSTR(cipherPass));
+
+        result = manifestBinWriteResult(manifestWrite);
+        bufMove(result, MEM_CONTEXT_OLD());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
@@ -0,0 +1,115 @@
+/***********************************************************************************************************************************
+Binary Manifest
+
+The text manifest (backup.manifest) is an ini file with a JSON value per file, so every entry must be parsed and stored as Strings
+and Variants before any file can be found.  The binary manifest stores the files as fixed-size records sorted by name followed by a
+string table and a SHA-1 checksum of the preceding contents:
+
+    header | record[fileTotal] | string table | sha1
+
+Records reference names and other strings by offset into the string table.  Repeated strings, e.g. user, group, and reference, are
+stored once.  Files can be iterated or found by name with a binary search directly from the buffer, which may be memory-mapped from
+a local copy so only the pages that are accessed are read.
+
+Backup writes the binary manifest (backup.manifest.bin) next to the text manifest so files can be read without parsing JSON.  The
+text manifest is still the authority.  The binary manifest is written in the byte order of the host, so a manifest written on a host
+with a different byte order or record layout is rejected with VersionNotSupportedError and the text manifest must be used instead.
+Page checksum errors and the path, link, and database sections are not included since they are not required to find and verify
+files.
+***********************************************************************************************************************************/
+#ifndef INFO_MANIFESTBIN_H
+#define INFO_MANIFESTBIN_H
+
+/***********************************************************************************************************************************
+Object types
+***********************************************************************************************************************************/
+#define MANIFEST_BIN_TYPE                                           ManifestBin
+#define MANIFEST_BIN_PREFIX                                         manifestBin
+
+typedef struct ManifestBin ManifestBin;
+
+#define MANIFEST_BIN_WRITE_TYPE                                     ManifestBinWrite
+#define MANIFEST_BIN_WRITE_PREFIX                                   manifestBinWrite
+
+typedef struct ManifestBinWrite ManifestBinWrite;
+
+#include <time.h>
+
+#include "common/type/buffer.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+File stored in the binary manifest.  Strings point into the binary manifest so they are valid only as long as the manifest is.
+***********************************************************************************************************************************/
+typedef struct ManifestBinFile
+{
+    const char *name;                                               // File name, e.g. pg_data/PG_VERSION
+    const char *checksum;                                           // SHA-1 checksum or NULL for zero-length files
+    const char *reference;                                          // Label of the backup where the file is stored or NULL
+    const char *user;                                               // User name or NULL if the user has no name
+    const char *group;                                              // Group name or NULL if the group has no name
+    const char *mode;                                               // Mode, e.g. 0600
+    uint64_t size;                                                  // Original size
+    uint64_t sizeRepo;                                              // Size in the repo
+    time_t timestamp;                                               // Original modification time
+    bool master;                                                    // Is the file required from the master in a standby backup?
+    bool checksumPage;                                              // Were page checksums checked?
+    bool checksumPageError;                                         // Were page checksum errors found?
+} ManifestBinFile;
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Load a binary manifest from a buffer.  The buffer is not copied so it must not be freed or modified while the manifest is in use.
+ManifestBin *manifestBinNew(const Buffer *buffer);
+
+// Load a binary manifest by mapping a local file into memory.  Skipping the checksum means only the pages that are accessed are
+// read, so the header is validated on load and each record is validated when it is fetched.
+ManifestBin *manifestBinNewMap(const String *fileName, bool checksum);
+
+// Convert a text manifest to a binary manifest.  Pass manifestBinWriteCallback() and the object to infoNewLoad() to add the files.
+ManifestBinWrite *manifestBinWriteNew(void);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Convert a text manifest, including the passphrase for the backup files, to a binary manifest
+Buffer *manifestBinFromText(const Buffer *manifest);
+
+// Find a file by name.  Returns false if the file is not in the manifest.
+bool manifestBinFileFind(const ManifestBin *this, const char *name, ManifestBinFile *file);
+
+// Add files from the text manifest.  The signature matches InfoLoadNewCallback.
+void manifestBinWriteCallback(void *data, const String *section, const String *key, const String *value);
+
+// Write the binary manifest after all files have been added
+Buffer *manifestBinWriteResult(ManifestBinWrite *this);
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+// Passphrase for the backup files or NULL if the repo is not encrypted
+const char *manifestBinCipherPass(const ManifestBin *this);
+
+ManifestBinFile manifestBinFile(const ManifestBin *this, unsigned int fileIdx);
+unsigned int manifestBinFileTotal(const ManifestBin *this);
+
+/***********************************************************************************************************************************
+Destructors
+***********************************************************************************************************************************/
+void manifestBinFree(ManifestBin *this);
+void manifestBinWriteFree(ManifestBinWrite *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_MANIFEST_BIN_TYPE                                                                                             \
+    ManifestBin *
+#define FUNCTION_LOG_MANIFEST_BIN_FORMAT(value, buffer, bufferSize)                                                                \
+    objToLog(value, "ManifestBin", buffer, bufferSize)
+#define FUNCTION_LOG_MANIFEST_BIN_WRITE_TYPE                                                                                       \
+    ManifestBinWrite *
+#define FUNCTION_LOG_MANIFEST_BIN_WRITE_FORMAT(value, buffer, bufferSize)                                                          \
+    objToLog(value, "ManifestBinWrite", buffer, bufferSize)
+
+#endif
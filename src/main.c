@@ -18,10 +18,12 @@ Main
 #include "command/info/info.h"
 #include "command/local/local.h"
 #include "command/remote/remote.h"
+#include "command/server/server.h"
 #include "command/stanza/create.h"
 #include "command/stanza/delete.h"
 #include "command/stanza/upgrade.h"
 #include "command/storage/list.h"
+#include "command/verify/verify.h"
 #include "common/debug.h"
 #include "common/error.h"
 #include "common/exit.h"
@@ -194,6 +196,14 @@ main(int argListSize, const char *argList[])
                     break;
                 }
 
+                // Server command
+                // -----------------------------------------------------------------------------------------------------------------
+                case cfgCmdServer:
+                {
+                    cmdServer(0);
+                    break;
+                }
+
                 // Stanza create command
                 // -----------------------------------------------------------------------------------------------------------------
                 case cfgCmdStanzaCreate:
@@ -242,6 +252,14 @@ main(int argListSize, const char *argList[])
                     break;
                 }
 
+                // Verify command
+                // -----------------------------------------------------------------------------------------------------------------
+                case cfgCmdVerify:
+                {
+                    cmdVerify();
+                    break;
+                }
+
                 // Display version
                 // -----------------------------------------------------------------------------------------------------------------
                 case cfgCmdVersion:
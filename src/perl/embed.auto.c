@@ -1136,8 +1136,11 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "$oBackupProcess->hostAdd($self->{iMasterRemoteIdx}, 1);\n"
             "}\n"
-            "\n"
-            "$oBackupProcess->hostAdd($self->{iCopyRemoteIdx}, cfgOption(CFGOPT_PROCESS_MAX));\n"
+            "\n\n"
+            "my $iCopyHostTotal = $self->copyHostAdd($oBackupProcess);\n"
+            "\n\n"
+            "my $bCopyMulti = $iCopyHostTotal > 1;\n"
+            "my $hCopySize = {};\n"
             "\n\n"
             "my $lFileTotal = 0;\n"
             "my $lSizeTotal = 0;\n"
@@ -1192,7 +1195,7 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n\n"
             "my $bIgnoreMissing = true;\n"
-            "my $strDbFile = $oBackupManifest->dbPathGet($strDbCopyPath, $strRepoFile);\n"
+            "my $strDbFile = $oBackupManifest->dbPathGet($bCopyMulti ? undef : $strDbCopyPath, $strRepoFile);\n"
             "my $iHostConfigIdx = $self->{iCopyRemoteIdx};\n"
             "\n\n"
             "if ($oBackupManifest->boolGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_MASTER))\n"
@@ -1219,7 +1222,9 @@ static const EmbeddedModule embeddedModule[] =
             "defined($strLsnStart) ? hex((split('/', $strLsnStart))[0]) : 0xFFFFFFFF,\n"
             "defined($strLsnStart) ? hex((split('/', $strLsnStart))[1]) : 0xFFFFFFFF,\n"
             "$strRepoFile, defined($strReference) ? true : false, $bCompress, cfgOption(CFGOPT_COMPRESS_LEVEL),\n"
-            "$strBackupLabel, cfgOption(CFGOPT_DELTA)],\n"
+            "$strBackupLabel, cfgOption(CFGOPT_DELTA),\n"
+            "cfgOption(CFGOPT_BACKUP_COMPRESS_SIDE) eq CFGOPTVAL_BACKUP_COMPRESS_SIDE_REPO ? true : false,\n"
+            "cfgOption(CFGOPT_BACKUP_CIPHER_SIDE) eq CFGOPTVAL_BACKUP_CIPHER_SIDE_REPO ? true : false],\n"
             "{rParamSecure => $oBackupManifest->cipherPassSub() ? [$oBackupManifest->cipherPassSub()] : undef});\n"
             "\n\n"
             "$oBackupManifest->remove(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);\n"
@@ -1252,15 +1257,35 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "foreach my $hJob (@{$hyJob})\n"
             "{\n"
+            "my $strDbFile = @{$hJob->{rParam}}[0];\n"
+            "\n\n"
+            "if ($bCopyMulti)\n"
+            "{\n"
+            "if (index($strDbFile, '/') != 0)\n"
+            "{\n"
+            "$strDbFile = cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_PATH, $hJob->{iHostConfigIdx})) . \"/${strDbFile}\";\n"
+            "}\n"
+            "\n"
+            "$hCopySize->{$hJob->{iHostConfigIdx}} += @{$hJob->{rResult}}[1];\n"
+            "}\n"
+            "\n"
             "($lSizeCurrent, $lManifestSaveCurrent) = backupManifestUpdate(\n"
             "$oBackupManifest, cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $hJob->{iHostConfigIdx}), false),\n"
-            "$hJob->{iProcessId}, @{$hJob->{rParam}}[0], @{$hJob->{rParam}}[7], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],\n"
+            "$hJob->{iProcessId}, $strDbFile, @{$hJob->{rParam}}[7], @{$hJob->{rParam}}[2], @{$hJob->{rParam}}[3],\n"
             "@{$hJob->{rParam}}[4], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent, $lManifestSaveSize,\n"
             "$lManifestSaveCurrent);\n"
             "}\n"
             "\n\n\n"
             "protocolKeepAlive();\n"
             "}\n"
+            "\n\n"
+            "foreach my $iHostConfigIdx (sort {$a <=> $b} keys(%{$hCopySize}))\n"
+            "{\n"
+            "&log(DETAIL,\n"
+            "'copied ' . fileSizeFormat($hCopySize->{$iHostConfigIdx}) . ' from pg' . $iHostConfigIdx .\n"
+            "(cfgOptionTest(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $iHostConfigIdx)) ?\n"
+            "' (' . cfgOption(cfgOptionIdFromIndex(CFGOPT_PG_HOST, $iHostConfigIdx)) . ')' : ''));\n"
+            "}\n"
             "\n"
             "foreach my $strFile ($oBackupManifest->keys(MANIFEST_SECTION_TARGET_FILE))\n"
             "{\n"
@@ -1295,6 +1320,104 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'lSizeTotal', value => $lSizeTotal}\n"
             ");\n"
             "}\n"
+            "\n\n\n\n\n\n\n\n"
+            "sub copyHostAdd\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my\n"
+            "(\n"
+            "$strOperation,\n"
+            "$oBackupProcess,\n"
+            ") =\n"
+            "logDebugParam\n"
+            "(\n"
+            "__PACKAGE__ . '->copyHostAdd', \\@_,\n"
+            "{name => 'oBackupProcess', trace => true},\n"
+            ");\n"
+            "\n"
+            "my @iyCopyRemoteIdx = defined($self->{iyCopyRemoteIdx}) ? @{$self->{iyCopyRemoteIdx}} : ($self->{iCopyRemoteIdx});\n"
+            "my $iCopyProcessMax = cfgOption(CFGOPT_PROCESS_MAX);\n"
+            "\n\n"
+            "if (@iyCopyRemoteIdx > $iCopyProcessMax)\n"
+            "{\n"
+            "splice(@iyCopyRemoteIdx, $iCopyProcessMax);\n"
+            "}\n"
+            "\n"
+            "for (my $iCopyIdx = 0; $iCopyIdx < @iyCopyRemoteIdx; $iCopyIdx++)\n"
+            "{\n"
+            "$oBackupProcess->hostAdd(\n"
+            "$iyCopyRemoteIdx[$iCopyIdx],\n"
+            "int($iCopyProcessMax / @iyCopyRemoteIdx) + ($iCopyIdx < $iCopyProcessMax % @iyCopyRemoteIdx ? 1 : 0),\n"
+            "$self->{iCopyRemoteIdx});\n"
+            "}\n"
+            "\n\n"
+            "return logDebugReturn\n"
+            "(\n"
+            "$strOperation,\n"
+            "{name => 'iCopyHostTotal', value => scalar(@iyCopyRemoteIdx), trace => true}\n"
+            ");\n"
+            "}\n"
+            "\n\n\n\n\n\n\n\n"
+            "sub standbyCopyGet\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my\n"
+            "(\n"
+            "$strOperation,\n"
+            "$oBackupInfo,\n"
+            "$hyDbStandbyOther,\n"
+            "$strLsnStart,\n"
+            ") =\n"
+            "logDebugParam\n"
+            "(\n"
+            "__PACKAGE__ . '->standbyCopyGet', \\@_,\n"
+            "{name => 'oBackupInfo', trace => true},\n"
+            "{name => 'hyDbStandbyOther', trace => true},\n"
+            "{name => 'strLsnStart', trace => true},\n"
+            ");\n"
+            "\n"
+            "my @iyRemoteIdx;\n"
+            "\n"
+            "foreach my $hDbStandbyOther (@{$hyDbStandbyOther})\n"
+            "{\n"
+            "my $iRemoteIdx = $hDbStandbyOther->{iRemoteIdx};\n"
+            "my $oDbStandbyOther = $hDbStandbyOther->{oDb};\n"
+            "\n"
+            "my ($strStandbyDbVersion, $iStandbyControlVersion, $iStandbyCatalogVersion, $ullStandbyDbSysId) = $oDbStandbyOther->info();\n"
+            "$oBackupInfo->check($strStandbyDbVersion, $iStandbyControlVersion, $iStandbyCatalogVersion, $ullStandbyDbSysId);\n"
+            "\n"
+            "$oDbStandbyOther->configValidate();\n"
+            "\n"
+            "&log(INFO, \"wait for replay on standby pg${iRemoteIdx} to reach ${strLsnStart}\");\n"
+            "\n"
+            "logWarnOnErrorEnable();\n"
+            "eval\n"
+            "{\n"
+            "my ($strReplayedLSN) = $oDbStandbyOther->replayWait($strLsnStart);\n"
+            "push(@iyRemoteIdx, $iRemoteIdx);\n"
+            "\n"
+            "&log(INFO, \"replay on standby pg${iRemoteIdx} reached ${strReplayedLSN}\");\n"
+            "return true;\n"
+            "}\n"
+            "or do\n"
+            "{\n"
+            "&log(WARN, \"standby pg${iRemoteIdx} did not reach ${strLsnStart} and will not be used to copy files\");\n"
+            "};\n"
+            "logWarnOnErrorDisable();\n"
+            "\n"
+            "undef($oDbStandbyOther);\n"
+            "delete($hDbStandbyOther->{oDb});\n"
+            "protocolDestroy(CFGOPTVAL_REMOTE_TYPE_DB, $iRemoteIdx, true);\n"
+            "}\n"
+            "\n\n"
+            "return logDebugReturn\n"
+            "(\n"
+            "$strOperation,\n"
+            "{name => 'iyRemoteIdx', value => \\@iyRemoteIdx, trace => true}\n"
+            ");\n"
+            "}\n"
             "\n\n\n\n\n\n"
             "sub process\n"
             "{\n"
@@ -1317,8 +1440,9 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "my $oDbMaster = undef;\n"
             "my $oDbStandby = undef;\n"
+            "my $hyDbStandbyOther = undef;\n"
             "\n\n"
-            "($oDbMaster, $self->{iMasterRemoteIdx}, $oDbStandby, $self->{iCopyRemoteIdx}) = dbObjectGet();\n"
+            "($oDbMaster, $self->{iMasterRemoteIdx}, $oDbStandby, $self->{iCopyRemoteIdx}, $hyDbStandbyOther) = dbObjectGet();\n"
             "\n\n"
             "if (!defined($self->{iCopyRemoteIdx}))\n"
             "{\n"
@@ -1626,6 +1750,14 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "undef($oDbStandby);\n"
             "protocolDestroy(CFGOPTVAL_REMOTE_TYPE_DB, $self->{iCopyRemoteIdx}, true);\n"
+            "\n\n"
+            "$self->{iyCopyRemoteIdx} =\n"
+            "[$self->{iCopyRemoteIdx}, $self->standbyCopyGet($oBackupInfo, $hyDbStandbyOther, $strLsnStart)];\n"
+            "\n"
+            "if (@{$self->{iyCopyRemoteIdx}} > 1)\n"
+            "{\n"
+            "&log(INFO, 'copy files from standbys ' . join(', ', map {\"pg$_\"} @{$self->{iyCopyRemoteIdx}}));\n"
+            "}\n"
             "}\n"
             "}\n"
             "\n\n\n"
@@ -1796,6 +1928,7 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n\n"
             "$oBackupManifest->save();\n"
+            "$oBackupManifest->saveBin();\n"
             "\n"
             "&log(INFO, \"new backup label = ${strBackupLabel}\");\n"
             "\n\n\n"
@@ -2269,11 +2402,13 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "}\n"
             "\n\n"
+            "$oManifest->journalAdd($strRepoFile);\n"
+            "\n\n"
             "$lManifestSaveCurrent += $lSize;\n"
             "\n"
             "if ($lManifestSaveCurrent >= $lManifestSaveSize)\n"
             "{\n"
-            "$oManifest->saveCopy();\n"
+            "$oManifest->journalSave();\n"
             "\n"
             "logDebugMisc\n"
             "(\n"
@@ -3748,6 +3883,8 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(ERROR_SERVICE);\n"
             "use constant ERROR_EXECUTE => 102;\n"
             "push @EXPORT, qw(ERROR_EXECUTE);\n"
+            "use constant ERROR_REPO_INVALID => 103;\n"
+            "push @EXPORT, qw(ERROR_REPO_INVALID);\n"
             "use constant ERROR_RUNTIME => 122;\n"
             "push @EXPORT, qw(ERROR_RUNTIME);\n"
             "use constant ERROR_INVALID => 123;\n"
@@ -3939,6 +4076,8 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "confess &log(ERROR, \"unable to open $self->{strFileName} or $self->{strFileName}\" . INI_COPY_EXT, ERROR_FILE_MISSING);\n"
             "}\n"
+            "\n\n"
+            "$self->{bLoadCopy} = true;\n"
             "}\n"
             "\n"
             "$self->{bExists} = true;\n"
@@ -7509,7 +7648,7 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'strCheckpointLSN', value => $strCheckpointLSN},\n"
             ");\n"
             "}\n"
-            "\n\n\n\n\n\n\n\n"
+            "\n\n\n\n\n\n\n\n\n"
             "sub dbObjectGet\n"
             "{\n"
             "\n"
@@ -7527,6 +7666,7 @@ static const EmbeddedModule embeddedModule[] =
             "my $iMasterRemoteIdx = 1;\n"
             "my $oDbMaster = undef;\n"
             "my $oDbStandby = undef;\n"
+            "my $hyDbStandbyOther = [];\n"
             "\n\n\n"
             "if (!$bMasterOnly && cfgOptionTest(CFGOPT_ONLINE) && cfgOption(CFGOPT_ONLINE) && multipleDb())\n"
             "{\n"
@@ -7565,6 +7705,12 @@ static const EmbeddedModule embeddedModule[] =
             "$iStandbyIdx = $iRemoteIdx;\n"
             "$bAssigned = true;\n"
             "}\n"
+            "\n"
+            "elsif (cfgOption(CFGOPT_BACKUP_STANDBY))\n"
+            "{\n"
+            "push(@{$hyDbStandbyOther}, {oDb => $oDb, iRemoteIdx => $iRemoteIdx});\n"
+            "$bAssigned = true;\n"
+            "}\n"
             "}\n"
             "\n"
             "else\n"
@@ -7614,6 +7760,7 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'iDbMasterIdx', value => $iMasterRemoteIdx},\n"
             "{name => 'oDbStandby', value => $oDbStandby},\n"
             "{name => 'iDbStandbyIdx', value => $iStandbyIdx},\n"
+            "{name => 'hyDbStandbyOther', value => $hyDbStandbyOther},\n"
             ");\n"
             "}\n"
             "\n"
@@ -7819,15 +7966,28 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "return\n"
             "{\n"
+            "CFGOPTVAL_BACKUP_CIPHER_SIDE_DB                                  => 'db',\n"
+            "CFGOPTVAL_BACKUP_CIPHER_SIDE_REPO                                => 'repo',\n"
+            "\n"
+            "CFGOPTVAL_BACKUP_COMPRESS_SIDE_DB                                => 'db',\n"
+            "CFGOPTVAL_BACKUP_COMPRESS_SIDE_REPO                              => 'repo',\n"
+            "\n"
             "CFGOPTVAL_INFO_OUTPUT_TEXT                                       => 'text',\n"
             "CFGOPTVAL_INFO_OUTPUT_JSON                                       => 'json',\n"
             "\n"
             "CFGOPTVAL_LS_OUTPUT_TEXT                                         => 'text',\n"
             "CFGOPTVAL_LS_OUTPUT_JSON                                         => 'json',\n"
+            "CFGOPTVAL_LS_OUTPUT_JSON_LINES                                   => 'json-lines',\n"
+            "\n"
+            "CFGOPTVAL_PG_HOST_TYPE_SSH                                       => 'ssh',\n"
+            "CFGOPTVAL_PG_HOST_TYPE_TLS                                       => 'tls',\n"
             "\n"
             "CFGOPTVAL_REPO_CIPHER_TYPE_NONE                                  => 'none',\n"
             "CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC                           => 'aes-256-cbc',\n"
             "\n"
+            "CFGOPTVAL_REPO_HOST_TYPE_SSH                                     => 'ssh',\n"
+            "CFGOPTVAL_REPO_HOST_TYPE_TLS                                     => 'tls',\n"
+            "\n"
             "CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL                       => 'full',\n"
             "CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF                       => 'diff',\n"
             "CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR                       => 'incr',\n"
@@ -7882,6 +8042,11 @@ static const EmbeddedModule embeddedModule[] =
             "{\n"
             "return\n"
             "{\n"
+            "backup =>\n"
+            "[\n"
+            "'backupDelta',\n"
+            "],\n"
+            "\n"
             "checksum =>\n"
             "[\n"
             "'pageChecksum',\n"
@@ -7889,12 +8054,21 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "config =>\n"
             "[\n"
+            "'CFGOPTVAL_BACKUP_CIPHER_SIDE_DB',\n"
+            "'CFGOPTVAL_BACKUP_CIPHER_SIDE_REPO',\n"
+            "'CFGOPTVAL_BACKUP_COMPRESS_SIDE_DB',\n"
+            "'CFGOPTVAL_BACKUP_COMPRESS_SIDE_REPO',\n"
             "'CFGOPTVAL_INFO_OUTPUT_TEXT',\n"
             "'CFGOPTVAL_INFO_OUTPUT_JSON',\n"
             "'CFGOPTVAL_LS_OUTPUT_TEXT',\n"
             "'CFGOPTVAL_LS_OUTPUT_JSON',\n"
+            "'CFGOPTVAL_LS_OUTPUT_JSON_LINES',\n"
+            "'CFGOPTVAL_PG_HOST_TYPE_SSH',\n"
+            "'CFGOPTVAL_PG_HOST_TYPE_TLS',\n"
             "'CFGOPTVAL_REPO_CIPHER_TYPE_NONE',\n"
             "'CFGOPTVAL_REPO_CIPHER_TYPE_AES_256_CBC',\n"
+            "'CFGOPTVAL_REPO_HOST_TYPE_SSH',\n"
+            "'CFGOPTVAL_REPO_HOST_TYPE_TLS',\n"
             "'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL',\n"
             "'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF',\n"
             "'CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR',\n"
@@ -7934,18 +8108,23 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGCMD_LS',\n"
             "'CFGCMD_REMOTE',\n"
             "'CFGCMD_RESTORE',\n"
+            "'CFGCMD_SERVER',\n"
             "'CFGCMD_STANZA_CREATE',\n"
             "'CFGCMD_STANZA_DELETE',\n"
             "'CFGCMD_STANZA_UPGRADE',\n"
             "'CFGCMD_START',\n"
             "'CFGCMD_STOP',\n"
+            "'CFGCMD_VERIFY',\n"
             "'CFGCMD_VERSION',\n"
             "'CFGOPT_ARCHIVE_ASYNC',\n"
             "'CFGOPT_ARCHIVE_CHECK',\n"
             "'CFGOPT_ARCHIVE_COPY',\n"
             "'CFGOPT_ARCHIVE_GET_QUEUE_MAX',\n"
+            "'CFGOPT_ARCHIVE_PUSH_COMPRESS_BACKLOG',\n"
             "'CFGOPT_ARCHIVE_PUSH_QUEUE_MAX',\n"
             "'CFGOPT_ARCHIVE_TIMEOUT',\n"
+            "'CFGOPT_BACKUP_CIPHER_SIDE',\n"
+            "'CFGOPT_BACKUP_COMPRESS_SIDE',\n"
             "'CFGOPT_BACKUP_STANDBY',\n"
             "'CFGOPT_BUFFER_SIZE',\n"
             "'CFGOPT_C',\n"
@@ -7975,6 +8154,7 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_LOG_SUBPROCESS',\n"
             "'CFGOPT_LOG_TIMESTAMP',\n"
             "'CFGOPT_MANIFEST_SAVE_THRESHOLD',\n"
+            "'CFGOPT_METRIC_PATH',\n"
             "'CFGOPT_NEUTRAL_UMASK',\n"
             "'CFGOPT_ONLINE',\n"
             "'CFGOPT_OUTPUT',\n"
@@ -7987,6 +8167,30 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_PG_HOST6',\n"
             "'CFGOPT_PG_HOST7',\n"
             "'CFGOPT_PG_HOST8',\n"
+            "'CFGOPT_PG_HOST_CA_FILE',\n"
+            "'CFGOPT_PG_HOST_CA_FILE2',\n"
+            "'CFGOPT_PG_HOST_CA_FILE3',\n"
+            "'CFGOPT_PG_HOST_CA_FILE4',\n"
+            "'CFGOPT_PG_HOST_CA_FILE5',\n"
+            "'CFGOPT_PG_HOST_CA_FILE6',\n"
+            "'CFGOPT_PG_HOST_CA_FILE7',\n"
+            "'CFGOPT_PG_HOST_CA_FILE8',\n"
+            "'CFGOPT_PG_HOST_CA_PATH',\n"
+            "'CFGOPT_PG_HOST_CA_PATH2',\n"
+            "'CFGOPT_PG_HOST_CA_PATH3',\n"
+            "'CFGOPT_PG_HOST_CA_PATH4',\n"
+            "'CFGOPT_PG_HOST_CA_PATH5',\n"
+            "'CFGOPT_PG_HOST_CA_PATH6',\n"
+            "'CFGOPT_PG_HOST_CA_PATH7',\n"
+            "'CFGOPT_PG_HOST_CA_PATH8',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE2',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE3',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE4',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE5',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE6',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE7',\n"
+            "'CFGOPT_PG_HOST_CERT_FILE8',\n"
             "'CFGOPT_PG_HOST_CMD',\n"
             "'CFGOPT_PG_HOST_CMD2',\n"
             "'CFGOPT_PG_HOST_CMD3',\n"
@@ -8019,6 +8223,14 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_PG_HOST_CONFIG_PATH6',\n"
             "'CFGOPT_PG_HOST_CONFIG_PATH7',\n"
             "'CFGOPT_PG_HOST_CONFIG_PATH8',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE2',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE3',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE4',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE5',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE6',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE7',\n"
+            "'CFGOPT_PG_HOST_KEY_FILE8',\n"
             "'CFGOPT_PG_HOST_PORT',\n"
             "'CFGOPT_PG_HOST_PORT2',\n"
             "'CFGOPT_PG_HOST_PORT3',\n"
@@ -8027,6 +8239,14 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_PG_HOST_PORT6',\n"
             "'CFGOPT_PG_HOST_PORT7',\n"
             "'CFGOPT_PG_HOST_PORT8',\n"
+            "'CFGOPT_PG_HOST_TYPE',\n"
+            "'CFGOPT_PG_HOST_TYPE2',\n"
+            "'CFGOPT_PG_HOST_TYPE3',\n"
+            "'CFGOPT_PG_HOST_TYPE4',\n"
+            "'CFGOPT_PG_HOST_TYPE5',\n"
+            "'CFGOPT_PG_HOST_TYPE6',\n"
+            "'CFGOPT_PG_HOST_TYPE7',\n"
+            "'CFGOPT_PG_HOST_TYPE8',\n"
             "'CFGOPT_PG_HOST_USER',\n"
             "'CFGOPT_PG_HOST_USER2',\n"
             "'CFGOPT_PG_HOST_USER3',\n"
@@ -8061,18 +8281,26 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_PG_SOCKET_PATH8',\n"
             "'CFGOPT_PROCESS',\n"
             "'CFGOPT_PROCESS_MAX',\n"
+            "'CFGOPT_PROFILE',\n"
             "'CFGOPT_PROTOCOL_TIMEOUT',\n"
             "'CFGOPT_RECOVERY_OPTION',\n"
             "'CFGOPT_RECURSE',\n"
+            "'CFGOPT_REPO_CACHE_PATH',\n"
+            "'CFGOPT_REPO_CACHE_SIZE',\n"
             "'CFGOPT_REPO_CIPHER_PASS',\n"
             "'CFGOPT_REPO_CIPHER_TYPE',\n"
             "'CFGOPT_REPO_HARDLINK',\n"
             "'CFGOPT_REPO_HOST',\n"
+            "'CFGOPT_REPO_HOST_CA_FILE',\n"
+            "'CFGOPT_REPO_HOST_CA_PATH',\n"
+            "'CFGOPT_REPO_HOST_CERT_FILE',\n"
             "'CFGOPT_REPO_HOST_CMD',\n"
             "'CFGOPT_REPO_HOST_CONFIG',\n"
             "'CFGOPT_REPO_HOST_CONFIG_INCLUDE_PATH',\n"
             "'CFGOPT_REPO_HOST_CONFIG_PATH',\n"
+            "'CFGOPT_REPO_HOST_KEY_FILE',\n"
             "'CFGOPT_REPO_HOST_PORT',\n"
+            "'CFGOPT_REPO_HOST_TYPE',\n"
             "'CFGOPT_REPO_HOST_USER',\n"
             "'CFGOPT_REPO_PATH',\n"
             "'CFGOPT_REPO_RETENTION_ARCHIVE',\n"
@@ -8086,6 +8314,7 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_REPO_S3_HOST',\n"
             "'CFGOPT_REPO_S3_KEY',\n"
             "'CFGOPT_REPO_S3_KEY_SECRET',\n"
+            "'CFGOPT_REPO_S3_LIST_PARALLEL',\n"
             "'CFGOPT_REPO_S3_PORT',\n"
             "'CFGOPT_REPO_S3_REGION',\n"
             "'CFGOPT_REPO_S3_TOKEN',\n"
@@ -8094,6 +8323,7 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_RESUME',\n"
             "'CFGOPT_SET',\n"
             "'CFGOPT_SORT',\n"
+            "'CFGOPT_SORT_MAX',\n"
             "'CFGOPT_SPOOL_PATH',\n"
             "'CFGOPT_STANZA',\n"
             "'CFGOPT_START_FAST',\n"
@@ -8107,6 +8337,12 @@ static const EmbeddedModule embeddedModule[] =
             "'CFGOPT_TEST',\n"
             "'CFGOPT_TEST_DELAY',\n"
             "'CFGOPT_TEST_POINT',\n"
+            "'CFGOPT_TLS_SERVER_ADDRESS',\n"
+            "'CFGOPT_TLS_SERVER_AUTH',\n"
+            "'CFGOPT_TLS_SERVER_CA_FILE',\n"
+            "'CFGOPT_TLS_SERVER_CERT_FILE',\n"
+            "'CFGOPT_TLS_SERVER_KEY_FILE',\n"
+            "'CFGOPT_TLS_SERVER_PORT',\n"
             "'CFGOPT_TYPE',\n"
             "'cfgCommandName',\n"
             "'cfgOptionIndex',\n"
@@ -8159,6 +8395,11 @@ static const EmbeddedModule embeddedModule[] =
             "'lockRelease',\n"
             "],\n"
             "\n"
+            "manifest =>\n"
+            "[\n"
+            "'manifestBinFromText',\n"
+            "],\n"
+            "\n"
             "random =>\n"
             "[\n"
             "'cryptoRandomBytes',\n"
@@ -8418,6 +8659,7 @@ static const EmbeddedModule embeddedModule[] =
             "use Exporter qw(import);\n"
             "our @EXPORT = qw();\n"
             "use File::Basename qw(dirname basename);\n"
+            "use JSON::PP;\n"
             "use Time::Local qw(timelocal);\n"
             "\n"
             "use pgBackRest::DbVersion;\n"
@@ -8426,6 +8668,7 @@ static const EmbeddedModule embeddedModule[] =
             "use pgBackRest::Common::Log;\n"
             "use pgBackRest::Common::Wait;\n"
             "use pgBackRest::Config::Config;\n"
+            "use pgBackRest::LibC qw(:backup :manifest);\n"
             "use pgBackRest::Protocol::Helper;\n"
             "use pgBackRest::Protocol::Storage::Helper;\n"
             "use pgBackRest::Storage::Helper;\n"
@@ -8436,6 +8679,8 @@ static const EmbeddedModule embeddedModule[] =
             "push @EXPORT, qw(FILE_MANIFEST);\n"
             "use constant FILE_MANIFEST_COPY => FILE_MANIFEST . INI_COPY_EXT;\n"
             "push @EXPORT, qw(FILE_MANIFEST_COPY);\n"
+            "use constant FILE_MANIFEST_BIN => FILE_MANIFEST . '.bin';\n"
+            "push @EXPORT, qw(FILE_MANIFEST_BIN);\n"
             "\n\n\n\n"
             "use constant MANIFEST_DEFAULT_MATCH_FACTOR => 0.1;\n"
             "push @EXPORT, qw(MANIFEST_DEFAULT_MATCH_FACTOR);\n"
@@ -8721,8 +8966,151 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "$self->SUPER::save();\n"
             "\n\n"
+            "$self->journalRemove();\n"
+            "\n\n"
+            "return logDebugReturn($strOperation);\n"
+            "}\n"
+            "\n\n\n\n\n\n\n"
+            "sub saveBin\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my ($strOperation) = logDebugParam(__PACKAGE__ . '->saveBin');\n"
+            "\n"
+            "$self->{oStorage}->put(\n"
+            "dirname($self->{strFileName}) . '/' . FILE_MANIFEST_BIN, manifestBinFromText(iniRender($self->{oContent})),\n"
+            "{strCipherPass => $self->{strCipherPass}});\n"
+            "\n\n"
+            "return logDebugReturn($strOperation);\n"
+            "}\n"
+            "\n\n\n\n\n\n"
+            "sub load\n"
+            "{\n"
+            "my $self = shift;\n"
+            "my $bIgnoreMissing = shift;\n"
+            "\n\n"
+            "$self->SUPER::load($bIgnoreMissing);\n"
+            "\n"
+            "if ($self->{bLoadCopy})\n"
+            "{\n"
+            "$self->journalReplay();\n"
+            "}\n"
+            "}\n"
+            "\n\n\n\n\n\n"
+            "sub saveCopy\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my ($strOperation) = logDebugParam(__PACKAGE__ . '->saveCopy');\n"
+            "\n\n"
+            "$self->SUPER::saveCopy();\n"
+            "\n\n"
+            "$self->journalRemove();\n"
+            "\n\n"
+            "return logDebugReturn($strOperation);\n"
+            "}\n"
+            "\n\n\n\n\n\n\n"
+            "sub journalAdd\n"
+            "{\n"
+            "my $self = shift;\n"
+            "my $strRepoFile = shift;\n"
+            "\n"
+            "$self->{hJournal}{$strRepoFile} = true;\n"
+            "}\n"
+            "\n\n\n\n\n\n\n\n"
+            "sub journalSave\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my ($strOperation) = logDebugParam(__PACKAGE__ . '->journalSave');\n"
+            "\n"
+            "if (defined($self->{hJournal}))\n"
+            "{\n"
+            "\n"
+            "my $hContent;\n"
+            "\n"
+            "foreach my $strRepoFile (keys(%{$self->{hJournal}}))\n"
+            "{\n"
+            "$hContent->{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile} =\n"
+            "$self->{oContent}{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile};\n"
+            "}\n"
+            "\n"
+            "$self->{iJournalTotal} = (defined($self->{iJournalTotal}) ? $self->{iJournalTotal} : 0) + 1;\n"
+            "\n"
+            "$self->{oStorage}->put(\n"
+            "$self->journalFile($self->{iJournalTotal}), iniRender($hContent), {strCipherPass => $self->{strCipherPass}});\n"
+            "\n"
+            "delete($self->{hJournal});\n"
+            "}\n"
+            "\n\n"
             "return logDebugReturn($strOperation);\n"
             "}\n"
+            "\n\n\n\n\n\n\n"
+            "sub journalReplay\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my ($strOperation) = logDebugParam(__PACKAGE__ . '->journalReplay');\n"
+            "\n"
+            "my $iSegmentIdx = 1;\n"
+            "\n"
+            "while (true)\n"
+            "{\n"
+            "my $rstrContent = $self->{oStorage}->get(\n"
+            "$self->{oStorage}->openRead(\n"
+            "$self->journalFile($iSegmentIdx), {bIgnoreMissing => true, strCipherPass => $self->{strCipherPass}}));\n"
+            "\n"
+            "last if !defined($rstrContent);\n"
+            "\n"
+            "my $hContent = iniParse($$rstrContent, {bIgnoreInvalid => true});\n"
+            "\n"
+            "last if !defined($hContent);\n"
+            "\n"
+            "foreach my $strRepoFile (keys(%{$hContent->{&MANIFEST_SECTION_TARGET_FILE}}))\n"
+            "{\n"
+            "my $hFile = $hContent->{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile};\n"
+            "\n"
+            "if (defined($hFile))\n"
+            "{\n"
+            "$self->{oContent}{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile} = $hFile;\n"
+            "}\n"
+            "else\n"
+            "{\n"
+            "delete($self->{oContent}{&MANIFEST_SECTION_TARGET_FILE}{$strRepoFile});\n"
+            "}\n"
+            "}\n"
+            "\n"
+            "$self->{bModified} = true;\n"
+            "$iSegmentIdx++;\n"
+            "}\n"
+            "\n\n"
+            "return logDebugReturn\n"
+            "(\n"
+            "$strOperation,\n"
+            "{name => 'iSegmentTotal', value => $iSegmentIdx - 1, trace => true}\n"
+            ");\n"
+            "}\n"
+            "\n\n\n\n\n\n"
+            "sub journalRemove\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n"
+            "delete($self->{hJournal});\n"
+            "\n"
+            "if (defined($self->{iJournalTotal}))\n"
+            "{\n"
+            "$self->{oStorage}->remove([map {$self->journalFile($_)} (1 .. $self->{iJournalTotal})]);\n"
+            "delete($self->{iJournalTotal});\n"
+            "}\n"
+            "}\n"
+            "\n\n\n\n\n\n"
+            "sub journalFile\n"
+            "{\n"
+            "my $self = shift;\n"
+            "my $iSegmentIdx = shift;\n"
+            "\n"
+            "return $self->{strFileName} . INI_COPY_EXT . '.journal.' . sprintf('%06d', $iSegmentIdx);\n"
+            "}\n"
             "\n\n\n\n\n\n"
             "sub get\n"
             "{\n"
@@ -9355,87 +9743,30 @@ static const EmbeddedModule embeddedModule[] =
             "$self->numericSet(MANIFEST_SECTION_DB, $strDbName, MANIFEST_KEY_DB_LAST_SYSTEM_ID,\n"
             "$hDatabaseMap->{$strDbName}{&MANIFEST_KEY_DB_LAST_SYSTEM_ID});\n"
             "}\n"
-            "\n\n"
-            "if (!$bDelta)\n"
-            "{\n"
-            "my @stryFileList = $self->keys(MANIFEST_SECTION_TARGET_FILE);\n"
-            "\n"
-            "if (@stryFileList)\n"
-            "{\n"
-            "$bDelta = $self->checkDeltaFile(\\@stryFileList, $oLastManifest, $lTimeBegin);\n"
-            "}\n"
-            "}\n"
-            "\n\n"
-            "foreach my $strName ($self->keys(MANIFEST_SECTION_TARGET_FILE))\n"
-            "{\n"
-            "\n\n"
-            "if ($self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP) > $lTimeBegin ||\n"
-            "(defined($oLastManifest) &&\n"
-            "$oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_FUTURE, 'y')))\n"
-            "{\n"
-            "$bTimeInFuture = true;\n"
-            "\n\n"
-            "if ($self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP) > $lTimeBegin)\n"
-            "{\n"
-            "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_FUTURE, 'y');\n"
-            "}\n"
-            "}\n"
-            "\n\n\n\n\n"
-            "elsif (defined($oLastManifest) && $oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName) &&\n"
-            "$self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE) ==\n"
-            "$oLastManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE) &&\n"
-            "($bDelta || ($self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE) == 0 ||\n"
-            "$self->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP) ==\n"
-            "$oLastManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_TIMESTAMP))))\n"
-            "{\n"
-            "\n"
-            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE))\n"
+            "\n\n\n"
+            "if ($self->test(MANIFEST_SECTION_TARGET_FILE))\n"
             "{\n"
-            "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE,\n"
-            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE));\n"
-            "}\n"
+            "my $hDelta = JSON::PP->new()->decode(\n"
+            "backupDelta(\n"
+            "$self->{oContent}{&MANIFEST_SECTION_TARGET_FILE},\n"
+            "defined($oLastManifest) ? $oLastManifest->{oContent}{&MANIFEST_SECTION_TARGET_FILE} : undef,\n"
+            "defined($oLastManifest) ? $oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LABEL) : undef,\n"
+            "$lTimeBegin, $bDelta));\n"
             "\n"
-            "else\n"
-            "{\n"
-            "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REFERENCE,\n"
-            "$oLastManifest->get(MANIFEST_SECTION_BACKUP, MANIFEST_KEY_LABEL));\n"
-            "}\n"
-            "\n\n"
-            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM))\n"
-            "{\n"
-            "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM,\n"
-            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM));\n"
-            "}\n"
-            "\n\n"
-            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE))\n"
+            "if ($hDelta->{deltaReason} eq 'future')\n"
             "{\n"
-            "$self->set(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE,\n"
-            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_REPO_SIZE));\n"
+            "&log(WARN, \"file $hDelta->{deltaFile} has timestamp in the future, enabling delta checksum\");\n"
             "}\n"
-            "\n\n"
-            "if ($oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER))\n"
+            "elsif ($hDelta->{deltaReason} eq 'change')\n"
             "{\n"
-            "$self->set(\n"
-            "MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER,\n"
-            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_MASTER));\n"
+            "&log(\n"
+            "WARN,\n"
+            "\"file $hDelta->{deltaFile} timestamp in the past or size changed but timestamp did not, enabling delta\" .\n"
+            "\" checksum\");\n"
             "}\n"
-            "\n\n"
-            "my $bChecksumPage = $oLastManifest->get(\n"
-            "MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE, false);\n"
             "\n"
-            "if (defined($bChecksumPage))\n"
-            "{\n"
-            "$self->boolSet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE, $bChecksumPage);\n"
-            "\n"
-            "if (!$bChecksumPage &&\n"
-            "$oLastManifest->test(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR))\n"
-            "{\n"
-            "$self->set(\n"
-            "MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR,\n"
-            "$oLastManifest->get(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_CHECKSUM_PAGE_ERROR));\n"
-            "}\n"
-            "}\n"
-            "}\n"
+            "$bDelta = $hDelta->{delta} ? true : false;\n"
+            "$bTimeInFuture = $hDelta->{timeInFuture} ? true : false;\n"
             "}\n"
             "\n\n"
             "if ($bTimeInFuture)\n"
@@ -10331,6 +10662,7 @@ static const EmbeddedModule embeddedModule[] =
             "use Exporter qw(import);\n"
             "our @EXPORT = qw();\n"
             "\n"
+            "use pgBackRest::Common::Exception;\n"
             "use pgBackRest::Common::Log;\n"
             "use pgBackRest::Config::Config;\n"
             "use pgBackRest::Protocol::Remote::Master;\n"
@@ -10373,6 +10705,8 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "use constant OP_RESTORE_FILE => 'restoreFile';\n"
             "push @EXPORT, qw(OP_RESTORE_FILE);\n"
+            "use constant OP_RESTORE_PATH => 'restorePath';\n"
+            "push @EXPORT, qw(OP_RESTORE_PATH);\n"
             "\n\n"
             "use constant OP_WAIT => 'wait';\n"
             "push @EXPORT, qw(OP_WAIT);\n"
@@ -10456,9 +10790,11 @@ static const EmbeddedModule embeddedModule[] =
             "my $strOptionDbPort = undef;\n"
             "my $strOptionDbSocketPath = undef;\n"
             "my $strOptionSshPort = CFGOPT_REPO_HOST_PORT;\n"
+            "my $iOptionIdType = CFGOPT_REPO_HOST_TYPE;\n"
             "\n"
             "if ($strRemoteType eq CFGOPTVAL_REMOTE_TYPE_DB)\n"
             "{\n"
+            "$iOptionIdType = cfgOptionIdFromIndex(CFGOPT_PG_HOST_TYPE, $iRemoteIdx);\n"
             "$iOptionIdCmd = cfgOptionIdFromIndex(CFGOPT_PG_HOST_CMD, $iRemoteIdx);\n"
             "$iOptionIdConfig = cfgOptionIdFromIndex(CFGOPT_PG_HOST_CONFIG, $iRemoteIdx);\n"
             "$iOptionIdConfigIncludePath = cfgOptionIdFromIndex(CFGOPT_PG_HOST_CONFIG_INCLUDE_PATH, $iRemoteIdx);\n"
@@ -10468,6 +10804,15 @@ static const EmbeddedModule embeddedModule[] =
             "$strOptionSshPort = cfgOptionIdFromIndex(CFGOPT_PG_HOST_PORT, $iRemoteIdx);\n"
             "}\n"
             "\n\n"
+            "if (cfgOptionValid($iOptionIdType) && cfgOption($iOptionIdType) eq CFGOPTVAL_REPO_HOST_TYPE_TLS)\n"
+            "{\n"
+            "confess &log(\n"
+            "ERROR,\n"
+            "\"option '\" . cfgOptionName($iOptionIdType) . '=' . CFGOPTVAL_REPO_HOST_TYPE_TLS . \"' is not supported by the \" .\n"
+            "cfgCommandName(cfgCommandGet()) . ' command',\n"
+            "ERROR_OPTION_INVALID_VALUE);\n"
+            "}\n"
+            "\n\n"
             "if (cfgOptionValid(cfgOptionIdFromIndex(CFGOPT_PG_PATH, $iRemoteIdx)))\n"
             "{\n"
             "$strOptionDbPath =\n"
@@ -10827,6 +11172,7 @@ static const EmbeddedModule embeddedModule[] =
             "$self->{iSelectTimeout},\n"
             "$self->{strBackRestBin},\n"
             "$self->{bConfessError},\n"
+            "$self->{bQueueDynamic},\n"
             ") =\n"
             "logDebugParam\n"
             "(\n"
@@ -10835,6 +11181,8 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'iSelectTimeout', default => int(cfgOption(CFGOPT_PROTOCOL_TIMEOUT) / 2)},\n"
             "{name => 'strBackRestBin', default => projectBin()},\n"
             "{name => 'bConfessError', default => true},\n"
+            "\n"
+            "{name => 'bQueueDynamic', default => false},\n"
             ");\n"
             "\n\n"
             "$self->{hHostMap} = {};\n"
@@ -10868,7 +11216,7 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "return logDebugReturn($strOperation);\n"
             "}\n"
-            "\n\n\n\n\n\n"
+            "\n\n\n\n\n\n\n\n"
             "sub hostAdd\n"
             "{\n"
             "my $self = shift;\n"
@@ -10878,12 +11226,14 @@ static const EmbeddedModule embeddedModule[] =
             "$strOperation,\n"
             "$iHostConfigIdx,\n"
             "$iProcessMax,\n"
+            "$iQueueHostConfigIdx,\n"
             ") =\n"
             "logDebugParam\n"
             "(\n"
             "__PACKAGE__ . '->hostAdd', \\@_,\n"
             "{name => 'iHostConfigIdx'},\n"
             "{name => 'iProcessMax'},\n"
+            "{name => 'iQueueHostConfigIdx', required => false},\n"
             ");\n"
             "\n"
             "my $iHostIdx = $self->{hHostMap}{$iHostConfigIdx};\n"
@@ -10899,12 +11249,30 @@ static const EmbeddedModule embeddedModule[] =
             "iHostConfigIdx => $iHostConfigIdx,\n"
             "iProcessMax => $iProcessMax,\n"
             "};\n"
+            "\n\n"
+            "if (defined($iQueueHostConfigIdx) && $iQueueHostConfigIdx != $iHostConfigIdx)\n"
+            "{\n"
+            "$hHost->{iQueueHostIdx} = $self->{hHostMap}{$iQueueHostConfigIdx};\n"
+            "\n"
+            "if (!defined($hHost->{iQueueHostIdx}))\n"
+            "{\n"
+            "confess &log(ASSERT, \"iQueueHostConfigIdx = ${iQueueHostConfigIdx} must be added before it can be shared\");\n"
+            "}\n"
+            "}\n"
             "\n"
             "push(@{$self->{hyHost}}, $hHost);\n"
             "\n\n"
             "return logDebugReturn($strOperation);\n"
             "}\n"
             "\n\n\n\n\n\n"
+            "sub hostQueue\n"
+            "{\n"
+            "my $self = shift;\n"
+            "my $hHost = shift;\n"
+            "\n"
+            "return defined($hHost->{iQueueHostIdx}) ? $self->{hyHost}[$hHost->{iQueueHostIdx}] : $hHost;\n"
+            "}\n"
+            "\n\n\n\n\n\n"
             "sub hostConnect\n"
             "{\n"
             "my $self = shift;\n"
@@ -10918,7 +11286,7 @@ static const EmbeddedModule embeddedModule[] =
             "foreach my $hHost (@{$self->{hyHost}})\n"
             "{\n"
             "\n"
-            "if (!defined($hHost->{hyQueue}))\n"
+            "if (!defined($self->hostQueue($hHost)->{hyQueue}))\n"
             "{\n"
             "logDebugMisc(\n"
             "$strOperation, \"no jobs for host\",\n"
@@ -10993,29 +11361,17 @@ static const EmbeddedModule embeddedModule[] =
             "foreach my $hLocal (@{$self->{hyLocal}})\n"
             "{\n"
             "my $hHost = $self->{hyHost}[$hLocal->{iHostIdx}];\n"
-            "my $hyQueue = $hHost->{hyQueue};\n"
+            "my $hyQueue = $self->hostQueue($hHost)->{hyQueue};\n"
             "\n\n"
             "$hLocal->{iDirection} = $hLocal->{iHostProcessIdx} % 2 == 0 ? 1 : -1;\n"
             "$hLocal->{iQueueIdx} = int((@{$hyQueue} / $hHost->{iProcessMax}) * $hLocal->{iHostProcessIdx});\n"
-            "\n\n"
-            "$hLocal->{iQueueLastIdx} = $hLocal->{iQueueIdx} + ($hLocal->{iDirection} * -1);\n"
-            "\n"
-            "if ($hLocal->{iQueueLastIdx} < 0)\n"
-            "{\n"
-            "$hLocal->{iQueueLastIdx} = @{$hyQueue} - 1;\n"
-            "}\n"
-            "elsif ($hLocal->{iQueueLastIdx} >= @{$hyQueue})\n"
-            "{\n"
-            "$hLocal->{iQueueLastIdx} = 0;\n"
-            "}\n"
             "\n"
             "logDebugMisc(\n"
             "$strOperation, 'init local process',\n"
             "{name => 'iHostIdx', value => $hLocal->{iHostIdx}},\n"
             "{name => 'iProcessId', value => $hLocal->{iProcessId}},\n"
             "{name => 'iDirection', value => $hLocal->{iDirection}},\n"
-            "{name => 'iQueueIdx', value => $hLocal->{iQueueIdx}},\n"
-            "{name => 'iQueueLastIdx', value => $hLocal->{iQueueLastIdx}});\n"
+            "{name => 'iQueueIdx', value => $hLocal->{iQueueIdx}});\n"
             "}\n"
             "\n"
             "$self->{bProcessing} = true;\n"
@@ -11044,6 +11400,11 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "}\n"
             "\n\n"
+            "if ($self->{bQueueDynamic} && $self->{iQueued} > 0)\n"
+            "{\n"
+            "$self->jobAssign();\n"
+            "}\n"
+            "\n\n"
             "my @hyResult = ();\n"
             "my $iCompleted = 0;\n"
             "\n"
@@ -11123,6 +11484,34 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'iRunning', value => $self->{iRunning}, trace => true},\n"
             "{name => 'iCompleted', value => $iCompleted, trace => true});\n"
             "\n"
+            "my $bFound = $self->jobAssign(@hyResult > 0);\n"
+            "\n\n"
+            "if (!$bFound && !$self->{iRunning} && @hyResult == 0)\n"
+            "{\n"
+            "logDebugMisc($strOperation, 'all jobs complete');\n"
+            "$self->reset();\n"
+            "return;\n"
+            "}\n"
+            "}\n"
+            "\n\n"
+            "return \\@hyResult;\n"
+            "}\n"
+            "\n\n\n\n\n\n"
+            "sub jobAssign\n"
+            "{\n"
+            "my $self = shift;\n"
+            "\n\n"
+            "my\n"
+            "(\n"
+            "$strOperation,\n"
+            "$bResultPending,\n"
+            ") =\n"
+            "logDebugParam\n"
+            "(\n"
+            "__PACKAGE__ . '->jobAssign', \\@_,\n"
+            "{name => 'bResultPending', default => false, trace => true},\n"
+            ");\n"
+            "\n"
             "my $bFound = false;\n"
             "my $iLocalIdx = -1;\n"
             "\n\n"
@@ -11133,15 +11522,16 @@ static const EmbeddedModule embeddedModule[] =
             "next if (!defined($hLocal));\n"
             "\n"
             "my $hHost = $self->{hyHost}[$hLocal->{iHostIdx}];\n"
-            "my $hyQueue = $hHost->{hyQueue};\n"
+            "my $hyQueue = $self->hostQueue($hHost)->{hyQueue};\n"
             "\n\n"
             "if (!defined($hLocal->{hJob}))\n"
             "{\n"
-            "\n"
+            "\n\n"
             "my $iQueueIdx = $hLocal->{iQueueIdx};\n"
             "my $hJob = shift(@{$$hyQueue[$iQueueIdx]});\n"
+            "my $iQueueSearched = 1;\n"
             "\n"
-            "while (!defined($hJob) && $iQueueIdx != $hLocal->{iQueueLastIdx})\n"
+            "while (!defined($hJob) && $iQueueSearched < @{$hyQueue})\n"
             "{\n"
             "$iQueueIdx += $hLocal->{iDirection};\n"
             "\n"
@@ -11155,6 +11545,12 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n"
             "$hJob = shift(@{$$hyQueue[$iQueueIdx]});\n"
+            "$iQueueSearched++;\n"
+            "}\n"
+            "\n\n\n"
+            "if (!defined($hJob) && $self->{bQueueDynamic} && ($self->{iRunning} > 0 || $bResultPending))\n"
+            "{\n"
+            "next;\n"
             "}\n"
             "\n\n"
             "if (!defined($hJob))\n"
@@ -11184,7 +11580,8 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "next;\n"
             "}\n"
-            "\n\n"
+            "\n\n\n"
+            "$hJob->{iHostConfigIdx} = $hHost->{iHostConfigIdx};\n"
             "$hLocal->{hJob} = $hJob;\n"
             "$bFound = true;\n"
             "$self->{iRunning}++;\n"
@@ -11201,15 +11598,11 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "}\n"
             "\n\n"
-            "if (!$bFound && !$self->{iRunning} && @hyResult == 0)\n"
-            "{\n"
-            "logDebugMisc($strOperation, 'all jobs complete');\n"
-            "$self->reset();\n"
-            "return;\n"
-            "}\n"
-            "}\n"
-            "\n\n"
-            "return \\@hyResult;\n"
+            "return logDebugReturn\n"
+            "(\n"
+            "$strOperation,\n"
+            "{name => 'bFound', value => $bFound, trace => true}\n"
+            ");\n"
             "}\n"
             "\n\n\n\n\n\n"
             "sub queueJob\n"
@@ -11237,7 +11630,7 @@ static const EmbeddedModule embeddedModule[] =
             "{name => 'rParamSecure', optional => true, redact => true},\n"
             ");\n"
             "\n\n"
-            "if ($self->processing())\n"
+            "if ($self->processing() && !$self->{bQueueDynamic})\n"
             "{\n"
             "confess &log(ASSERT, 'new jobs cannot be added until processing is complete');\n"
             "}\n"
@@ -12122,6 +12515,16 @@ static const EmbeddedModule embeddedModule[] =
             "use pgBackRest::Storage::Helper;\n"
             "use pgBackRest::Version;\n"
             "\n\n\n\n"
+            "use constant RESTORE_PATH_KEY_DESTINATION => 'destination';\n"
+            "use constant RESTORE_PATH_KEY_GROUP => 'group';\n"
+            "use constant RESTORE_PATH_KEY_MODE => 'mode';\n"
+            "use constant RESTORE_PATH_KEY_TYPE => 'type';\n"
+            "use constant RESTORE_PATH_KEY_USER => 'user';\n"
+            "\n"
+            "use constant RESTORE_PATH_TYPE_FILE => 'f';\n"
+            "use constant RESTORE_PATH_TYPE_LINK => 'l';\n"
+            "use constant RESTORE_PATH_TYPE_PATH => 'd';\n"
+            "\n\n\n\n"
             "sub new\n"
             "{\n"
             "my $class = shift;\n"
@@ -12520,20 +12923,12 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "my $oStorageDb = storageDb();\n"
             "\n\n"
-            "my %oRemoveHash =\n"
-            "(\n"
-            "&MANIFEST_SECTION_TARGET_FILE => 0,\n"
-            "&MANIFEST_SECTION_TARGET_PATH => 0,\n"
-            "&MANIFEST_SECTION_TARGET_LINK => 0\n"
-            ");\n"
-            "\n\n"
             "my %oTargetFound;\n"
             "my $bDelta = cfgOption(CFGOPT_FORCE) || cfgOption(CFGOPT_DELTA);\n"
             "\n"
             "for my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET))\n"
             "{\n"
             "${$self->{oTargetPath}}{$strTarget} = $oManifest->get(MANIFEST_SECTION_BACKUP_TARGET, $strTarget, MANIFEST_SUBKEY_PATH);\n"
-            "$oTargetFound{$strTarget} = false;\n"
             "\n"
             "my $strCheckPath = ${$self->{oTargetPath}}{$strTarget};\n"
             "\n"
@@ -12572,7 +12967,6 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "if ($oStorageDb->exists($strCheckFile))\n"
             "{\n"
-            "\n"
             "if (!$bDelta)\n"
             "{\n"
             "confess &log(ERROR, \"cannot restore file '${strCheckFile}' that already exists - \" .\n"
@@ -12591,20 +12985,17 @@ static const EmbeddedModule embeddedModule[] =
             "\n"
             "${$self->{oTargetPath}}{$strTarget} = \"${$self->{oTargetPath}}{$strTarget}\" .\n"
             "(($oManifest->dbVersion() >= PG_VERSION_90) ? \"/\" . $oManifest->tablespacePathGet() : \"\");\n"
+            "}\n"
             "\n\n"
             "if (!$oStorageDb->pathExists(${$self->{oTargetPath}}{$strTarget}))\n"
             "{\n"
             "next;\n"
             "}\n"
-            "}\n"
-            "\n\n"
-            "my $hTargetManifest = $oStorageDb->manifest(${$self->{oTargetPath}}{$strTarget});\n"
-            "\n"
-            "for my $strName (keys(%{$hTargetManifest}))\n"
+            "\n\n\n"
+            "for my $strName ($oStorageDb->list(${$self->{oTargetPath}}{$strTarget}))\n"
             "{\n"
             "\n"
-            "if ($strName eq '.' ||\n"
-            "(($strName eq FILE_MANIFEST || $strName eq DB_FILE_RECOVERYCONF) && $strTarget eq MANIFEST_TARGET_PGDATA))\n"
+            "if (($strName eq FILE_MANIFEST || $strName eq DB_FILE_RECOVERYCONF) && $strTarget eq MANIFEST_TARGET_PGDATA)\n"
             "{\n"
             "next;\n"
             "}\n"
@@ -12616,276 +13007,33 @@ static const EmbeddedModule embeddedModule[] =
             "}\n"
             "\n\n"
             "$oTargetFound{$strTarget} = true;\n"
+            "last;\n"
             "}\n"
             "}\n"
             "}\n"
-            "\n\n"
-            "my %oFileChecked;\n"
-            "\n"
+            "\n\n\n"
             "for my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET, INI_SORT_REVERSE))\n"
             "{\n"
             "if ($oTargetFound{$strTarget})\n"
             "{\n"
             "&log(INFO, \"remove invalid files/paths/links from ${$self->{oTargetPath}}{$strTarget}\");\n"
-            "\n\n"
-            "if (!$oStorageDb->pathExists(${$self->{oTargetPath}}{$strTarget}) &&\n"
-            "$oManifest->isTargetTablespace($strTarget))\n"
-            "{\n"
-            "next;\n"
-            "}\n"
-            "\n\n"
-            "my $hTargetManifest = $oStorageDb->manifest(${$self->{oTargetPath}}{$strTarget});\n"
-            "\n\n"
-            "if ($oManifest->isTargetFile($strTarget))\n"
-            "{\n"
-            "next;\n"
-            "}\n"
-            "\n"
-            "foreach my $strName (sort {$b cmp $a} (keys(%{$hTargetManifest})))\n"
-            "{\n"
-            "\n"
-            "if ($strName eq '.' || ($strName eq FILE_MANIFEST && $strTarget eq MANIFEST_TARGET_PGDATA))\n"
-            "{\n"
-            "next;\n"
-            "}\n"
-            "\n"
-            "my $strOsFile = \"${$self->{oTargetPath}}{$strTarget}/${strName}\";\n"
-            "my $strManifestFile = $oManifest->repoPathGet($strTarget, $strName);\n"
-            "\n\n"
-            "my $strSection = MANIFEST_SECTION_TARGET_FILE;\n"
-            "\n"
-            "if ($hTargetManifest->{$strName}{type} eq 'd')\n"
-            "{\n"
-            "$strSection = MANIFEST_SECTION_TARGET_PATH;\n"
-            "}\n"
-            "elsif ($hTargetManifest->{$strName}{type} eq 'l')\n"
-            "{\n"
-            "$strSection = MANIFEST_SECTION_TARGET_LINK;\n"
             "}\n"
-            "\n\n"
-            "if ($oManifest->test($strSection, $strManifestFile) &&\n"
-            "!defined($oFileChecked{$strSection}{$strManifestFile}))\n"
-            "{\n"
-            "my $strUser = $oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_USER);\n"
-            "my $strGroup = $oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_GROUP);\n"
-            "\n\n"
-            "if (!defined($hTargetManifest->{$strName}{user}) ||\n"
-            "$strUser ne $hTargetManifest->{$strName}{user} ||\n"
-            "!defined($hTargetManifest->{$strName}{group}) ||\n"
-            "$strGroup ne $hTargetManifest->{$strName}{group})\n"
-            "{\n"
-            "&log(DETAIL, \"set ownership ${strUser}:${strGroup} on ${strOsFile}\");\n"
-            "\n"
-            "$oStorageDb->owner($strOsFile, $strUser, $strGroup);\n"
-            "}\n"
-            "\n\n"
-            "if ($strSection eq MANIFEST_SECTION_TARGET_LINK)\n"
-            "{\n"
-            "if ($oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_DESTINATION) ne\n"
-            "$hTargetManifest->{$strName}{link_destination})\n"
-            "{\n"
-            "&log(DETAIL, \"remove link ${strOsFile} - destination changed\");\n"
-            "$oStorageDb->remove($strOsFile);\n"
-            "}\n"
-            "}\n"
-            "\n"
-            "else\n"
-            "{\n"
-            "my $strMode = $oManifest->get($strSection, $strManifestFile, MANIFEST_SUBKEY_MODE);\n"
-            "\n"
-            "if ($strMode ne $hTargetManifest->{$strName}{mode})\n"
-            "{\n"
-            "&log(DETAIL, \"set mode ${strMode} on ${strOsFile}\");\n"
-            "\n"
-            "chmod(oct($strMode), $strOsFile)\n"
-            "or confess 'unable to set mode ${strMode} on ${strOsFile}';\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "\n"
-            "else\n"
-            "{\n"
-            "\n"
-            "if ($strSection eq MANIFEST_SECTION_TARGET_PATH)\n"
-            "{\n"
-            "&log(DETAIL, \"remove path ${strOsFile}\");\n"
-            "rmdir($strOsFile) or confess &log(ERROR, \"unable to delete path ${strOsFile}, is it empty?\");\n"
-            "\n"
-            "$oRemoveHash{$strSection} += 1;\n"
-            "}\n"
-            "\n"
-            "else\n"
-            "{\n"
-            "my $strType = (split('\\:', $strSection))[1];\n"
-            "\n\n\n"
-            "if ($oManifest->dbPathGet(undef, $strManifestFile) eq DB_FILE_RECOVERYCONF)\n"
-            "{\n"
-            "&log(DETAIL, \"preserve ${strType} ${strOsFile}\");\n"
-            "}\n"
-            "else\n"
-            "{\n"
-            "&log(DETAIL, \"remove ${strType} ${strOsFile}\");\n"
-            "$oStorageDb->remove($strOsFile);\n"
-            "\n\n"
-            "protocolKeepAlive();\n"
-            "\n"
-            "$oRemoveHash{$strSection} += 1;\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "\n\n\n"
-            "foreach my $strSection (sort (keys %oRemoveHash))\n"
-            "{\n"
-            "for my $strManifestFile ($oManifest->keys($strSection))\n"
-            "{\n"
-            "\n\n"
-            "if ($strSection ne MANIFEST_SECTION_TARGET_LINK || $strManifestFile ne $strTarget)\n"
-            "{\n"
-            "\n"
-            "if (index($strManifestFile, \"${strTarget}/\") == 0)\n"
-            "{\n"
-            "\n"
-            "$oFileChecked{$strSection}{$strManifestFile} = true;\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "\n\n"
-            "my @stryMessage;\n"
-            "\n"
-            "foreach my $strFileType (sort (keys %oRemoveHash))\n"
-            "{\n"
-            "if ($oRemoveHash{$strFileType} > 0)\n"
-            "{\n"
-            "push(@stryMessage, \"$oRemoveHash{$strFileType} \" . (split('\\:', $strFileType))[1] .\n"
-            "($oRemoveHash{$strFileType} > 1 ? 's' : ''));\n"
-            "}\n"
-            "}\n"
-            "\n"
-            "if (@stryMessage)\n"
-            "{\n"
-            "&log(INFO, 'cleanup removed ' . join(', ', @stryMessage));\n"
             "}\n"
             "\n\n"
             "return logDebugReturn($strOperation);\n"
             "}\n"
             "\n\n\n\n\n\n"
-            "sub build\n"
+            "sub queueKey\n"
             "{\n"
             "my $self = shift;\n"
-            "\n\n"
-            "my\n"
-            "(\n"
-            "$strOperation,\n"
-            "$oManifest\n"
-            "\n"
-            ") =\n"
-            "logDebugParam\n"
-            "(\n"
-            "__PACKAGE__ . '->build', \\@_,\n"
-            "{name => 'oManifest'}\n"
-            ");\n"
-            "\n\n"
-            "my $oStorageDb = storageDb();\n"
-            "\n\n"
-            "foreach my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET))\n"
-            "{\n"
-            "if ($strTarget ne MANIFEST_TARGET_PGDATA)\n"
-            "{\n"
-            "my $strPath = ${$self->{oTargetPath}}{$strTarget};\n"
+            "my $strName = shift;\n"
             "\n"
-            "if ($oManifest->isTargetTablespace($strTarget))\n"
+            "if (index($strName, DB_PATH_PGTBLSPC . '/') == 0)\n"
             "{\n"
-            "\n"
-            "$strPath = dirname($strPath);\n"
+            "return DB_PATH_PGTBLSPC . '/' . (split('\\/', $strName))[1];\n"
             "}\n"
-            "\n\n"
-            "if (!$oStorageDb->pathExists($strPath))\n"
-            "{\n"
-            "$oStorageDb->pathCreate(\n"
-            "$strPath, {strMode => $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_MODE)});\n"
-            "\n\n"
-            "my $strUser = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_USER);\n"
-            "my $strGroup = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_GROUP);\n"
             "\n"
-            "if ($strUser ne getpwuid($<) || $strGroup ne getgrgid($())\n"
-            "{\n"
-            "$oStorageDb->owner($strPath, $strUser, $strGroup);\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "\n"
-            "$oManifest->remove(MANIFEST_SECTION_TARGET_PATH, $strTarget);\n"
-            "}\n"
-            "\n\n\n"
-            "my $iLevel = 1;\n"
-            "my $iFound;\n"
-            "\n"
-            "do\n"
-            "{\n"
-            "$iFound = 0;\n"
-            "\n"
-            "&log(DEBUG, \"build level ${iLevel} paths/links\");\n"
-            "\n\n"
-            "foreach my $strSection (&MANIFEST_SECTION_TARGET_PATH, &MANIFEST_SECTION_TARGET_LINK)\n"
-            "{\n"
-            "\n"
-            "foreach my $strName ($oManifest->keys($strSection))\n"
-            "{\n"
-            "\n"
-            "if ($strName eq '.')\n"
-            "{\n"
-            "next;\n"
-            "}\n"
-            "\n\n"
-            "my @stryName = split('\\/', $oManifest->dbPathGet(undef, $strName));\n"
-            "\n\n"
-            "if (@stryName == $iLevel)\n"
-            "{\n"
-            "my $strDbPath = $oManifest->dbPathGet($self->{strDbClusterPath}, $strName);\n"
-            "\n\n\n"
-            "if (!$oStorageDb->pathExists($strDbPath) && !$oStorageDb->exists($strDbPath))\n"
-            "{\n"
-            "\n"
-            "if ($strSection eq &MANIFEST_SECTION_TARGET_PATH)\n"
-            "{\n"
-            "$oStorageDb->pathCreate(\n"
-            "$strDbPath, {strMode => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_MODE)});\n"
-            "}\n"
-            "\n"
-            "else\n"
-            "{\n"
-            "\n"
-            "my $strDestination = $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_DESTINATION);\n"
-            "\n\n\n\n"
-            "$oStorageDb->linkCreate(\n"
-            "$oStorageDb->pathAbsolute(\n"
-            "dirname($strDbPath), $strDestination), $strDbPath,\n"
-            "{bRelative => (index($strDestination, '/') != 0, bIgnoreExists => true)});\n"
-            "}\n"
-            "\n\n"
-            "my $strUser = $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_USER);\n"
-            "my $strGroup = $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_GROUP);\n"
-            "\n"
-            "if ($strUser ne getpwuid($<) || $strGroup ne getgrgid($())\n"
-            "{\n"
-            "$oStorageDb->owner($strDbPath, $strUser, $strGroup);\n"
-            "}\n"
-            "}\n"
-            "\n\n"
-            "$iFound++;\n"
-            "}\n"
-            "}\n"
-            "}\n"
-            "\n\n"
-            "$iLevel++;\n"
-            "}\n"
-            "while ($iFound > 0);\n"
-            "\n\n"
-            "return logDebugReturn($strOperation);\n"
+            "return MANIFEST_TARGET_PGDATA;\n"
             "}\n"
             "\n\n\n\n\n\n"
             "sub recovery\n"
@@ -13083,11 +13231,6 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "$self->clean($oManifest);\n"
             "\n\n"
-            "$self->build($oManifest);\n"
-            "\n\n"
-            "my $strCurrentUser = getpwuid($<);\n"
-            "my $strCurrentGroup = getgrgid($();\n"
-            "\n\n"
             "my $strDbFilter;\n"
             "\n"
             "if (cfgOptionTest(CFGOPT_DB_INCLUDE))\n"
@@ -13179,31 +13322,142 @@ static const EmbeddedModule embeddedModule[] =
             "\n\n"
             "&log(DETAIL, \"database filter: \" . (defined($strDbFilter) ? \"${strDbFilter}\" : ''));\n"
             "}\n"
-            "\n\n"
-            "my $oRestoreProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_BACKUP);\n"
+            "\n\n\n"
+            "foreach my $strTarget ($oManifest->keys(MANIFEST_SECTION_BACKUP_TARGET))\n"
+            "{\n"
+            "next if !$oManifest->isTargetTablespace($strTarget);\n"
+            "\n"
+            "my $strPath = dirname(${$self->{oTargetPath}}{$strTarget});\n"
+            "\n"
+            "if (!$oStorageDb->pathExists($strPath))\n"
+            "{\n"
+            "$oStorageDb->pathCreate(\n"
+            "$strPath, {strMode => $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_MODE)});\n"
+            "\n"
+            "my $strUser = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_USER);\n"
+            "my $strGroup = $oManifest->get(MANIFEST_SECTION_TARGET_PATH, $strTarget, MANIFEST_SUBKEY_GROUP);\n"
+            "\n"
+            "if ($strUser ne getpwuid($<) || $strGroup ne getgrgid($())\n"
+            "{\n"
+            "$oStorageDb->owner($strPath, $strUser, $strGroup);\n"
+            "}\n"
+            "}\n"
+            "}\n"
+            "\n\n\n"
+            "my $oRestoreProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_BACKUP, undef, undef, undef, true);\n"
             "$oRestoreProcess->hostAdd(1, cfgOption(CFGOPT_PROCESS_MAX));\n"
             "\n\n"
             "my $lSizeTotal = 0;\n"
             "my $lSizeCurrent = 0;\n"
+            "\n\n\n\n"
+            "my $bDelta = cfgOption(CFGOPT_FORCE) || cfgOption(CFGOPT_DELTA) ? true : false;\n"
+            "my $hPath = {};\n"
             "\n"
-            "foreach my $strRepoFile (\n"
-            "sort {sprintf(\"%016d-%s\", $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $b, MANIFEST_SUBKEY_SIZE), $b) cmp\n"
-            "sprintf(\"%016d-%s\", $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $a, MANIFEST_SUBKEY_SIZE), $a)}\n"
-            "($oManifest->keys(MANIFEST_SECTION_TARGET_FILE, INI_SORT_NONE)))\n"
+            "foreach my $strSection (&MANIFEST_SECTION_TARGET_PATH, &MANIFEST_SECTION_TARGET_LINK, &MANIFEST_SECTION_TARGET_FILE)\n"
+            "{\n"
+            "foreach my $strName ($oManifest->keys($strSection))\n"
             "{\n"
+            "\n"
+            "next if $strSection eq MANIFEST_SECTION_TARGET_PATH && $strName eq MANIFEST_TARGET_PGTBLSPC;\n"
+            "\n\n\n"
+            "next if $strSection eq MANIFEST_SECTION_TARGET_FILE && $strName eq MANIFEST_FILE_TABLESPACEMAP &&\n"
+            "$oManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_DB_VERSION) >= PG_VERSION_95;\n"
             "\n\n"
-            "if ($strRepoFile eq MANIFEST_FILE_TABLESPACEMAP &&\n"
-            "$oManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_DB_VERSION) >= PG_VERSION_95)\n"
+            "my $strParent = dirname($strName);\n"
+            "$strParent = MANIFEST_TARGET_PGDATA . '/' . MANIFEST_TARGET_PGTBLSPC if $strParent eq MANIFEST_TARGET_PGTBLSPC;\n"
+            "\n"
+            "if ($strSection eq MANIFEST_SECTION_TARGET_FILE)\n"
             "{\n"
-            "next;\n"
+            "push(@{$hPath->{$strParent}{stryFile}}, $strName);\n"
+            "$lSizeTotal += $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strName, MANIFEST_SUBKEY_SIZE);\n"
+            "}\n"
+            "\n"
+            "elsif (($strSection eq MANIFEST_SECTION_TARGET_PATH && $strParent ne '.') ||\n"
+            "($strSection eq MANIFEST_SECTION_TARGET_LINK && $oManifest->test(MANIFEST_SECTION_BACKUP_TARGET, $strName) &&\n"
+            "!$oManifest->isTargetFile($strName) && !$oManifest->test(MANIFEST_SECTION_TARGET_PATH, $strName)))\n"
+            "{\n"
+            "push(@{$hPath->{$strParent}{stryPath}}, $strName);\n"
+            "}\n"
+            "\n\n\n"
+            "next if $strParent eq '.' ||\n"
+            "($strSection ne MANIFEST_SECTION_TARGET_LINK && $oManifest->test(MANIFEST_SECTION_TARGET_LINK, $strName));\n"
+            "\n"
+            "$hPath->{$strParent}{hEntry}{basename($strName)} =\n"
+            "{\n"
+            "&RESTORE_PATH_KEY_TYPE =>\n"
+            "$strSection eq MANIFEST_SECTION_TARGET_PATH ? RESTORE_PATH_TYPE_PATH :\n"
+            "($strSection eq MANIFEST_SECTION_TARGET_LINK ? RESTORE_PATH_TYPE_LINK : RESTORE_PATH_TYPE_FILE),\n"
+            "&RESTORE_PATH_KEY_MODE => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_MODE, false),\n"
+            "&RESTORE_PATH_KEY_USER => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_USER),\n"
+            "&RESTORE_PATH_KEY_GROUP => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_GROUP),\n"
+            "&RESTORE_PATH_KEY_DESTINATION => $oManifest->get($strSection, $strName, MANIFEST_SUBKEY_DESTINATION, false),\n"
+            "};\n"
+            "}\n"
+            "}\n"
+            "\n\n\n"
+            "$hPath->{&MANIFEST_TARGET_PGDATA}{hEntry}{&FILE_MANIFEST} = undef;\n"
+            "\n"
+            "if (!defined($hPath->{&MANIFEST_TARGET_PGDATA}{hEntry}{&DB_FILE_RECOVERYCONF}))\n"
+            "{\n"
+            "$hPath->{&MANIFEST_TARGET_PGDATA}{hEntry}{&DB_FILE_RECOVERYCONF} = undef;\n"
             "}\n"
             "\n\n"
-            "my $strQueueKey = MANIFEST_TARGET_PGDATA;\n"
+            "my $fnQueuePath = sub\n"
+            "{\n"
+            "my $strPath = shift;\n"
             "\n\n"
-            "if (index($strRepoFile, DB_PATH_PGTBLSPC . '/') == 0)\n"
+            "my $bTarget = $oManifest->test(MANIFEST_SECTION_BACKUP_TARGET, $strPath);\n"
+            "my $bClean = $bDelta;\n"
+            "\n\n"
+            "my $strSection = $oManifest->test(MANIFEST_SECTION_TARGET_PATH, $strPath) ?\n"
+            "MANIFEST_SECTION_TARGET_PATH : MANIFEST_SECTION_TARGET_LINK;\n"
+            "\n"
+            "if ($bTarget && $oManifest->isTargetTablespace($strPath))\n"
             "{\n"
-            "$strQueueKey = DB_PATH_PGTBLSPC . '/' . (split('\\/', $strRepoFile))[1];\n"
+            "$bClean = $oManifest->dbVersion() < PG_VERSION_90 ? true : false;\n"
             "}\n"
+            "\n"
+            "$oRestoreProcess->queueJob(\n"
+            "1, $self->queueKey($strPath), $strPath, OP_RESTORE_PATH,\n"
+            "[$strPath eq MANIFEST_TARGET_PGDATA ?\n"
+            "$self->{strDbClusterPath} : $oManifest->dbPathGet($self->{strDbClusterPath}, $strPath),\n"
+            "$oManifest->get(\n"
+            "$strSection, $strPath, MANIFEST_SUBKEY_MODE, false,\n"
+            "$oManifest->get(MANIFEST_SECTION_TARGET_PATH, MANIFEST_TARGET_PGDATA, MANIFEST_SUBKEY_MODE)),\n"
+            "$oManifest->get($strSection, $strPath, MANIFEST_SUBKEY_USER),\n"
+            "$oManifest->get($strSection, $strPath, MANIFEST_SUBKEY_GROUP),\n"
+            "\n"
+            "$bTarget ? false : true, $bClean,\n"
+            "defined($hPath->{$strPath}{hEntry}) ? $hPath->{$strPath}{hEntry} : {}]);\n"
+            "};\n"
+            "\n\n\n"
+            "my @hyFileReady;\n"
+            "my $iProcessMax = cfgOption(CFGOPT_PROCESS_MAX);\n"
+            "\n\n"
+            "my $fnFileReady = sub\n"
+            "{\n"
+            "my $strPath = shift;\n"
+            "\n"
+            "my @hyFile =\n"
+            "sort {$b->[0] cmp $a->[0]}\n"
+            "map {[sprintf('%016d-%s', $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $_, MANIFEST_SUBKEY_SIZE), $_), $_]}\n"
+            "(defined($hPath->{$strPath}{stryFile}) ? @{$hPath->{$strPath}{stryFile}} : ());\n"
+            "\n\n"
+            "my @hyFileMerge;\n"
+            "\n"
+            "while (@hyFileReady && @hyFile)\n"
+            "{\n"
+            "push(@hyFileMerge, $hyFileReady[0][0] ge $hyFile[0][0] ? shift(@hyFileReady) : shift(@hyFile));\n"
+            "}\n"
+            "\n"
+            "@hyFileReady = (@hyFileMerge, @hyFileReady, @hyFile);\n"
+            "};\n"
+            "\n\n"
+            "my $fnQueueFile = sub\n"
+            "{\n"
+            "while (@hyFileReady && $oRestoreProcess->jobTotal() < $iProcessMax * 2)\n"
+            "{\n"
+            "my $strRepoFile = (shift(@hyFileReady))->[1];\n"
             "\n\n"
             "my $strDbFile = $oManifest->dbPathGet($self->{strDbClusterPath}, $strRepoFile);\n"
             "my $lSize = $oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_SIZE);\n"
@@ -13213,10 +13467,8 @@ static const EmbeddedModule embeddedModule[] =
             "$strDbFile .= '.' . STORAGE_TEMP_EXT;\n"
             "}\n"
             "\n\n"
-            "$lSizeTotal += $lSize;\n"
-            "\n\n"
             "$oRestoreProcess->queueJob(\n"
-            "1, $strQueueKey, $strRepoFile, OP_RESTORE_FILE,\n"
+            "1, $self->queueKey($strRepoFile), $strRepoFile, OP_RESTORE_FILE,\n"
             "[$strDbFile, $lSize,\n"
             "$oManifest->numericGet(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_TIMESTAMP),\n"
             "$oManifest->get(MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $lSize > 0),\n"
@@ -13231,24 +13483,80 @@ static const EmbeddedModule embeddedModule[] =
             "$self->{strBackupSet}, $oManifest->boolGet(MANIFEST_SECTION_BACKUP_OPTION, MANIFEST_KEY_COMPRESS)],\n"
             "{rParamSecure => $oManifest->cipherPassSub() ? [$oManifest->cipherPassSub()] : undef});\n"
             "}\n"
+            "};\n"
+            "\n\n\n"
+            "$fnQueuePath->(MANIFEST_TARGET_PGDATA);\n"
+            "\n\n"
+            "my $iFileRemoved = 0;\n"
+            "my $iLinkRemoved = 0;\n"
+            "my $iPathRemoved = 0;\n"
             "\n\n"
             "while (my $hyJob = $oRestoreProcess->process())\n"
             "{\n"
             "foreach my $hJob (@{$hyJob})\n"
             "{\n"
+            "\n"
+            "if ($hJob->{strOp} eq OP_RESTORE_PATH)\n"
+            "{\n"
+            "$iFileRemoved += $hJob->{rResult}[0];\n"
+            "$iLinkRemoved += $hJob->{rResult}[1];\n"
+            "$iPathRemoved += $hJob->{rResult}[2];\n"
+            "\n\n\n"
+            "foreach my $strMessage (@{$hJob->{rResult}[3]})\n"
+            "{\n"
+            "next if $strMessage eq \"preserve file $self->{strDbClusterPath}/\" . FILE_MANIFEST;\n"
+            "\n"
+            "&log(DETAIL, $strMessage);\n"
+            "}\n"
+            "\n"
+            "foreach my $strPath (defined($hPath->{$hJob->{strKey}}{stryPath}) ? @{$hPath->{$hJob->{strKey}}{stryPath}} : ())\n"
+            "{\n"
+            "$fnQueuePath->($strPath);\n"
+            "}\n"
+            "\n"
+            "$fnFileReady->($hJob->{strKey});\n"
+            "delete($hPath->{$hJob->{strKey}});\n"
+            "}\n"
+            "else\n"
+            "{\n"
             "($lSizeCurrent) = restoreLog(\n"
             "$hJob->{iProcessId}, @{$hJob->{rParam}}[0..5], @{$hJob->{rResult}}, $lSizeTotal, $lSizeCurrent);\n"
             "}\n"
+            "}\n"
+            "\n"
+            "$fnQueueFile->();\n"
             "\n\n\n"
             "protocolKeepAlive();\n"
             "}\n"
             "\n\n"
+            "if (keys(%{$hPath}) > 0)\n"
+            "{\n"
+            "confess &log(ASSERT, 'paths not restored: ' . join(', ', sort(keys(%{$hPath}))));\n"
+            "}\n"
+            "\n\n"
+            "my @stryMessage;\n"
+            "\n"
+            "foreach my $rhRemove (['file', $iFileRemoved], ['link', $iLinkRemoved], ['path', $iPathRemoved])\n"
+            "{\n"
+            "if ($rhRemove->[1] > 0)\n"
+            "{\n"
+            "push(@stryMessage, \"$rhRemove->[1] $rhRemove->[0]\" . ($rhRemove->[1] > 1 ? 's' : ''));\n"
+            "}\n"
+            "}\n"
+            "\n"
+            "if (@stryMessage)\n"
+            "{\n"
+            "&log(INFO, 'cleanup removed ' . join(', ', @stryMessage));\n"
+            "}\n"
+            "\n\n"
             "$self->recovery($oManifest->get(MANIFEST_SECTION_BACKUP_DB, MANIFEST_KEY_DB_VERSION));\n"
             "\n\n"
             "foreach my $strPath ($oManifest->keys(MANIFEST_SECTION_TARGET_PATH))\n"
             "{\n"
             "\n"
             "next if $strPath eq MANIFEST_TARGET_PGTBLSPC;\n"
+            "\n\n"
+            "next if $oManifest->test(MANIFEST_SECTION_BACKUP_TARGET, $strPath);\n"
             "\n"
             "$oStorageDb->pathSync($oManifest->dbPathGet($self->{strDbClusterPath}, $strPath));\n"
             "}\n"
@@ -64,6 +64,7 @@ These includes are from the src directory.  There is no Perl-specific code in th
 #include "config/define.h"
 #include "config/load.h"
 #include "config/parse.h"
+#include "info/manifestBin.h"
 #include "perl/config.h"
 #include "postgres/pageChecksum.h"
 #include "storage/posix/storage.h"
@@ -78,6 +79,7 @@ XSH includes
 
 These includes define data structures that are required for the C to Perl interface but are not part of the regular C source.
 ***********************************************************************************************************************************/
+#include "xs/command/backup/delta.xsh"
 #include "xs/crypto/hash.xsh"
 #include "xs/common/encode.xsh"
 #include "xs/postgres/client.xsh"
@@ -248,7 +250,10 @@ XS_EUPXS(XS_pgBackRest__LibC_libcUvSize)
 }
 
 
-/* INCLUDE:  Including 'xs/common/encode.xs' from 'LibC.xs' */
+/* INCLUDE:  Including 'xs/command/backup/delta.xs' from 'LibC.xs' */
+
+
+/* INCLUDE:  Including 'xs/common/encode.xs' from 'xs/command/backup/delta.xs' */
 
 
 /* INCLUDE:  Including 'xs/common/lock.xs' from 'xs/common/encode.xs' */
@@ -269,7 +274,10 @@ XS_EUPXS(XS_pgBackRest__LibC_libcUvSize)
 /* INCLUDE:  Including 'xs/crypto/random.xs' from 'xs/crypto/hash.xs' */
 
 
-/* INCLUDE:  Including 'xs/postgres/client.xs' from 'xs/crypto/random.xs' */
+/* INCLUDE:  Including 'xs/info/manifestBin.xs' from 'xs/crypto/random.xs' */
+
+
+/* INCLUDE:  Including 'xs/postgres/client.xs' from 'xs/info/manifestBin.xs' */
 
 
 /* INCLUDE:  Including 'xs/postgres/pageChecksum.xs' from 'xs/postgres/client.xs' */
@@ -1729,7 +1737,32 @@ XS_EUPXS(XS_pgBackRest__LibC__PgClient_DESTROY)
 }
 
 
-/* INCLUDE: Returning to 'xs/crypto/random.xs' from 'xs/postgres/client.xs' */
+/* INCLUDE: Returning to 'xs/info/manifestBin.xs' from 'xs/postgres/client.xs' */
+
+
+XS_EUPXS(XS_pgBackRest__LibC_manifestBinFromText); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_pgBackRest__LibC_manifestBinFromText)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "manifest");
+    {
+    MEM_CONTEXT_XS_TEMP_BEGIN()
+    {
+	const Buffer *	manifest = BUF_CONST_SV(ST(0));
+	SV *	RETVAL;
+    Buffer *result = manifestBinFromText(manifest);
+    RETVAL = newSVpv((char *)bufPtr(result), bufUsed(result));
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    MEM_CONTEXT_XS_TEMP_END();
+    }
+    XSRETURN(1);
+}
+
+
+/* INCLUDE: Returning to 'xs/crypto/random.xs' from 'xs/info/manifestBin.xs' */
 
 
 XS_EUPXS(XS_pgBackRest__LibC_cryptoRandomBytes); /* prototype to pass -Wmissing-prototypes */
@@ -2232,7 +2265,67 @@ XS_EUPXS(XS_pgBackRest__LibC_decodeToBin)
 }
 
 
-/* INCLUDE: Returning to 'LibC.xs' from 'xs/common/encode.xs' */
+/* INCLUDE: Returning to 'xs/command/backup/delta.xs' from 'xs/common/encode.xs' */
+
+
+XS_EUPXS(XS_pgBackRest__LibC_backupDelta); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_pgBackRest__LibC_backupDelta)
+{
+    dVAR; dXSARGS;
+    if (items != 5)
+       croak_xs_usage(cv,  "fileList, priorList, priorLabel, timeBegin, delta");
+    {
+    MEM_CONTEXT_XS_TEMP_BEGIN()
+    {
+	HV *	fileList;
+	SV *	priorList = ST(1)
+;
+	SV *	priorLabel = ST(2)
+;
+	IV	timeBegin = (IV)SvIV(ST(3))
+;
+	bool	delta = (bool)SvTRUE(ST(4))
+;
+	SV *	RETVAL;
+
+	STMT_START {
+		SV* const xsub_tmp_sv = ST(0);
+		SvGETMAGIC(xsub_tmp_sv);
+		if (SvROK(xsub_tmp_sv) && SvTYPE(SvRV(xsub_tmp_sv)) == SVt_PVHV){
+		    fileList = (HV*)SvRV(xsub_tmp_sv);
+		}
+		else{
+		    Perl_croak_nocontext("%s: %s is not a HASH reference",
+				"pgBackRest::LibC::backupDelta",
+				"fileList");
+		}
+	} STMT_END
+;
+    BackupDeltaXsCallbackData data = {.fileListHv = fileList, .priorLabel = priorLabel};
+
+    if (SvOK(priorList))
+    {
+        CHECK(SvROK(priorList) && SvTYPE(SvRV(priorList)) == SVt_PVHV);
+        data.priorListHv = (HV *)SvRV(priorList);
+    }
+
+    String *result = backupDeltaXsResult(
+        backupDelta(
+            backupDeltaXsFileList(fileList, false),
+            data.priorListHv != NULL ? backupDeltaXsFileList(data.priorListHv, true) : NULL,
+            (time_t)timeBegin, delta, backupDeltaXsCallback, &data));
+
+    RETVAL = newSVpv(strPtr(result), strSize(result));
+	RETVAL = sv_2mortal(RETVAL);
+	ST(0) = RETVAL;
+    }
+    MEM_CONTEXT_XS_TEMP_END();
+    }
+    XSRETURN(1);
+}
+
+
+/* INCLUDE: Returning to 'LibC.xs' from 'xs/command/backup/delta.xs' */
 
 #ifdef __cplusplus
 extern "C"
@@ -2306,6 +2399,7 @@ XS_EXTERNAL(boot_pgBackRest__LibC)
         newXS_deffile("pgBackRest::LibC::PgClient::query", XS_pgBackRest__LibC__PgClient_query);
         newXS_deffile("pgBackRest::LibC::PgClient::close", XS_pgBackRest__LibC__PgClient_close);
         newXS_deffile("pgBackRest::LibC::PgClient::DESTROY", XS_pgBackRest__LibC__PgClient_DESTROY);
+        newXS_deffile("pgBackRest::LibC::manifestBinFromText", XS_pgBackRest__LibC_manifestBinFromText);
         newXS_deffile("pgBackRest::LibC::cryptoRandomBytes", XS_pgBackRest__LibC_cryptoRandomBytes);
         newXS_deffile("pgBackRest::LibC::cryptoHashOne", XS_pgBackRest__LibC_cryptoHashOne);
         newXS_deffile("pgBackRest::LibC::cfgCommandId", XS_pgBackRest__LibC_cfgCommandId);
@@ -2325,6 +2419,7 @@ XS_EXTERNAL(boot_pgBackRest__LibC)
         newXS_deffile("pgBackRest::LibC::lockRelease", XS_pgBackRest__LibC_lockRelease);
         newXS_deffile("pgBackRest::LibC::encodeToStr", XS_pgBackRest__LibC_encodeToStr);
         newXS_deffile("pgBackRest::LibC::decodeToBin", XS_pgBackRest__LibC_decodeToBin);
+        newXS_deffile("pgBackRest::LibC::backupDelta", XS_pgBackRest__LibC_backupDelta);
 #if PERL_VERSION_LE(5, 21, 5)
 #  if PERL_VERSION_GE(5, 9, 0)
     if (PL_unitcheckav)
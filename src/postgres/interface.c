@@ -35,12 +35,6 @@ really old storage with 512-byte sectors.  This is true across all versions of P
 #define PG_CONTROL_SIZE                                             ((unsigned int)(8 * 1024))
 #define PG_CONTROL_DATA_SIZE                                        ((unsigned int)(512))
 
-/***********************************************************************************************************************************
-WAL header size.  It doesn't seem worth tracking the exact size of the WAL header across versions of PostgreSQL so just set it to
-something far larger needed but <= the minimum read size on just about any system.
-***********************************************************************************************************************************/
-#define PG_WAL_HEADER_SIZE                                          ((unsigned int)(512))
-
 /***********************************************************************************************************************************
 Name of default PostgreSQL database used for running all queries and commands
 ***********************************************************************************************************************************/
@@ -596,6 +590,9 @@ pgWalTestToBuffer(PgWal pgWal, Buffer *walBuffer)
 
     ASSERT(walBuffer != NULL);
 
+    // Set defaults if values are not passed
+    pgWal.walSegmentSize = pgWal.walSegmentSize == 0 ? PG_WAL_SEGMENT_SIZE_DEFAULT : pgWal.walSegmentSize;
+
     // Generate WAL
     pgInterfaceVersion(pgWal.version)->walTest(pgWal, bufPtr(walBuffer));
 
@@ -675,5 +672,6 @@ pgControlToLog(const PgControl *pgControl)
 String *
 pgWalToLog(const PgWal *pgWal)
 {
-    return strNewFmt("{version: %u, systemId: %" PRIu64 "}", pgWal->version, pgWal->systemId);
+    return strNewFmt(
+        "{version: %u, systemId: %" PRIu64 ", walSegmentSize: %u}", pgWal->version, pgWal->systemId, pgWal->walSegmentSize);
 }
@@ -24,6 +24,12 @@ Defines for various Postgres paths and files
 #define PG_NAME_XLOG                                                "xlog"
     STRING_DECLARE(PG_NAME_XLOG_STR);
 
+/***********************************************************************************************************************************
+WAL header size.  It doesn't seem worth tracking the exact size of the WAL header across versions of PostgreSQL so just set it to
+something far larger needed but <= the minimum read size on just about any system.
+***********************************************************************************************************************************/
+#define PG_WAL_HEADER_SIZE                                          ((unsigned int)(512))
+
 /***********************************************************************************************************************************
 Name of default PostgreSQL database used for running all queries and commands
 ***********************************************************************************************************************************/
@@ -66,6 +72,7 @@ typedef struct PgWal
 {
     unsigned int version;
     uint64_t systemId;
+    unsigned int walSegmentSize;
 } PgWal;
 
 /***********************************************************************************************************************************
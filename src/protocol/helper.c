@@ -8,7 +8,9 @@ Protocol Helper
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/exec.h"
+#include "common/io/tls/client.h"
 #include "common/memContext.h"
+#include "common/type/json.h"
 #include "config/config.h"
 #include "config/exec.h"
 #include "config/protocol.h"
@@ -20,12 +22,15 @@ Constants
 STRING_EXTERN(PROTOCOL_SERVICE_LOCAL_STR,                           PROTOCOL_SERVICE_LOCAL);
 STRING_EXTERN(PROTOCOL_SERVICE_REMOTE_STR,                          PROTOCOL_SERVICE_REMOTE);
 
+STRING_EXTERN(PROTOCOL_HOST_TYPE_TLS_STR,                           PROTOCOL_HOST_TYPE_TLS);
+
 /***********************************************************************************************************************************
 Local variables
 ***********************************************************************************************************************************/
 typedef struct ProtocolHelperClient
 {
     Exec *exec;                                                     // Executed client
+    TlsClient *tlsClient;                                           // TLS client when the remote is started by a TLS server
     ProtocolClient *client;                                         // Protocol client
 } ProtocolHelperClient;
 
@@ -195,10 +200,29 @@ protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int protocolI
 }
 
 /***********************************************************************************************************************************
-Get the command line required for remote protocol execution
+Is the remote started by a TLS server rather than SSH?
+***********************************************************************************************************************************/
+static bool
+protocolRemoteIsTls(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, protocolStorageType);
+        FUNCTION_TEST_PARAM(UINT, hostIdx);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(
+        strEq(
+            cfgOptionStr(protocolStorageType == protocolStorageTypeRepo ? cfgOptRepoHostType : cfgOptPgHostType + hostIdx),
+            PROTOCOL_HOST_TYPE_TLS_STR));
+}
+
+/***********************************************************************************************************************************
+Get the parameters for the remote command
+
+Config options are not passed when the remote is started by a TLS server since the server always uses its own configuration.
 ***********************************************************************************************************************************/
 static StringList *
-protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protocolId, unsigned int hostIdx)
+protocolRemoteExecParam(ProtocolStorageType protocolStorageType, unsigned int protocolId, unsigned int hostIdx)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
@@ -208,31 +232,7 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protoc
 
     // Is this a repo remote?
     bool isRepo = protocolStorageType == protocolStorageTypeRepo;
-
-    // Fixed parameters for ssh command
-    StringList *result = strLstNew();
-    strLstAddZ(result, "-o");
-    strLstAddZ(result, "LogLevel=error");
-    strLstAddZ(result, "-o");
-    strLstAddZ(result, "Compression=no");
-    strLstAddZ(result, "-o");
-    strLstAddZ(result, "PasswordAuthentication=no");
-
-    // Append port if specified
-    ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort + hostIdx;
-
-    if (cfgOptionTest(optHostPort))
-    {
-        strLstAddZ(result, "-p");
-        strLstAdd(result, strNewFmt("%u", cfgOptionUInt(optHostPort)));
-    }
-
-    // Append user/host
-    strLstAdd(
-        result,
-        strNewFmt(
-            "%s@%s", strPtr(cfgOptionStr(isRepo ? cfgOptRepoHostUser : cfgOptPgHostUser + hostIdx)),
-            strPtr(cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx))));
+    bool isTls = protocolRemoteIsTls(protocolStorageType, hostIdx);
 
     // Option replacements
     KeyValue *optionReplace = kvNew();
@@ -240,19 +240,21 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protoc
     // Replace config options with the host versions
     unsigned int optConfig = isRepo ? cfgOptRepoHostConfig : cfgOptPgHostConfig + hostIdx;
 
-    kvPut(optionReplace, VARSTR(CFGOPT_CONFIG_STR), cfgOptionSource(optConfig) != cfgSourceDefault  ? cfgOption(optConfig) : NULL);
+    kvPut(
+        optionReplace, VARSTR(CFGOPT_CONFIG_STR),
+        !isTls && cfgOptionSource(optConfig) != cfgSourceDefault ? cfgOption(optConfig) : NULL);
 
     unsigned int optConfigIncludePath = isRepo ? cfgOptRepoHostConfigIncludePath : cfgOptPgHostConfigIncludePath + hostIdx;
 
     kvPut(
         optionReplace, VARSTR(CFGOPT_CONFIG_INCLUDE_PATH_STR),
-        cfgOptionSource(optConfigIncludePath) != cfgSourceDefault ? cfgOption(optConfigIncludePath) : NULL);
+        !isTls && cfgOptionSource(optConfigIncludePath) != cfgSourceDefault ? cfgOption(optConfigIncludePath) : NULL);
 
     unsigned int optConfigPath = isRepo ? cfgOptRepoHostConfigPath : cfgOptPgHostConfigPath + hostIdx;
 
     kvPut(
         optionReplace, VARSTR(CFGOPT_CONFIG_PATH_STR),
-        cfgOptionSource(optConfigPath) != cfgSourceDefault ? cfgOption(optConfigPath) : NULL);
+        !isTls && cfgOptionSource(optConfigPath) != cfgSourceDefault ? cfgOption(optConfigPath) : NULL);
 
     // Use a C remote
     kvPut(optionReplace, VARSTR(CFGOPT_C_STR), VARBOOL(true));
@@ -300,13 +302,119 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protoc
     // Add the type
     kvPut(optionReplace, VARSTR(CFGOPT_TYPE_STR), isRepo ? VARSTRDEF("backup") : VARSTRDEF("db"));
 
-    StringList *commandExec = cfgExecParam(cfgCmdRemote, optionReplace);
+    FUNCTION_LOG_RETURN(STRING_LIST, cfgExecParam(cfgCmdRemote, optionReplace));
+}
+
+/***********************************************************************************************************************************
+Get the command line required for remote protocol execution
+***********************************************************************************************************************************/
+static StringList *
+protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int protocolId, unsigned int hostIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, protocolId);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+    FUNCTION_LOG_END();
+
+    // Is this a repo remote?
+    bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+    // Fixed parameters for ssh command
+    StringList *result = strLstNew();
+    strLstAddZ(result, "-o");
+    strLstAddZ(result, "LogLevel=error");
+    strLstAddZ(result, "-o");
+    strLstAddZ(result, "Compression=no");
+    strLstAddZ(result, "-o");
+    strLstAddZ(result, "PasswordAuthentication=no");
+
+    // Append port if specified
+    ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort + hostIdx;
+
+    if (cfgOptionTest(optHostPort))
+    {
+        strLstAddZ(result, "-p");
+        strLstAdd(result, strNewFmt("%u", cfgOptionUInt(optHostPort)));
+    }
+
+    // Append user/host
+    strLstAdd(
+        result,
+        strNewFmt(
+            "%s@%s", strPtr(cfgOptionStr(isRepo ? cfgOptRepoHostUser : cfgOptPgHostUser + hostIdx)),
+            strPtr(cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx))));
+
+    // Append the remote command
+    StringList *commandExec = protocolRemoteExecParam(protocolStorageType, protocolId, hostIdx);
     strLstInsert(commandExec, 0, cfgOptionStr(isRepo ? cfgOptRepoHostCmd : cfgOptPgHostCmd + hostIdx));
     strLstAdd(result, strLstJoin(commandExec, " "));
 
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
+/***********************************************************************************************************************************
+Connect to the TLS server on the remote host and have it start the remote
+
+The remote command parameters are sent as a JSON array on a single line.  The server replies with an empty object once the remote
+has started or with an error in the same format used by the protocol.
+***********************************************************************************************************************************/
+static TlsClient *
+protocolRemoteTls(ProtocolStorageType protocolStorageType, unsigned int protocolId, unsigned int hostIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, protocolId);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+    FUNCTION_LOG_END();
+
+    // Is this a repo remote?
+    bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+    TlsClient *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Use the TLS server default port if the port is not specified
+        ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort + hostIdx;
+        unsigned int port = cfgOptionTest(optHostPort) ?
+            cfgOptionUInt(optHostPort) : cvtZToUInt(cfgDefOptionDefault(cfgDefCmdServer, cfgDefOptTlsServerPort));
+
+        // Connect to the server
+        const String *host = cfgOptionStr(isRepo ? cfgOptRepoHost : cfgOptPgHost + hostIdx);
+
+        result = tlsClientNew(
+            host, port, (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000), true,
+            cfgOptionStr(isRepo ? cfgOptRepoHostCaFile : cfgOptPgHostCaFile + hostIdx),
+            cfgOptionStr(isRepo ? cfgOptRepoHostCaPath : cfgOptPgHostCaPath + hostIdx),
+            cfgOptionStr(isRepo ? cfgOptRepoHostCertFile : cfgOptPgHostCertFile + hostIdx),
+            cfgOptionStr(isRepo ? cfgOptRepoHostKeyFile : cfgOptPgHostKeyFile + hostIdx));
+        tlsClientOpen(result);
+
+        // Send the remote command parameters
+        ioWriteStrLine(
+            tlsClientIoWrite(result),
+            jsonFromVar(varNewVarLst(varLstNewStrLst(protocolRemoteExecParam(protocolStorageType, protocolId, hostIdx))), 0));
+        ioWriteFlush(tlsClientIoWrite(result));
+
+        // Throw the error if the server could not start the remote
+        KeyValue *response = jsonToKv(ioReadLine(tlsClientIoRead(result)));
+        const Variant *error = kvGet(response, VARSTR(PROTOCOL_ERROR_STR));
+
+        if (error != NULL)
+        {
+            THROWP_FMT(
+                errorTypeFromCode(varIntForce(error)), "unable to start remote on '%s:%u': %s", strPtr(host), port,
+                strPtr(varStr(kvGet(response, VARSTR(PROTOCOL_OUTPUT_STR)))));
+        }
+
+        tlsClientMove(result, MEM_CONTEXT_OLD());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(TLS_CLIENT, result);
+}
+
 /***********************************************************************************************************************************
 Get the remote protocol client
 ***********************************************************************************************************************************/
@@ -361,18 +469,33 @@ protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId)
         MEM_CONTEXT_BEGIN(protocolHelper.memContext)
         {
             unsigned int optHost = isRepo ? cfgOptRepoHost : cfgOptPgHost + hostId - 1;
+            const String *name = strNewFmt(
+                PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", protocolId, strPtr(cfgOptionStr(optHost)));
 
-            // Execute the protocol command
-            protocolHelperClient->exec = execNew(
-                cfgOptionStr(cfgOptCmdSsh), protocolRemoteParam(protocolStorageType, protocolId, hostId - 1),
-                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", protocolId, strPtr(cfgOptionStr(optHost))),
-                (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
-            execOpen(protocolHelperClient->exec);
+            // Connect to the TLS server, which will start the remote
+            if (protocolRemoteIsTls(protocolStorageType, hostId - 1))
+            {
+                protocolHelperClient->tlsClient = protocolRemoteTls(protocolStorageType, protocolId, hostId - 1);
 
-            // Create protocol object
-            protocolHelperClient->client = protocolClientNew(
-                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", protocolId, strPtr(cfgOptionStr(optHost))),
-                PROTOCOL_SERVICE_REMOTE_STR, execIoRead(protocolHelperClient->exec), execIoWrite(protocolHelperClient->exec));
+                // Create protocol object
+                protocolHelperClient->client = protocolClientNew(
+                    name, PROTOCOL_SERVICE_REMOTE_STR, tlsClientIoRead(protocolHelperClient->tlsClient),
+                    tlsClientIoWrite(protocolHelperClient->tlsClient));
+            }
+            // Else execute the protocol command via ssh
+            else
+            {
+                protocolHelperClient->exec = execNew(
+                    cfgOptionStr(cfgOptCmdSsh), protocolRemoteParam(protocolStorageType, protocolId, hostId - 1),
+                    strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", protocolId, strPtr(cfgOptionStr(optHost))),
+                    (TimeMSec)(cfgOptionDbl(cfgOptProtocolTimeout) * 1000));
+                execOpen(protocolHelperClient->exec);
+
+                // Create protocol object
+                protocolHelperClient->client = protocolClientNew(
+                    name, PROTOCOL_SERVICE_REMOTE_STR, execIoRead(protocolHelperClient->exec),
+                    execIoWrite(protocolHelperClient->exec));
+            }
 
             // Get cipher options from the remote if none are locally configured
             if (isRepo && strEq(cfgOptionStr(cfgOptRepoCipherType), CIPHER_TYPE_NONE_STR))
@@ -391,7 +514,10 @@ protocolRemoteGet(ProtocolStorageType protocolStorageType, unsigned int hostId)
                 }
             }
 
-            protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
+            // Free the protocol client with the exec it depends on.  The TLS client is not used since its session would be freed
+            // before the protocol client could send the exit command, so protocolFree() frees the protocol client first.
+            if (protocolHelperClient->exec != NULL)
+                protocolClientMove(protocolHelperClient->client, execMemContext(protocolHelperClient->exec));
         }
         MEM_CONTEXT_END();
     }
@@ -438,9 +564,11 @@ protocolFree(void)
             {
                 protocolClientFree(protocolHelperClient->client);
                 execFree(protocolHelperClient->exec);
+                tlsClientFree(protocolHelperClient->tlsClient);
 
                 protocolHelperClient->client = NULL;
                 protocolHelperClient->exec = NULL;
+                protocolHelperClient->tlsClient = NULL;
             }
         }
 
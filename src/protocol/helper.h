@@ -23,6 +23,9 @@ Constants
 #define PROTOCOL_SERVICE_REMOTE                                     "remote"
     STRING_DECLARE(PROTOCOL_SERVICE_REMOTE_STR);
 
+#define PROTOCOL_HOST_TYPE_TLS                                      "tls"
+    STRING_DECLARE(PROTOCOL_HOST_TYPE_TLS_STR);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
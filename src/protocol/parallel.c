@@ -3,19 +3,27 @@ Protocol Parallel Executor
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <errno.h>
+#include <poll.h>
 #include <string.h>
-#include <sys/select.h>
 
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/object.h"
+#include "common/stat.h"
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
 #include "common/type/list.h"
 #include "protocol/command.h"
 #include "protocol/parallel.h"
 
+/***********************************************************************************************************************************
+Statistics
+***********************************************************************************************************************************/
+STRING_STATIC(PROTOCOL_PARALLEL_STAT_JOB_ERROR_STR,                 "parallel.job.error");
+STRING_STATIC(PROTOCOL_PARALLEL_STAT_JOB_MS_STR,                    "parallel.job.ms");
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -28,6 +36,8 @@ struct ProtocolParallel
     List *jobList;                                                  // List of jobs to be processed
 
     ProtocolParallelJob **clientJobList;                            // Jobs being processing by each client
+    TimeMSec *clientJobTimeList;                                    // Time each client started processing its job
+    struct pollfd *clientPollList;                                  // Handles polled for each client
 
     ProtocolParallelJobState state;                                 // Overall state of job processing
 };
@@ -85,7 +95,8 @@ protocolParallelClientAdd(ProtocolParallel *this, ProtocolClient *client)
 }
 
 /***********************************************************************************************************************************
-Add job
+Add job.  Jobs may also be added while jobs are being processed so the queue can be refilled as results are collected, but not once
+all results have been collected and the executor is done.
 ***********************************************************************************************************************************/
 void
 protocolParallelJobAdd(ProtocolParallel *this, ProtocolParallelJob *job)
@@ -97,7 +108,7 @@ protocolParallelJobAdd(ProtocolParallel *this, ProtocolParallelJob *job)
 
     ASSERT(this != NULL);
     ASSERT(job != NULL);
-    ASSERT(this->state == protocolParallelJobStatePending);
+    ASSERT(this->state != protocolParallelJobStateDone);
 
     protocolParallelJobMove(job, lstMemContext(this->jobList));
     lstAdd(this->jobList, &job);
@@ -126,29 +137,25 @@ protocolParallelProcess(ProtocolParallel *this)
         MEM_CONTEXT_BEGIN(this->memContext)
         {
             this->clientJobList = (ProtocolParallelJob **)memNew(sizeof(ProtocolParallelJob *) * lstSize(this->clientList));
+            this->clientJobTimeList = (TimeMSec *)memNew(sizeof(TimeMSec) * lstSize(this->clientList));
+            this->clientPollList = (struct pollfd *)memNew(sizeof(struct pollfd) * lstSize(this->clientList));
         }
         MEM_CONTEXT_END();
 
         this->state = protocolParallelJobStateRunning;
     }
 
-    // Initialize the file descriptor set used for select
-    fd_set selectSet;
-    FD_ZERO(&selectSet);
-    int handleMax = -1;
-
-    // Find clients that are running jobs
+    // Find clients that are running jobs.  Clients that are not running jobs are given a negative handle so poll() ignores them.
     unsigned int clientRunningTotal = 0;
 
     for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
     {
+        this->clientPollList[clientIdx] = (struct pollfd){.fd = -1, .events = POLLIN};
+
         if (this->clientJobList[clientIdx] != NULL)
         {
-            int handle = ioReadHandle(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx)));
-            FD_SET((unsigned int)handle, &selectSet);
-
-            // Find the max file handle needed for select()
-            MAX_ASSIGN(handleMax, handle);
+            this->clientPollList[clientIdx].fd = ioReadHandle(
+                protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx)));
 
             clientRunningTotal++;
         }
@@ -157,14 +164,27 @@ protocolParallelProcess(ProtocolParallel *this)
     // If clients are running then wait for one to finish
     if (clientRunningTotal > 0)
     {
-        // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
-        struct timeval timeoutSelect;
-        timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
-        timeoutSelect.tv_usec = (time_t)(this->timeout % MSEC_PER_SEC * 1000);
+        // Determine if there is data to be read.  Use poll() since it does not limit the value of the handles like select() does.
+        // Retry if interrupted by a signal, which may extend the timeout but is simpler than tracking the time remaining.
+        int completed;
+
+        do
+        {
+            completed = poll(this->clientPollList, lstSize(this->clientList), (int)this->timeout);
+        }
+        while (completed == -1 && errno == EINTR);
+
+        // An invalid handle is reported in the returned events rather than as an error
+        for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+        {
+            if (this->clientPollList[clientIdx].revents & POLLNVAL)
+            {
+                completed = -1;
+                errno = EBADF;
+            }
+        }
 
-        // Determine if there is data to be read
-        int completed = select(handleMax + 1, &selectSet, NULL, NULL, &timeoutSelect);
-        THROW_ON_SYS_ERROR(completed == -1, AssertError, "unable to select from parallel client(s)");
+        THROW_ON_SYS_ERROR(completed == -1, AssertError, "unable to poll parallel client(s)");
 
         // If any jobs have completed then get the results
         if (completed > 0)
@@ -173,10 +193,7 @@ protocolParallelProcess(ProtocolParallel *this)
             {
                 ProtocolParallelJob *job = this->clientJobList[clientIdx];
 
-                if (job != NULL &&
-                    FD_ISSET(
-                        (unsigned int)ioReadHandle(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx))),
-                        &selectSet))
+                if (job != NULL && this->clientPollList[clientIdx].revents != 0)
                 {
                     MEM_CONTEXT_TEMP_BEGIN()
                     {
@@ -188,9 +205,11 @@ protocolParallelProcess(ProtocolParallel *this)
                         CATCH_ANY()
                         {
                             protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
+                            statInc(PROTOCOL_PARALLEL_STAT_JOB_ERROR_STR);
                         }
                         TRY_END();
 
+                        statTimeAdd(PROTOCOL_PARALLEL_STAT_JOB_MS_STR, this->clientJobTimeList[clientIdx]);
                         protocolParallelJobStateSet(job, protocolParallelJobStateDone);
                         this->clientJobList[clientIdx] = NULL;
                     }
@@ -220,6 +239,7 @@ protocolParallelProcess(ProtocolParallel *this)
                     protocolParallelJobProcessIdSet(job, clientIdx + 1);
                     protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
                     this->clientJobList[clientIdx] = job;
+                    this->clientJobTimeList[clientIdx] = timeMSec();
 
                     break;
                 }
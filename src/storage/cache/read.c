@@ -0,0 +1,259 @@
+/***********************************************************************************************************************************
+Cache Storage Read
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/debug.h"
+#include "common/io/read.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "storage/cache/read.h"
+#include "storage/read.intern.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define STORAGE_READ_CACHE_TYPE                                     StorageReadCache
+#define STORAGE_READ_CACHE_PREFIX                                   storageReadCache
+
+typedef struct StorageReadCache
+{
+    MemContext *memContext;                                         // Object mem context
+    StorageReadInterface interface;                                 // Interface
+    StorageCache *storage;                                          // Storage that created this object
+
+    StorageRead *read;                                              // Read from the wrapped storage
+    StorageRead *cacheRead;                                         // Read from the cache when the file is cached
+    StorageWrite *cacheWrite;                                       // Write to the cache when the file is not cached
+    String *cacheNameTmp;                                           // Temp file name so it can be removed if the read fails
+} StorageReadCache;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_READ_CACHE_TYPE                                                                                       \
+    StorageReadCache *
+#define FUNCTION_LOG_STORAGE_READ_CACHE_FORMAT(value, buffer, bufferSize)                                                          \
+    objToLog(value, "StorageReadCache", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Remove the cache temp file when the read is not completed
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(STORAGE_READ_CACHE, LOG, logLevelTrace)
+{
+    storageCacheWriteAbort(this->storage, this->cacheNameTmp);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Open the file
+***********************************************************************************************************************************/
+static bool
+storageReadCacheOpen(THIS_VOID)
+{
+    THIS(StorageReadCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_CACHE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->cacheRead == NULL && this->cacheWrite == NULL);
+
+    bool result = true;
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        // Read from the cache if the file is cached
+        this->cacheRead = storageCacheReadOpen(this->storage, this->interface.name);
+
+        // Else read from the wrapped storage and cache the file as it is read
+        if (this->cacheRead == NULL)
+        {
+            result = ioReadOpen(storageReadIo(this->read));
+
+            if (result)
+            {
+                this->cacheWrite = storageCacheWriteOpen(this->storage, this->interface.name);
+
+                if (this->cacheWrite != NULL)
+                {
+                    this->cacheNameTmp = strDup(storageWriteName(this->cacheWrite));
+                    memContextCallbackSet(this->memContext, storageReadCacheFreeResource, this);
+                }
+            }
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/***********************************************************************************************************************************
+Read from a file
+***********************************************************************************************************************************/
+static size_t
+storageReadCache(THIS_VOID, Buffer *buffer, bool block)
+{
+    THIS(StorageReadCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_CACHE, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+        FUNCTION_LOG_PARAM(BOOL, block);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL && !bufFull(buffer));
+
+    size_t result = 0;
+
+    if (this->cacheRead != NULL)
+        result = ioRead(storageReadIo(this->cacheRead), buffer);
+    else
+    {
+        size_t bufferUsed = bufUsed(buffer);
+        result = ioRead(storageReadIo(this->read), buffer);
+
+        // Write the bytes that were just read to the cache
+        if (this->cacheWrite != NULL && result > 0)
+        {
+            this->cacheWrite = storageCacheWrite(
+                this->storage, this->cacheWrite, BUF(bufPtr(buffer) + bufferUsed, bufUsed(buffer) - bufferUsed));
+
+            if (this->cacheWrite == NULL)
+                memContextCallbackClear(this->memContext);
+        }
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
+/***********************************************************************************************************************************
+Close the file
+***********************************************************************************************************************************/
+static void
+storageReadCacheClose(THIS_VOID)
+{
+    THIS(StorageReadCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_CACHE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    if (this->cacheRead != NULL)
+    {
+        ioReadClose(storageReadIo(this->cacheRead));
+        storageReadFree(this->cacheRead);
+        this->cacheRead = NULL;
+    }
+    else
+    {
+        bool eof = ioReadEof(storageReadIo(this->read));
+
+        ioReadClose(storageReadIo(this->read));
+
+        // Only cache the file if it was read completely
+        if (this->cacheWrite != NULL)
+        {
+            memContextCallbackClear(this->memContext);
+
+            if (eof)
+                storageCacheWriteClose(this->storage, this->cacheWrite, this->interface.name);
+            else
+            {
+                storageWriteFree(this->cacheWrite);
+                storageCacheWriteAbort(this->storage, this->cacheNameTmp);
+            }
+
+            this->cacheWrite = NULL;
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Has file reached EOF?
+***********************************************************************************************************************************/
+static bool
+storageReadCacheEof(THIS_VOID)
+{
+    THIS(StorageReadCache);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_READ_CACHE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(ioReadEof(storageReadIo(this->cacheRead != NULL ? this->cacheRead : this->read)));
+}
+
+/***********************************************************************************************************************************
+Create a new file
+***********************************************************************************************************************************/
+StorageRead *
+storageReadCacheNew(StorageCache *storage, const String *name, bool ignoreMissing, bool compressible)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, storage);
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(BOOL, compressible);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(name != NULL);
+
+    StorageRead *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StorageReadCache")
+    {
+        StorageReadCache *driver = memNew(sizeof(StorageReadCache));
+        driver->memContext = MEM_CONTEXT_NEW();
+
+        driver->storage = storage;
+        driver->read = storageInterface(storageCacheStorage(storage)).newRead(
+            storageDriver(storageCacheStorage(storage)), name, ignoreMissing, compressible);
+
+        driver->interface = (StorageReadInterface)
+        {
+            .type = storageReadType(driver->read),
+            .name = strDup(name),
+            .compressible = compressible,
+            .ignoreMissing = ignoreMissing,
+
+            .ioInterface = (IoReadInterface)
+            {
+                .close = storageReadCacheClose,
+                .eof = storageReadCacheEof,
+                .open = storageReadCacheOpen,
+                .read = storageReadCache,
+            },
+        };
+
+        this = storageReadNew(driver, &driver->interface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_READ, this);
+}
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+StorageRead *
+storageReadCacheRead(const StorageRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(((StorageReadCache *)storageRead(this))->read);
+}
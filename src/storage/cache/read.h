@@ -0,0 +1,21 @@
+/***********************************************************************************************************************************
+Cache Storage Read
+***********************************************************************************************************************************/
+#ifndef STORAGE_CACHE_READ_H
+#define STORAGE_CACHE_READ_H
+
+#include "storage/cache/storage.intern.h"
+#include "storage/read.h"
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+StorageRead *storageReadCacheNew(StorageCache *storage, const String *name, bool ignoreMissing, bool compressible);
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+// Read object for the wrapped storage, used to move files
+StorageRead *storageReadCacheRead(const StorageRead *this);
+
+#endif
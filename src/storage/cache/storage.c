@@ -0,0 +1,892 @@
+/***********************************************************************************************************************************
+Cache Storage
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "common/regExp.h"
+#include "common/stat.h"
+#include "common/type/list.h"
+#include "storage/cache/read.h"
+#include "storage/cache/storage.intern.h"
+#include "storage/cache/write.h"
+#include "storage/posix/storage.h"
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+STRING_STATIC(STORAGE_CACHE_STAT_HIT_STR,                           "storage.cache.hit");
+STRING_STATIC(STORAGE_CACHE_STAT_MISS_STR,                          "storage.cache.miss");
+STRING_STATIC(STORAGE_CACHE_STAT_STALE_STR,                         "storage.cache.stale");
+STRING_STATIC(STORAGE_CACHE_STAT_REMOVE_STR,                        "storage.cache.remove");
+
+/***********************************************************************************************************************************
+When the cache is pruned files are removed until the cache is this percentage of the maximum size so the cache is not pruned again
+for every new file
+***********************************************************************************************************************************/
+#define STORAGE_CACHE_PRUNE_PERCENT                                 90
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct StorageCache
+{
+    MemContext *memContext;                                         // Object memory context
+    const Storage *storage;                                         // Wrapped storage
+    Storage *cache;                                                 // Local storage where files are cached
+    uint64_t cacheSizeMax;                                          // Maximum size of the cache
+    const StringList *excludeList;                                  // Files beginning with these names are not cached
+    RegExp *immutableRegExp;                                        // Files matching are not checked against the wrapped storage
+
+    bool cacheSizeLoaded;                                           // Has the cache size been loaded?
+    uint64_t cacheSize;                                             // Estimated size of the cache
+};
+
+/***********************************************************************************************************************************
+Get the name of a file in the cache, or NULL if the file is not cacheable
+***********************************************************************************************************************************/
+static String *
+storageCacheName(const StorageCache *this, const String *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_CACHE, this);
+        FUNCTION_TEST_PARAM(STRING, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+    ASSERT(strBeginsWithZ(file, "/"));
+
+    String *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *fileName = strBase(file);
+        bool exclude = strSize(file) == 1;
+
+        for (unsigned int excludeIdx = 0; excludeIdx < strLstSize(this->excludeList) && !exclude; excludeIdx++)
+            exclude = strBeginsWith(fileName, strLstGet(this->excludeList, excludeIdx));
+
+        if (!exclude)
+        {
+            memContextSwitch(MEM_CONTEXT_OLD());
+            result = strSub(file, 1);
+            memContextSwitch(MEM_CONTEXT_TEMP());
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Remove a file from the cache.  Errors are logged as warnings since a file that cannot be removed will eventually be pruned.
+***********************************************************************************************************************************/
+static void
+storageCacheRemoveFile(StorageCache *this, const String *file)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *name = storageCacheName(this, file);
+
+        if (name != NULL)
+        {
+            TRY_BEGIN()
+            {
+                storageRemoveNP(this->cache, name);
+            }
+            CATCH_ANY()
+            {
+                LOG_WARN("unable to remove '%s' from cache: %s", strPtr(name), errorMessage());
+            }
+            TRY_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Set the times of a cached file
+
+The access time is the time the file was last used, which is how the least recently used files are found.  The modification time is
+the modification time of the wrapped file so a cached file can be checked against the wrapped file before it is used.
+***********************************************************************************************************************************/
+static void
+storageCacheTimeSet(StorageCache *this, const String *name, time_t timeModified)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_CACHE, this);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(INT64, timeModified);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(name != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *fileCache = storagePathNP(this->cache, name);
+        struct utimbuf timeBuf = {.actime = time(NULL), .modtime = timeModified};
+
+        THROW_ON_SYS_ERROR_FMT(
+            utime(strPtr(fileCache), &timeBuf) == -1, FileInfoError, "unable to set time for '%s'", strPtr(fileCache));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Load the list of cached files, sorted from least to most recently used
+***********************************************************************************************************************************/
+typedef struct StorageCacheFile
+{
+    const String *name;                                             // Name relative to the cache path
+    time_t timeAccessed;                                            // Time last used
+    uint64_t size;                                                  // File size
+} StorageCacheFile;
+
+typedef struct StorageCacheFileListData
+{
+    const Storage *cache;                                           // Cache storage
+    List *fileList;                                                 // List of cached files
+} StorageCacheFileListData;
+
+static int
+storageCacheFileComparator(const void *item1, const void *item2)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, item1);
+        FUNCTION_TEST_PARAM_P(VOID, item2);
+    FUNCTION_TEST_END();
+
+    ASSERT(item1 != NULL);
+    ASSERT(item2 != NULL);
+
+    const StorageCacheFile *file1 = item1;
+    const StorageCacheFile *file2 = item2;
+
+    int result = file1->timeAccessed < file2->timeAccessed ? -1 : file1->timeAccessed > file2->timeAccessed ? 1 : 0;
+
+    // Sort by name when the times are equal so the order is deterministic
+    if (result == 0)
+        result = strCmp(file1->name, file2->name);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+static void
+storageCacheFileListCallback(void *data, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(info != NULL);
+
+    // Temp files are skipped since they are still being written
+    if (info->type == storageTypeFile && !strEndsWithZ(info->name, "." STORAGE_FILE_TEMP_EXT))
+    {
+        StorageCacheFileListData *listData = data;
+
+        MEM_CONTEXT_BEGIN(lstMemContext(listData->fileList))
+        {
+            StorageCacheFile file = {.name = strDup(info->name), .size = info->size};
+
+            // The access time is not part of the storage info.  A file removed by another process since it was listed keeps an
+            // access time of zero so it sorts first and removing it again does nothing.
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                struct stat statFile = {0};
+                stat(strPtr(storagePathNP(listData->cache, info->name)), &statFile);
+
+                file.timeAccessed = statFile.st_atime;
+            }
+            MEM_CONTEXT_TEMP_END();
+
+            lstAdd(listData->fileList, &file);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static List *
+storageCacheFileList(StorageCache *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    List *result = lstNewP(sizeof(StorageCacheFile), .comparator = storageCacheFileComparator);
+
+    StorageCacheFileListData data = {.cache = this->cache, .fileList = result};
+
+    storageInfoListP(this->cache, NULL, storageCacheFileListCallback, &data, .recurse = true);
+    lstSort(result, sortOrderAsc);
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
+/***********************************************************************************************************************************
+Add a file to the cache size and remove the least recently used files when the cache is too large
+
+The size is only an estimate since other processes may be adding and removing files, so the cache is scanned again before files are
+removed.
+***********************************************************************************************************************************/
+static void
+storageCacheSizeAdd(StorageCache *this, uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Load the cache size the first time it is needed
+        if (!this->cacheSizeLoaded)
+        {
+            const List *fileList = storageCacheFileList(this);
+
+            for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+                this->cacheSize += ((const StorageCacheFile *)lstGet(fileList, fileIdx))->size;
+
+            this->cacheSizeLoaded = true;
+        }
+        else
+            this->cacheSize += size;
+
+        // Remove the least recently used files when the cache is too large
+        if (this->cacheSize > this->cacheSizeMax)
+        {
+            const List *fileList = storageCacheFileList(this);
+            uint64_t cacheSizeTarget = this->cacheSizeMax - this->cacheSizeMax / 100 * (100 - STORAGE_CACHE_PRUNE_PERCENT);
+
+            this->cacheSize = 0;
+
+            for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+                this->cacheSize += ((const StorageCacheFile *)lstGet(fileList, fileIdx))->size;
+
+            for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList) && this->cacheSize > cacheSizeTarget; fileIdx++)
+            {
+                const StorageCacheFile *file = lstGet(fileList, fileIdx);
+
+                LOG_DETAIL("remove '%s' from cache", strPtr(file->name));
+
+                storageRemoveNP(this->cache, file->name);
+                statInc(STORAGE_CACHE_STAT_REMOVE_STR);
+
+                this->cacheSize -= file->size;
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+StorageRead *
+storageCacheReadOpen(StorageCache *this, const String *file)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    StorageRead *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *name = storageCacheName(this, file);
+
+        if (name != NULL)
+        {
+            TRY_BEGIN()
+            {
+                StorageInfo info = storageInfoP(this->cache, name, .ignoreMissing = true);
+
+                if (info.exists)
+                {
+                    // Immutable files are used without a request to the wrapped storage.  Other files are only used when the size
+                    // and modification time match the wrapped file since the wrapped file may have been replaced or removed by a
+                    // process that does not use this cache.
+                    bool current = this->immutableRegExp != NULL && regExpMatch(this->immutableRegExp, file);
+
+                    if (!current)
+                    {
+                        StorageInfo infoWrapped = storageInterface(this->storage).info(storageDriver(this->storage), file, true);
+                        current =
+                            infoWrapped.exists && infoWrapped.size == info.size && infoWrapped.timeModified == info.timeModified;
+                    }
+
+                    if (current)
+                    {
+                        StorageRead *read = storageNewReadNP(this->cache, name);
+                        ioReadOpen(storageReadIo(read));
+
+                        // Update the access time so the file is not pruned while it is in use
+                        storageCacheTimeSet(this, name, info.timeModified);
+
+                        statInc(STORAGE_CACHE_STAT_HIT_STR);
+                        result = storageReadMove(read, MEM_CONTEXT_OLD());
+                    }
+                    else
+                    {
+                        LOG_DETAIL("remove changed '%s' from cache", strPtr(name));
+
+                        storageRemoveNP(this->cache, name);
+                        statInc(STORAGE_CACHE_STAT_STALE_STR);
+                    }
+                }
+
+                if (result == NULL)
+                    statInc(STORAGE_CACHE_STAT_MISS_STR);
+            }
+            CATCH_ANY()
+            {
+                LOG_WARN("unable to read '%s' from cache: %s", strPtr(name), errorMessage());
+            }
+            TRY_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_READ, result);
+}
+
+/**********************************************************************************************************************************/
+StorageWrite *
+storageCacheWriteOpen(StorageCache *this, const String *file)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    StorageWrite *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *name = storageCacheName(this, file);
+
+        if (name != NULL)
+        {
+            TRY_BEGIN()
+            {
+                // The temp file includes the process id since the cache may be shared with other processes.  The file does not need
+                // to be synced since a partial file can only be left by a system crash and the wrapped storage has the original.
+                StorageWrite *write = storageNewWriteP(
+                    this->cache, strNewFmt("%s.%d." STORAGE_FILE_TEMP_EXT, strPtr(name), getpid()), .noAtomic = true,
+                    .noSyncFile = true, .noSyncPath = true);
+
+                ioWriteOpen(storageWriteIo(write));
+
+                result = storageWriteMove(write, MEM_CONTEXT_OLD());
+            }
+            CATCH_ANY()
+            {
+                LOG_WARN("unable to write '%s' to cache: %s", strPtr(name), errorMessage());
+            }
+            TRY_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_WRITE, result);
+}
+
+/**********************************************************************************************************************************/
+StorageWrite *
+storageCacheWrite(StorageCache *this, StorageWrite *write, const Buffer *buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, write);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(write != NULL);
+    ASSERT(buffer != NULL);
+
+    StorageWrite *result = write;
+
+    TRY_BEGIN()
+    {
+        ioWrite(storageWriteIo(write), buffer);
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN("unable to write '%s' to cache: %s", strPtr(storageWriteName(write)), errorMessage());
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const String *nameTmp = strDup(storageWriteName(write));
+
+            storageWriteFree(write);
+            storageCacheWriteAbort(this, nameTmp);
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        result = NULL;
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_WRITE, result);
+}
+
+/**********************************************************************************************************************************/
+void
+storageCacheWriteClose(StorageCache *this, StorageWrite *write, const String *file)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, write);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(write != NULL);
+    ASSERT(file != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *nameTmp = strDup(storageWriteName(write));
+
+        TRY_BEGIN()
+        {
+            ioWriteClose(storageWriteIo(write));
+            storageWriteFree(write);
+
+            // Only cache the file when it matches the wrapped file, which may have been replaced while it was being read.  The
+            // modification time of the wrapped file is copied to the temp file so it is in place as soon as the file is moved.
+            StorageInfo infoWrapped = storageInterface(this->storage).info(storageDriver(this->storage), file, true);
+            uint64_t size = storageInfoNP(this->cache, nameTmp).size;
+
+            if (infoWrapped.exists && infoWrapped.size == size)
+            {
+                storageCacheTimeSet(this, nameTmp, infoWrapped.timeModified);
+
+                // Move the temp file into place.  If another process cached the same file in the meantime it will be replaced.
+                storageMoveNP(
+                    this->cache, storageNewReadNP(this->cache, nameTmp),
+                    storageNewWriteP(
+                        this->cache, storageCacheName(this, file), .noSyncFile = true, .noSyncPath = true, .noAtomic = true));
+
+                storageCacheSizeAdd(this, size);
+            }
+            else
+                storageCacheWriteAbort(this, nameTmp);
+        }
+        CATCH_ANY()
+        {
+            LOG_WARN("unable to write '%s' to cache: %s", strPtr(nameTmp), errorMessage());
+            storageCacheWriteAbort(this, nameTmp);
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storageCacheWriteAbort(StorageCache *this, const String *nameTmp)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, nameTmp);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(nameTmp != NULL);
+
+    TRY_BEGIN()
+    {
+        storageRemoveNP(this->cache, nameTmp);
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN("unable to remove '%s' from cache: %s", strPtr(nameTmp), errorMessage());
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Functions that are passed to the wrapped storage
+***********************************************************************************************************************************/
+static bool
+storageCacheExists(THIS_VOID, const String *file)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, storageInterface(this->storage).exists(storageDriver(this->storage), file));
+}
+
+static StorageInfo
+storageCacheInfo(THIS_VOID, const String *file, bool followLink)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(BOOL, followLink);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_LOG_RETURN(STORAGE_INFO, storageInterface(this->storage).info(storageDriver(this->storage), file, followLink));
+}
+
+static bool
+storageCacheInfoList(THIS_VOID, const String *path, StorageInfoListCallback callback, void *callbackData)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+    ASSERT(callback != NULL);
+
+    FUNCTION_LOG_RETURN(
+        BOOL, storageInterface(this->storage).infoList(storageDriver(this->storage), path, callback, callbackData));
+}
+
+static bool
+storageCacheInfoListRecurse(THIS_VOID, const String *path, StorageInfoListCallback callback, void *callbackData)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+    ASSERT(callback != NULL);
+
+    FUNCTION_LOG_RETURN(
+        BOOL, storageInterface(this->storage).infoListRecurse(storageDriver(this->storage), path, callback, callbackData));
+}
+
+static StringList *
+storageCacheList(THIS_VOID, const String *path, const String *expression)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(STRING, expression);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+
+    FUNCTION_LOG_RETURN(STRING_LIST, storageInterface(this->storage).list(storageDriver(this->storage), path, expression));
+}
+
+static bool
+storageCacheMove(THIS_VOID, StorageRead *source, StorageWrite *destination)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STORAGE_READ, source);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(source != NULL);
+    ASSERT(destination != NULL);
+
+    // The cached copies are removed rather than moved since the file is not read or written
+    storageCacheRemoveFile(this, storageReadName(source));
+    storageCacheRemoveFile(this, storageWriteName(destination));
+
+    FUNCTION_LOG_RETURN(
+        BOOL,
+        storageInterface(this->storage).move(
+            storageDriver(this->storage), storageReadCacheRead(source), storageWriteCacheWrite(destination)));
+}
+
+static StorageRead *
+storageCacheNewRead(THIS_VOID, const String *file, bool ignoreMissing, bool compressible)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(BOOL, compressible);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadCacheNew(this, file, ignoreMissing, compressible));
+}
+
+static StorageWrite *
+storageCacheNewWrite(
+    THIS_VOID, const String *file, mode_t modeFile, mode_t modePath, const String *user, const String *group, time_t timeModified,
+    bool createPath, bool syncFile, bool syncPath, bool atomic, bool compressible)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(MODE, modeFile);
+        FUNCTION_LOG_PARAM(MODE, modePath);
+        FUNCTION_LOG_PARAM(STRING, user);
+        FUNCTION_LOG_PARAM(STRING, group);
+        FUNCTION_LOG_PARAM(INT64, timeModified);
+        FUNCTION_LOG_PARAM(BOOL, createPath);
+        FUNCTION_LOG_PARAM(BOOL, syncFile);
+        FUNCTION_LOG_PARAM(BOOL, syncPath);
+        FUNCTION_LOG_PARAM(BOOL, atomic);
+        FUNCTION_LOG_PARAM(BOOL, compressible);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_LOG_RETURN(
+        STORAGE_WRITE,
+        storageWriteCacheNew(
+            this, file, modeFile, modePath, user, group, timeModified, createPath, syncFile, syncPath, atomic, compressible));
+}
+
+static void
+storageCachePathCreate(THIS_VOID, const String *path, bool errorOnExists, bool noParentCreate, mode_t mode)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(BOOL, errorOnExists);
+        FUNCTION_LOG_PARAM(BOOL, noParentCreate);
+        FUNCTION_LOG_PARAM(MODE, mode);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+
+    storageInterface(this->storage).pathCreate(storageDriver(this->storage), path, errorOnExists, noParentCreate, mode);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+static bool
+storageCachePathExists(THIS_VOID, const String *path)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, storageInterface(this->storage).pathExists(storageDriver(this->storage), path));
+}
+
+static bool
+storageCachePathRemove(THIS_VOID, const String *path, bool recurse)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(BOOL, recurse);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+
+    bool result = storageInterface(this->storage).pathRemove(storageDriver(this->storage), path, recurse);
+
+    // Remove the path from the cache.  The path is always removed recursively since files may be cached that were removed from the
+    // wrapped storage by another process.
+    TRY_BEGIN()
+    {
+        storagePathRemoveP(this->cache, strSize(path) == 1 ? NULL : strSub(path, 1), .recurse = true);
+    }
+    CATCH_ANY()
+    {
+        LOG_WARN("unable to remove '%s' from cache: %s", strPtr(path), errorMessage());
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+static void
+storageCachePathSync(THIS_VOID, const String *path)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+
+    storageInterface(this->storage).pathSync(storageDriver(this->storage), path);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+static void
+storageCacheRemove(THIS_VOID, const String *file, bool errorOnMissing)
+{
+    THIS(StorageCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, this);
+        FUNCTION_LOG_PARAM(STRING, file);
+        FUNCTION_LOG_PARAM(BOOL, errorOnMissing);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(file != NULL);
+
+    storageInterface(this->storage).remove(storageDriver(this->storage), file, errorOnMissing);
+    storageCacheRemoveFile(this, file);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+Storage *
+storageCacheNew(
+    const Storage *storage, const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction,
+    const String *cachePath, uint64_t cacheSizeMax, const StringList *excludeList, const String *immutableExpression)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(BOOL, write);
+        FUNCTION_LOG_PARAM(FUNCTIONP, pathExpressionFunction);
+        FUNCTION_LOG_PARAM(STRING, cachePath);
+        FUNCTION_LOG_PARAM(UINT64, cacheSizeMax);
+        FUNCTION_LOG_PARAM(STRING_LIST, excludeList);
+        FUNCTION_LOG_PARAM(STRING, immutableExpression);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(storageInterface(storage).info != NULL);
+    ASSERT(path != NULL);
+    ASSERT(cachePath != NULL);
+    ASSERT(cacheSizeMax > 0);
+
+    Storage *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StorageCache")
+    {
+        StorageCache *driver = memNew(sizeof(StorageCache));
+        driver->memContext = MEM_CONTEXT_NEW();
+
+        driver->storage = storage;
+        driver->cache = storagePosixNew(cachePath, STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+        driver->cacheSizeMax = cacheSizeMax;
+        driver->excludeList = excludeList == NULL ? strLstNew() : strLstDup(excludeList);
+        driver->immutableRegExp = immutableExpression == NULL ? NULL : regExpNew(immutableExpression);
+
+        // Optional functions are only set when the wrapped storage implements them so storage feature checks work the same
+        StorageInterface interface = storageInterface(storage);
+
+        this = storageNewP(
+            storageType(storage), path, STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, write, pathExpressionFunction,
+            driver, .feature = interface.feature, .exists = storageCacheExists,
+            .info = storageCacheInfo,
+            .infoList = interface.infoList == NULL ? NULL : storageCacheInfoList,
+            .infoListRecurse = interface.infoListRecurse == NULL ? NULL : storageCacheInfoListRecurse, .list = storageCacheList,
+            .move = interface.move == NULL ? NULL : storageCacheMove, .newRead = storageCacheNewRead,
+            .newWrite = storageCacheNewWrite, .pathCreate = interface.pathCreate == NULL ? NULL : storageCachePathCreate,
+            .pathExists = interface.pathExists == NULL ? NULL : storageCachePathExists, .pathRemove = storageCachePathRemove,
+            .pathSync = interface.pathSync == NULL ? NULL : storageCachePathSync, .remove = storageCacheRemove);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(STORAGE, this);
+}
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+const Storage *
+storageCacheStorage(const StorageCache *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_CACHE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->storage);
+}
@@ -0,0 +1,33 @@
+/***********************************************************************************************************************************
+Cache Storage
+
+Read-through cache in front of another storage driver, intended for object stores where every read is a network request.  Files
+that are read or written are also stored in a local path.  Later reads of files matching the immutable expression, which are never
+changed once written, are served from the local copy without a request to the wrapped storage.  Other files are served from the
+local copy when its size and modification time match the info from the wrapped storage, so a hit still costs an info request but
+the file is not transferred.  A cached file that does not match is removed and the file is read from the wrapped storage.  The
+cached file keeps the modification time of the wrapped file and the access time is updated on each read so other processes sharing
+the cache see the same recency.  When the cache grows past the maximum size the least recently used files are removed.
+
+The cache path must be specific to the wrapped storage since file names are stored as they are passed to the wrapped storage.
+
+All other operations are passed to the wrapped storage.  Files whose names begin with an entry in the exclude list are never cached,
+which should be used for files that are updated in place since a change within the same second that does not change the size will
+not be detected.  Errors writing to the cache are logged as warnings and do not affect the operation on the wrapped storage.
+***********************************************************************************************************************************/
+#ifndef STORAGE_CACHE_STORAGE_H
+#define STORAGE_CACHE_STORAGE_H
+
+#include "common/type/stringList.h"
+#include "storage/storage.intern.h"
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+// The type and features of the new storage are the same as the wrapped storage so the cache is transparent to callers.  The
+// immutable expression is matched against the full file name and may be NULL.
+Storage *storageCacheNew(
+    const Storage *storage, const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction,
+    const String *cachePath, uint64_t cacheSizeMax, const StringList *excludeList, const String *immutableExpression);
+
+#endif
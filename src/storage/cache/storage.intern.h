@@ -0,0 +1,47 @@
+/***********************************************************************************************************************************
+Cache Storage Internal
+***********************************************************************************************************************************/
+#ifndef STORAGE_CACHE_STORAGE_INTERN_H
+#define STORAGE_CACHE_STORAGE_INTERN_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StorageCache StorageCache;
+
+#include "storage/cache/storage.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Open a cached file for read.  Returns NULL if the file is not cacheable or is not in the cache.
+StorageRead *storageCacheReadOpen(StorageCache *this, const String *file);
+
+// Open a temp file to cache the file as it is read or written.  Returns NULL if the file is not cacheable or the temp file cannot
+// be opened.
+StorageWrite *storageCacheWriteOpen(StorageCache *this, const String *file);
+
+// Write to the temp file.  Returns NULL if the write failed, in which case the temp file has been removed.
+StorageWrite *storageCacheWrite(StorageCache *this, StorageWrite *write, const Buffer *buffer);
+
+// Close the temp file and move it into the cache
+void storageCacheWriteClose(StorageCache *this, StorageWrite *write, const String *file);
+
+// Remove a temp file that was not closed, e.g. because of an error reading or writing the wrapped file
+void storageCacheWriteAbort(StorageCache *this, const String *nameTmp);
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+// Wrapped storage
+const Storage *storageCacheStorage(const StorageCache *this);
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_CACHE_TYPE                                                                                            \
+    StorageCache *
+#define FUNCTION_LOG_STORAGE_CACHE_FORMAT(value, buffer, bufferSize)                                                               \
+    objToLog(value, "StorageCache", buffer, bufferSize)
+
+#endif
@@ -0,0 +1,216 @@
+/***********************************************************************************************************************************
+Cache Storage Write
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/debug.h"
+#include "common/io/write.intern.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/object.h"
+#include "storage/cache/write.h"
+#include "storage/write.intern.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+#define STORAGE_WRITE_CACHE_TYPE                                    StorageWriteCache
+#define STORAGE_WRITE_CACHE_PREFIX                                  storageWriteCache
+
+typedef struct StorageWriteCache
+{
+    MemContext *memContext;                                         // Object mem context
+    StorageWriteInterface interface;                                // Interface
+    StorageCache *storage;                                          // Storage that created this object
+
+    StorageWrite *write;                                            // Write to the wrapped storage
+    StorageWrite *cacheWrite;                                       // Write to the cache
+    String *cacheNameTmp;                                           // Temp file name so it can be removed if the write fails
+} StorageWriteCache;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_WRITE_CACHE_TYPE                                                                                      \
+    StorageWriteCache *
+#define FUNCTION_LOG_STORAGE_WRITE_CACHE_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(value, "StorageWriteCache", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Remove the cache temp file when the write is not completed
+***********************************************************************************************************************************/
+OBJECT_DEFINE_FREE_RESOURCE_BEGIN(STORAGE_WRITE_CACHE, LOG, logLevelTrace)
+{
+    storageCacheWriteAbort(this->storage, this->cacheNameTmp);
+}
+OBJECT_DEFINE_FREE_RESOURCE_END(LOG);
+
+/***********************************************************************************************************************************
+Open the file
+***********************************************************************************************************************************/
+static void
+storageWriteCacheOpen(THIS_VOID)
+{
+    THIS(StorageWriteCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_CACHE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->cacheWrite == NULL);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        ioWriteOpen(storageWriteIo(this->write));
+
+        this->cacheWrite = storageCacheWriteOpen(this->storage, this->interface.name);
+
+        if (this->cacheWrite != NULL)
+        {
+            this->cacheNameTmp = strDup(storageWriteName(this->cacheWrite));
+            memContextCallbackSet(this->memContext, storageWriteCacheFreeResource, this);
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write to the file
+***********************************************************************************************************************************/
+static void
+storageWriteCache(THIS_VOID, const Buffer *buffer)
+{
+    THIS(StorageWriteCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_CACHE, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL);
+
+    ioWrite(storageWriteIo(this->write), buffer);
+
+    if (this->cacheWrite != NULL)
+    {
+        this->cacheWrite = storageCacheWrite(this->storage, this->cacheWrite, buffer);
+
+        if (this->cacheWrite == NULL)
+            memContextCallbackClear(this->memContext);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Close the file.  The wrapped file is closed first so the file is only cached when the write succeeds.
+***********************************************************************************************************************************/
+static void
+storageWriteCacheClose(THIS_VOID)
+{
+    THIS(StorageWriteCache);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_CACHE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    ioWriteClose(storageWriteIo(this->write));
+
+    if (this->cacheWrite != NULL)
+    {
+        memContextCallbackClear(this->memContext);
+        storageCacheWriteClose(this->storage, this->cacheWrite, this->interface.name);
+        this->cacheWrite = NULL;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Create a new file
+***********************************************************************************************************************************/
+StorageWrite *
+storageWriteCacheNew(
+    StorageCache *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool compressible)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_CACHE, storage);
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(MODE, modeFile);
+        FUNCTION_LOG_PARAM(MODE, modePath);
+        FUNCTION_LOG_PARAM(STRING, user);
+        FUNCTION_LOG_PARAM(STRING, group);
+        FUNCTION_LOG_PARAM(INT64, timeModified);
+        FUNCTION_LOG_PARAM(BOOL, createPath);
+        FUNCTION_LOG_PARAM(BOOL, syncFile);
+        FUNCTION_LOG_PARAM(BOOL, syncPath);
+        FUNCTION_LOG_PARAM(BOOL, atomic);
+        FUNCTION_LOG_PARAM(BOOL, compressible);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(name != NULL);
+
+    StorageWrite *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StorageWriteCache")
+    {
+        StorageWriteCache *driver = memNew(sizeof(StorageWriteCache));
+        driver->memContext = MEM_CONTEXT_NEW();
+
+        driver->storage = storage;
+        driver->write = storageInterface(storageCacheStorage(storage)).newWrite(
+            storageDriver(storageCacheStorage(storage)), name, modeFile, modePath, user, group, timeModified, createPath, syncFile,
+            syncPath, atomic, compressible);
+
+        driver->interface = (StorageWriteInterface)
+        {
+            .type = storageWriteType(driver->write),
+            .name = strDup(name),
+            .atomic = atomic,
+            .compressible = compressible,
+            .createPath = createPath,
+            .group = strDup(group),
+            .modeFile = modeFile,
+            .modePath = modePath,
+            .syncFile = syncFile,
+            .syncPath = syncPath,
+            .timeModified = timeModified,
+            .user = strDup(user),
+
+            .ioInterface = (IoWriteInterface)
+            {
+                .close = storageWriteCacheClose,
+                .open = storageWriteCacheOpen,
+                .write = storageWriteCache,
+            },
+        };
+
+        this = storageWriteNew(driver, &driver->interface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_WRITE, this);
+}
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+StorageWrite *
+storageWriteCacheWrite(const StorageWrite *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_WRITE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(((StorageWriteCache *)storageWriteDriver(this))->write);
+}
@@ -0,0 +1,23 @@
+/***********************************************************************************************************************************
+Cache Storage Write
+***********************************************************************************************************************************/
+#ifndef STORAGE_CACHE_WRITE_H
+#define STORAGE_CACHE_WRITE_H
+
+#include "storage/cache/storage.intern.h"
+#include "storage/write.h"
+
+/***********************************************************************************************************************************
+Constructor
+***********************************************************************************************************************************/
+StorageWrite *storageWriteCacheNew(
+    StorageCache *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool compressible);
+
+/***********************************************************************************************************************************
+Getters
+***********************************************************************************************************************************/
+// Write object for the wrapped storage, used to move files
+StorageWrite *storageWriteCacheWrite(const StorageWrite *this);
+
+#endif
@@ -10,7 +10,11 @@ Storage Helper
 #include "common/regExp.h"
 #include "config/define.h"
 #include "config/config.h"
+#include "info/infoArchive.h"
+#include "info/infoBackup.h"
+#include "info/manifest.h"
 #include "protocol/helper.h"
+#include "storage/cache/storage.h"
 #include "storage/cifs/storage.h"
 #include "storage/posix/storage.h"
 #include "storage/remote/storage.h"
@@ -26,6 +30,13 @@ STRING_EXTERN(STORAGE_SPOOL_ARCHIVE_OUT_STR,                        STORAGE_SPOO
 STRING_EXTERN(STORAGE_PATH_ARCHIVE_STR,                             STORAGE_PATH_ARCHIVE);
 STRING_EXTERN(STORAGE_PATH_BACKUP_STR,                              STORAGE_PATH_BACKUP);
 
+/***********************************************************************************************************************************
+Repository files that are never changed once written, i.e. WAL segments, which have a checksum of their content in the name, and
+files in a backup
+***********************************************************************************************************************************/
+#define STORAGE_REPO_CACHE_IMMUTABLE_REGEXP                                                                                        \
+    "(/[0-F]{24}-[0-f]{40}(\\.gz){0,1}|/" STORAGE_PATH_BACKUP "/[^/]+/[0-9]{8}-[0-9]{6}F(_[0-9]{8}-[0-9]{6}(D|I)){0,1}/.+)$"
+
 /***********************************************************************************************************************************
 Local variables
 ***********************************************************************************************************************************/
@@ -331,6 +342,12 @@ storageRepoGet(const String *type, bool write)
 
     Storage *result = NULL;
 
+    // The repository cache is stored in a path for each repository since the same file names may exist in more than one repository
+    String *cachePath = NULL;
+
+    if (cfgOptionTest(cfgOptRepoCachePath))
+        cachePath = strNewFmt("%s/%s", strPtr(cfgOptionStr(cfgOptRepoCachePath)), strPtr(type));
+
     // Use remote storage
     if (!repoIsLocal())
     {
@@ -364,17 +381,37 @@ storageRepoGet(const String *type, bool write)
         if (cfgOptionSource(cfgOptRepoS3Port) != cfgSourceDefault)
             port = cfgOptionUInt(cfgOptRepoS3Port);
 
+        // Object names only identify a file within the bucket
+        if (cachePath != NULL)
+            strCatFmt(cachePath, "/%s:%u/%s", strPtr(endPoint), port, strPtr(cfgOptionStr(cfgOptRepoS3Bucket)));
+
         result = storageS3New(
             cfgOptionStr(cfgOptRepoPath), write, storageRepoPathExpression, cfgOptionStr(cfgOptRepoS3Bucket), endPoint,
             cfgOptionStr(cfgOptRepoS3Region), cfgOptionStr(cfgOptRepoS3Key), cfgOptionStr(cfgOptRepoS3KeySecret),
             cfgOptionTest(cfgOptRepoS3Token) ? cfgOptionStr(cfgOptRepoS3Token) : NULL, STORAGE_S3_PARTSIZE_MIN,
-            STORAGE_S3_DELETE_MAX, host, port, STORAGE_S3_TIMEOUT_DEFAULT, cfgOptionBool(cfgOptRepoS3VerifyTls),
+            STORAGE_S3_DELETE_MAX, cfgOptionUInt(cfgOptRepoS3ListParallel), host, port, STORAGE_S3_TIMEOUT_DEFAULT,
+            cfgOptionBool(cfgOptRepoS3VerifyTls),
             cfgOptionTest(cfgOptRepoS3CaFile) ? cfgOptionStr(cfgOptRepoS3CaFile) : NULL,
             cfgOptionTest(cfgOptRepoS3CaPath) ? cfgOptionStr(cfgOptRepoS3CaPath) : NULL);
     }
     else
         THROW_FMT(AssertError, "invalid storage type '%s'", strPtr(type));
 
+    // Cache local repository files when requested.  Info, archive index, and manifest files (including copies) are updated in place
+    // so they are never cached.  WAL segments and backup files are served from the cache without checking the repository.
+    if (repoIsLocal() && cachePath != NULL)
+    {
+        StringList *excludeList = strLstNew();
+        strLstAddZ(excludeList, INFO_ARCHIVE_FILE);
+        strLstAddZ(excludeList, INFO_ARCHIVE_INDEX_FILE);
+        strLstAddZ(excludeList, INFO_BACKUP_FILE);
+        strLstAddZ(excludeList, MANIFEST_FILE);
+
+        result = storageCacheNew(
+            result, cfgOptionStr(cfgOptRepoPath), write, storageRepoPathExpression, cachePath, cfgOptionUInt64(cfgOptRepoCacheSize),
+            excludeList, STRDEF(STORAGE_REPO_CACHE_IMMUTABLE_REGEXP));
+    }
+
     FUNCTION_TEST_RETURN(result);
 }
 
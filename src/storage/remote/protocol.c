@@ -148,7 +148,7 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             // Transfer the file if it exists
             if (exists)
             {
-                Buffer *buffer = bufNew(ioBufferSize());
+                Buffer *buffer = ioBufferPoolGet();
 
                 // Write file out to protocol layer
                 do
@@ -167,6 +167,7 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
                 while (!ioReadEof(fileRead));
 
                 ioReadClose(fileRead);
+                ioBufferPoolPut(buffer);
 
                 // Write a zero block to show file is complete
                 ioWriteLine(protocolServerIoWrite(server), BUFSTRDEF(PROTOCOL_BLOCK_HEADER "0"));
@@ -194,7 +195,7 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             protocolServerResponse(server, NULL);
 
             // Write data
-            Buffer *buffer = bufNew(ioBufferSize());
+            Buffer *buffer = ioBufferPoolGet();
             ssize_t remaining;
 
             do
@@ -237,6 +238,7 @@ storageRemoteProtocol(const String *command, const VariantList *paramList, Proto
             }
             while (remaining > 0);
 
+            ioBufferPoolPut(buffer);
         }
         else if (strEq(command, PROTOCOL_COMMAND_STORAGE_PATH_CREATE_STR))
         {
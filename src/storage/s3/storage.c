@@ -3,6 +3,7 @@ S3 Storage
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <stdio.h>
 #include <string.h>
 #include <time.h>
 
@@ -32,6 +33,7 @@ STRING_STATIC(S3_HEADER_AUTHORIZATION_STR,                          "authorizati
 STRING_STATIC(S3_HEADER_HOST_STR,                                   "host");
 STRING_STATIC(S3_HEADER_CONTENT_SHA256_STR,                         "x-amz-content-sha256");
 STRING_STATIC(S3_HEADER_DATE_STR,                                   "x-amz-date");
+STRING_STATIC(S3_HEADER_LAST_MODIFIED_STR,                          "last-modified");
 STRING_STATIC(S3_HEADER_TOKEN_STR,                                  "x-amz-security-token");
 
 /***********************************************************************************************************************************
@@ -50,6 +52,11 @@ S3 errors
 ***********************************************************************************************************************************/
 STRING_STATIC(S3_ERROR_REQUEST_TIME_TOO_SKEWED_STR,                 "RequestTimeTooSkewed");
 
+/***********************************************************************************************************************************
+Retries for S3 errors that can be retried, e.g. RequestTimeTooSkewed
+***********************************************************************************************************************************/
+#define S3_REQUEST_RETRY_MAX                                        2
+
 /***********************************************************************************************************************************
 XML tags
 ***********************************************************************************************************************************/
@@ -97,6 +104,7 @@ struct StorageS3
     const String *securityToken;                                    // Security token, if any
     size_t partSize;                                                // Part size for multi-part upload
     unsigned int deleteMax;                                         // Maximum objects that can be deleted in one request
+    unsigned int listParallel;                                      // Maximum prefixes listed in parallel by recursive lists
     const String *bucketEndpoint;                                   // Set to {bucket}.{endpoint}
     unsigned int port;                                              // Host port
 
@@ -231,13 +239,172 @@ storageS3Auth(
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Create request headers, including authorization
+***********************************************************************************************************************************/
+static HttpHeader *
+storageS3RequestHeader(StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const Buffer *body)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_S3, this);
+        FUNCTION_TEST_PARAM(STRING, verb);
+        FUNCTION_TEST_PARAM(STRING, uri);
+        FUNCTION_TEST_PARAM(HTTP_QUERY, query);
+        FUNCTION_TEST_PARAM(BUFFER, body);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+
+    // Create header list and add content length
+    HttpHeader *result = httpHeaderNew(this->headerRedactList);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Set content length
+        httpHeaderAdd(
+            result, HTTP_HEADER_CONTENT_LENGTH_STR,
+            body == NULL || bufUsed(body) == 0 ? ZERO_STR : strNewFmt("%zu", bufUsed(body)));
+
+        // Calculate content-md5 header if there is content
+        if (body != NULL)
+        {
+            char md5Hash[HASH_TYPE_MD5_SIZE_HEX];
+            encodeToStr(encodeBase64, bufPtr(cryptoHashOne(HASH_TYPE_MD5_STR, body)), HASH_TYPE_M5_SIZE, md5Hash);
+            httpHeaderAdd(result, HTTP_HEADER_CONTENT_MD5_STR, STR(md5Hash));
+        }
+
+        // Generate authorization header
+        storageS3Auth(
+            this, verb, httpUriEncode(uri, true), query, storageS3DateTime(time(NULL)), result,
+            body == NULL || bufUsed(body) == 0 ? HASH_TYPE_SHA256_ZERO_STR : bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, body)));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Should a failed request be retried?  The S3 error code is extracted from the response when there is one.
+***********************************************************************************************************************************/
+static bool
+storageS3RequestRetry(const Buffer *response)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, response);
+    FUNCTION_TEST_END();
+
+    bool result = false;
+
+    if (response != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Attempt to parse the XML and extract the S3 error code
+            TRY_BEGIN()
+            {
+                XmlNode *error = xmlDocumentRoot(xmlDocumentNewBuf(response));
+                const String *errorCode = xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_CODE_STR, true));
+
+                if (strEq(errorCode, S3_ERROR_REQUEST_TIME_TOO_SKEWED_STR))
+                {
+                    LOG_DEBUG(
+                        "retry %s: %s", strPtr(errorCode),
+                        strPtr(xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_MESSAGE_STR, true))));
+
+                    result = true;
+                }
+            }
+            // On failure just drop through and report the error as usual
+            CATCH_ANY()
+            {
+            }
+            TRY_END();
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Throw an error with the details of a failed request
+***********************************************************************************************************************************/
+static void
+storageS3RequestError(
+    HttpClient *httpClient, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader, const Buffer *response)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_CLIENT, httpClient);
+        FUNCTION_TEST_PARAM(STRING, uri);
+        FUNCTION_TEST_PARAM(HTTP_QUERY, query);
+        FUNCTION_TEST_PARAM(HTTP_HEADER, requestHeader);
+        FUNCTION_TEST_PARAM(BUFFER, response);
+    FUNCTION_TEST_END();
+
+    ASSERT(httpClient != NULL);
+    ASSERT(uri != NULL);
+    ASSERT(requestHeader != NULL);
+
+    // General error message
+    String *error = strNewFmt(
+        "S3 request failed with %u: %s", httpClientResponseCode(httpClient), strPtr(httpClientResponseMessage(httpClient)));
+
+    // Output uri/query
+    strCat(error, "\n*** URI/Query ***:");
+
+    strCatFmt(error, "\n%s", strPtr(httpUriEncode(uri, true)));
+
+    if (query != NULL)
+        strCatFmt(error, "?%s", strPtr(httpQueryRender(query)));
+
+    // Output request headers
+    const StringList *requestHeaderList = httpHeaderList(requestHeader);
+
+    strCat(error, "\n*** Request Headers ***:");
+
+    for (unsigned int requestHeaderIdx = 0; requestHeaderIdx < strLstSize(requestHeaderList); requestHeaderIdx++)
+    {
+        const String *key = strLstGet(requestHeaderList, requestHeaderIdx);
+
+        strCatFmt(
+            error, "\n%s: %s", strPtr(key),
+            httpHeaderRedact(requestHeader, key) || strEq(key, S3_HEADER_DATE_STR) ?
+                "<redacted>" : strPtr(httpHeaderGet(requestHeader, key)));
+    }
+
+    // Output response headers
+    const HttpHeader *responseHeader = httpClientResponseHeader(httpClient);
+    const StringList *responseHeaderList = httpHeaderList(responseHeader);
+
+    if (strLstSize(responseHeaderList) > 0)
+    {
+        strCat(error, "\n*** Response Headers ***:");
+
+        for (unsigned int responseHeaderIdx = 0; responseHeaderIdx < strLstSize(responseHeaderList); responseHeaderIdx++)
+        {
+            const String *key = strLstGet(responseHeaderList, responseHeaderIdx);
+            strCatFmt(error, "\n%s: %s", strPtr(key), strPtr(httpHeaderGet(responseHeader, key)));
+        }
+    }
+
+    // If there was content then output it
+    if (response!= NULL)
+        strCatFmt(error, "\n*** Response Content ***:\n%s", strPtr(strNewBuf(response)));
+
+    THROW(ProtocolError, strPtr(error));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Process S3 request
 ***********************************************************************************************************************************/
-StorageS3RequestResult
-storageS3Request(
+static StorageS3RequestResult
+storageS3RequestInternal(
     StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const Buffer *body, bool returnContent,
-    bool allowMissing)
+    bool allowMissing, unsigned int retryRemaining)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE_S3, this);
@@ -247,6 +414,7 @@ storageS3Request(
         FUNCTION_LOG_PARAM(BUFFER, body);
         FUNCTION_LOG_PARAM(BOOL, returnContent);
         FUNCTION_LOG_PARAM(BOOL, allowMissing);
+        FUNCTION_LOG_PARAM(UINT, retryRemaining);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
@@ -254,7 +422,6 @@ storageS3Request(
     ASSERT(uri != NULL);
 
     StorageS3RequestResult result = {0};
-    unsigned int retryRemaining = 2;
     bool done;
 
     do
@@ -263,26 +430,8 @@ storageS3Request(
 
         MEM_CONTEXT_TEMP_BEGIN()
         {
-            // Create header list and add content length
-            HttpHeader *requestHeader = httpHeaderNew(this->headerRedactList);
-
-            // Set content length
-            httpHeaderAdd(
-                requestHeader, HTTP_HEADER_CONTENT_LENGTH_STR,
-                body == NULL || bufUsed(body) == 0 ? ZERO_STR : strNewFmt("%zu", bufUsed(body)));
-
-            // Calculate content-md5 header if there is content
-            if (body != NULL)
-            {
-                char md5Hash[HASH_TYPE_MD5_SIZE_HEX];
-                encodeToStr(encodeBase64, bufPtr(cryptoHashOne(HASH_TYPE_MD5_STR, body)), HASH_TYPE_M5_SIZE, md5Hash);
-                httpHeaderAdd(requestHeader, HTTP_HEADER_CONTENT_MD5_STR, STR(md5Hash));
-            }
-
-            // Generate authorization header
-            storageS3Auth(
-                this, verb, httpUriEncode(uri, true), query, storageS3DateTime(time(NULL)), requestHeader,
-                body == NULL || bufUsed(body) == 0 ? HASH_TYPE_SHA256_ZERO_STR : bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, body)));
+            // Create request headers
+            HttpHeader *requestHeader = storageS3RequestHeader(this, verb, uri, query, body);
 
             // Get an http client
             HttpClient *httpClient = httpClientCacheGet(this->httpClientCache);
@@ -294,108 +443,207 @@ storageS3Request(
             if (!httpClientResponseCodeOk(httpClient) &&
                 (!allowMissing || httpClientResponseCode(httpClient) != HTTP_RESPONSE_CODE_NOT_FOUND))
             {
-                // If there are retries remaining and a response parse it as XML to extract the S3 error code
-                if (response != NULL && retryRemaining > 0)
+                // If there are retries remaining check if the error can be retried
+                if (retryRemaining > 0 && storageS3RequestRetry(response))
                 {
-                    // Attempt to parse the XML and extract the S3 error code
-                    TRY_BEGIN()
-                    {
-                        XmlNode *error = xmlDocumentRoot(xmlDocumentNewBuf(response));
-                        const String *errorCode = xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_CODE_STR, true));
+                    retryRemaining--;
+                    done = false;
+                }
+                // Else report the error
+                else
+                    storageS3RequestError(httpClient, uri, query, requestHeader, response);
+            }
+            else
+            {
+                // On success move the buffer to the calling context
+                result.httpClient = httpClient;
+                result.responseHeader = httpHeaderMove(httpHeaderDup(httpClientResponseHeader(httpClient), NULL), MEM_CONTEXT_OLD());
+                result.response = bufMove(response, MEM_CONTEXT_OLD());
+            }
 
-                        if (strEq(errorCode, S3_ERROR_REQUEST_TIME_TOO_SKEWED_STR))
-                        {
-                            LOG_DEBUG(
-                                "retry %s: %s", strPtr(errorCode),
-                                strPtr(xmlNodeContent(xmlNodeChild(error, S3_XML_TAG_MESSAGE_STR, true))));
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    while (!done);
 
-                            retryRemaining--;
-                            done = false;
-                        }
-                    }
-                    // On failure just drop through and report the error as usual
-                    CATCH_ANY()
-                    {
-                    }
-                    TRY_END();
-                }
+    FUNCTION_LOG_RETURN(STORAGE_S3_REQUEST_RESULT, result);
+}
 
-                // If not done then retry instead of reporting the error
-                if (done)
-                {
-                    // General error message
-                    String *error = strNewFmt(
-                        "S3 request failed with %u: %s", httpClientResponseCode(httpClient),
-                        strPtr(httpClientResponseMessage(httpClient)));
+StorageS3RequestResult
+storageS3Request(
+    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const Buffer *body, bool returnContent,
+    bool allowMissing)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(BUFFER, body);
+        FUNCTION_LOG_PARAM(BOOL, returnContent);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+    FUNCTION_LOG_END();
 
-                    // Output uri/query
-                    strCat(error, "\n*** URI/Query ***:");
+    FUNCTION_LOG_RETURN(
+        STORAGE_S3_REQUEST_RESULT,
+        storageS3RequestInternal(this, verb, uri, query, body, returnContent, allowMissing, S3_REQUEST_RETRY_MAX));
+}
 
-                    strCatFmt(error, "\n%s", strPtr(httpUriEncode(uri, true)));
+/***********************************************************************************************************************************
+Write an S3 request without waiting for the response so requests can be made in parallel. The response must be read with
+storageS3ResponseRead().  The request header is created by the caller so it is available to report errors when the response is read.
+***********************************************************************************************************************************/
+static HttpClient *
+storageS3RequestWrite(
+    StorageS3 *this, const String *verb, const String *uri, const HttpQuery *query, const HttpHeader *requestHeader)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+    FUNCTION_LOG_END();
 
-                    if (query != NULL)
-                        strCatFmt(error, "?%s", strPtr(httpQueryRender(query)));
+    ASSERT(this != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+    ASSERT(requestHeader != NULL);
 
-                    // Output request headers
-                    const StringList *requestHeaderList = httpHeaderList(requestHeader);
+    // Get an http client.  The client is busy until the response is read so each request gets its own client.
+    HttpClient *result = httpClientCacheGet(this->httpClientCache);
 
-                    strCat(error, "\n*** Request Headers ***:");
+    httpClientRequestWrite(result, verb, uri, query, requestHeader, NULL);
 
-                    for (unsigned int requestHeaderIdx = 0; requestHeaderIdx < strLstSize(requestHeaderList); requestHeaderIdx++)
-                    {
-                        const String *key = strLstGet(requestHeaderList, requestHeaderIdx);
+    FUNCTION_LOG_RETURN(HTTP_CLIENT, result);
+}
 
-                        strCatFmt(
-                            error, "\n%s: %s", strPtr(key),
-                            httpHeaderRedact(requestHeader, key) || strEq(key, S3_HEADER_DATE_STR) ?
-                                "<redacted>" : strPtr(httpHeaderGet(requestHeader, key)));
-                    }
+/***********************************************************************************************************************************
+Read the response to a request written by storageS3RequestWrite()
+***********************************************************************************************************************************/
+static Buffer *
+storageS3ResponseRead(
+    StorageS3 *this, HttpClient *httpClient, const String *verb, const String *uri, const HttpQuery *query,
+    const HttpHeader *requestHeader)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(HTTP_CLIENT, httpClient);
+        FUNCTION_LOG_PARAM(STRING, verb);
+        FUNCTION_LOG_PARAM(STRING, uri);
+        FUNCTION_LOG_PARAM(HTTP_QUERY, query);
+        FUNCTION_LOG_PARAM(HTTP_HEADER, requestHeader);
+    FUNCTION_LOG_END();
 
-                    // Output response headers
-                    const HttpHeader *responseHeader = httpClientResponseHeader(httpClient);
-                    const StringList *responseHeaderList = httpHeaderList(responseHeader);
+    ASSERT(this != NULL);
+    ASSERT(httpClient != NULL);
+    ASSERT(verb != NULL);
+    ASSERT(uri != NULL);
+    ASSERT(requestHeader != NULL);
 
-                    if (strLstSize(responseHeaderList) > 0)
-                    {
-                        strCat(error, "\n*** Response Headers ***:");
+    Buffer *result = httpClientResponseRead(httpClient, true);
 
-                        for (unsigned int responseHeaderIdx = 0; responseHeaderIdx < strLstSize(responseHeaderList); responseHeaderIdx++)
-                        {
-                            const String *key = strLstGet(responseHeaderList, responseHeaderIdx);
-                            strCatFmt(error, "\n%s: %s", strPtr(key), strPtr(httpHeaderGet(responseHeader, key)));
-                        }
-                    }
+    if (!httpClientResponseCodeOk(httpClient))
+    {
+        // If the error can be retried then repeat the request with the remaining retries.  The request cannot be written again as
+        // is because the authorization is tied to the request time.
+        if (storageS3RequestRetry(result))
+        {
+            bufFree(result);
+            result = storageS3RequestInternal(this, verb, uri, query, NULL, true, false, S3_REQUEST_RETRY_MAX - 1).response;
+        }
+        // Else report the error from the response that was already read
+        else
+            storageS3RequestError(httpClient, uri, query, requestHeader, result);
+    }
 
-                    // If there was content then output it
-                    if (response!= NULL)
-                        strCatFmt(error, "\n*** Response Content ***:\n%s", strPtr(strNewBuf(response)));
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
 
-                    THROW(ProtocolError, strPtr(error));
-                }
-            }
-            else
+/***********************************************************************************************************************************
+General function for listing files to be used by other list routines
+
+Recursive lists are split by common prefix so the prefixes can be listed in parallel.  The first level of the path is listed with a
+delimiter and each common prefix found is queued to be listed.  Prefixes are listed with a delimiter until there are enough of them
+to keep listParallel requests in flight -- after that each prefix is listed recursively.  Requests are pipelined over separate
+connections rather than run in separate processes, so the callback is always called from this process, but results for different
+prefixes are interleaved.
+
+When listing recursively without a delimiter S3 does not return paths, so paths are reported based on the keys.  Keys under a path
+are contiguous in the list so a path only needs to be reported when it is not a parent of the prior key.
+***********************************************************************************************************************************/
+typedef struct StorageS3ListPrefix
+{
+    String *prefix;                                                 // Prefix to list
+    bool expand;                                                    // List with a delimiter and queue the common prefixes?
+    bool recurse;                                                   // List without a delimiter?
+    String *pathLast;                                               // Path of the prior key when listing without a delimiter
+    String *continuationToken;                                      // Token for the next page, if any
+    HttpQuery *query;                                               // Query for the request in flight
+    HttpHeader *header;                                             // Header for the request in flight
+    HttpClient *httpClient;                                         // Client for the request in flight, NULL if none
+} StorageS3ListPrefix;
+
+typedef void (*StorageS3ListCallback)(
+    StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlNode *xml);
+
+static void
+storageS3ListPath(
+    StorageS3 *this, StorageS3ListPrefix *listPrefix, const String *file, StorageS3ListCallback callback, void *callbackData,
+    const XmlNode *xml)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_S3, this);
+        FUNCTION_TEST_PARAM_P(VOID, listPrefix);
+        FUNCTION_TEST_PARAM(STRING, file);
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+        FUNCTION_TEST_PARAM(XML_NODE, xml);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(listPrefix != NULL);
+    ASSERT(file != NULL);
+    ASSERT(callback != NULL);
+
+    const char *fileZ = strPtr(file);
+    const char *pathEnd = strrchr(fileZ, '/');
+    size_t pathSize = pathEnd == NULL ? 0 : (size_t)(pathEnd - fileZ);
+
+    // Only report paths that were not already reported for the prior key
+    if (pathSize > 0)
+    {
+        const char *pathLastZ = strPtr(listPrefix->pathLast);
+        size_t pathLastSize = strSize(listPrefix->pathLast);
+
+        if (pathSize != pathLastSize || strncmp(fileZ, pathLastZ, pathSize) != 0)
+        {
+            // Report the paths that are not also paths of the prior key
+            MEM_CONTEXT_TEMP_BEGIN()
             {
-                // On success move the buffer to the calling context
-                result.httpClient = httpClient;
-                result.responseHeader = httpHeaderMove(httpHeaderDup(httpClientResponseHeader(httpClient), NULL), MEM_CONTEXT_OLD());
-                result.response = bufMove(response, MEM_CONTEXT_OLD());
+                for (size_t charIdx = 1; charIdx <= pathSize; charIdx++)
+                {
+                    if ((charIdx == pathSize || fileZ[charIdx] == '/') &&
+                        !(charIdx <= pathLastSize && (charIdx == pathLastSize || pathLastZ[charIdx] == '/') &&
+                          strncmp(fileZ, pathLastZ, charIdx) == 0))
+                    {
+                        callback(this, callbackData, strSubN(file, 0, charIdx), storageTypePath, xml);
+                    }
+                }
             }
+            MEM_CONTEXT_TEMP_END();
 
+            // Update the path in place so it stays in the context of the prefix
+            strCatFmt(strTrunc(listPrefix->pathLast, 0), "%.*s", (int)pathSize, fileZ);
         }
-        MEM_CONTEXT_TEMP_END();
     }
-    while (!done);
 
-    FUNCTION_LOG_RETURN(STORAGE_S3_REQUEST_RESULT, result);
+    FUNCTION_TEST_RETURN_VOID();
 }
 
-/***********************************************************************************************************************************
-General function for listing files to be used by other list routines
-***********************************************************************************************************************************/
 static void
 storageS3ListInternal(
-    StorageS3 *this, const String *path, const String *expression, bool recurse,
-    void (*callback)(StorageS3 *this, void *callbackData, const String *name, StorageType type, const XmlNode *xml),
+    StorageS3 *this, const String *path, const String *expression, bool recurse, StorageS3ListCallback callback,
     void *callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
@@ -409,11 +657,10 @@ storageS3ListInternal(
 
     ASSERT(this != NULL);
     ASSERT(path != NULL);
+    ASSERT(!recurse || expression == NULL);
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        const String *continuationToken = NULL;
-
         // Prepare regexp if an expression was passed
         RegExp *regExp = expression == NULL ? NULL : regExpNew(expression);
 
@@ -441,78 +688,185 @@ storageS3ListInternal(
                 queryPrefix = strNewFmt("%s%s", strPtr(basePrefix), strPtr(expressionPrefix));
         }
 
-        // Loop as long as a continuation token returned
-        do
+        // Queue the query prefix.  Recursive lists are only split by prefix when more than one prefix can be listed at a time.
+        List *prefixList = lstNew(sizeof(StorageS3ListPrefix));
+
+        MEM_CONTEXT_BEGIN(lstMemContext(prefixList))
         {
-            // Use an inner mem context here because we could potentially be retrieving millions of files so it is a good idea to
-            // free memory at regular intervals
-            MEM_CONTEXT_TEMP_BEGIN()
+            StorageS3ListPrefix listPrefix =
             {
-                HttpQuery *query = httpQueryNew();
+                .prefix = strDup(queryPrefix),
+                .expand = recurse && this->listParallel > 1,
+                .recurse = recurse && this->listParallel == 1,
+                .pathLast = strNew(""),
+            };
 
-                // Add continuation token from the prior loop if any
-                if (continuationToken != NULL)
-                    httpQueryAdd(query, S3_QUERY_CONTINUATION_TOKEN_STR, continuationToken);
+            lstAdd(prefixList, &listPrefix);
+        }
+        MEM_CONTEXT_END();
 
-                // Add the delimiter to not recurse
-                if (!recurse)
-                    httpQueryAdd(query, S3_QUERY_DELIMITER_STR, FSLASH_STR);
+        TRY_BEGIN()
+        {
+            // Loop as long as there are prefixes to list
+            while (lstSize(prefixList) > 0)
+            {
+                // Write requests for prefixes at the head of the queue so up to listParallel requests are in flight
+                for (unsigned int prefixIdx = 0; prefixIdx < lstSize(prefixList) && prefixIdx < this->listParallel; prefixIdx++)
+                {
+                    StorageS3ListPrefix *listPrefix = lstGet(prefixList, prefixIdx);
 
-                // Use list type 2
-                httpQueryAdd(query, S3_QUERY_LIST_TYPE_STR, S3_QUERY_VALUE_LIST_TYPE_2_STR);
+                    if (listPrefix->httpClient == NULL)
+                    {
+                        MEM_CONTEXT_BEGIN(lstMemContext(prefixList))
+                        {
+                            listPrefix->query = httpQueryNew();
 
-                // Don't specified empty prefix because it is the default
-                if (!strEmpty(queryPrefix))
-                    httpQueryAdd(query, S3_QUERY_PREFIX_STR, queryPrefix);
+                            // Add continuation token from the prior page if any
+                            if (listPrefix->continuationToken != NULL)
+                                httpQueryAdd(listPrefix->query, S3_QUERY_CONTINUATION_TOKEN_STR, listPrefix->continuationToken);
 
-                XmlNode *xmlRoot = xmlDocumentRoot(
-                    xmlDocumentNewBuf(
-                        storageS3Request(this, HTTP_VERB_GET_STR, FSLASH_STR, query, NULL, true, false).response));
+                            // Add the delimiter to not recurse
+                            if (!listPrefix->recurse)
+                                httpQueryAdd(listPrefix->query, S3_QUERY_DELIMITER_STR, FSLASH_STR);
 
-                // Get subpath list
-                XmlNodeList *subPathList = xmlNodeChildList(xmlRoot, S3_XML_TAG_COMMON_PREFIXES_STR);
+                            // Use list type 2
+                            httpQueryAdd(listPrefix->query, S3_QUERY_LIST_TYPE_STR, S3_QUERY_VALUE_LIST_TYPE_2_STR);
 
-                for (unsigned int subPathIdx = 0; subPathIdx < xmlNodeLstSize(subPathList); subPathIdx++)
+                            // Don't specified empty prefix because it is the default
+                            if (!strEmpty(listPrefix->prefix))
+                                httpQueryAdd(listPrefix->query, S3_QUERY_PREFIX_STR, listPrefix->prefix);
+
+                            listPrefix->header = storageS3RequestHeader(
+                                this, HTTP_VERB_GET_STR, FSLASH_STR, listPrefix->query, NULL);
+                        }
+                        MEM_CONTEXT_END();
+
+                        listPrefix->httpClient = storageS3RequestWrite(
+                            this, HTTP_VERB_GET_STR, FSLASH_STR, listPrefix->query, listPrefix->header);
+                    }
+                }
+
+                // Use an inner mem context here because we could potentially be retrieving millions of files so it is a good idea
+                // to free memory at regular intervals
+                MEM_CONTEXT_TEMP_BEGIN()
                 {
-                    const XmlNode *subPathNode = xmlNodeLstGet(subPathList, subPathIdx);
+                    // Read the response for the prefix at the head of the queue and remove it from the queue
+                    StorageS3ListPrefix listPrefix = *(StorageS3ListPrefix *)lstGet(prefixList, 0);
 
-                    // Get subpath name
-                    const String *subPath = xmlNodeContent(xmlNodeChild(subPathNode, S3_XML_TAG_PREFIX_STR, true));
+                    XmlNode *xmlRoot = xmlDocumentRoot(
+                        xmlDocumentNewBuf(
+                            storageS3ResponseRead(
+                                this, listPrefix.httpClient, HTTP_VERB_GET_STR, FSLASH_STR, listPrefix.query, listPrefix.header)));
 
-                    // Strip off base prefix and final /
-                    subPath = strSubN(subPath, strSize(basePrefix), strSize(subPath) - strSize(basePrefix) - 1);
+                    lstRemoveIdx(prefixList, 0);
+                    httpQueryFree(listPrefix.query);
+                    listPrefix.query = NULL;
+                    httpHeaderFree(listPrefix.header);
+                    listPrefix.header = NULL;
+                    listPrefix.httpClient = NULL;
 
-                    // Add to list after checking expression if present
-                    if (regExp == NULL || regExpMatch(regExp, subPath))
-                        callback(this, callbackData, subPath, storageTypePath, subPathNode);
-                }
+                    // Get subpath list
+                    XmlNodeList *subPathList = xmlNodeChildList(xmlRoot, S3_XML_TAG_COMMON_PREFIXES_STR);
 
-                // Get file list
-                XmlNodeList *fileList = xmlNodeChildList(xmlRoot, S3_XML_TAG_CONTENTS_STR);
+                    // Subpaths are split further while there are not enough prefixes queued to keep all requests in flight
+                    bool subPathExpand = lstSize(prefixList) + xmlNodeLstSize(subPathList) < this->listParallel;
 
-                for (unsigned int fileIdx = 0; fileIdx < xmlNodeLstSize(fileList); fileIdx++)
-                {
-                    const XmlNode *fileNode = xmlNodeLstGet(fileList, fileIdx);
+                    for (unsigned int subPathIdx = 0; subPathIdx < xmlNodeLstSize(subPathList); subPathIdx++)
+                    {
+                        const XmlNode *subPathNode = xmlNodeLstGet(subPathList, subPathIdx);
+
+                        // Get subpath name
+                        const String *subPathPrefix = xmlNodeContent(xmlNodeChild(subPathNode, S3_XML_TAG_PREFIX_STR, true));
+
+                        // Strip off base prefix and final /
+                        const String *subPath = strSubN(
+                            subPathPrefix, strSize(basePrefix), strSize(subPathPrefix) - strSize(basePrefix) - 1);
+
+                        // Add to list after checking expression if present
+                        if (regExp == NULL || regExpMatch(regExp, subPath))
+                            callback(this, callbackData, subPath, storageTypePath, subPathNode);
+
+                        // Queue the subpath to be listed
+                        if (listPrefix.expand)
+                        {
+                            MEM_CONTEXT_BEGIN(lstMemContext(prefixList))
+                            {
+                                StorageS3ListPrefix subPathListPrefix =
+                                {
+                                    .prefix = strDup(subPathPrefix),
+                                    .expand = subPathExpand,
+                                    .recurse = !subPathExpand,
+                                    .pathLast = strDup(subPath),
+                                };
+
+                                lstAdd(prefixList, &subPathListPrefix);
+                            }
+                            MEM_CONTEXT_END();
+                        }
+                    }
+
+                    // Get file list
+                    XmlNodeList *fileList = xmlNodeChildList(xmlRoot, S3_XML_TAG_CONTENTS_STR);
+
+                    for (unsigned int fileIdx = 0; fileIdx < xmlNodeLstSize(fileList); fileIdx++)
+                    {
+                        const XmlNode *fileNode = xmlNodeLstGet(fileList, fileIdx);
+
+                        // Get file name
+                        const String *file = xmlNodeContent(xmlNodeChild(fileNode, S3_XML_TAG_KEY_STR, true));
+
+                        // Strip off the base prefix when present
+                        file = strEmpty(basePrefix) ? file : strSub(file, strSize(basePrefix));
 
-                    // Get file name
-                    const String *file = xmlNodeContent(xmlNodeChild(fileNode, S3_XML_TAG_KEY_STR, true));
+                        // Report paths that S3 does not return when there is no delimiter
+                        if (listPrefix.recurse)
+                            storageS3ListPath(this, &listPrefix, file, callback, callbackData, fileNode);
 
-                    // Strip off the base prefix when present
-                    file = strEmpty(basePrefix) ? file : strSub(file, strSize(basePrefix));
+                        // Add to list after checking expression if present
+                        if (regExp == NULL || regExpMatch(regExp, file))
+                            callback(this, callbackData, file, storageTypeFile, fileNode);
+                    }
+
+                    // If there is a continuation token then queue the prefix again to get the next page.  Free the prior token so
+                    // memory usage does not grow with the number of pages.
+                    const String *continuationToken = xmlNodeContent(
+                        xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR, false));
+
+                    strFree(listPrefix.continuationToken);
+                    listPrefix.continuationToken = NULL;
+
+                    if (continuationToken != NULL)
+                    {
+                        MEM_CONTEXT_BEGIN(lstMemContext(prefixList))
+                        {
+                            listPrefix.continuationToken = strDup(continuationToken);
+                        }
+                        MEM_CONTEXT_END();
 
-                    // Add to list after checking expression if present
-                    if (regExp == NULL || regExpMatch(regExp, file))
-                        callback(this, callbackData, file, storageTypeFile, fileNode);
+                        lstAdd(prefixList, &listPrefix);
+                    }
+                    // Else the prefix is done
+                    else
+                    {
+                        strFree(listPrefix.prefix);
+                        strFree(listPrefix.pathLast);
+                    }
                 }
+                MEM_CONTEXT_TEMP_END();
+            }
+        }
+        FINALLY()
+        {
+            // Discard requests that are still in flight after an error so the clients can be reused
+            for (unsigned int prefixIdx = 0; prefixIdx < lstSize(prefixList); prefixIdx++)
+            {
+                StorageS3ListPrefix *listPrefix = lstGet(prefixList, prefixIdx);
 
-                // Get the continuation token and store it in the outer temp context
-                memContextSwitch(MEM_CONTEXT_OLD());
-                continuationToken = xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_NEXT_CONTINUATION_TOKEN_STR, false));
-                memContextSwitch(MEM_CONTEXT_TEMP());
+                if (listPrefix->httpClient != NULL)
+                    httpClientDone(listPrefix->httpClient);
             }
-            MEM_CONTEXT_TEMP_END();
         }
-        while (continuationToken != NULL);
+        TRY_END();
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -546,6 +900,45 @@ storageS3Exists(THIS_VOID, const String *file)
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/***********************************************************************************************************************************
+Convert an http date, e.g. Wed, 21 Oct 2015 07:28:00 GMT, to epoch time.  The date is converted directly since there is no portable
+function to convert UTC broken-down time.  Zero is returned when the date is missing or cannot be parsed.
+***********************************************************************************************************************************/
+static time_t
+storageS3CvtTime(const String *date)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, date);
+    FUNCTION_TEST_END();
+
+    static const char *monthList[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+    time_t result = 0;
+    char monthName[4];
+    int day, year, hour, minute, second;
+
+    if (date != NULL &&
+        sscanf(strPtr(date), "%*3s, %2d %3s %4d %2d:%2d:%2d GMT", &day, monthName, &year, &hour, &minute, &second) == 6)
+    {
+        for (int month = 1; month <= 12; month++)
+        {
+            if (strcmp(monthName, monthList[month - 1]) == 0)
+            {
+                // Days since the epoch with years starting in March so the leap day is the last day of the year
+                int yearMarch = month <= 2 ? year - 1 : year;
+                int dayOfYear = (153 * (month <= 2 ? month + 9 : month - 3) + 2) / 5 + day - 1;
+                int64_t dayTotal =
+                    (int64_t)yearMarch * 365 + yearMarch / 4 - yearMarch / 100 + yearMarch / 400 + dayOfYear - 719468;
+
+                result = (time_t)(dayTotal * 86400 + hour * 3600 + minute * 60 + second);
+                break;
+            }
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 File info
 ***********************************************************************************************************************************/
@@ -574,6 +967,7 @@ storageS3Info(THIS_VOID, const String *file, bool followLink)
         result.exists = true;
         result.type = storageTypeFile;
         result.size = cvtZToUInt64(strPtr(httpHeaderGet(httpResult.responseHeader, HTTP_HEADER_CONTENT_LENGTH_STR)));
+        result.timeModified = storageS3CvtTime(httpHeaderGet(httpResult.responseHeader, S3_HEADER_LAST_MODIFIED_STR));
     }
 
     FUNCTION_LOG_RETURN(STORAGE_INFO, result);
@@ -644,6 +1038,32 @@ storageS3InfoList(THIS_VOID, const String *path, StorageInfoListCallback callbac
     FUNCTION_LOG_RETURN(BOOL, true);
 }
 
+static bool
+storageS3InfoListRecurse(THIS_VOID, const String *path, StorageInfoListCallback callback, void *callbackData)
+{
+    THIS(StorageS3);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_S3, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+    ASSERT(callback != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        StorageS3InfoListData data = {.callback = callback, .callbackData = callbackData};
+        storageS3ListInternal(this, path, NULL, true, storageS3InfoListCallback, &data);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, true);
+}
+
 /***********************************************************************************************************************************
 Get a list of files from a directory
 ***********************************************************************************************************************************/
@@ -907,8 +1327,8 @@ Storage *
 storageS3New(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
     const String *endPoint, const String *region, const String *accessKey, const String *secretAccessKey,
-    const String *securityToken, size_t partSize, unsigned int deleteMax, const String *host, unsigned int port, TimeMSec timeout,
-    bool verifyPeer, const String *caFile, const String *caPath)
+    const String *securityToken, size_t partSize, unsigned int deleteMax, unsigned int listParallel, const String *host,
+    unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, path);
@@ -921,6 +1341,8 @@ storageS3New(
         FUNCTION_TEST_PARAM(STRING, secretAccessKey);
         FUNCTION_TEST_PARAM(STRING, securityToken);
         FUNCTION_LOG_PARAM(SIZE, partSize);
+        FUNCTION_LOG_PARAM(UINT, deleteMax);
+        FUNCTION_LOG_PARAM(UINT, listParallel);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(UINT, port);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
@@ -935,6 +1357,7 @@ storageS3New(
     ASSERT(region != NULL);
     ASSERT(accessKey != NULL);
     ASSERT(secretAccessKey != NULL);
+    ASSERT(listParallel > 0);
 
     Storage *this = NULL;
 
@@ -950,6 +1373,7 @@ storageS3New(
         driver->securityToken = strDup(securityToken);
         driver->partSize = partSize;
         driver->deleteMax = deleteMax;
+        driver->listParallel = listParallel;
         driver->bucketEndpoint = strNewFmt("%s.%s", strPtr(bucket), strPtr(endPoint));
         driver->port = port;
 
@@ -966,9 +1390,9 @@ storageS3New(
 
         this = storageNewP(
             STORAGE_S3_TYPE_STR, path, 0, 0, write, pathExpressionFunction, driver,
-            .exists = storageS3Exists, .info = storageS3Info, .infoList = storageS3InfoList, .list = storageS3List,
-            .newRead = storageS3NewRead, .newWrite = storageS3NewWrite, .pathRemove = storageS3PathRemove,
-            .remove = storageS3Remove);
+            .exists = storageS3Exists, .info = storageS3Info, .infoList = storageS3InfoList,
+            .infoListRecurse = storageS3InfoListRecurse, .list = storageS3List, .newRead = storageS3NewRead,
+            .newWrite = storageS3NewWrite, .pathRemove = storageS3PathRemove, .remove = storageS3Remove);
     }
     MEM_CONTEXT_NEW_END();
 
@@ -13,6 +13,7 @@ Storage Interface
 #include "common/memContext.h"
 #include "common/object.h"
 #include "common/regExp.h"
+#include "common/type/json.h"
 #include "common/wait.h"
 #include "storage/storage.intern.h"
 
@@ -107,7 +108,7 @@ storageCopy(StorageRead *source, StorageWrite *destination)
             ioWriteOpen(storageWriteIo(destination));
 
             // Copy data from source to destination
-            Buffer *read = bufNew(ioBufferSize());
+            Buffer *read = ioBufferPoolGet();
 
             do
             {
@@ -117,6 +118,8 @@ storageCopy(StorageRead *source, StorageWrite *destination)
             }
             while (!ioReadEof(storageReadIo(source)));
 
+            ioBufferPoolPut(read);
+
             // Close the source and destination files
             ioReadClose(storageReadIo(source));
             ioWriteClose(storageWriteIo(destination));
@@ -204,7 +207,7 @@ storageGet(StorageRead *file, StorageGetParam param)
             else
             {
                 result = bufNew(0);
-                Buffer *read = bufNew(ioBufferSize());
+                Buffer *read = ioBufferPoolGet();
 
                 do
                 {
@@ -216,6 +219,8 @@ storageGet(StorageRead *file, StorageGetParam param)
                     bufUsedZero(read);
                 }
                 while (!ioReadEof(storageReadIo(file)));
+
+                ioBufferPoolPut(read);
             }
 
             // Move buffer to parent context on success
@@ -274,13 +279,265 @@ storageInfo(const Storage *this, const String *fileExp, StorageInfoParam param)
 /***********************************************************************************************************************************
 Info for all files/paths in a path
 ***********************************************************************************************************************************/
+// Storage for sorted runs when there are more entries in a path than can be sorted in memory
+typedef struct StorageInfoListSortSpill
+{
+    const Storage *storage;                                         // Storage where sorted runs are written
+    unsigned int runMax;                                            // Max entries to sort in memory before writing a run
+    unsigned int runTotal;                                          // Total runs written, used to generate unique run names
+} StorageInfoListSortSpill;
+
 typedef struct StorageInfoListSortData
 {
+    MemContext *parentContext;                                      // Mem context where the list mem context is created
     MemContext *memContext;                                         // Mem context to use for allocating data in this struct
     StringList *ownerList;                                          // List of users and groups to reduce memory usage
     List *infoList;                                                 // List of info
+    SortOrder sortOrder;                                            // Sort order
+    StorageInfoListSortSpill *spill;                                // Spill sorted runs to storage when set
+    StringList *runList;                                            // Sorted runs written to spill storage
 } StorageInfoListSortData;
 
+// Create the list that info is sorted in.  A new mem context is used so the memory can be freed after a run is written.
+static void
+storageInfoListSortNew(StorageInfoListSortData *data)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+    FUNCTION_TEST_END();
+
+    MEM_CONTEXT_BEGIN(data->parentContext)
+    {
+        MEM_CONTEXT_NEW_BEGIN("StorageInfoListSort")
+        {
+            data->memContext = MEM_CONTEXT_NEW();
+            data->ownerList = strLstNew();
+            data->infoList = lstNewP(sizeof(StorageInfo), .comparator = lstComparatorStr);
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Write info sorted in memory to a run in spill storage.  Each info is written as a json array on a single line.
+static void
+storageInfoListSortRunWrite(StorageInfoListSortData *data)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+    FUNCTION_TEST_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        lstSort(data->infoList, data->sortOrder);
+
+        const String *runName = strNewFmt("%u.run", data->spill->runTotal++);
+        IoWrite *write = storageWriteIo(storageNewWriteP(data->spill->storage, runName, .noAtomic = true, .noSyncFile = true));
+        ioWriteOpen(write);
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            for (unsigned int infoIdx = 0; infoIdx < lstSize(data->infoList); infoIdx++)
+            {
+                const StorageInfo *info = lstGet(data->infoList, infoIdx);
+
+                ioWriteStrLine(
+                    write,
+                    strNewFmt(
+                        "[%s,%u,%s,%u,%s,%u,%s,%u,%" PRId64 ",%" PRIu64 "]", strPtr(jsonFromStr(info->name)), info->type,
+                        strPtr(jsonFromStr(info->linkDestination)), (unsigned int)info->userId, strPtr(jsonFromStr(info->user)),
+                        (unsigned int)info->groupId, strPtr(jsonFromStr(info->group)), (unsigned int)info->mode,
+                        (int64_t)info->timeModified, info->size));
+
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        ioWriteClose(write);
+
+        strLstAdd(data->runList, runName);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    // Free the info that was written and start a new list
+    memContextFree(data->memContext);
+    storageInfoListSortNew(data);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// State of a run being merged
+typedef struct StorageInfoListSortRun
+{
+    MemContext *memContext;                                         // Mem context for the current info
+    IoRead *read;                                                   // Read the run
+    StorageInfo info;                                               // Current info
+} StorageInfoListSortRun;
+
+// Read the next info from a run.  Returns false at the end of the run.
+static bool
+storageInfoListSortRunNext(StorageInfoListSortRun *run)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, run);
+    FUNCTION_TEST_END();
+
+    bool result = false;
+
+    // Free the prior info
+    if (run->memContext != NULL)
+    {
+        memContextFree(run->memContext);
+        run->memContext = NULL;
+    }
+
+    // The end of the run is reached when an empty line is read
+    MEM_CONTEXT_NEW_BEGIN("StorageInfoListSortRun")
+    {
+        run->memContext = MEM_CONTEXT_NEW();
+
+        const String *line = ioReadLineParam(run->read, true);
+
+        if (!strEmpty(line))
+        {
+            const VariantList *infoList = jsonToVarLst(line);
+
+            run->info = (StorageInfo)
+            {
+                .name = varStr(varLstGet(infoList, 0)),
+                .type = (StorageType)varUIntForce(varLstGet(infoList, 1)),
+                .exists = true,
+                .linkDestination = varStr(varLstGet(infoList, 2)),
+                .userId = (uid_t)varUIntForce(varLstGet(infoList, 3)),
+                .user = varStr(varLstGet(infoList, 4)),
+                .groupId = (gid_t)varUIntForce(varLstGet(infoList, 5)),
+                .group = varStr(varLstGet(infoList, 6)),
+                .mode = (mode_t)varUIntForce(varLstGet(infoList, 7)),
+                .timeModified = (time_t)varInt64Force(varLstGet(infoList, 8)),
+                .size = varUInt64Force(varLstGet(infoList, 9)),
+            };
+
+            result = true;
+        }
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Does the current info of the first run sort before the current info of the second run?
+static bool
+storageInfoListSortRunBefore(const StorageInfoListSortRun *run1, const StorageInfoListSortRun *run2, SortOrder sortOrder)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, run1);
+        FUNCTION_TEST_PARAM_P(VOID, run2);
+        FUNCTION_TEST_PARAM(ENUM, sortOrder);
+    FUNCTION_TEST_END();
+
+    int compare = strCmp(run1->info.name, run2->info.name);
+
+    FUNCTION_TEST_RETURN(sortOrder == sortOrderAsc ? compare < 0 : compare > 0);
+}
+
+// Move a run down the heap until neither of its children sorts before it
+static void
+storageInfoListSortRunSift(List *runHeap, unsigned int runIdx, SortOrder sortOrder)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, runHeap);
+        FUNCTION_TEST_PARAM(UINT, runIdx);
+        FUNCTION_TEST_PARAM(ENUM, sortOrder);
+    FUNCTION_TEST_END();
+
+    while (true)
+    {
+        unsigned int runNextIdx = runIdx;
+
+        for (unsigned int childIdx = runIdx * 2 + 1; childIdx <= runIdx * 2 + 2 && childIdx < lstSize(runHeap); childIdx++)
+        {
+            if (storageInfoListSortRunBefore(lstGet(runHeap, childIdx), lstGet(runHeap, runNextIdx), sortOrder))
+                runNextIdx = childIdx;
+        }
+
+        if (runNextIdx == runIdx)
+            break;
+
+        StorageInfoListSortRun run = *(StorageInfoListSortRun *)lstGet(runHeap, runIdx);
+        *(StorageInfoListSortRun *)lstGet(runHeap, runIdx) = *(StorageInfoListSortRun *)lstGet(runHeap, runNextIdx);
+        *(StorageInfoListSortRun *)lstGet(runHeap, runNextIdx) = run;
+
+        runIdx = runNextIdx;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Merge sorted runs and pass info to the callback in sort order.  Only the current info from each run is held in memory and the
+// runs are kept in a heap ordered by their current info so each info costs O(log runs) comparisons rather than a scan of all runs.
+static void
+storageInfoListSortMerge(StorageInfoListSortData *data, StorageInfoListCallback callback, void *callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(FUNCTIONP, callback);
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Open all runs and read the first info from each
+        List *runHeap = lstNew(sizeof(StorageInfoListSortRun));
+
+        for (unsigned int runIdx = 0; runIdx < strLstSize(data->runList); runIdx++)
+        {
+            StorageInfoListSortRun run =
+            {
+                .read = storageReadIo(storageNewReadNP(data->spill->storage, strLstGet(data->runList, runIdx))),
+            };
+
+            ioReadOpen(run.read);
+
+            // Runs are never empty so there is always a first info
+            storageInfoListSortRunNext(&run);
+            lstAdd(runHeap, &run);
+        }
+
+        // Order the runs into a heap so the run with the first info is always at the top
+        for (unsigned int runIdx = lstSize(runHeap) / 2; runIdx > 0; runIdx--)
+            storageInfoListSortRunSift(runHeap, runIdx - 1, data->sortOrder);
+
+        // Pass the first info in sort order to the callback until all runs are empty
+        while (lstSize(runHeap) > 0)
+        {
+            StorageInfoListSortRun *run = lstGet(runHeap, 0);
+            callback(callbackData, &run->info);
+
+            // If the run is empty then replace it with the last run in the heap
+            if (!storageInfoListSortRunNext(run))
+            {
+                ioReadClose(run->read);
+
+                *run = *(StorageInfoListSortRun *)lstGet(runHeap, lstSize(runHeap) - 1);
+                lstRemoveIdx(runHeap, lstSize(runHeap) - 1);
+            }
+
+            // Move the top run down to its place in the heap
+            storageInfoListSortRunSift(runHeap, 0, data->sortOrder);
+        }
+
+        // Remove the runs
+        for (unsigned int runIdx = 0; runIdx < strLstSize(data->runList); runIdx++)
+            storageRemoveNP(data->spill->storage, strLstGet(data->runList, runIdx));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 static void
 storageInfoListSortCallback(void *data, const StorageInfo *info)
 {
@@ -304,17 +561,23 @@ storageInfoListSortCallback(void *data, const StorageInfo *info)
     }
     MEM_CONTEXT_END();
 
+    // Write a sorted run when the max that can be sorted in memory has been reached
+    if (infoData->spill != NULL && lstSize(infoData->infoList) >= infoData->spill->runMax)
+        storageInfoListSortRunWrite(infoData);
+
     FUNCTION_TEST_RETURN_VOID();
 }
 
 static bool
 storageInfoListSort(
-    const Storage *this, const String *path, SortOrder sortOrder, StorageInfoListCallback callback, void *callbackData)
+    const Storage *this, const String *path, SortOrder sortOrder, StorageInfoListSortSpill *spill, StorageInfoListCallback callback,
+    void *callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE, this);
         FUNCTION_LOG_PARAM(STRING, path);
         FUNCTION_LOG_PARAM(ENUM, sortOrder);
+        FUNCTION_LOG_PARAM_P(VOID, spill);
         FUNCTION_LOG_PARAM(FUNCTIONP, callback);
         FUNCTION_LOG_PARAM_P(VOID, callbackData);
     FUNCTION_LOG_END();
@@ -336,26 +599,44 @@ storageInfoListSort(
         {
             StorageInfoListSortData data =
             {
-                .memContext = MEM_CONTEXT_TEMP(),
-                .ownerList = strLstNew(),
-                .infoList = lstNewP(sizeof(StorageInfo), .comparator = lstComparatorStr),
+                .parentContext = MEM_CONTEXT_TEMP(),
+                .sortOrder = sortOrder,
+                .spill = spill,
+                .runList = strLstNew(),
             };
 
+            storageInfoListSortNew(&data);
+
             result = this->interface.infoList(this->driver, path, storageInfoListSortCallback, &data);
-            lstSort(data.infoList, sortOrder);
 
-            MEM_CONTEXT_TEMP_RESET_BEGIN()
+            // If runs were written then write the remaining info as a run and merge the runs
+            if (strLstSize(data.runList) > 0)
             {
-                for (unsigned int infoIdx = 0; infoIdx < lstSize(data.infoList); infoIdx++)
-                {
-                    // Pass info to the caller
-                    callback(callbackData, lstGet(data.infoList, infoIdx));
+                if (lstSize(data.infoList) > 0)
+                    storageInfoListSortRunWrite(&data);
 
-                    // Reset the memory context occasionally
-                    MEM_CONTEXT_TEMP_RESET(1000);
+                storageInfoListSortMerge(&data, callback, callbackData);
+            }
+            // Else all info was sorted in memory
+            else
+            {
+                lstSort(data.infoList, sortOrder);
+
+                MEM_CONTEXT_TEMP_RESET_BEGIN()
+                {
+                    for (unsigned int infoIdx = 0; infoIdx < lstSize(data.infoList); infoIdx++)
+                    {
+                        // Pass info to the caller
+                        callback(callbackData, lstGet(data.infoList, infoIdx));
+
+                        // Reset the memory context occasionally
+                        MEM_CONTEXT_TEMP_RESET(1000);
+                    }
                 }
+                MEM_CONTEXT_TEMP_END();
             }
-            MEM_CONTEXT_TEMP_END();
+
+            memContextFree(data.memContext);
         }
     }
     MEM_CONTEXT_TEMP_END();
@@ -371,6 +652,7 @@ typedef struct StorageInfoListData
     RegExp *expression;                                             // Filter for names
     bool recurse;                                                   // Should we recurse?
     SortOrder sortOrder;                                            // Sort order
+    StorageInfoListSortSpill *spill;                                // Spill sorted runs to storage when set
     const String *path;                                             // Top-level path for info
     const String *subPath;                                          // Path below the top-level path (starts as NULL)
 } StorageInfoListData;
@@ -414,8 +696,8 @@ storageInfoListCallback(void *data, const StorageInfo *info)
             data.subPath = infoUpdate.name;
 
             storageInfoListSort(
-                data.storage, strNewFmt("%s/%s", strPtr(data.path), strPtr(data.subPath)), data.sortOrder, storageInfoListCallback,
-                &data);
+                data.storage, strNewFmt("%s/%s", strPtr(data.path), strPtr(data.subPath)), data.sortOrder, data.spill,
+                storageInfoListCallback, &data);
         }
 
         if (listData->sortOrder == sortOrderDesc)
@@ -438,11 +720,14 @@ storageInfoList(
         FUNCTION_LOG_PARAM(ENUM, param.sortOrder);
         FUNCTION_LOG_PARAM(STRING, param.expression);
         FUNCTION_LOG_PARAM(BOOL, param.recurse);
+        FUNCTION_LOG_PARAM(STORAGE, param.sortStorage);
+        FUNCTION_LOG_PARAM(UINT, param.sortMax);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(callback != NULL);
     ASSERT(this->interface.infoList != NULL);
+    ASSERT(param.sortStorage == NULL || param.sortMax > 0);
     ASSERT(!param.errorOnMissing || storageFeature(this, storageFeaturePath));
 
     bool result = false;
@@ -452,8 +737,18 @@ storageInfoList(
         // Build the path
         String *path = storagePathNP(this, pathExp);
 
-        // If there is an expression or recursion then the info will need to be filtered through a local callback
-        if (param.expression != NULL || param.recurse)
+        // Spill sorted runs to storage when requested so memory does not grow with the number of entries in a path
+        StorageInfoListSortSpill spillData = {.storage = param.sortStorage, .runMax = param.sortMax};
+        StorageInfoListSortSpill *spill = param.sortStorage == NULL ? NULL : &spillData;
+
+        // If the driver can list recursively in one pass then use it when the info does not need to be filtered or sorted
+        if (param.recurse && param.expression == NULL && param.sortOrder == sortOrderNone &&
+            this->interface.infoListRecurse != NULL)
+        {
+            result = this->interface.infoListRecurse(this->driver, path, callback, callbackData);
+        }
+        // Else if there is an expression or recursion then the info will need to be filtered through a local callback
+        else if (param.expression != NULL || param.recurse)
         {
             StorageInfoListData data =
             {
@@ -461,6 +756,7 @@ storageInfoList(
                 .callbackFunction = callback,
                 .callbackData = callbackData,
                 .sortOrder = param.sortOrder,
+                .spill = spill,
                 .recurse = param.recurse,
                 .path = path,
             };
@@ -468,10 +764,10 @@ storageInfoList(
             if (param.expression != NULL)
                 data.expression = regExpNew(param.expression);
 
-            result = storageInfoListSort(this, path, param.sortOrder, storageInfoListCallback, &data);
+            result = storageInfoListSort(this, path, param.sortOrder, spill, storageInfoListCallback, &data);
         }
         else
-            result = storageInfoListSort(this, path, param.sortOrder, callback, callbackData);
+            result = storageInfoListSort(this, path, param.sortOrder, spill, callback, callbackData);
 
         if (!result && param.errorOnMissing)
             THROW_FMT(PathMissingError, STORAGE_ERROR_LIST_INFO_MISSING, strPtr(path));
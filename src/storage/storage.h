@@ -112,6 +112,8 @@ typedef struct StorageInfoListParam
     SortOrder sortOrder;
     const String *expression;
     bool recurse;
+    const Storage *sortStorage;
+    unsigned int sortMax;
 } StorageInfoListParam;
 
 #define storageInfoListP(this, fileExp, callback, callbackData, ...)                                                               \
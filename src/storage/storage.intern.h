@@ -61,6 +61,8 @@ typedef struct StorageInterface
     bool (*exists)(void *driver, const String *file);
     StorageInfo (*info)(void *driver, const String *path, bool followLink);
     bool (*infoList)(void *driver, const String *file, StorageInfoListCallback callback, void *callbackData);
+    // Optional recursive infoList() for drivers that can list a tree faster than path by path.  Paths precede their contents.
+    bool (*infoListRecurse)(void *driver, const String *path, StorageInfoListCallback callback, void *callbackData);
     StringList *(*list)(void *driver, const String *path, const String *expression);
     bool (*move)(void *driver, StorageRead *source, StorageWrite *destination);
     StorageRead *(*newRead)(void *driver, const String *file, bool ignoreMissing, bool compressible);
@@ -343,6 +343,12 @@ sub backupEnd
         confess &log(ERROR, "'" . LINK_LATEST . "' link should not exist");
     }
 
+    # Check that the binary manifest was written next to the manifest
+    if (!storageRepo()->exists(STORAGE_REPO_BACKUP . "/${strBackup}/" . FILE_MANIFEST_BIN))
+    {
+        confess &log(ERROR, "'" . FILE_MANIFEST_BIN . "' should exist in '${strBackup}'");
+    }
+
     # Only do compare for synthetic backups since for real backups the expected manifest *is* the actual manifest.
     if ($self->synthetic())
     {
@@ -187,11 +187,31 @@ sub run
         $self->testResult(sub {$oBackupManifest->test(MANIFEST_SECTION_TARGET_FILE, $strRepoFile,
             MANIFEST_SUBKEY_CHECKSUM, $strFileHash)}, true, "manifest updated for $strRepoFile");
 
-        # Backup.manifest not written but backup.manifest.copy written because size threshold  met
-        $self->testResult(sub {storageTest()->exists("$strBackupPath/" . FILE_MANIFEST . INI_COPY_EXT)}, true,
-            'backup.manifest.copy exists in repo');
+        # Neither backup.manifest nor backup.manifest.copy written but journal written because size threshold met
+        $self->testResult(sub {storageTest()->exists("$strBackupPath/" . FILE_MANIFEST . INI_COPY_EXT . '.journal.000001')},
+            true, 'backup.manifest.copy.journal.000001 exists in repo');
         $self->testResult(
-            sub {storageRepo()->exists("$strBackupPath/" . FILE_MANIFEST)}, false, 'backup.manifest.copy missing in repo');
+            sub {storageRepo()->exists("$strBackupPath/" . FILE_MANIFEST . INI_COPY_EXT)}, false,
+            'backup.manifest.copy missing in repo');
+        $self->testResult(
+            sub {storageRepo()->exists("$strBackupPath/" . FILE_MANIFEST)}, false, 'backup.manifest missing in repo');
+
+        # Journal is replayed when the manifest is loaded from the copy
+        my $oAbortedManifest = new pgBackRest::Manifest("$strBackupPath/" . FILE_MANIFEST,
+            {bLoad => false, strDbVersion => PG_VERSION_94, iDbCatalogVersion => 201409291});
+        $oAbortedManifest->build(storageDb(), $self->{strDbPath}, undef, true, false);
+        $oAbortedManifest->saveCopy();
+
+        $self->testResult(sub {(new pgBackRest::Manifest("$strBackupPath/" . FILE_MANIFEST))->test(
+            MANIFEST_SECTION_TARGET_FILE, $strRepoFile, MANIFEST_SUBKEY_CHECKSUM, $strFileHash)}, true,
+            "journal replayed for $strRepoFile");
+
+        # Journal is removed when the copy is saved
+        $oBackupManifest->saveCopy();
+
+        $self->testResult(sub {storageTest()->exists("$strBackupPath/" . FILE_MANIFEST . INI_COPY_EXT . '.journal.000001')},
+            false, 'backup.manifest.copy.journal.000001 removed from repo');
+        storageRepo()->remove("$strBackupPath/" . FILE_MANIFEST . INI_COPY_EXT);
 
         #---------------------------------------------------------------------------------------------------------------------------
         #  Set up page checksum result
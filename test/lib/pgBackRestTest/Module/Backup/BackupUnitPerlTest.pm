@@ -24,6 +24,7 @@ use pgBackRest::Config::Config;
 use pgBackRest::DbVersion;
 use pgBackRest::Manifest;
 use pgBackRest::Protocol::Helper;
+use pgBackRest::Protocol::Local::Process;
 use pgBackRest::Protocol::Storage::Helper;
 use pgBackRest::Storage::Helper;
 
@@ -404,6 +405,182 @@ sub run
         $self->testResult(sub {$oManifest->boolTest(MANIFEST_SECTION_TARGET_FILE, $strInManifestWithChecksum,
             MANIFEST_SUBKEY_CHECKSUM_PAGE, true)}, true, '    checksum page set true in manifest');
     }
+
+    ################################################################################################################################
+    if ($self->begin('copyHostAdd()'))
+    {
+        $self->optionTestSet(CFGOPT_STANZA, $self->stanza());
+        $self->optionTestSet(CFGOPT_REPO_PATH, $self->testPath() . '/repo');
+        $self->optionTestSet(CFGOPT_PG_PATH, $self->testPath() . '/db');
+        $self->optionTestSet(CFGOPT_PROCESS_MAX, 3);
+        $self->configTestLoad(CFGCMD_BACKUP);
+
+        my $oBackup = new pgBackRest::Backup::Backup();
+        $oBackup->{iMasterRemoteIdx} = 1;
+        $oBackup->{iCopyRemoteIdx} = 2;
+
+        # Single standby gets all the processes
+        #---------------------------------------------------------------------------------------------------------------------------
+        my $oBackupProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_DB);
+
+        $self->testResult(sub {$oBackup->copyHostAdd($oBackupProcess)}, 1, 'single standby');
+        $self->testResult(sub {$oBackupProcess->{hyHost}[0]{iProcessMax}}, 3, '    all processes on pg2');
+        $self->testResult(
+            sub {$oBackupProcess->hostQueue($oBackupProcess->{hyHost}[0])->{iHostConfigIdx}}, 2, '    pg2 owns its queue');
+
+        # Processes are split across two standbys that share the queue of the first standby
+        #---------------------------------------------------------------------------------------------------------------------------
+        $oBackup->{iyCopyRemoteIdx} = [2, 3];
+        $oBackupProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_DB);
+
+        $self->testResult(sub {$oBackup->copyHostAdd($oBackupProcess)}, 2, 'two standbys');
+        $self->testResult(sub {$oBackupProcess->{hyHost}[0]{iProcessMax}}, 2, '    two processes on pg2');
+        $self->testResult(sub {$oBackupProcess->{hyHost}[1]{iProcessMax}}, 1, '    one process on pg3');
+        $self->testResult(
+            sub {$oBackupProcess->hostQueue($oBackupProcess->{hyHost}[1])->{iHostConfigIdx}}, 2, '    pg3 shares queue of pg2');
+
+        # Jobs queued for the first standby are copied by whichever standby is free
+        $oBackupProcess->queueJob(2, 'pg_data', 'pg_data/1', 'backupFile', ['1']);
+        $oBackupProcess->queueJob(2, 'pg_data', 'pg_data/2', 'backupFile', ['2']);
+
+        $self->testResult(sub {defined($oBackupProcess->{hyHost}[1]{hyQueue}) ? true : false}, false, '    no queue on pg3');
+
+        $oBackupProcess->{oSelect} = IO::Select->new();
+        $oBackupProcess->{hyLocal} =
+        [
+            {iHostIdx => 0, iProcessId => 1, iQueueIdx => 0, iDirection => 1,
+                oLocal => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Local()},
+            {iHostIdx => 1, iProcessId => 2, iQueueIdx => 0, iDirection => 1,
+                oLocal => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Local()},
+        ];
+
+        $self->testResult(sub {$oBackupProcess->jobAssign()}, true, '    assign jobs');
+        $self->testResult(
+            sub {$oBackupProcess->{hyLocal}[0]{hJob}{strKey} . ' on pg' . $oBackupProcess->{hyLocal}[0]{hJob}{iHostConfigIdx}},
+            'pg_data/1 on pg2', '    first job copied from pg2');
+        $self->testResult(
+            sub {$oBackupProcess->{hyLocal}[1]{hJob}{strKey} . ' on pg' . $oBackupProcess->{hyLocal}[1]{hJob}{iHostConfigIdx}},
+            'pg_data/2 on pg3', '    second job copied from pg3');
+        $self->testResult(sub {$oBackupProcess->{hyLocal}[1]{oLocal}{strOp}}, 'backupFile', '    second job sent to pg3 local');
+
+        # More standbys than processes
+        #---------------------------------------------------------------------------------------------------------------------------
+        $oBackup->{iyCopyRemoteIdx} = [2, 3, 4, 5];
+        $oBackupProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_DB);
+
+        $self->testResult(sub {$oBackup->copyHostAdd($oBackupProcess)}, 3, 'more standbys than processes');
+        $self->testResult(
+            sub {join(', ', map {"pg$_->{iHostConfigIdx}=$_->{iProcessMax}"} @{$oBackupProcess->{hyHost}})}, 'pg2=1, pg3=1, pg4=1',
+            '    one process on each of the first three standbys');
+
+        # Shared queue must already exist
+        #---------------------------------------------------------------------------------------------------------------------------
+        $oBackupProcess = new pgBackRest::Protocol::Local::Process(CFGOPTVAL_LOCAL_TYPE_DB);
+
+        $self->testException(
+            sub {$oBackupProcess->hostAdd(3, 1, 2)}, ERROR_ASSERT, 'iQueueHostConfigIdx = 2 must be added before it can be shared');
+    }
+
+    ################################################################################################################################
+    if ($self->begin('standbyCopyGet()'))
+    {
+        $self->optionTestSet(CFGOPT_STANZA, $self->stanza());
+        $self->optionTestSet(CFGOPT_REPO_PATH, $self->testPath() . '/repo');
+        $self->optionTestSet(CFGOPT_PG_PATH, $self->testPath() . '/db');
+        $self->configTestLoad(CFGCMD_BACKUP);
+
+        my $oBackup = new pgBackRest::Backup::Backup();
+        my $oBackupInfo = new pgBackRestTest::Module::Backup::BackupUnitPerlTest::BackupInfo();
+
+        # No additional standbys
+        #---------------------------------------------------------------------------------------------------------------------------
+        $self->testResult(sub {$oBackup->standbyCopyGet($oBackupInfo, [], '0/1000028')}, '[undef]', 'no additional standbys');
+
+        # All standbys reach the backup start
+        #---------------------------------------------------------------------------------------------------------------------------
+        my $hyDbStandbyOther =
+        [
+            {iRemoteIdx => 3, oDb => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Db('0/1000030')},
+            {iRemoteIdx => 4, oDb => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Db('0/1000040')},
+        ];
+
+        $self->testResult(sub {$oBackup->standbyCopyGet($oBackupInfo, $hyDbStandbyOther, '0/1000028')}, '(3, 4)',
+            'two standbys reach backup start');
+        $self->testResult(sub {$oBackupInfo->{iCheckTotal}}, 2, '    both standbys checked against backup info');
+        $self->testResult(
+            sub {defined($hyDbStandbyOther->[0]{oDb}) || defined($hyDbStandbyOther->[1]{oDb}) ? true : false}, false,
+            '    db objects released');
+
+        # A standby that does not reach the backup start is skipped
+        #---------------------------------------------------------------------------------------------------------------------------
+        $hyDbStandbyOther =
+        [
+            {iRemoteIdx => 3, oDb => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Db()},
+            {iRemoteIdx => 4, oDb => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Db('0/1000040')},
+        ];
+
+        $self->testResult(sub {$oBackup->standbyCopyGet($oBackupInfo, $hyDbStandbyOther, '0/1000028')}, 4,
+            'standby pg3 drops out', {strLogExpect =>
+                "WARN: [082]: timeout before standby replayed to 0/1000028\n" .
+                "WARN: standby pg3 did not reach 0/1000028 and will not be used to copy files"});
+        $self->testResult(
+            sub {defined($hyDbStandbyOther->[0]{oDb}) ? true : false}, false, '    db object released for dropped standby');
+
+        # No standbys reach the backup start
+        #---------------------------------------------------------------------------------------------------------------------------
+        $hyDbStandbyOther =
+        [
+            {iRemoteIdx => 3, oDb => new pgBackRestTest::Module::Backup::BackupUnitPerlTest::Db()},
+        ];
+
+        $self->testResult(sub {$oBackup->standbyCopyGet($oBackupInfo, $hyDbStandbyOther, '0/1000028')}, '[undef]',
+            'only standby drops out', {strLogExpect =>
+                "WARN: standby pg3 did not reach 0/1000028 and will not be used to copy files"});
+    }
 }
 
+####################################################################################################################################
+# Db object for a standby that replays to the requested lsn or times out when no replay lsn is set
+####################################################################################################################################
+package pgBackRestTest::Module::Backup::BackupUnitPerlTest::Db;
+
+use Carp qw(confess);
+
+use pgBackRest::Common::Exception;
+use pgBackRest::Common::Log;
+use pgBackRest::DbVersion;
+
+sub new {my $class = shift; return bless({strReplayLsn => shift}, $class)}
+sub info {return (PG_VERSION_94, 942, 201409291, 6353949018581704918)}
+sub configValidate {}
+
+sub replayWait
+{
+    my $self = shift;
+    my $strTargetLsn = shift;
+
+    if (!defined($self->{strReplayLsn}))
+    {
+        confess &log(ERROR, "timeout before standby replayed to ${strTargetLsn}", ERROR_ARCHIVE_TIMEOUT);
+    }
+
+    return ($self->{strReplayLsn}, undef);
+}
+
+####################################################################################################################################
+# Backup info object that accepts any db and counts the checks
+####################################################################################################################################
+package pgBackRestTest::Module::Backup::BackupUnitPerlTest::BackupInfo;
+
+sub new {return bless({iCheckTotal => 0}, shift)}
+sub check {return ++shift->{iCheckTotal}}
+
+####################################################################################################################################
+# Local process that records the last command written instead of running it
+####################################################################################################################################
+package pgBackRestTest::Module::Backup::BackupUnitPerlTest::Local;
+
+sub new {return bless({}, shift)}
+sub cmdWrite {my $self = shift; ($self->{strOp}, $self->{rParam}) = @_}
+
 1;
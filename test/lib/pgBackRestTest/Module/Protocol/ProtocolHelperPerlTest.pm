@@ -123,6 +123,30 @@ sub run
                 ' --config-path=/config-path-repo --log-level-file=off --pg1-path=/db1 --process=0 --protocol-timeout=1830' .
                 ' --repo1-path=/repo --stanza=db --type=backup remote)',
             'config params to repo host');
+
+        # --------------------------------------------------------------------------------------------------------------------------
+        $self->optionTestSet(CFGOPT_REPO_HOST_TYPE, CFGOPTVAL_REPO_HOST_TYPE_TLS);
+        $self->optionTestSet(CFGOPT_REPO_HOST_CERT_FILE, '/path/client.crt');
+        $self->optionTestSet(CFGOPT_REPO_HOST_KEY_FILE, '/path/client.key');
+        $self->configTestLoad(CFGCMD_RESTORE);
+
+        $self->testException(
+            sub {pgBackRest::Protocol::Helper::protocolParam(cfgCommandName(CFGCMD_RESTORE), CFGOPTVAL_REMOTE_TYPE_BACKUP)},
+            ERROR_OPTION_INVALID_VALUE, "option 'repo1-host-type=tls' is not supported by the restore command");
+
+        # --------------------------------------------------------------------------------------------------------------------------
+        $self->configTestClear();
+        $self->optionTestSet(CFGOPT_STANZA, $self->stanza());
+        $self->optionTestSet(cfgOptionIdFromIndex(CFGOPT_PG_HOST, 1), 'pg-host-1');
+        $self->optionTestSet(cfgOptionIdFromIndex(CFGOPT_PG_PATH, 1), '/db1');
+        $self->optionTestSet(cfgOptionIdFromIndex(CFGOPT_PG_HOST_TYPE, 1), CFGOPTVAL_PG_HOST_TYPE_TLS);
+        $self->optionTestSet(cfgOptionIdFromIndex(CFGOPT_PG_HOST_CERT_FILE, 1), '/path/client.crt');
+        $self->optionTestSet(cfgOptionIdFromIndex(CFGOPT_PG_HOST_KEY_FILE, 1), '/path/client.key');
+        $self->configTestLoad(CFGCMD_BACKUP);
+
+        $self->testException(
+            sub {pgBackRest::Protocol::Helper::protocolParam(cfgCommandName(CFGCMD_BACKUP), CFGOPTVAL_REMOTE_TYPE_DB, 1)},
+            ERROR_OPTION_INVALID_VALUE, "option 'pg1-host-type=tls' is not supported by the backup command");
     }
 
     ################################################################################################################################
@@ -0,0 +1,271 @@
+/***********************************************************************************************************************************
+Benchmark Test Harness
+***********************************************************************************************************************************/
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+#include "common/memContext.h"
+#include "common/type/json.h"
+#include "common/type/keyValue.h"
+
+#include "common/harnessBench.h"
+#include "common/harnessDebug.h"
+#include "common/harnessTest.h"
+
+/***********************************************************************************************************************************
+Max benchmarks that can be recorded by a test
+***********************************************************************************************************************************/
+#define HRN_BENCH_RESULT_MAX                                        64
+
+/***********************************************************************************************************************************
+Benchmark results
+***********************************************************************************************************************************/
+typedef struct HrnBenchResult
+{
+    char name[64];                                                  // Benchmark name
+    uint64_t iteration;                                             // Iterations run
+    uint64_t nsPerOp;                                               // Nanoseconds per iteration
+    uint64_t bytePerSec;                                            // Bytes per second (zero if no bytes were specified)
+    uint64_t allocPerOp;                                            // Allocations still active at the end of each iteration
+    uint64_t allocPeak;                                             // Highest bytes allocated by any iteration
+} HrnBenchResult;
+
+static HrnBenchResult hrnBenchResultList[HRN_BENCH_RESULT_MAX];
+static unsigned int hrnBenchResultTotal = 0;
+
+/***********************************************************************************************************************************
+Benchmark currently running
+***********************************************************************************************************************************/
+static struct
+{
+    HrnBenchParam param;                                            // Benchmark parameters
+    HrnBenchResult *result;                                         // Result being recorded
+    uint64_t timeBegin;                                             // Time the benchmark began in microseconds
+    uint64_t allocTotal;                                            // Active allocations at the end of all iterations
+    MemContext *memContext;                                         // Context for the current iteration
+    MemContext *memContextPrior;                                    // Context to restore after the iteration
+} hrnBenchLocal;
+
+/***********************************************************************************************************************************
+Get the time in microseconds
+***********************************************************************************************************************************/
+static uint64_t
+hrnBenchTimeUSec(void)
+{
+    struct timeval currentTime;
+    gettimeofday(&currentTime, NULL);
+
+    return (uint64_t)currentTime.tv_sec * 1000000 + (uint64_t)currentTime.tv_usec;
+}
+
+/**********************************************************************************************************************************/
+void
+hrnBenchBegin(const char *name, HrnBenchParam param)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(STRINGZ, name);
+
+        FUNCTION_HARNESS_ASSERT(name != NULL);
+        FUNCTION_HARNESS_ASSERT(strlen(name) < sizeof(hrnBenchResultList[0].name));
+        FUNCTION_HARNESS_ASSERT(hrnBenchResultTotal < HRN_BENCH_RESULT_MAX);
+        FUNCTION_HARNESS_ASSERT(hrnBenchLocal.result == NULL);
+    FUNCTION_HARNESS_END();
+
+    hrnBenchLocal.param = param;
+
+    if (hrnBenchLocal.param.iteration == 0)
+        hrnBenchLocal.param.iteration = HRN_BENCH_ITERATION_DEFAULT;
+
+    if (hrnBenchLocal.param.timeMSec == 0)
+        hrnBenchLocal.param.timeMSec = HRN_BENCH_TIME_MSEC_DEFAULT;
+
+    hrnBenchLocal.result = &hrnBenchResultList[hrnBenchResultTotal];
+    hrnBenchLocal.allocTotal = 0;
+    hrnBenchResultTotal++;
+
+    *hrnBenchLocal.result = (HrnBenchResult){0};
+    strcpy(hrnBenchLocal.result->name, name);
+
+    // Collect memory statistics for the iterations.  They are disabled by default and must work in builds without debug.
+    memContextStatEnable(true);
+
+    hrnBenchLocal.timeBegin = hrnBenchTimeUSec();
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
+
+/**********************************************************************************************************************************/
+bool
+hrnBenchNext(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    FUNCTION_HARNESS_ASSERT(hrnBenchLocal.result != NULL);
+
+    HrnBenchResult *result = hrnBenchLocal.result;
+    bool next = true;
+
+    // Finish the prior iteration
+    if (hrnBenchLocal.memContext != NULL)
+    {
+        memContextSwitch(hrnBenchLocal.memContextPrior);
+
+        MemContextStat stat = memContextStat(hrnBenchLocal.memContext);
+
+        if (stat.peak > result->allocPeak)
+            result->allocPeak = stat.peak;
+
+        hrnBenchLocal.allocTotal += stat.allocTotal;
+
+        memContextFree(hrnBenchLocal.memContext);
+        hrnBenchLocal.memContext = NULL;
+
+        result->iteration++;
+    }
+
+    uint64_t timeElapsed = hrnBenchTimeUSec() - hrnBenchLocal.timeBegin;
+
+    // Complete the benchmark when the minimum iterations and time have both been reached
+    if (result->iteration >= hrnBenchLocal.param.iteration && timeElapsed >= hrnBenchLocal.param.timeMSec * 1000)
+    {
+        result->nsPerOp = timeElapsed * 1000 / result->iteration;
+        result->allocPerOp = hrnBenchLocal.allocTotal / result->iteration;
+
+        if (hrnBenchLocal.param.byte > 0 && timeElapsed > 0)
+        {
+            result->bytePerSec = (uint64_t)(
+                (double)hrnBenchLocal.param.byte * (double)result->iteration * 1000000 / (double)timeElapsed);
+        }
+
+        TEST_LOG_FMT(
+            "bench %s: %" PRIu64 " iterations, %" PRIu64 " ns/op, %.2f MB/s, %" PRIu64 " allocs/op, %" PRIu64 " bytes peak",
+            result->name, result->iteration, result->nsPerOp, (double)result->bytePerSec / (1024 * 1024), result->allocPerOp,
+            result->allocPeak);
+
+        memContextStatEnable(false);
+
+        hrnBenchLocal.result = NULL;
+        next = false;
+    }
+    // Else start the next iteration in a new context
+    else
+    {
+        hrnBenchLocal.memContextPrior = memContextCurrent();
+        hrnBenchLocal.memContext = memContextNew("HrnBench");
+        memContextSwitch(hrnBenchLocal.memContext);
+    }
+
+    FUNCTION_HARNESS_RESULT(BOOL, next);
+}
+
+/**********************************************************************************************************************************/
+void
+hrnBenchComplete(const char *name)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(STRINGZ, name);
+
+        FUNCTION_HARNESS_ASSERT(name != NULL);
+    FUNCTION_HARNESS_END();
+
+    char path[1024];
+    char file[1024];
+
+    // Write results
+    if (snprintf(path, sizeof(path), "%s/test/bench", testRepoPath()) >= (int)sizeof(path))
+        THROW(AssertError, "bench path is too long");
+
+    if (mkdir(path, 0750) == -1 && errno != EEXIST)
+        THROW_SYS_ERROR_FMT(PathCreateError, "unable to create path '%s'", path);
+
+    if (snprintf(file, sizeof(file), "%s/%s.json", path, name) >= (int)sizeof(file))
+        THROW(AssertError, "bench file is too long");
+
+    FILE *result = fopen(file, "w");
+
+    if (result == NULL)
+        THROW_SYS_ERROR_FMT(FileOpenError, "unable to open '%s' for write", file);
+
+    fprintf(result, "{");
+
+    for (unsigned int resultIdx = 0; resultIdx < hrnBenchResultTotal; resultIdx++)
+    {
+        const HrnBenchResult *benchResult = &hrnBenchResultList[resultIdx];
+
+        fprintf(
+            result,
+            "%s\n    \"%s\": {\"allocPeak\": %" PRIu64 ", \"allocPerOp\": %" PRIu64 ", \"bytePerSec\": %" PRIu64
+                ", \"iteration\": %" PRIu64 ", \"nsPerOp\": %" PRIu64 "}",
+            resultIdx == 0 ? "" : ",", benchResult->name, benchResult->allocPeak, benchResult->allocPerOp, benchResult->bytePerSec,
+            benchResult->iteration, benchResult->nsPerOp);
+    }
+
+    fprintf(result, "\n}\n");
+    fclose(result);
+
+    // Compare with the baseline if it exists
+    if (snprintf(file, sizeof(file), "%s/%s.baseline.json", path, name) >= (int)sizeof(file))
+        THROW(AssertError, "bench baseline file is too long");
+
+    FILE *baseline = fopen(file, "r");
+
+    if (baseline != NULL)
+    {
+        unsigned int regressionTotal = 0;
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            String *baselineJson = strNew("");
+            char buffer[4096];
+            size_t bufferSize;
+
+            while ((bufferSize = fread(buffer, 1, sizeof(buffer) - 1, baseline)) > 0)
+            {
+                buffer[bufferSize] = '\0';
+                strCat(baselineJson, buffer);
+            }
+
+            fclose(baseline);
+
+            const KeyValue *baselineKv = varKv(jsonToVar(baselineJson));
+
+            for (unsigned int resultIdx = 0; resultIdx < hrnBenchResultTotal; resultIdx++)
+            {
+                const HrnBenchResult *benchResult = &hrnBenchResultList[resultIdx];
+                const Variant *baselineResult = kvGet(baselineKv, VARSTRZ(benchResult->name));
+
+                // Benchmarks missing from the baseline are new so there is nothing to compare
+                if (baselineResult == NULL)
+                    continue;
+
+                uint64_t baselineNsPerOp = varUInt64Force(kvGet(varKv(baselineResult), VARSTRDEF("nsPerOp")));
+
+                if (benchResult->nsPerOp * 100 > baselineNsPerOp * (100 + HRN_BENCH_TOLERANCE))
+                {
+                    TEST_LOG_FMT(
+                        "bench %s: REGRESSION %" PRIu64 " ns/op is slower than baseline %" PRIu64 " ns/op", benchResult->name,
+                        benchResult->nsPerOp, baselineNsPerOp);
+
+                    regressionTotal++;
+                }
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        if (regressionTotal > 0)
+        {
+            THROW_FMT(
+                AssertError, "%u benchmark(s) more than %d%% slower than baseline '%s'", regressionTotal, HRN_BENCH_TOLERANCE,
+                file);
+        }
+    }
+
+    // Reset results for the next test
+    hrnBenchResultTotal = 0;
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
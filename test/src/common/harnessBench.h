@@ -0,0 +1,65 @@
+/***********************************************************************************************************************************
+Benchmark Test Harness
+
+Run a statement block repeatedly and record the time per iteration, throughput, and memory usage. Each iteration runs in its own
+memory context, which is freed before the next iteration, so allocations do not accumulate:
+
+HRN_BENCH("gzipCompressNew()", .byte = bufUsed(buffer))
+{
+    <Do something that processes buffer>
+}
+
+The block runs until both the minimum iterations and the minimum time have been reached, so fast operations are measured over
+enough iterations to be meaningful. Do not break out of the block early, since the iteration will not be recorded correctly.
+
+Call hrnBenchComplete() at the end of the test to write the results to test/bench/<name>.json in the repository. If
+test/bench/<name>.baseline.json exists, the results are compared with it. An error is thrown if any benchmark is slower than the
+baseline by more than the allowed tolerance. To create a baseline, copy a result file that is known to be good.
+***********************************************************************************************************************************/
+#ifndef TEST_COMMON_HARNESS_BENCH_H
+#define TEST_COMMON_HARNESS_BENCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************************
+Default minimum iterations and time for each benchmark
+***********************************************************************************************************************************/
+#define HRN_BENCH_ITERATION_DEFAULT                                 10
+#define HRN_BENCH_TIME_MSEC_DEFAULT                                 1000
+
+/***********************************************************************************************************************************
+Percent a benchmark may be slower than the baseline before it is flagged as a regression
+***********************************************************************************************************************************/
+#define HRN_BENCH_TOLERANCE                                         20
+
+/***********************************************************************************************************************************
+Parameters for each benchmark
+***********************************************************************************************************************************/
+typedef struct HrnBenchParam
+{
+    uint64_t iteration;                                             // Minimum iterations (defaults to HRN_BENCH_ITERATION_DEFAULT)
+    uint64_t timeMSec;                                              // Minimum time (defaults to HRN_BENCH_TIME_MSEC_DEFAULT)
+    uint64_t byte;                                                  // Bytes processed per iteration (for bytes/second)
+} HrnBenchParam;
+
+/***********************************************************************************************************************************
+Run a benchmark (at least one parameter is required)
+***********************************************************************************************************************************/
+#define HRN_BENCH(name, ...)                                                                                                       \
+    for (hrnBenchBegin(name, (HrnBenchParam){__VA_ARGS__}); hrnBenchNext();)
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Begin a benchmark. Use the HRN_BENCH() macro instead of calling this directly.
+void hrnBenchBegin(const char *name, HrnBenchParam param);
+
+// Start the next iteration and return false when the benchmark is complete. Use the HRN_BENCH() macro instead of calling this
+// directly.
+bool hrnBenchNext(void);
+
+// Write results and compare them to the baseline (if it exists)
+void hrnBenchComplete(const char *name);
+
+#endif
@@ -0,0 +1,351 @@
+/***********************************************************************************************************************************
+PostgreSQL Data Directory Test Harness
+***********************************************************************************************************************************/
+#include <string.h>
+#include <unistd.h>
+
+#include "common/crypto/hash.h"
+#include "common/memContext.h"
+#include "common/type/convert.h"
+#include "postgres/interface.h"
+#include "postgres/pageChecksum.h"
+#include "postgres/version.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessDebug.h"
+#include "common/harnessPgData.h"
+
+/***********************************************************************************************************************************
+Page header with all the fields PostgreSQL writes so generated pages look like real pages
+***********************************************************************************************************************************/
+typedef struct HrnPgDataPageHeader
+{
+    uint32_t pd_lsn_walid;                                          // lsn high bits
+    uint32_t pd_lsn_xrecoff;                                        // lsn low bits
+    uint16_t pd_checksum;                                           // checksum
+    uint16_t pd_flags;                                              // flag bits
+    uint16_t pd_lower;                                              // offset to start of free space
+    uint16_t pd_upper;                                              // offset to end of free space
+    uint16_t pd_special;                                            // offset to start of special space
+    uint16_t pd_pagesize_version;                                   // page size and layout version
+    uint32_t pd_prune_xid;                                          // oldest prunable xid
+} HrnPgDataPageHeader;
+
+#define HRN_PG_DATA_PAGE_LAYOUT_VERSION                             4
+
+/***********************************************************************************************************************************
+First oid assigned to user objects. Databases, tablespaces, and relations are numbered from here in that order.
+***********************************************************************************************************************************/
+#define HRN_PG_DATA_OID_FIRST                                       16384
+
+/***********************************************************************************************************************************
+Random numbers (xorshift) so the same data directory is generated for the same seed
+***********************************************************************************************************************************/
+static uint32_t hrnPgDataRandomState = 1;
+
+static uint32_t
+hrnPgDataRandom(void)
+{
+    hrnPgDataRandomState ^= hrnPgDataRandomState << 13;
+    hrnPgDataRandomState ^= hrnPgDataRandomState >> 17;
+    hrnPgDataRandomState ^= hrnPgDataRandomState << 5;
+
+    return hrnPgDataRandomState;
+}
+
+/***********************************************************************************************************************************
+LSN written to pages. Incremented by each update so changed pages can be identified.
+***********************************************************************************************************************************/
+static uint64_t hrnPgDataLsn = HRN_PG_DATA_LSN_DEFAULT;
+
+/***********************************************************************************************************************************
+Generate a page with a valid header and checksum
+
+Line pointers grow up from the header and tuples grow down from the end of the page with free space between them. Tuple data uses
+half of each byte so the page compresses about as well as typical table data.
+***********************************************************************************************************************************/
+static void
+hrnPgDataPage(unsigned char *page, unsigned int blockNo)
+{
+    unsigned int lower = (unsigned int)sizeof(HrnPgDataPageHeader) + (16 + hrnPgDataRandom() % 48) * 4;
+    unsigned int upper = lower + ((hrnPgDataRandom() % (PG_PAGE_SIZE_DEFAULT / 2)) & ~7U);
+
+    for (unsigned int offset = sizeof(HrnPgDataPageHeader); offset < lower; offset += 4)
+        *(uint32_t *)(page + offset) = hrnPgDataRandom() & 0x0F0F0F0F;
+
+    memset(page + lower, 0, upper - lower);
+
+    for (unsigned int offset = upper; offset < PG_PAGE_SIZE_DEFAULT; offset += 4)
+        *(uint32_t *)(page + offset) = hrnPgDataRandom() & 0x0F0F0F0F;
+
+    *(HrnPgDataPageHeader *)page = (HrnPgDataPageHeader)
+    {
+        .pd_lsn_walid = (uint32_t)(hrnPgDataLsn >> 32),
+        .pd_lsn_xrecoff = (uint32_t)(hrnPgDataLsn & 0xFFFFFFFF),
+        .pd_lower = (uint16_t)lower,
+        .pd_upper = (uint16_t)upper,
+        .pd_special = (uint16_t)PG_PAGE_SIZE_DEFAULT,
+        .pd_pagesize_version = (uint16_t)(PG_PAGE_SIZE_DEFAULT | HRN_PG_DATA_PAGE_LAYOUT_VERSION),
+    };
+
+    ((HrnPgDataPageHeader *)page)->pd_checksum = pageChecksum(page, blockNo, PG_PAGE_SIZE_DEFAULT);
+}
+
+/***********************************************************************************************************************************
+Write a file and add it to the list
+***********************************************************************************************************************************/
+static void
+hrnPgDataFilePut(const Storage *storage, List *fileList, const String *name, const Buffer *content, bool checksumPage, bool zero)
+{
+    storagePutNP(storageNewWriteP(storage, name, .noSyncFile = true, .noSyncPath = true, .noAtomic = true), content);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(fileList))
+    {
+        HrnPgDataFile file =
+        {
+            .name = strDup(name),
+            .size = bufUsed(content),
+            .checksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, content)),
+            .checksumPage = checksumPage,
+            .zero = zero,
+        };
+
+        lstAdd(fileList, &file);
+    }
+    MEM_CONTEXT_END();
+}
+
+/***********************************************************************************************************************************
+Get the segment number of a relation file from the extension, e.g. 16390.2
+***********************************************************************************************************************************/
+static unsigned int
+hrnPgDataSegmentNo(const String *name)
+{
+    const char *extension = strchr(strrchr(strPtr(name), '/'), '.');
+
+    return extension == NULL ? 0 : cvtZToUInt(extension + 1);
+}
+
+/**********************************************************************************************************************************/
+List *
+hrnPgDataCreate(const Storage *storage, HrnPgDataParam param)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(STORAGE, storage);
+        FUNCTION_HARNESS_PARAM(UINT, param.relationTotal);
+        FUNCTION_HARNESS_PARAM(UINT64, param.sizeMax);
+        FUNCTION_HARNESS_PARAM(UINT64, param.segmentSize);
+
+        FUNCTION_HARNESS_ASSERT(storage != NULL);
+        FUNCTION_HARNESS_ASSERT(param.zeroPercent <= 100);
+        FUNCTION_HARNESS_ASSERT(param.segmentSize % PG_PAGE_SIZE_DEFAULT == 0);
+    FUNCTION_HARNESS_END();
+
+    if (param.pgVersion == 0)
+        param.pgVersion = PG_VERSION_MAX;
+
+    if (param.relationTotal == 0)
+        param.relationTotal = HRN_PG_DATA_RELATION_TOTAL_DEFAULT;
+
+    if (param.sizeMax == 0)
+        param.sizeMax = HRN_PG_DATA_SIZE_MAX_DEFAULT;
+
+    if (param.segmentSize == 0)
+        param.segmentSize = PG_SEGMENT_SIZE_DEFAULT;
+
+    if (param.databaseTotal == 0)
+        param.databaseTotal = 1;
+
+    if (param.seed == 0)
+        param.seed = 1;
+
+    hrnPgDataRandomState = param.seed;
+    hrnPgDataLsn = HRN_PG_DATA_LSN_DEFAULT;
+
+    List *result = lstNew(sizeof(HrnPgDataFile));
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *pgPath = storagePathNP(storage, NULL);
+        const Buffer *version = BUFSTR(strNewFmt("%s\n", strPtr(pgVersionToStr(param.pgVersion))));
+
+        // Create files that are not relations
+        hrnPgDataFilePut(storage, result, STRDEF("PG_VERSION"), version, false, false);
+
+        Buffer *fileNodeMap = bufNew(512);
+        bufUsedSet(fileNodeMap, bufSize(fileNodeMap));
+        memset(bufPtr(fileNodeMap), 0, bufSize(fileNodeMap));
+
+        hrnPgDataFilePut(storage, result, STRDEF("global/pg_filenode.map"), fileNodeMap, false, false);
+
+        // Create database paths in base and each tablespace. Tablespaces are located outside the data directory and linked from
+        // pg_tblspc, the same as PostgreSQL.
+        StringList *databasePathList = strLstNew();
+
+        for (unsigned int databaseIdx = 0; databaseIdx < param.databaseTotal; databaseIdx++)
+        {
+            String *databasePath = strNewFmt("base/%u", HRN_PG_DATA_OID_FIRST + databaseIdx);
+
+            storagePathCreateNP(storage, databasePath);
+            hrnPgDataFilePut(storage, result, strNewFmt("%s/PG_VERSION", strPtr(databasePath)), version, false, false);
+            strLstAdd(databasePathList, databasePath);
+        }
+
+        if (param.tablespaceTotal > 0)
+        {
+            storagePathCreateNP(storage, STRDEF("pg_tblspc"));
+
+            const Storage *storageTablespace = storagePosixNew(
+                strNewFmt("%s-tablespace", strPtr(pgPath)), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+            for (unsigned int tablespaceIdx = 0; tablespaceIdx < param.tablespaceTotal; tablespaceIdx++)
+            {
+                unsigned int tablespaceOid = HRN_PG_DATA_OID_FIRST + param.databaseTotal + tablespaceIdx;
+                const String *tablespaceLink = storagePathNP(storage, strNewFmt("pg_tblspc/%u", tablespaceOid));
+                const String *tablespacePath = storagePathNP(storageTablespace, strNewFmt("%u", tablespaceOid));
+
+                storagePathCreateNP(storageTablespace, tablespacePath);
+
+                THROW_ON_SYS_ERROR_FMT(
+                    symlink(strPtr(tablespacePath), strPtr(tablespaceLink)) == -1, FileOpenError, "unable to create link '%s'",
+                    strPtr(tablespaceLink));
+
+                for (unsigned int databaseIdx = 0; databaseIdx < param.databaseTotal; databaseIdx++)
+                {
+                    String *databasePath = strNewFmt(
+                        "pg_tblspc/%u/%s/%u", tablespaceOid, strPtr(pgTablespaceId(param.pgVersion)),
+                        HRN_PG_DATA_OID_FIRST + databaseIdx);
+
+                    storagePathCreateNP(storage, databasePath);
+                    strLstAdd(databasePathList, databasePath);
+                }
+            }
+        }
+
+        // Create relations. Sizes are distributed logarithmically by picking a power of two up to the max and then a size up to
+        // that power of two.
+        unsigned int pageMax = (unsigned int)(param.sizeMax / PG_PAGE_SIZE_DEFAULT);
+        unsigned int pageBits = 0;
+
+        while (pageMax >> (pageBits + 1) > 0)
+            pageBits++;
+
+        unsigned int segmentPageTotal = (unsigned int)(param.segmentSize / PG_PAGE_SIZE_DEFAULT);
+        unsigned int relationOid = HRN_PG_DATA_OID_FIRST + param.databaseTotal + param.tablespaceTotal;
+
+        for (unsigned int relationIdx = 0; relationIdx < param.relationTotal; relationIdx++)
+        {
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                unsigned int pageTotal = 1 + hrnPgDataRandom() % (1U << (hrnPgDataRandom() % (pageBits + 1)));
+                const String *relationFile = strNewFmt(
+                    "%s/%u", strPtr(strLstGet(databasePathList, relationIdx % strLstSize(databasePathList))),
+                    relationOid + relationIdx);
+
+                for (unsigned int segmentNo = 0; segmentNo * segmentPageTotal < pageTotal; segmentNo++)
+                {
+                    unsigned int segmentPage = pageTotal - segmentNo * segmentPageTotal;
+
+                    if (segmentPage > segmentPageTotal)
+                        segmentPage = segmentPageTotal;
+
+                    Buffer *segment = bufNew(segmentPage * PG_PAGE_SIZE_DEFAULT);
+                    bufUsedSet(segment, bufSize(segment));
+
+                    bool zero = hrnPgDataRandom() % 100 < param.zeroPercent;
+
+                    if (zero)
+                        memset(bufPtr(segment), 0, bufSize(segment));
+                    else
+                    {
+                        for (unsigned int pageIdx = 0; pageIdx < segmentPage; pageIdx++)
+                        {
+                            hrnPgDataPage(
+                                bufPtr(segment) + pageIdx * PG_PAGE_SIZE_DEFAULT, segmentNo * PG_SEGMENT_PAGE_DEFAULT + pageIdx);
+                        }
+                    }
+
+                    hrnPgDataFilePut(
+                        storage, result,
+                        segmentNo == 0 ? relationFile : strNewFmt("%s.%u", strPtr(relationFile), segmentNo), segment, true, zero);
+                }
+            }
+            MEM_CONTEXT_TEMP_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_HARNESS_RESULT(LIST, result);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+hrnPgDataUpdate(const Storage *storage, List *fileList, unsigned int percent)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(STORAGE, storage);
+        FUNCTION_HARNESS_PARAM(LIST, fileList);
+        FUNCTION_HARNESS_PARAM(UINT, percent);
+
+        FUNCTION_HARNESS_ASSERT(storage != NULL);
+        FUNCTION_HARNESS_ASSERT(fileList != NULL);
+        FUNCTION_HARNESS_ASSERT(percent <= 100);
+    FUNCTION_HARNESS_END();
+
+    unsigned int result = 0;
+
+    // Pages written by this update get a higher LSN than all prior pages
+    hrnPgDataLsn += 0x01000000;
+
+    for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+    {
+        HrnPgDataFile *file = lstGet(fileList, fileIdx);
+        file->changed = false;
+
+        if (!file->checksumPage || file->zero || hrnPgDataRandom() % 100 >= percent)
+            continue;
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Rewrite every eighth page starting from a random page
+            Buffer *content = storageGetNP(storageNewReadNP(storage, file->name));
+            unsigned int segmentNo = hrnPgDataSegmentNo(file->name);
+            unsigned int pageTotal = (unsigned int)(bufUsed(content) / PG_PAGE_SIZE_DEFAULT);
+
+            for (unsigned int pageIdx = hrnPgDataRandom() % 8 % pageTotal; pageIdx < pageTotal; pageIdx += 8)
+                hrnPgDataPage(bufPtr(content) + pageIdx * PG_PAGE_SIZE_DEFAULT, segmentNo * PG_SEGMENT_PAGE_DEFAULT + pageIdx);
+
+            storagePutNP(storageNewWriteP(storage, file->name, .noSyncFile = true, .noSyncPath = true, .noAtomic = true), content);
+
+            MEM_CONTEXT_BEGIN(lstMemContext(fileList))
+            {
+                file->checksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, content));
+            }
+            MEM_CONTEXT_END();
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        file->changed = true;
+        result++;
+    }
+
+    FUNCTION_HARNESS_RESULT(UINT, result);
+}
+
+/**********************************************************************************************************************************/
+uint64_t
+hrnPgDataSize(const List *fileList)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(LIST, fileList);
+
+        FUNCTION_HARNESS_ASSERT(fileList != NULL);
+    FUNCTION_HARNESS_END();
+
+    uint64_t result = 0;
+
+    for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+        result += ((HrnPgDataFile *)lstGet(fileList, fileIdx))->size;
+
+    FUNCTION_HARNESS_RESULT(UINT64, result);
+}
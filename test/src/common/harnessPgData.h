@@ -0,0 +1,73 @@
+/***********************************************************************************************************************************
+PostgreSQL Data Directory Test Harness
+
+Generate a synthetic PostgreSQL data directory for benchmarking backup and restore without a running cluster. Relation sizes are
+distributed logarithmically between one page and sizeMax so, like a real cluster, most relations are small and a few are large.
+Relation pages have valid headers and checksums, a percentage of segments can be zero-filled like relations that have been extended
+but not yet written, and relations larger than segmentSize are split into numbered segments. Relations are spread across databases
+in base and tablespaces linked from pg_tblspc.
+
+Page checksums are calculated with the block number PostgreSQL would use for a 1GB segment size so they validate when segmentSize is
+reduced to keep the data directory small.
+***********************************************************************************************************************************/
+#ifndef TEST_COMMON_HARNESS_PG_DATA_H
+#define TEST_COMMON_HARNESS_PG_DATA_H
+
+#include <stdint.h>
+
+#include "common/type/list.h"
+#include "common/type/string.h"
+#include "storage/storage.h"
+
+/***********************************************************************************************************************************
+Data directory defaults
+***********************************************************************************************************************************/
+#define HRN_PG_DATA_RELATION_TOTAL_DEFAULT                          100
+#define HRN_PG_DATA_SIZE_MAX_DEFAULT                                (1024 * 1024)
+#define HRN_PG_DATA_LSN_DEFAULT                                     0x0000000100000000
+
+/***********************************************************************************************************************************
+Data directory parameters
+***********************************************************************************************************************************/
+typedef struct HrnPgDataParam
+{
+    unsigned int pgVersion;                                         // PostgreSQL version (defaults to PG_VERSION_MAX)
+    unsigned int relationTotal;                                     // Relations to create across all databases and tablespaces
+    uint64_t sizeMax;                                               // Largest relation (defaults to HRN_PG_DATA_SIZE_MAX_DEFAULT)
+    uint64_t segmentSize;                                           // Relation segment size (defaults to PG_SEGMENT_SIZE_DEFAULT)
+    unsigned int zeroPercent;                                       // Percent of segments that are zero-filled
+    unsigned int databaseTotal;                                     // Databases in base and each tablespace (defaults to 1)
+    unsigned int tablespaceTotal;                                   // Tablespaces to create in <pg path>-tablespace
+    uint32_t seed;                                                  // Seed for generating sizes and content (defaults to 1)
+} HrnPgDataParam;
+
+/***********************************************************************************************************************************
+Files created in the data directory
+***********************************************************************************************************************************/
+typedef struct HrnPgDataFile
+{
+    const String *name;                                             // File name relative to the data directory
+    uint64_t size;                                                  // File size
+    const String *checksum;                                         // SHA1 checksum of the file content
+    bool checksumPage;                                              // Are page checksums valid for this file?
+    bool zero;                                                      // Is the file zero-filled?
+    bool changed;                                                   // Was the file changed by the last hrnPgDataUpdate()?
+} HrnPgDataFile;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Create the data directory in the base path of storage and return a list of HrnPgDataFile
+#define hrnPgDataCreateP(storage, ...)                                                                                             \
+    hrnPgDataCreate(storage, (HrnPgDataParam){__VA_ARGS__})
+
+List *hrnPgDataCreate(const Storage *storage, HrnPgDataParam param);
+
+// Write new pages to percent of the relation segments that are not zero-filled, as an incremental backup would see after activity
+// in the cluster. Changed files are marked in the list and the number of files changed is returned.
+unsigned int hrnPgDataUpdate(const Storage *storage, List *fileList, unsigned int percent);
+
+// Total size of all files in the list
+uint64_t hrnPgDataSize(const List *fileList);
+
+#endif
@@ -0,0 +1,941 @@
+/***********************************************************************************************************************************
+S3 Test Harness
+***********************************************************************************************************************************/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <openssl/ssl.h>
+
+#include "common/crypto/common.h"
+#include "common/crypto/hash.h"
+#include "common/error.h"
+#include "common/fork.h"
+#include "common/io/http/header.h"
+#include "common/io/io.h"
+#include "common/memContext.h"
+#include "common/type/convert.h"
+#include "common/type/list.h"
+#include "common/type/xml.h"
+#include "common/wait.h"
+#include "storage/posix/storage.h"
+#include "storage/write.intern.h"
+
+#include "common/harnessDebug.h"
+#include "common/harnessS3.h"
+#include "common/harnessTls.h"
+
+/***********************************************************************************************************************************
+Size of the connection read buffer and of the chunks used to send content
+***********************************************************************************************************************************/
+#define HRN_S3_BUFFER_SIZE                                          65536
+
+/***********************************************************************************************************************************
+Storage paths for objects and multipart uploads
+***********************************************************************************************************************************/
+#define HRN_S3_PATH_OBJECT                                          "object"
+#define HRN_S3_PATH_UPLOAD                                          "upload"
+
+/***********************************************************************************************************************************
+Connection state (each connection runs in its own process)
+***********************************************************************************************************************************/
+typedef struct HrnS3Connection
+{
+    SSL *ssl;                                                       // TLS session
+    const Storage *storage;                                         // Storage for objects and uploads
+    const HrnS3ServerParam *param;                                  // Server parameters
+    unsigned int uploadTotal;                                       // Uploads initiated on this connection (to build upload ids)
+    bool head;                                                      // Is the current request HEAD? (content must not be sent)
+
+    unsigned char buffer[HRN_S3_BUFFER_SIZE];                       // Read buffer
+    size_t bufferPos;                                               // Current position in the read buffer
+    size_t bufferSize;                                              // Bytes in the read buffer
+} HrnS3Connection;
+
+static HrnS3Connection hrnS3Connection;
+
+/***********************************************************************************************************************************
+Sleep as needed to keep the transfer rate within the bandwidth limit
+***********************************************************************************************************************************/
+static void
+hrnS3Throttle(const HrnS3Connection *this, TimeMSec timeBegin, uint64_t byteTotal)
+{
+    if (this->param->bandwidth > 0)
+    {
+        TimeMSec timeExpected = byteTotal * 1000 / this->param->bandwidth;
+        TimeMSec timeElapsed = timeMSec() - timeBegin;
+
+        if (timeElapsed < timeExpected)
+            sleepMSec(timeExpected - timeElapsed);
+    }
+}
+
+/***********************************************************************************************************************************
+Fill the read buffer when it is empty. Returns false if the client closed the connection.
+***********************************************************************************************************************************/
+static bool
+hrnS3Fill(HrnS3Connection *this)
+{
+    if (this->bufferPos == this->bufferSize)
+    {
+        int result = SSL_read(this->ssl, this->buffer, sizeof(this->buffer));
+
+        if (result <= 0)
+            return false;
+
+        this->bufferPos = 0;
+        this->bufferSize = (size_t)result;
+    }
+
+    return true;
+}
+
+/***********************************************************************************************************************************
+Read a line (including the linefeed). Returns NULL if the client closed the connection.
+***********************************************************************************************************************************/
+static String *
+hrnS3ReadLine(HrnS3Connection *this)
+{
+    Buffer *result = bufNew(0);
+
+    do
+    {
+        if (!hrnS3Fill(this))
+            return NULL;
+
+        const unsigned char *linefeed = memchr(this->buffer + this->bufferPos, '\n', this->bufferSize - this->bufferPos);
+        size_t size = linefeed == NULL ?
+            this->bufferSize - this->bufferPos : (size_t)(linefeed - (this->buffer + this->bufferPos)) + 1;
+
+        bufCatC(result, this->buffer, this->bufferPos, size);
+        this->bufferPos += size;
+
+        if (linefeed != NULL)
+            break;
+    }
+    while (true);
+
+    return strNewBuf(result);
+}
+
+/***********************************************************************************************************************************
+Read the request content
+***********************************************************************************************************************************/
+static Buffer *
+hrnS3ReadContent(HrnS3Connection *this, size_t size)
+{
+    Buffer *result = bufNew(size);
+    TimeMSec timeBegin = timeMSec();
+
+    while (bufUsed(result) < size)
+    {
+        // Copy what is left in the read buffer and then read directly into the result
+        if (this->bufferPos < this->bufferSize)
+        {
+            size_t copySize = this->bufferSize - this->bufferPos;
+
+            if (copySize > size - bufUsed(result))
+                copySize = size - bufUsed(result);
+
+            bufCatC(result, this->buffer, this->bufferPos, copySize);
+            this->bufferPos += copySize;
+        }
+        else
+        {
+            size_t readSize = bufRemains(result) > HRN_S3_BUFFER_SIZE ? HRN_S3_BUFFER_SIZE : bufRemains(result);
+            int readResult = SSL_read(this->ssl, bufRemainsPtr(result), (int)readSize);
+
+            if (readResult <= 0)
+                THROW(FileReadError, "unexpected eof while reading content");
+
+            bufUsedInc(result, (size_t)readResult);
+        }
+
+        hrnS3Throttle(this, timeBegin, bufUsed(result));
+    }
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Write to the client
+***********************************************************************************************************************************/
+static void
+hrnS3Write(HrnS3Connection *this, const unsigned char *data, size_t size)
+{
+    TimeMSec timeBegin = timeMSec();
+    size_t sizeWritten = 0;
+
+    while (sizeWritten < size)
+    {
+        size_t writeSize = size - sizeWritten > HRN_S3_BUFFER_SIZE ? HRN_S3_BUFFER_SIZE : size - sizeWritten;
+
+        if (SSL_write(this->ssl, data + sizeWritten, (int)writeSize) != (int)writeSize)
+            THROW(FileWriteError, "unable to write to client");
+
+        sizeWritten += writeSize;
+        hrnS3Throttle(this, timeBegin, sizeWritten);
+    }
+}
+
+/***********************************************************************************************************************************
+Send a response. The content size is passed separately so HEAD can report the size without sending content.
+***********************************************************************************************************************************/
+static void
+hrnS3Response(
+    HrnS3Connection *this, unsigned int code, const char *message, const String *header, uint64_t contentSize,
+    const Buffer *content)
+{
+    if (this->param->latency > 0)
+        sleepMSec(this->param->latency);
+
+    String *response = strNewFmt(
+        "HTTP/1.1 %u %s\r\ncontent-length:%" PRIu64 "\r\n%s\r\n", code, message, contentSize,
+        header == NULL ? "" : strPtr(header));
+
+    hrnS3Write(this, (const unsigned char *)strPtr(response), strSize(response));
+
+    if (content != NULL && !this->head)
+        hrnS3Write(this, bufPtr(content), bufUsed(content));
+}
+
+static void
+hrnS3ResponseXml(HrnS3Connection *this, unsigned int code, const char *message, const XmlDocument *xml)
+{
+    const Buffer *content = xmlDocumentBuf(xml);
+    hrnS3Response(this, code, message, NULL, bufUsed(content), content);
+}
+
+static void
+hrnS3ResponseError(HrnS3Connection *this, unsigned int code, const char *message, const char *errorCode, const String *errorMessage)
+{
+    XmlDocument *xml = xmlDocumentNew(STRDEF("Error"));
+    xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(xml), STRDEF("Code")), STR(errorCode));
+    xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(xml), STRDEF("Message")), errorMessage);
+
+    hrnS3ResponseXml(this, code, message, xml);
+}
+
+/***********************************************************************************************************************************
+Decode a URI encoded string
+***********************************************************************************************************************************/
+static String *
+hrnS3UriDecode(const String *uri)
+{
+    String *result = strNew("");
+
+    for (size_t uriIdx = 0; uriIdx < strSize(uri); uriIdx++)
+    {
+        if (strPtr(uri)[uriIdx] == '%' && uriIdx + 2 < strSize(uri))
+        {
+            strCatChr(result, (char)cvtZToUIntBase(strPtr(strSubN(uri, uriIdx + 1, 2)), 16));
+            uriIdx += 2;
+        }
+        else
+            strCatChr(result, strPtr(uri)[uriIdx]);
+    }
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Get a decoded value from the query. Returns NULL if the key is missing.
+***********************************************************************************************************************************/
+static String *
+hrnS3QueryGet(const String *query, const char *key)
+{
+    const StringList *queryList = strLstNewSplitZ(query, "&");
+
+    for (unsigned int queryIdx = 0; queryIdx < strLstSize(queryList); queryIdx++)
+    {
+        const String *queryItem = strLstGet(queryList, queryIdx);
+        int equalIdx = strChr(queryItem, '=');
+
+        if (equalIdx == -1 ? strEqZ(queryItem, key) : strEqZ(strSubN(queryItem, 0, (size_t)equalIdx), key))
+            return equalIdx == -1 ? strNew("") : hrnS3UriDecode(STR(strPtr(queryItem) + equalIdx + 1));
+    }
+
+    return NULL;
+}
+
+/***********************************************************************************************************************************
+Validate the request signature. Returns an S3 error code if the request is not authorized, else NULL.
+
+The canonical request is rebuilt from the request exactly as it was received, so this validates the driver's encoding of the URI,
+query, and headers as well as the signature itself.
+***********************************************************************************************************************************/
+static const char *
+hrnS3Authorize(
+    const HrnS3Connection *this, const String *verb, const String *uriPath, const String *uriQuery, const HttpHeader *header,
+    const Buffer *content)
+{
+    const String *authorization = httpHeaderGet(header, STRDEF("authorization"));
+
+    if (authorization == NULL || !strBeginsWithZ(authorization, "AWS4-HMAC-SHA256 "))
+        return "AccessDenied";
+
+    // Split authorization into credential, signed headers, and signature
+    const String *credential = NULL;
+    const String *signedHeaders = NULL;
+    const String *signature = NULL;
+    const StringList *authList = strLstNewSplitZ(strSub(authorization, sizeof("AWS4-HMAC-SHA256")), ",");
+
+    for (unsigned int authIdx = 0; authIdx < strLstSize(authList); authIdx++)
+    {
+        const String *auth = strLstGet(authList, authIdx);
+
+        if (strBeginsWithZ(auth, "Credential="))
+            credential = strSub(auth, sizeof("Credential=") - 1);
+        else if (strBeginsWithZ(auth, "SignedHeaders="))
+            signedHeaders = strSub(auth, sizeof("SignedHeaders=") - 1);
+        else if (strBeginsWithZ(auth, "Signature="))
+            signature = strSub(auth, sizeof("Signature=") - 1);
+    }
+
+    if (credential == NULL || signedHeaders == NULL || signature == NULL)
+        return "AuthorizationHeaderMalformed";
+
+    // Credential is <access key>/<date>/<region>/s3/aws4_request
+    const StringList *credentialList = strLstNewSplitZ(credential, "/");
+
+    if (strLstSize(credentialList) != 5)
+        return "AuthorizationHeaderMalformed";
+
+    if (!strEqZ(strLstGet(credentialList, 0), this->param->accessKey))
+        return "InvalidAccessKeyId";
+
+    const char *region = this->param->region == NULL ? "us-east-1" : this->param->region;
+
+    if (!strEqZ(strLstGet(credentialList, 2), region))
+        return "AuthorizationHeaderMalformed";
+
+    // Check the payload hash
+    const String *payloadHash = httpHeaderGet(header, STRDEF("x-amz-content-sha256"));
+
+    if (payloadHash == NULL || !strEq(payloadHash, bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, content))))
+        return "XAmzContentSHA256Mismatch";
+
+    // Build the canonical request
+    String *canonicalRequest = strNewFmt("%s\n%s\n%s\n", strPtr(verb), strPtr(uriPath), strPtr(uriQuery));
+    const StringList *signedHeaderList = strLstNewSplitZ(signedHeaders, ";");
+
+    for (unsigned int headerIdx = 0; headerIdx < strLstSize(signedHeaderList); headerIdx++)
+    {
+        const String *headerKey = strLstGet(signedHeaderList, headerIdx);
+        const String *headerValue = httpHeaderGet(header, headerKey);
+
+        if (headerValue == NULL)
+            return "AccessDenied";
+
+        strCatFmt(canonicalRequest, "%s:%s\n", strPtr(headerKey), strPtr(headerValue));
+    }
+
+    strCatFmt(canonicalRequest, "\n%s\n%s", strPtr(signedHeaders), strPtr(payloadHash));
+
+    // Build the string to sign and the signing key
+    const String *date = strLstGet(credentialList, 1);
+    const String *dateTime = httpHeaderGet(header, STRDEF("x-amz-date"));
+
+    if (dateTime == NULL)
+        return "AccessDenied";
+
+    const String *stringToSign = strNewFmt(
+        "AWS4-HMAC-SHA256\n%s\n%s/%s/s3/aws4_request\n%s", strPtr(dateTime), strPtr(date), region,
+        strPtr(bufHex(cryptoHashOne(HASH_TYPE_SHA256_STR, BUFSTR(canonicalRequest)))));
+
+    const Buffer *dateKey = cryptoHmacOne(
+        HASH_TYPE_SHA256_STR, BUFSTR(strNewFmt("AWS4%s", this->param->secretAccessKey)), BUFSTR(date));
+    const Buffer *regionKey = cryptoHmacOne(HASH_TYPE_SHA256_STR, dateKey, BUFSTRZ(region));
+    const Buffer *serviceKey = cryptoHmacOne(HASH_TYPE_SHA256_STR, regionKey, BUFSTRDEF("s3"));
+    const Buffer *signingKey = cryptoHmacOne(HASH_TYPE_SHA256_STR, serviceKey, BUFSTRDEF("aws4_request"));
+
+    if (!strEq(signature, bufHex(cryptoHmacOne(HASH_TYPE_SHA256_STR, signingKey, BUFSTR(stringToSign)))))
+        return "SignatureDoesNotMatch";
+
+    return NULL;
+}
+
+/***********************************************************************************************************************************
+ListObjectsV2
+***********************************************************************************************************************************/
+typedef struct HrnS3ListItem
+{
+    String *key;                                                    // Object key (must be first for lstComparatorStr())
+    uint64_t size;                                                  // Object size
+} HrnS3ListItem;
+
+typedef struct HrnS3ListData
+{
+    const String *base;                                             // Key prefix of the path being listed
+    List *list;                                                     // Objects found
+} HrnS3ListData;
+
+static void
+hrnS3ListCallback(void *callbackData, const StorageInfo *info)
+{
+    HrnS3ListData *data = callbackData;
+
+    // Skip paths and files that are still being written
+    if (info->type == storageTypeFile && !strEndsWithZ(info->name, "." STORAGE_FILE_TEMP_EXT))
+    {
+        MEM_CONTEXT_BEGIN(lstMemContext(data->list))
+        {
+            lstAdd(
+                data->list,
+                &(HrnS3ListItem){.key = strNewFmt("%s%s", strPtr(data->base), strPtr(info->name)), .size = info->size});
+        }
+        MEM_CONTEXT_END();
+    }
+}
+
+static void
+hrnS3List(HrnS3Connection *this, const String *uriQuery)
+{
+    const String *prefix = hrnS3QueryGet(uriQuery, "prefix");
+    const String *delimiter = hrnS3QueryGet(uriQuery, "delimiter");
+    const String *continuationToken = hrnS3QueryGet(uriQuery, "continuation-token");
+    const String *maxKeys = hrnS3QueryGet(uriQuery, "max-keys");
+    unsigned int listMax = maxKeys == NULL ? this->param->listMax : cvtZToUInt(strPtr(maxKeys));
+
+    if (prefix == NULL)
+        prefix = EMPTY_STR;
+
+    // Only list the path that contains the prefix rather than all objects
+    HrnS3ListData data = {.base = EMPTY_STR, .list = lstNewP(sizeof(HrnS3ListItem), .comparator = lstComparatorStr)};
+    const String *path = STRDEF(HRN_S3_PATH_OBJECT);
+    const char *prefixPath = strrchr(strPtr(prefix), '/');
+
+    if (prefixPath != NULL)
+    {
+        data.base = strSubN(prefix, 0, (size_t)(prefixPath - strPtr(prefix)) + 1);
+        path = strNewFmt(HRN_S3_PATH_OBJECT "/%s", strPtr(data.base));
+    }
+
+    storageInfoListP(this->storage, path, hrnS3ListCallback, &data, .recurse = true);
+    lstSort(data.list, sortOrderAsc);
+
+    // Build the result
+    XmlDocument *xml = xmlDocumentNew(STRDEF("ListBucketResult"));
+    XmlNode *xmlRoot = xmlDocumentRoot(xml);
+    xmlNodeContentSet(xmlNodeAdd(xmlRoot, STRDEF("Prefix")), prefix);
+
+    const String *prefixLast = NULL;
+    const String *keyLast = NULL;
+    unsigned int keyTotal = 0;
+    bool truncated = false;
+
+    for (unsigned int listIdx = 0; listIdx < lstSize(data.list); listIdx++)
+    {
+        const HrnS3ListItem *item = lstGet(data.list, listIdx);
+
+        if (!strBeginsWith(item->key, prefix))
+            continue;
+
+        // Skip keys up to and including the continuation token, which is the last key or common prefix returned
+        if (continuationToken != NULL &&
+            (strCmp(item->key, continuationToken) <= 0 ||
+             (delimiter != NULL && strEndsWith(continuationToken, delimiter) && strBeginsWith(item->key, continuationToken))))
+        {
+            continue;
+        }
+
+        // Keys that contain the delimiter after the prefix are rolled up into a common prefix
+        const String *commonPrefix = NULL;
+
+        if (delimiter != NULL)
+        {
+            const char *delimiterPos = strstr(strPtr(item->key) + strSize(prefix), strPtr(delimiter));
+
+            if (delimiterPos != NULL)
+                commonPrefix = strSubN(item->key, 0, (size_t)(delimiterPos - strPtr(item->key)) + strSize(delimiter));
+        }
+
+        if (commonPrefix != NULL && prefixLast != NULL && strEq(commonPrefix, prefixLast))
+            continue;
+
+        if (keyTotal == listMax)
+        {
+            truncated = true;
+            break;
+        }
+
+        if (commonPrefix != NULL)
+        {
+            xmlNodeContentSet(xmlNodeAdd(xmlNodeAdd(xmlRoot, STRDEF("CommonPrefixes")), STRDEF("Prefix")), commonPrefix);
+            prefixLast = commonPrefix;
+            keyLast = commonPrefix;
+        }
+        else
+        {
+            XmlNode *xmlContents = xmlNodeAdd(xmlRoot, STRDEF("Contents"));
+            xmlNodeContentSet(xmlNodeAdd(xmlContents, STRDEF("Key")), item->key);
+            xmlNodeContentSet(xmlNodeAdd(xmlContents, STRDEF("Size")), strNewFmt("%" PRIu64, item->size));
+            keyLast = item->key;
+        }
+
+        keyTotal++;
+    }
+
+    xmlNodeContentSet(xmlNodeAdd(xmlRoot, STRDEF("KeyCount")), strNewFmt("%u", keyTotal));
+    xmlNodeContentSet(xmlNodeAdd(xmlRoot, STRDEF("IsTruncated")), truncated ? TRUE_STR : FALSE_STR);
+
+    if (truncated)
+        xmlNodeContentSet(xmlNodeAdd(xmlRoot, STRDEF("NextContinuationToken")), keyLast);
+
+    hrnS3ResponseXml(this, 200, "OK", xml);
+}
+
+/***********************************************************************************************************************************
+Batch delete
+***********************************************************************************************************************************/
+static void
+hrnS3Delete(HrnS3Connection *this, const Buffer *content)
+{
+    XmlNodeList *objectList = xmlNodeChildList(xmlDocumentRoot(xmlDocumentNewBuf(content)), STRDEF("Object"));
+
+    for (unsigned int objectIdx = 0; objectIdx < xmlNodeLstSize(objectList); objectIdx++)
+    {
+        storageRemoveNP(
+            this->storage,
+            strNewFmt(
+                HRN_S3_PATH_OBJECT "/%s",
+                strPtr(xmlNodeContent(xmlNodeChild(xmlNodeLstGet(objectList, objectIdx), STRDEF("Key"), true)))));
+    }
+
+    hrnS3ResponseXml(this, 200, "OK", xmlDocumentNew(STRDEF("DeleteResult")));
+}
+
+/***********************************************************************************************************************************
+GET and HEAD
+***********************************************************************************************************************************/
+static void
+hrnS3Get(HrnS3Connection *this, const String *file, const HttpHeader *header)
+{
+    if (this->head)
+    {
+        StorageInfo info = storageInfoP(this->storage, file, .ignoreMissing = true);
+
+        if (!info.exists)
+            hrnS3Response(this, 404, "Not Found", NULL, 0, NULL);
+        else
+            hrnS3Response(this, 200, "OK", NULL, info.size, NULL);
+
+        return;
+    }
+
+    Buffer *content = storageGetP(storageNewReadP(this->storage, file, .ignoreMissing = true));
+
+    if (content == NULL)
+    {
+        hrnS3ResponseError(this, 404, "Not Found", "NoSuchKey", STRDEF("The specified key does not exist."));
+        return;
+    }
+
+    // Return the requested range, e.g. bytes=0-1023 or bytes=1024-
+    const String *range = httpHeaderGet(header, STRDEF("range"));
+
+    if (range != NULL)
+    {
+        const StringList *rangeList = strLstNewSplitZ(strSub(range, sizeof("bytes=") - 1), "-");
+        size_t rangeBegin = (size_t)cvtZToUInt64(strPtr(strLstGet(rangeList, 0)));
+
+        // No range can be satisfied when the beginning is past the end of the content, which includes any range on an empty object
+        if (rangeBegin >= bufUsed(content))
+        {
+            hrnS3ResponseError(
+                this, 416, "Requested Range Not Satisfiable", "InvalidRange", STRDEF("The requested range is not satisfiable"));
+            return;
+        }
+
+        size_t rangeEnd =
+            strLstSize(rangeList) < 2 || strEmpty(strLstGet(rangeList, 1)) ?
+                bufUsed(content) - 1 : (size_t)cvtZToUInt64(strPtr(strLstGet(rangeList, 1)));
+
+        if (rangeEnd >= bufUsed(content))
+            rangeEnd = bufUsed(content) - 1;
+
+        if (rangeBegin > rangeEnd)
+        {
+            hrnS3ResponseError(
+                this, 416, "Requested Range Not Satisfiable", "InvalidRange", STRDEF("The requested range is not satisfiable"));
+            return;
+        }
+
+        Buffer *contentRange = bufNewC(bufPtr(content) + rangeBegin, rangeEnd - rangeBegin + 1);
+
+        hrnS3Response(
+            this, 206, "Partial Content", strNewFmt("content-range:bytes %zu-%zu/%zu\r\n", rangeBegin, rangeEnd, bufUsed(content)),
+            bufUsed(contentRange), contentRange);
+        return;
+    }
+
+    hrnS3Response(this, 200, "OK", NULL, bufUsed(content), content);
+}
+
+/***********************************************************************************************************************************
+Multipart upload
+***********************************************************************************************************************************/
+static void
+hrnS3UploadInit(HrnS3Connection *this, const String *key)
+{
+    // Upload ids must be unique across connections so include the process id
+    const String *uploadId = strNewFmt("%d-%u", (int)getpid(), this->uploadTotal++);
+    storagePathCreateNP(this->storage, strNewFmt(HRN_S3_PATH_UPLOAD "/%s", strPtr(uploadId)));
+
+    XmlDocument *xml = xmlDocumentNew(STRDEF("InitiateMultipartUploadResult"));
+    xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(xml), STRDEF("Key")), key);
+    xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(xml), STRDEF("UploadId")), uploadId);
+
+    hrnS3ResponseXml(this, 200, "OK", xml);
+}
+
+static void
+hrnS3UploadPart(HrnS3Connection *this, const String *uploadId, const String *partNumber, const Buffer *content)
+{
+    const String *uploadPath = strNewFmt(HRN_S3_PATH_UPLOAD "/%s", strPtr(uploadId));
+
+    if (!storagePathExistsNP(this->storage, uploadPath))
+    {
+        hrnS3ResponseError(this, 404, "Not Found", "NoSuchUpload", STRDEF("The specified upload does not exist."));
+        return;
+    }
+
+    storagePutNP(
+        storageNewWriteP(
+            this->storage, strNewFmt("%s/%05u", strPtr(uploadPath), cvtZToUInt(strPtr(partNumber))), .noCreatePath = true,
+            .noSyncFile = true, .noSyncPath = true),
+        content);
+
+    hrnS3Response(this, 200, "OK", strNewFmt("etag:\"%s-%s\"\r\n", strPtr(uploadId), strPtr(partNumber)), 0, NULL);
+}
+
+static void
+hrnS3UploadComplete(HrnS3Connection *this, const String *key, const String *file, const String *uploadId, const Buffer *content)
+{
+    const String *uploadPath = strNewFmt(HRN_S3_PATH_UPLOAD "/%s", strPtr(uploadId));
+
+    if (!storagePathExistsNP(this->storage, uploadPath))
+    {
+        hrnS3ResponseError(this, 404, "Not Found", "NoSuchUpload", STRDEF("The specified upload does not exist."));
+        return;
+    }
+
+    // Concatenate the parts in the order listed
+    XmlNodeList *partList = xmlNodeChildList(xmlDocumentRoot(xmlDocumentNewBuf(content)), STRDEF("Part"));
+    StorageWrite *write = storageNewWriteP(this->storage, file, .noSyncFile = true, .noSyncPath = true);
+
+    ioWriteOpen(storageWriteIo(write));
+
+    for (unsigned int partIdx = 0; partIdx < xmlNodeLstSize(partList); partIdx++)
+    {
+        const String *partNumber = xmlNodeContent(xmlNodeChild(xmlNodeLstGet(partList, partIdx), STRDEF("PartNumber"), true));
+
+        ioWrite(
+            storageWriteIo(write),
+            storageGetNP(
+                storageNewReadNP(this->storage, strNewFmt("%s/%05u", strPtr(uploadPath), cvtZToUInt(strPtr(partNumber))))));
+    }
+
+    ioWriteClose(storageWriteIo(write));
+    storagePathRemoveP(this->storage, uploadPath, .recurse = true);
+
+    XmlDocument *xml = xmlDocumentNew(STRDEF("CompleteMultipartUploadResult"));
+    xmlNodeContentSet(xmlNodeAdd(xmlDocumentRoot(xml), STRDEF("Key")), key);
+
+    hrnS3ResponseXml(this, 200, "OK", xml);
+}
+
+/***********************************************************************************************************************************
+Process a request. Returns false when the client has closed the connection.
+***********************************************************************************************************************************/
+static bool
+hrnS3Request(HrnS3Connection *this)
+{
+    bool result = true;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        String *request = hrnS3ReadLine(this);
+
+        if (request == NULL)
+            result = false;
+        else
+        {
+            // Parse the request line, e.g. GET /path/file?query HTTP/1.1
+            const StringList *requestList = strLstNewSplitZ(strTrim(request), " ");
+
+            if (strLstSize(requestList) != 3)
+                THROW_FMT(FormatError, "invalid request '%s'", strPtr(request));
+
+            const String *verb = strLstGet(requestList, 0);
+            const String *uri = strLstGet(requestList, 1);
+            int queryIdx = strChr(uri, '?');
+            const String *uriPath = queryIdx == -1 ? uri : strSubN(uri, 0, (size_t)queryIdx);
+            const String *uriQuery = queryIdx == -1 ? EMPTY_STR : STR(strPtr(uri) + queryIdx + 1);
+
+            this->head = strEqZ(verb, "HEAD");
+
+            // Read headers
+            HttpHeader *header = httpHeaderNew(NULL);
+
+            do
+            {
+                String *headerLine = hrnS3ReadLine(this);
+
+                if (headerLine == NULL)
+                    THROW(FileReadError, "unexpected eof while reading headers");
+
+                if (strSize(strTrim(headerLine)) == 0)
+                    break;
+
+                int colonIdx = strChr(headerLine, ':');
+
+                if (colonIdx == -1)
+                    THROW_FMT(FormatError, "header '%s' missing colon", strPtr(headerLine));
+
+                httpHeaderAdd(
+                    header, strLower(strTrim(strSubN(headerLine, 0, (size_t)colonIdx))),
+                    strTrim(strSub(headerLine, (size_t)colonIdx + 1)));
+            }
+            while (true);
+
+            // Read content
+            const String *contentLength = httpHeaderGet(header, STRDEF("content-length"));
+            const Buffer *content =
+                contentLength == NULL ? bufNew(0) : hrnS3ReadContent(this, (size_t)cvtZToUInt64(strPtr(contentLength)));
+
+            // Validate the signature when required
+            const char *authError =
+                this->param->accessKey == NULL ? NULL : hrnS3Authorize(this, verb, uriPath, uriQuery, header, content);
+
+            if (authError != NULL)
+                hrnS3ResponseError(this, 403, "Forbidden", authError, STRDEF("The request signature is not valid."));
+            else
+            {
+                const String *key = hrnS3UriDecode(STR(strPtr(uriPath) + 1));
+                const String *file = strNewFmt(HRN_S3_PATH_OBJECT "/%s", strPtr(key));
+                const String *uploadId = hrnS3QueryGet(uriQuery, "uploadId");
+
+                TRY_BEGIN()
+                {
+                    if (strEqZ(verb, "GET") && strEmpty(key) && hrnS3QueryGet(uriQuery, "list-type") != NULL)
+                        hrnS3List(this, uriQuery);
+                    else if (strEqZ(verb, "POST") && strEmpty(key) && hrnS3QueryGet(uriQuery, "delete") != NULL)
+                        hrnS3Delete(this, content);
+                    else if (strEmpty(key))
+                        hrnS3ResponseError(this, 501, "Not Implemented", "NotImplemented", STRDEF("Bucket request not supported."));
+                    else if (strEqZ(verb, "GET") || strEqZ(verb, "HEAD"))
+                        hrnS3Get(this, file, header);
+                    else if (strEqZ(verb, "PUT") && uploadId != NULL)
+                        hrnS3UploadPart(this, uploadId, hrnS3QueryGet(uriQuery, "partNumber"), content);
+                    else if (strEqZ(verb, "PUT"))
+                    {
+                        storagePutNP(storageNewWriteP(this->storage, file, .noSyncFile = true, .noSyncPath = true), content);
+                        hrnS3Response(this, 200, "OK", NULL, 0, NULL);
+                    }
+                    else if (strEqZ(verb, "POST") && hrnS3QueryGet(uriQuery, "uploads") != NULL)
+                        hrnS3UploadInit(this, key);
+                    else if (strEqZ(verb, "POST") && uploadId != NULL)
+                        hrnS3UploadComplete(this, key, file, uploadId, content);
+                    else if (strEqZ(verb, "DELETE"))
+                    {
+                        storageRemoveNP(this->storage, file);
+                        hrnS3Response(this, 204, "No Content", NULL, 0, NULL);
+                    }
+                    else
+                        hrnS3ResponseError(this, 501, "Not Implemented", "NotImplemented", STRDEF("Request not supported."));
+                }
+                // Report storage errors to the client the way S3 would report an internal error
+                CATCH(FileOpenError)
+                {
+                    hrnS3ResponseError(this, 500, "Internal Error", "InternalError", STR(errorMessage()));
+                }
+                CATCH(FileReadError)
+                {
+                    hrnS3ResponseError(this, 500, "Internal Error", "InternalError", STR(errorMessage()));
+                }
+                CATCH(FormatError)
+                {
+                    hrnS3ResponseError(this, 400, "Bad Request", "MalformedXML", STR(errorMessage()));
+                }
+                TRY_END();
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Process requests on a connection until the client closes it
+***********************************************************************************************************************************/
+static void
+hrnS3ServerConnection(SSL_CTX *context, int clientSocket, const Storage *storage, const HrnS3ServerParam *param)
+{
+    HrnS3Connection *this = &hrnS3Connection;
+    *this = (HrnS3Connection){.storage = storage, .param = param};
+
+    // Send responses without waiting to coalesce small writes, otherwise latency measurements will be distorted
+    int noDelay = 1;
+    setsockopt(clientSocket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    this->ssl = SSL_new(context);
+    SSL_set_fd(this->ssl, clientSocket);
+
+    if (SSL_accept(this->ssl) > 0)
+    {
+        TRY_BEGIN()
+        {
+            while (hrnS3Request(this));
+        }
+        // The connection is closed on any other error, which the client will report
+        CATCH_ANY()
+        {
+        }
+        TRY_END();
+    }
+
+    SSL_free(this->ssl);
+    close(clientSocket);
+}
+
+/**********************************************************************************************************************************/
+void
+hrnS3ServerRun(int port, const char *path, int stopFd, HrnS3ServerParam param)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(INT, port);
+        FUNCTION_HARNESS_PARAM(STRINGZ, path);
+        FUNCTION_HARNESS_PARAM(INT, stopFd);
+
+        FUNCTION_HARNESS_ASSERT(path != NULL);
+        FUNCTION_HARNESS_ASSERT(param.accessKey == NULL || param.secretAccessKey != NULL);
+    FUNCTION_HARNESS_END();
+
+    if (param.listMax == 0)
+        param.listMax = HRN_S3_LIST_MAX_DEFAULT;
+
+    if (param.serverCert == NULL)
+        param.serverCert = TLS_CERT_TEST_CERT;
+
+    if (param.serverKey == NULL)
+        param.serverKey = TLS_CERT_TEST_KEY;
+
+    const Storage *storage = storagePosixNew(strNew(path), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+    // Initialize TLS and create a context
+    cryptoInit();
+
+    SSL_CTX *context = SSL_CTX_new(SSLv23_method());
+    cryptoError(context == NULL, "unable to create TLS context");
+
+    cryptoError(
+        SSL_CTX_use_certificate_file(context, param.serverCert, SSL_FILETYPE_PEM) <= 0, "unable to load server certificate");
+    cryptoError(SSL_CTX_use_PrivateKey_file(context, param.serverKey, SSL_FILETYPE_PEM) <= 0, "unable to load server private key");
+
+    // Create the socket
+    struct sockaddr_in address;
+
+    address.sin_family = AF_INET;
+    address.sin_port = htons((uint16_t)port);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    int serverSocket = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (serverSocket < 0)
+        THROW_SYS_ERROR(AssertError, "unable to create socket");
+
+    int reuseAddr = 1;
+    setsockopt(serverSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddr, sizeof(reuseAddr));
+
+    // Bind the address.  It might take a bit to bind if another process was recently using it so retry a few times.
+    Wait *wait = waitNew(2000);
+    int result;
+
+    do
+    {
+        result = bind(serverSocket, (struct sockaddr *)&address, sizeof(address));
+    }
+    while (result < 0 && waitMore(wait));
+
+    if (result < 0)
+        THROW_SYS_ERROR(AssertError, "unable to bind socket");
+
+    if (listen(serverSocket, 128) < 0)
+        THROW_SYS_ERROR(AssertError, "unable to listen on socket");
+
+    // Connection processes do not need to be waited on
+    signal(SIGCHLD, SIG_IGN);
+
+    // Accept connections until the stop fd is written to or closed
+    struct pollfd pollList[2] = {{.fd = serverSocket, .events = POLLIN}, {.fd = stopFd, .events = POLLIN}};
+
+    do
+    {
+        if (poll(pollList, 2, -1) == -1)
+        {
+            if (errno == EINTR)
+                continue;
+
+            THROW_SYS_ERROR(AssertError, "unable to poll");
+        }
+
+        if (pollList[1].revents != 0)
+            break;
+
+        if (pollList[0].revents & POLLIN)
+        {
+            int clientSocket = accept(serverSocket, NULL, NULL);
+
+            if (clientSocket < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                THROW_SYS_ERROR(AssertError, "unable to accept socket");
+            }
+
+            // Handle the connection in a new process
+            if (forkSafe() == 0)
+            {
+                close(serverSocket);
+                close(stopFd);
+
+                hrnS3ServerConnection(context, clientSocket, storage, &param);
+
+                exit(0);
+            }
+
+            close(clientSocket);
+        }
+    }
+    while (true);
+
+    close(serverSocket);
+    SSL_CTX_free(context);
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+hrnS3ServerStop(int stopFd)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(INT, stopFd);
+    FUNCTION_HARNESS_END();
+
+    if (write(stopFd, "", 1) != 1)
+        THROW_SYS_ERROR(FileWriteError, "unable to stop server");
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -0,0 +1,73 @@
+/***********************************************************************************************************************************
+S3 Test Harness
+
+Local S3-compatible server for benchmarking the S3 storage driver without the S3 container used by the integration tests. The server
+supports the requests made by the driver: GET (including ranges), HEAD, PUT, DELETE, multipart upload, ListObjectsV2, and batch
+delete. Objects are stored in <path>/object/<key>, so tests can create objects directly when uploading them would be too slow.
+Signatures are only validated when an access key is set.
+
+Each connection is handled by a separate process, so the server can handle concurrent clients. Connections are kept open until the
+client closes them, so connection reuse in the client can be measured. Latency and bandwidth can be injected to simulate a remote
+server. The server runs until hrnS3ServerStop() is called or the stop file descriptor is closed, so it is normally run in a
+HARNESS_FORK() child:
+
+HARNESS_FORK_BEGIN()
+{
+    HARNESS_FORK_CHILD_BEGIN(0, true)
+    {
+        hrnS3ServerRunP(HRN_S3_PORT, testPath(), HARNESS_FORK_CHILD_READ(), .latency = 10);
+    }
+    HARNESS_FORK_CHILD_END();
+
+    HARNESS_FORK_PARENT_BEGIN()
+    {
+        <Run tests using storageS3New() with host 127.0.0.1 and port HRN_S3_PORT>
+
+        hrnS3ServerStop(HARNESS_FORK_PARENT_WRITE_PROCESS(0));
+    }
+    HARNESS_FORK_PARENT_END();
+}
+HARNESS_FORK_END();
+***********************************************************************************************************************************/
+#ifndef TEST_COMMON_HARNESS_S3_H
+#define TEST_COMMON_HARNESS_S3_H
+
+#include <stdint.h>
+
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+S3 test defaults
+***********************************************************************************************************************************/
+#define HRN_S3_PORT                                                 9444
+#define HRN_S3_LIST_MAX_DEFAULT                                     1000
+
+/***********************************************************************************************************************************
+Server parameters
+***********************************************************************************************************************************/
+typedef struct HrnS3ServerParam
+{
+    TimeMSec latency;                                               // Delay before each response is sent
+    uint64_t bandwidth;                                             // Bytes per second for each connection (0 for unlimited)
+    unsigned int listMax;                                           // Max keys per list page (defaults to HRN_S3_LIST_MAX_DEFAULT)
+    const char *accessKey;                                          // Validate signatures with this access key when set
+    const char *secretAccessKey;                                    // Secret access key used to validate signatures
+    const char *region;                                             // Region used to validate signatures
+    const char *serverCert;                                         // Server certificate (defaults to TLS_CERT_TEST_CERT)
+    const char *serverKey;                                          // Server key (defaults to TLS_CERT_TEST_KEY)
+} HrnS3ServerParam;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Run the server until stopFd is closed
+#define hrnS3ServerRunP(port, path, stopFd, ...)                                                                                   \
+    hrnS3ServerRun(port, path, stopFd, (HrnS3ServerParam){__VA_ARGS__})
+
+void hrnS3ServerRun(int port, const char *path, int stopFd, HrnS3ServerParam param);
+
+// Stop the server. Closing the stop file descriptor is not enough when other processes have inherited it, e.g. when more than one
+// server is forked.
+void hrnS3ServerStop(int stopFd);
+
+#endif
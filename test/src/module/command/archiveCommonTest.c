@@ -157,6 +157,65 @@ testRun(void)
             "remove ok");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("archiveAsyncWatchNew() and archiveAsyncWatchMore()"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAdd(argList, strNewFmt("--spool-path=%s", testPath()));
+        strLstAddZ(argList, "--stanza=db");
+        strLstAddZ(argList, "archive-push-async");
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+        String *walSegment = strNew("000000010000000100000001");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        ArchiveAsyncWatch *watch = NULL;
+
+        TEST_ASSIGN(watch, archiveAsyncWatchNew(archiveModePush, 5000), "new watch");
+        TEST_RESULT_BOOL(storagePathExistsNP(storageTest, strNew("archive/db/out")), true, "    queue created");
+        TEST_RESULT_BOOL(watch->handle != -1, true, "    queue watched");
+
+        archiveAsyncStatusOkWrite(archiveModePush, walSegment, NULL);
+
+        TimeMSec beginTime = timeMSec();
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, false), true, "status written");
+        TEST_RESULT_BOOL(timeMSec() - beginTime < 1000, true, "    returned before timeout");
+        TEST_RESULT_VOID(archiveAsyncWatchFree(watch), "free watch");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ASSIGN(watch, archiveAsyncWatchNew(archiveModePush, 100), "new watch");
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, false), true, "timeout with final check");
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, false), false, "no more checks");
+
+        watch->done = false;
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, false), true, "timeout already expired with final check");
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, false), false, "no more checks");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ASSIGN(watch, archiveAsyncWatchNew(archiveModePush, 5000), "new watch");
+
+        beginTime = timeMSec();
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, true), true, "retry");
+        TEST_RESULT_BOOL(timeMSec() - beginTime < 1000, true, "    returned before timeout");
+        TEST_RESULT_BOOL(watch->done, false, "    not done");
+        TEST_RESULT_VOID(archiveAsyncWatchFree(watch), "free watch");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePathRemoveP(storageTest, strNew("archive/db/out"), .recurse = true);
+        storagePutNP(storageNewWriteNP(storageTest, strNew("archive/db/out")), NULL);
+
+        TEST_ASSIGN(watch, archiveAsyncWatchNew(archiveModePush, 100), "new watch when queue is not a path");
+        TEST_RESULT_BOOL(watch->handle == -1, true, "    queue not watched");
+
+        beginTime = timeMSec();
+        TEST_RESULT_BOOL(archiveAsyncWatchMore(watch, false), true, "poll");
+
+        while (archiveAsyncWatchMore(watch, false));
+
+        TEST_RESULT_BOOL(timeMSec() - beginTime >= 100, true, "    polled until timeout");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("walIsPartial()"))
     {
@@ -205,6 +264,21 @@ testRun(void)
             walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678"), 500), NULL,
             "no segment after 500ms");
 
+        // Files that contain the segment and a checksum but have extra text are not matched
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678-junk-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa")),
+            NULL);
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.junk")),
+            NULL);
+        TEST_RESULT_PTR(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678"), 0), NULL,
+            "no segment with extra text");
+
         // Check timeout by making the wal segment appear after 250ms
         HARNESS_FORK_BEGIN()
         {
@@ -248,6 +322,26 @@ testRun(void)
         TEST_RESULT_STR(
             walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0), NULL,
             "did not find partial segment");
+
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678.partial-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.tmp")),
+            NULL);
+
+        TEST_RESULT_STR(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0), NULL,
+            "did not find partial segment with invalid extension");
+
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/db/9.6-2/1234567812345678/123456781234567812345678.partial-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa")),
+            NULL);
+
+        TEST_RESULT_STR(
+            strPtr(walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0)),
+            "123456781234567812345678.partial-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "found partial segment");
     }
 
     // *****************************************************************************************************************************
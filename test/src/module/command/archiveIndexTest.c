@@ -0,0 +1,348 @@
+/***********************************************************************************************************************************
+Test Archive Index
+***********************************************************************************************************************************/
+#include "common/type/json.h"
+#include "storage/posix/storage.h"
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // Create default storage object for testing
+    Storage *storageTest = storagePosixNew(
+        strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+    const String *archivePath = strNew("archive/9.4-1");
+    const String *indexFile = strNew("archive/9.4-1/" INFO_ARCHIVE_INDEX_FILE);
+
+    // *****************************************************************************************************************************
+    if (testBegin("archiveIndexBuild(), archiveIndexAdd(), archiveIndexMin(), archiveIndexMax(), and archiveIndexValid()"))
+    {
+        KeyValue *index = NULL;
+
+        TEST_ASSIGN(index, archiveIndexBuild(storageTest, archivePath), "build index on missing path");
+        TEST_RESULT_STR(strPtr(jsonFromKv(index, 0)), "{\"format\":1,\"timeline\":{}}", "    check index");
+        TEST_RESULT_PTR(archiveIndexMin(index), NULL, "    no min");
+        TEST_RESULT_PTR(archiveIndexMax(index), NULL, "    no max");
+
+        TEST_RESULT_BOOL(archiveIndexValid(NULL, NULL, NULL), false, "missing index is not valid");
+        TEST_RESULT_BOOL(archiveIndexValid(index, NULL, NULL), true, "empty index is valid without a range");
+        TEST_RESULT_BOOL(
+            archiveIndexValid(index, strNew("000000010000000100000001"), NULL), false, "empty index is not valid with a start");
+        TEST_RESULT_BOOL(
+            archiveIndexValid(index, NULL, strNew("000000010000000100000001")), false, "empty index is not valid with a stop");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePathCreateNP(storageTest, strNew("archive/9.4-1/0000000100000001"));
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000100000002/"
+                    "000000010000000200000003-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd.gz")),
+            NULL);
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000100000002/"
+                    "000000010000000200000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("archive/9.4-1/0000000100000002/000000010000000200000002.partial")), NULL);
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000100000003/"
+                    "000000010000000300000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+        storagePathCreateNP(storageTest, strNew("archive/9.4-1/0000000100000004"));
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000200000003/"
+                    "000000020000000300000005-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+        storagePathCreateNP(storageTest, strNew("archive/9.4-1/0000000300000001"));
+        storagePutNP(storageNewWriteNP(storageTest, strNew("archive/9.4-1/00000002.history")), NULL);
+
+        TEST_ASSIGN(index, archiveIndexBuild(storageTest, archivePath), "build index");
+        TEST_RESULT_STR(
+            strPtr(jsonFromKv(index, 0)),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000300000001\",\"min\":\"000000010000000200000001\"},"
+                "\"00000002\":{\"max\":\"000000020000000300000005\",\"min\":\"000000020000000300000005\"}}}",
+            "    check index");
+        TEST_RESULT_STR(strPtr(archiveIndexMin(index)), "000000010000000200000001", "    check min");
+        TEST_RESULT_STR(strPtr(archiveIndexMax(index)), "000000020000000300000005", "    check max");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(archiveIndexAdd(index, strNew("000000010000000200000002")), false, "add segment inside range");
+        TEST_RESULT_BOOL(
+            archiveIndexAdd(index, strNew("000000010000000100000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")), true,
+            "add older segment");
+        TEST_RESULT_BOOL(archiveIndexAdd(index, strNew("000000010000000400000001")), true, "add newer segment");
+        TEST_RESULT_BOOL(archiveIndexAdd(index, strNew("000000040000000400000002")), true, "add segment on new timeline");
+        TEST_RESULT_STR(
+            strPtr(jsonFromKv(index, 0)),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000400000001\",\"min\":\"000000010000000100000001\"},"
+                "\"00000002\":{\"max\":\"000000020000000300000005\",\"min\":\"000000020000000300000005\"},"
+                "\"00000004\":{\"max\":\"000000040000000400000002\",\"min\":\"000000040000000400000002\"}}}",
+            "    check index");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(
+            archiveIndexValid(index, strNew("000000010000000100000001"), strNew("000000040000000400000002")), true,
+            "index covers range");
+        TEST_RESULT_BOOL(archiveIndexValid(index, strNew("000000010000000100000000"), NULL), false, "index starts after start");
+        TEST_RESULT_BOOL(archiveIndexValid(index, NULL, strNew("000000040000000400000003")), false, "index stops before stop");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("archiveIndexLoad() and archiveIndexSave()"))
+    {
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "missing index");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storageTest, indexFile), BUFSTRDEF("{\"format\":1,"));
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "invalid json");
+
+        storagePutNP(storageNewWriteNP(storageTest, indexFile), BUFSTRDEF("{\"format\":2,\"timeline\":{}}"));
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "invalid format");
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, indexFile),
+            BUFSTRDEF("{\"format\":1,\"timeline\":{\"00000001\":{\"max\":\"000000010000000100000001\"}}}"));
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "missing min");
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, indexFile),
+            BUFSTRDEF("{\"format\":1,\"timeline\":{\"00000001\":{\"min\":\"000000010000000100000001\"}}}"));
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "missing max");
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, indexFile),
+            BUFSTRDEF("{\"format\":1,\"timeline\":{\"00000001\":{\"max\":\"BOGUS\",\"min\":\"000000010000000100000001\"}}}"));
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "invalid max");
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, indexFile),
+            BUFSTRDEF("{\"format\":1,\"timeline\":{\"00000001\":{\"max\":\"000000010000000100000001\",\"min\":\"BOGUS\"}}}"));
+        TEST_RESULT_PTR(archiveIndexLoad(storageTest, archivePath), NULL, "invalid min");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        KeyValue *index = archiveIndexBuild(storageTest, archivePath);
+        archiveIndexAdd(index, strNew("000000010000000100000001"));
+        archiveIndexAdd(index, strNew("000000010000000100000002"));
+
+        TEST_RESULT_VOID(archiveIndexSave(storageTest, archivePath, index), "save index");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000100000002\",\"min\":\"000000010000000100000001\"}}}",
+            "    check index file");
+
+        TEST_ASSIGN(index, archiveIndexLoad(storageTest, archivePath), "load index");
+        TEST_RESULT_STR(strPtr(archiveIndexMin(index)), "000000010000000100000001", "    check min");
+        TEST_RESULT_STR(strPtr(archiveIndexMax(index)), "000000010000000100000002", "    check max");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("archiveIndexUpdate(), archiveIndexExpire(), and archiveIndexCurrent()"))
+    {
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000100000001/"
+                    "000000010000000100000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000100000002/"
+                    "000000010000000200000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        StringList *walSegmentList = strLstNew();
+        strLstAddZ(walSegmentList, "000000010000000200000002");
+
+        TEST_RESULT_VOID(archiveIndexUpdate(storageTest, archivePath, walSegmentList), "create index");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000200000002\",\"min\":\"000000010000000100000001\"}}}",
+            "    check index file");
+
+        // A segment removed from the archive remains in the index until expire rebuilds it
+        storageRemoveNP(
+            storageTest,
+            strNew("archive/9.4-1/0000000100000001/000000010000000100000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd"));
+
+        strLstAddZ(walSegmentList, "000000010000000200000003");
+
+        TEST_RESULT_VOID(archiveIndexUpdate(storageTest, archivePath, walSegmentList), "update index");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000200000003\",\"min\":\"000000010000000100000001\"}}}",
+            "    check index file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        // A segment on a timeline that is not in the index causes the index to be rebuilt from the listing.  The new timeline is
+        // not in the listing to show that it is preserved by expire.
+        walSegmentList = strLstNew();
+        strLstAddZ(walSegmentList, "000000020000000200000004");
+
+        TEST_RESULT_VOID(archiveIndexUpdate(storageTest, archivePath, walSegmentList), "update index with new timeline");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000200000001\",\"min\":\"000000010000000200000001\"},"
+                "\"00000002\":{\"max\":\"000000020000000200000004\",\"min\":\"000000020000000200000004\"}}}",
+            "    check index file");
+
+        TEST_RESULT_VOID(archiveIndexExpire(storageTest, archivePath), "expire index");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000200000001\",\"min\":\"000000010000000200000001\"},"
+                "\"00000002\":{\"max\":\"000000020000000200000004\",\"min\":\"000000020000000200000004\"}}}",
+            "    check index file");
+
+        // Expired timelines are removed from the index
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000300000001/"
+                    "000000030000000100000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+        storagePathRemoveP(storageTest, strNew("archive/9.4-1/0000000100000002"), .recurse = true);
+
+        TEST_RESULT_VOID(archiveIndexExpire(storageTest, archivePath), "expire index");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000003\":{\"max\":\"000000030000000100000001\",\"min\":\"000000030000000100000001\"}}}",
+            "    check index file");
+
+        // Index is built when missing
+        storageRemoveNP(storageTest, indexFile);
+
+        TEST_RESULT_VOID(archiveIndexExpire(storageTest, archivePath), "expire missing index");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, indexFile)))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000003\":{\"max\":\"000000030000000100000001\",\"min\":\"000000030000000100000001\"}}}",
+            "    check index file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        KeyValue *index = NULL;
+
+        TEST_RESULT_BOOL(archiveIndexCurrent(storageTest, archivePath, NULL), false, "missing index is not current");
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, strNew("archive/9.4-3"), archiveIndexBuild(storageTest, strNew("archive/9.4-3"))),
+            true, "empty index is current for empty archive");
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, archivePath, archiveIndexBuild(storageTest, strNew("archive/9.4-3"))), false,
+            "empty index is not current for archive");
+
+        TEST_ASSIGN(index, archiveIndexLoad(storageTest, archivePath), "load index");
+        TEST_RESULT_BOOL(archiveIndexCurrent(storageTest, archivePath, index), true, "index is current");
+
+        // Simulate a segment pushed while expire was rebuilding the index so the update from archive-push was lost
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000300000001/"
+                    "000000030000000100000002-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd.gz")),
+            NULL);
+        storagePathCreateNP(storageTest, strNew("archive/9.4-1/0000000300000002"));
+
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, archivePath, index), false, "index missing newest segment is not current");
+
+        // The next push adds a newer segment so the index is current again
+        walSegmentList = strLstNew();
+        strLstAddZ(walSegmentList, "000000030000000200000001");
+
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000300000002/"
+                    "000000030000000200000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        TEST_RESULT_VOID(archiveIndexUpdate(storageTest, archivePath, walSegmentList), "update index");
+        TEST_ASSIGN(index, archiveIndexLoad(storageTest, archivePath), "load index");
+        TEST_RESULT_BOOL(archiveIndexCurrent(storageTest, archivePath, index), true, "index is current");
+
+        // A segment in the WAL path after the newest indexed segment is found
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000300000003/"
+                    "000000030000000300000000-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, archivePath, index), false, "index missing segment in next path is not current");
+
+        storagePathRemoveP(storageTest, strNew("archive/9.4-1/0000000300000003"), .recurse = true);
+
+        // A segment more than one WAL path after the newest indexed segment is found, e.g. when index updates failed
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000300000005/"
+                    "000000030000000500000000-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, archivePath, index), false, "index missing segment in later path is not current");
+
+        storagePathRemoveP(storageTest, strNew("archive/9.4-1/0000000300000005"), .recurse = true);
+
+        // A segment on a newer timeline is found
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew("archive/9.4-1/0000000400000002/"
+                    "000000040000000200000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd")),
+            NULL);
+
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, archivePath, index), false, "index missing newer timeline is not current");
+
+        storagePathRemoveP(storageTest, strNew("archive/9.4-1/0000000400000002"), .recurse = true);
+        TEST_RESULT_BOOL(archiveIndexCurrent(storageTest, archivePath, index), true, "index is current");
+
+        // WAL paths older than the newest indexed segment are not listed
+        archiveIndexAdd(index, strNew("000000030000000300000001"));
+        TEST_RESULT_BOOL(
+            archiveIndexCurrent(storageTest, archivePath, index), true, "index with segment newer than archive is current");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storageTest, strNew("archive/9.4-2")), NULL);
+
+        TEST_RESULT_VOID(archiveIndexUpdate(storageTest, strNew("archive/9.4-2"), walSegmentList), "update index on invalid path");
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   WARN: unable to update archive index in '%s/archive/9.4-2': unable to open file '%s/archive/9.4-2/"
+                        INFO_ARCHIVE_INDEX_FILE "' for read: [20] Not a directory",
+                    testPath(), testPath())));
+
+        TEST_RESULT_VOID(archiveIndexExpire(storageTest, strNew("archive/9.4-2")), "expire index on invalid path");
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   WARN: unable to update archive index in '%s/archive/9.4-2': unable to list files for path"
+                        " '%s/archive/9.4-2': [20] Not a directory",
+                    testPath(), testPath())));
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
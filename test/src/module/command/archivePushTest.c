@@ -1,6 +1,7 @@
 /***********************************************************************************************************************************
 Test Archive Push Command
 ***********************************************************************************************************************************/
+#include "common/compress/gzip/decompress.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
 #include "common/io/handleRead.h"
@@ -36,7 +37,7 @@ testRun(void)
     bufUsedSet(serverWrite, 0);
 
     // *****************************************************************************************************************************
-    if (testBegin("archivePushReadyList(), archivePushProcessList(), and archivePushDrop()"))
+    if (testBegin("archivePushReadyList(), archivePushProcessList(), archivePushDrop(), and archivePushCompressLevel()"))
     {
         StringList *argList = strLstNew();
         strLstAddZ(argList, "pgbackrest");
@@ -107,6 +108,21 @@ testRun(void)
         TEST_RESULT_BOOL(
             archivePushDrop(strNew("pg_wal"), archivePushProcessList(strNewFmt("%s/db/pg_wal", testPath()))), true,
             "wal is dropped");
+
+        // Test compress level
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_INT(archivePushCompressLevel(1000), 6, "level not lowered when backlog is not set");
+
+        StringList *argListBacklog = strLstDup(argList);
+        strLstAddZ(argListBacklog, "--archive-push-compress-backlog=4");
+        harnessCfgLoad(strLstSize(argListBacklog), strLstPtr(argListBacklog));
+
+        TEST_RESULT_INT(archivePushCompressLevel(1), 6, "level not lowered below backlog");
+        TEST_RESULT_INT(archivePushCompressLevel(4), 6, "level not lowered at backlog");
+        TEST_RESULT_INT(archivePushCompressLevel(5), 4, "level lowered above backlog");
+        TEST_RESULT_INT(archivePushCompressLevel(7), 1, "level lowered further");
+        TEST_RESULT_INT(archivePushCompressLevel(8), 0, "no compression at twice backlog");
+        TEST_RESULT_INT(archivePushCompressLevel(1000), 0, "no compression above twice backlog");
     }
 
     // *****************************************************************************************************************************
@@ -265,7 +281,7 @@ testRun(void)
                 storageTest,
                 strNewFmt(
                     "repo/archive/test/11-1/0000000100000001/000000010000000100000001-%s.gz",
-                    TEST_64BIT() ? "3e5ecd22712f319b2420d5b901fd29f4f6be2336" : "6903dce7e3cd64ba9a6134056405eaeb8dedcd37")),
+                    TEST_64BIT() ? "aae7591a1dbc58f21d0d004886075094f622e6dd" : "28a13fd8cf6fcd9f9a8108aed4c8bcc58040863a")),
             true, "check repo for WAL file");
 
         TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment again");
@@ -299,9 +315,78 @@ testRun(void)
                 storageTest,
                 strNewFmt(
                     "repo/archive/test/11-1/0000000100000001/000000010000000100000002-%s.gz",
-                    TEST_64BIT() ? "edad2f5a9d8a03ee3c09e8ce92c771e0d20232f5" : "e7c81f5513e0c6e3f19b9dbfc450019165994dda")),
+                    TEST_64BIT() ? "755defa48a0a0872767b6dea49bdd3b64902f147" : "9c2a6ec4491a2118bcdc9b653366581d8821c982")),
             true, "check repo for WAL file");
 
+        TEST_RESULT_STR(
+            strPtr(
+                strNewBuf(storageGetNP(storageNewReadNP(storageTest, strNew("repo/archive/test/11-1/" INFO_ARCHIVE_INDEX_FILE))))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000100000002\",\"min\":\"000000010000000100000001\"}}}",
+            "check archive index");
+
+        // The archive index is not updated when the archive lock is held by another process
+        // -------------------------------------------------------------------------------------------------------------------------
+        argListTemp = strLstDup(argList);
+        strLstAddZ(argListTemp, "pg_wal/000000010000000100000003");
+        harnessCfgLoad(strLstSize(argListTemp), strLstPtr(argListTemp));
+
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("pg_wal/000000010000000100000003")), walBuffer1);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, true)
+            {
+                IoRead *read = ioHandleReadNew(strNew("child read"), HARNESS_FORK_CHILD_READ(), 10000);
+                ioReadOpen(read);
+                IoWrite *write = ioHandleWriteNew(strNew("child write"), HARNESS_FORK_CHILD_WRITE());
+                ioWriteOpen(write);
+
+                lockAcquire(cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgLockType(), 30000, true);
+
+                // Let the parent know the lock has been acquired and wait for the parent to allow lock release
+                ioWriteStrLine(write, strNew(""));
+                ioWriteFlush(write);
+                ioReadLine(read);
+
+                lockRelease(true);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                IoRead *read = ioHandleReadNew(strNew("parent read"), HARNESS_FORK_PARENT_READ_PROCESS(0), 10000);
+                ioReadOpen(read);
+                IoWrite *write = ioHandleWriteNew(strNew("parent write"), HARNESS_FORK_PARENT_WRITE_PROCESS(0));
+                ioWriteOpen(write);
+
+                // Wait for the child to acquire the lock
+                ioReadLine(read);
+
+                harnessLogLevelSet(logLevelDetail);
+
+                TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment without updating the index");
+                harnessLogResult(
+                    "P00 DETAIL: unable to acquire archive lock so archive index was not updated\n"
+                    "P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+                harnessLogLevelReset();
+
+                // Notify the child to release the lock
+                ioWriteLine(write, bufNew(0));
+                ioWriteFlush(write);
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_STR(
+            strPtr(
+                strNewBuf(storageGetNP(storageNewReadNP(storageTest, strNew("repo/archive/test/11-1/" INFO_ARCHIVE_INDEX_FILE))))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000100000002\",\"min\":\"000000010000000100000001\"}}}",
+            "check archive index was not updated");
+
         // Push a history file
         // -------------------------------------------------------------------------------------------------------------------------
         argListTemp = strLstDup(argList);
@@ -406,7 +491,7 @@ testRun(void)
                 storageTest,
                 strNewFmt(
                     "repo/archive/test/11-1/0000000100000001/000000010000000100000002-%s",
-                    TEST_64BIT() ? "edad2f5a9d8a03ee3c09e8ce92c771e0d20232f5" : "e7c81f5513e0c6e3f19b9dbfc450019165994dda")),
+                    TEST_64BIT() ? "755defa48a0a0872767b6dea49bdd3b64902f147" : "9c2a6ec4491a2118bcdc9b653366581d8821c982")),
             true, "check repo for WAL file");
     }
 
@@ -550,7 +635,7 @@ testRun(void)
                 storageTest,
                 strNewFmt(
                     "repo/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s",
-                    TEST_64BIT() ? "f81d63dd5e258cd607534f3531bbd71442797e37" : "02d228126281e8e102b35a2737e45a0527946296")),
+                    TEST_64BIT() ? "ce58ec898a080e59d71dce49051843b03a497d99" : "765ee94e4f65d081f2dc3b8e77556da95bc31cbf")),
             true, "check repo for WAL file");
 
         // Direct tests of the async function
@@ -618,13 +703,20 @@ testRun(void)
                 storageTest,
                 strNewFmt(
                     "repo/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s",
-                    TEST_64BIT() ? "f81d63dd5e258cd607534f3531bbd71442797e37" : "02d228126281e8e102b35a2737e45a0527946296")),
+                    TEST_64BIT() ? "ce58ec898a080e59d71dce49051843b03a497d99" : "765ee94e4f65d081f2dc3b8e77556da95bc31cbf")),
             true, "check repo for WAL 1 file");
 
         TEST_RESULT_STR(
             strPtr(strLstJoin(strLstSort(storageListNP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc), "|")),
             "000000010000000100000001.ok|000000010000000100000002.error", "check status files");
 
+        TEST_RESULT_STR(
+            strPtr(
+                strNewBuf(storageGetNP(storageNewReadNP(storageTest, strNew("repo/archive/test/9.4-1/" INFO_ARCHIVE_INDEX_FILE))))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000100000001\",\"min\":\"000000010000000100000001\"}}}",
+            "check archive index");
+
         // Create WAL 2 segment
         Buffer *walBuffer2 = bufNew((size_t)16 * 1024 * 1024);
         bufUsedSet(walBuffer2, bufSize(walBuffer2));
@@ -647,9 +739,16 @@ testRun(void)
                 storageTest,
                 strNewFmt(
                     "repo/archive/test/9.4-1/0000000100000001/000000010000000100000002-%s",
-                    TEST_64BIT() ? "0aea6fa5d53500ce548b84a86bc3a29ae77fa048" : "408822a89ef44ef6740e785743bf1b870d8024a2")),
+                    TEST_64BIT() ? "251820f85b31554bbf33061fce7dabf18c16afe0" : "ae8cb1fe45d40bc364df6bc6e8803774f0e3eaeb")),
             true, "check repo for WAL 2 file");
 
+        TEST_RESULT_STR(
+            strPtr(
+                strNewBuf(storageGetNP(storageNewReadNP(storageTest, strNew("repo/archive/test/9.4-1/" INFO_ARCHIVE_INDEX_FILE))))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000100000002\",\"min\":\"000000010000000100000001\"}}}",
+            "check archive index");
+
         TEST_RESULT_STR(
             strPtr(strLstJoin(strLstSort(storageListNP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc), "|")),
             "000000010000000100000001.ok|000000010000000100000002.ok", "check status files");
@@ -687,6 +786,52 @@ testRun(void)
         TEST_RESULT_STR(
             strPtr(strLstJoin(strLstSort(storageListNP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc), "|")),
             "000000010000000100000001.ok|000000010000000100000002.ok", "check status files");
+
+        // Lower compression while there is a backlog
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePathRemoveP(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_OUT_STR, .recurse = true);
+        storagePathCreateNP(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_OUT_STR);
+
+        storagePathRemoveP(storageRepoWrite(), strNew(STORAGE_REPO_ARCHIVE "/9.4-1"), .recurse = true);
+        storagePathCreateNP(storageRepoWrite(), strNew(STORAGE_REPO_ARCHIVE "/9.4-1"));
+
+        argListTemp = strLstNew();
+        strLstAddZ(argListTemp, "pgbackrest");
+        strLstAddZ(argListTemp, "--stanza=test");
+        strLstAddZ(argListTemp, "--archive-push-compress-backlog=1");
+        strLstAdd(argListTemp, strNewFmt("--spool-path=%s/spool", testPath()));
+        strLstAdd(argListTemp, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAdd(argListTemp, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argListTemp, strNewFmt("--log-path=%s/log", testPath()));
+        strLstAddZ(argListTemp, "--log-level-file=trace");
+        strLstAddZ(argListTemp, "--log-subprocess");
+        strLstAddZ(argListTemp, "archive-push-async");
+        strLstAdd(argListTemp, strNewFmt("%s/pg/pg_xlog", testPath()));
+        harnessCfgLoad(strLstSize(argListTemp), strLstPtr(argListTemp));
+
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000003.ready")), NULL);
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("pg_xlog/000000010000000100000003")), walBuffer2);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        harnessLogResult(
+            "P00   INFO: push 3 WAL file(s) to archive: 000000010000000100000001...000000010000000100000003\n"
+            "P00 DETAIL: compress level 0 for WAL file '000000010000000100000001' with backlog of 3 WAL file(s)\n"
+            "P00 DETAIL: compress level 6 for WAL file '000000010000000100000003' with backlog of 1 WAL file(s)\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000001' to the archive\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000002' to the archive\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000003' to the archive");
+
+        StorageRead *read = storageNewReadNP(
+            storageTest,
+            strNewFmt(
+                "repo/archive/test/9.4-1/0000000100000001/000000010000000100000001-%s." GZIP_EXT,
+                TEST_64BIT() ? "ce58ec898a080e59d71dce49051843b03a497d99" : "765ee94e4f65d081f2dc3b8e77556da95bc31cbf"));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), gzipDecompressNew(false));
+        TEST_RESULT_UINT(bufUsed(storageGetNP(read)), 16 * 1024 * 1024, "check WAL 1 file");
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storageSpool(), strNew(STORAGE_SPOOL_ARCHIVE_OUT)), sortOrderAsc), "|")),
+            "000000010000000100000001.ok|000000010000000100000002.ok|000000010000000100000003.ok", "check status files");
         }
 
     FUNCTION_HARNESS_RESULT_VOID();
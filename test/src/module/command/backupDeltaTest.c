@@ -0,0 +1,161 @@
+/***********************************************************************************************************************************
+Test Backup Delta
+***********************************************************************************************************************************/
+
+/***********************************************************************************************************************************
+Add a file to a list
+***********************************************************************************************************************************/
+static void
+testFileAdd(List *fileList, const char *name, uint64_t size, time_t timestamp, bool future)
+{
+    BackupDeltaFile file = {.name = strNew(name), .size = size, .timestamp = timestamp, .future = future};
+    lstAdd(fileList, &file);
+}
+
+/***********************************************************************************************************************************
+Render decisions so they can be compared
+***********************************************************************************************************************************/
+static void
+testDeltaCallback(void *data, const BackupDeltaFile *file, const BackupDeltaFile *prior, bool reference, bool future)
+{
+    strCatFmt(
+        (String *)data, "%s: %s%s%s\n", strPtr(file->name), reference ? "reference" : "copy", prior != NULL ? ", prior" : "",
+        future ? ", future" : "");
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("backupDelta()"))
+    {
+        const time_t timeBegin = 1565282200;
+
+        // No prior backup
+        // -------------------------------------------------------------------------------------------------------------------------
+        List *fileList = lstNew(sizeof(BackupDeltaFile));
+        testFileAdd(fileList, "pg_data/base/1/2", 8192, timeBegin, false);
+        testFileAdd(fileList, "pg_data/PG_VERSION", 4, timeBegin - 100, false);
+
+        String *decision = strNew("");
+        BackupDeltaResult result = backupDelta(fileList, NULL, timeBegin, false, testDeltaCallback, decision);
+
+        TEST_RESULT_BOOL(result.delta, false, "delta not enabled");
+        TEST_RESULT_UINT(result.deltaReason, backupDeltaReasonNone, "    no reason");
+        TEST_RESULT_PTR(result.deltaFile, NULL, "    no file");
+        TEST_RESULT_BOOL(result.timeInFuture, false, "    no timestamps in the future");
+        TEST_RESULT_STR(
+            strPtr(decision),
+            "pg_data/PG_VERSION: copy\n"
+            "pg_data/base/1/2: copy\n",
+            "    all files copied");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        testFileAdd(fileList, "pg_data/base/1/3", 0, timeBegin + 1, false);
+
+        strTrunc(decision, 0);
+        result = backupDelta(fileList, NULL, timeBegin, false, testDeltaCallback, decision);
+
+        TEST_RESULT_BOOL(result.delta, true, "delta enabled");
+        TEST_RESULT_UINT(result.deltaReason, backupDeltaReasonFuture, "    timestamp in the future");
+        TEST_RESULT_STR(strPtr(result.deltaFile), "pg_data/base/1/3", "    check file");
+        TEST_RESULT_BOOL(result.timeInFuture, true, "    timestamps in the future");
+        TEST_RESULT_STR(
+            strPtr(decision),
+            "pg_data/PG_VERSION: copy\n"
+            "pg_data/base/1/2: copy\n"
+            "pg_data/base/1/3: copy, future\n",
+            "    all files copied");
+
+        // Prior backup
+        // -------------------------------------------------------------------------------------------------------------------------
+        fileList = lstNew(sizeof(BackupDeltaFile));
+        testFileAdd(fileList, "pg_data/base/1/4", 8192, timeBegin - 10, false);
+        testFileAdd(fileList, "pg_data/PG_VERSION", 4, timeBegin - 100, false);
+        testFileAdd(fileList, "pg_data/base/1/1", 0, timeBegin - 5, false);
+        testFileAdd(fileList, "pg_data/base/1/2", 8192, timeBegin - 5, false);
+        testFileAdd(fileList, "pg_data/base/1/6", 16384, timeBegin - 5, false);
+        testFileAdd(fileList, "pg_data/global/pg_control", 8192, timeBegin - 10, false);
+
+        List *priorList = lstNew(sizeof(BackupDeltaFile));
+        testFileAdd(priorList, "pg_data/PG_VERSION", 4, timeBegin - 100, false);
+        testFileAdd(priorList, "pg_data/base/1/0", 8192, timeBegin - 100, false);
+        testFileAdd(priorList, "pg_data/base/1/2", 8192, timeBegin - 10, false);
+        testFileAdd(priorList, "pg_data/base/1/1", 0, timeBegin - 10, false);
+        testFileAdd(priorList, "pg_data/base/1/5", 8192, timeBegin - 100, false);
+        testFileAdd(priorList, "pg_data/base/1/6", 8192, timeBegin - 10, false);
+        testFileAdd(priorList, "pg_data/global/pg_control", 8192, timeBegin - 10, true);
+
+        strTrunc(decision, 0);
+        result = backupDelta(fileList, priorList, timeBegin, true, testDeltaCallback, decision);
+
+        TEST_RESULT_BOOL(result.delta, true, "delta already enabled");
+        TEST_RESULT_UINT(result.deltaReason, backupDeltaReasonNone, "    no reason");
+        TEST_RESULT_BOOL(result.timeInFuture, true, "    timestamps in the future in prior backup");
+        TEST_RESULT_STR(
+            strPtr(decision),
+            "pg_data/PG_VERSION: reference, prior\n"
+            "pg_data/base/1/1: reference, prior\n"
+            "pg_data/base/1/2: reference, prior\n"
+            "pg_data/base/1/4: copy\n"
+            "pg_data/base/1/6: copy, prior\n"
+            "pg_data/global/pg_control: copy, prior\n",
+            "    check decisions");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        lstRemoveIdx(priorList, lstSize(priorList) - 1);
+
+        strTrunc(decision, 0);
+        result = backupDelta(fileList, priorList, timeBegin, false, testDeltaCallback, decision);
+
+        TEST_RESULT_BOOL(result.delta, false, "delta not enabled");
+        TEST_RESULT_BOOL(result.timeInFuture, false, "    no timestamps in the future");
+        TEST_RESULT_STR(
+            strPtr(decision),
+            "pg_data/PG_VERSION: reference, prior\n"
+            "pg_data/base/1/1: reference, prior\n"
+            "pg_data/base/1/2: copy, prior\n"
+            "pg_data/base/1/4: copy\n"
+            "pg_data/base/1/6: copy, prior\n"
+            "pg_data/global/pg_control: copy\n",
+            "    check decisions");
+
+        // Prior file has a timestamp in the future
+        // -------------------------------------------------------------------------------------------------------------------------
+        testFileAdd(priorList, "pg_data/global/pg_control", 8192, timeBegin - 10, true);
+
+        result = backupDelta(fileList, priorList, timeBegin, false, testDeltaCallback, strNew(""));
+
+        TEST_RESULT_BOOL(result.delta, true, "delta enabled");
+        TEST_RESULT_UINT(result.deltaReason, backupDeltaReasonFuture, "    timestamp in the future");
+        TEST_RESULT_STR(strPtr(result.deltaFile), "pg_data/global/pg_control", "    check file");
+
+        // Timestamp in the past
+        // -------------------------------------------------------------------------------------------------------------------------
+        testFileAdd(priorList, "pg_data/base/1/4", 8192, timeBegin - 5, false);
+
+        result = backupDelta(fileList, priorList, timeBegin, false, testDeltaCallback, strNew(""));
+
+        TEST_RESULT_BOOL(result.delta, true, "delta enabled");
+        TEST_RESULT_UINT(result.deltaReason, backupDeltaReasonChange, "    timestamp in the past");
+        TEST_RESULT_STR(strPtr(result.deltaFile), "pg_data/base/1/4", "    check file");
+
+        // Size changed but timestamp did not
+        // -------------------------------------------------------------------------------------------------------------------------
+        testFileAdd(priorList, "pg_data/base/1/3", 8192, timeBegin - 5, false);
+        testFileAdd(fileList, "pg_data/base/1/3", 0, timeBegin - 5, false);
+
+        result = backupDelta(fileList, priorList, timeBegin, false, testDeltaCallback, strNew(""));
+
+        TEST_RESULT_BOOL(result.delta, true, "delta enabled");
+        TEST_RESULT_UINT(result.deltaReason, backupDeltaReasonChange, "    size changed");
+        TEST_RESULT_STR(strPtr(result.deltaFile), "pg_data/base/1/3", "    check file");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -1,6 +1,9 @@
 /***********************************************************************************************************************************
 Test Backup Command
 ***********************************************************************************************************************************/
+#include "common/compress/gzip/common.h"
+#include "common/compress/gzip/decompress.h"
+#include "common/crypto/cipherBlock.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
 #include "common/io/io.h"
@@ -37,6 +40,8 @@ testRun(void)
     {
         TEST_RESULT_UINT(segmentNumber(pgFile), 0, "No segment number");
         TEST_RESULT_UINT(segmentNumber(strNewFmt("%s.123", strPtr(pgFile))), 123, "Segment number");
+        TEST_RESULT_UINT(segmentNumber(strNewFmt("%s.", strPtr(pgFile))), 0, "Empty extension is not a segment number");
+        TEST_RESULT_UINT(segmentNumber(strNewFmt("%s.12a", strPtr(pgFile))), 0, "Non-numeric extension is not a segment number");
     }
 
     // *****************************************************************************************************************************
@@ -60,7 +65,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                missingFile, true, 0, NULL, false, 0, missingFile, false, false, 1, backupLabel, false, cipherTypeNone, NULL),
+                missingFile, true, 0, NULL, false, 0, missingFile, false, false, 1, backupLabel, false,
+                backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "pg file missing, ignoreMissing=true, no delta");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy/repo size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -81,6 +87,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(0));                // repoFileCompressLevel
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // compressSide
+        varLstAdd(paramList, varNewBool(false));            // cipherSide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - skip");
@@ -91,7 +99,8 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ERROR_FMT(
             backupFile(
-                missingFile, false, 0, NULL, false, 0, missingFile, false, false, 1, backupLabel, false, cipherTypeNone, NULL),
+                missingFile, false, 0, NULL, false, 0, missingFile, false, false, 1, backupLabel, false,
+                backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             FileMissingError, "unable to open missing file '%s/pg/missing' for read", testPath());
 
         // Create a pg file to backup
@@ -106,7 +115,9 @@ testRun(void)
 
         TEST_ASSIGN(
             result,
-            backupFile(pgFile, false, 9, NULL, false, 0, pgFile, false, false, 1, backupLabel, false, cipherTypeNone, NULL),
+            backupFile(
+                pgFile, false, 9, NULL, false, 0, pgFile, false, false, 1, backupLabel, false,
+                backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         ((Storage *)storageRepo())->interface.feature = feature;
@@ -125,8 +136,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, false, 1, backupLabel, false, cipherTypeNone,
-                NULL),
+                pgFile, false, 9, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, false, 1, backupLabel, false,
+                backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "file checksummed with pageChecksum enabled");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -156,6 +167,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(1));                // repoFileCompressLevel
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // compressSide
+        varLstAdd(paramList, varNewBool(false));            // cipherSide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - pageChecksum");
@@ -171,7 +184,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true, false, 1, backupLabel,
-                true, cipherTypeNone, NULL),
+                true, backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "file in db and repo, checksum equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 0, "    repo size not set since already exists in repo");
@@ -198,6 +211,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(1));                // repoFileCompressLevel
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(true));             // delta
+        varLstAdd(paramList, varNewBool(false));            // compressSide
+        varLstAdd(paramList, varNewBool(false));            // cipherSide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - noop");
@@ -212,7 +227,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, true, false, 1, backupLabel,
-                true, cipherTypeNone, NULL),
+                true, backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "file in db and repo, pg checksum not equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -227,7 +242,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 8, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true, false, 1, backupLabel,
-                true, cipherTypeNone, NULL),
+                true, backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "db & repo file, pg checksum same, pg size different, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -245,7 +260,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, false, 1,
-                backupLabel, true, cipherTypeNone, NULL),
+                backupLabel, true, backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "    db & repo file, pgFileMatch, repo checksum no match, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    recopy file");
@@ -263,7 +278,7 @@ testRun(void)
             result,
             backupFile(
                 missingFile, true, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, false, 1,
-                backupLabel, true, cipherTypeNone, NULL),
+                backupLabel, true, backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "    file in repo only, checksum in repo equal, ignoreMissing=true, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=0 size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -275,7 +290,9 @@ testRun(void)
         // No prior checksum, compression, no page checksum, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(pgFile, false, 9, NULL, false, 0, pgFile, false, true, 3, backupLabel, false, cipherTypeNone, NULL),
+            backupFile(
+                pgFile, false, 9, NULL, false, 0, pgFile, false, true, 3, backupLabel, false,
+                backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "pg file exists, no checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -293,7 +310,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, true, 3, backupLabel,
-                false, cipherTypeNone, NULL),
+                false, backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "pg file & repo exists, match, checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -322,6 +339,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(3));                // repoFileCompressLevel
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
         varLstAdd(paramList, varNewBool(false));            // delta
+        varLstAdd(paramList, varNewBool(false));            // compressSide
+        varLstAdd(paramList, varNewBool(false));            // cipherSide
 
         TEST_RESULT_BOOL(
             backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - copy, compress");
@@ -339,7 +358,7 @@ testRun(void)
             result,
             backupFile(
                 strNew("zerofile"), false, 0, NULL, false, 0, strNew("zerofile"), false, false, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                backupFilterSideDb, backupFilterSideDb, cipherTypeNone, NULL),
             "zero-sized pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=pgFile size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -381,8 +400,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, NULL, false, 0, pgFile, false, false, 1, backupLabel, false, cipherTypeAes256Cbc,
-                strNew("12345678")),
+                pgFile, false, 9, NULL, false, 0, pgFile, false, false, 1, backupLabel, false,
+                backupFilterSideDb, backupFilterSideDb, cipherTypeAes256Cbc, strNew("12345678")),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -399,7 +418,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 8, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, false, 1,
-                backupLabel, true, cipherTypeAes256Cbc, strNew("12345678")),
+                backupLabel, true, backupFilterSideDb, backupFilterSideDb, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, pgFileMatch false, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -416,7 +435,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, false, false, 0,
-                backupLabel, false, cipherTypeAes256Cbc, strNew("12345678")),
+                backupLabel, false, backupFilterSideDb, backupFilterSideDb, cipherTypeAes256Cbc, strNew("12345678")),
             "pg and repo file exists, repo checksum no match, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -426,9 +445,49 @@ testRun(void)
                 storageExistsNP(storageRepo(), backupPathFile) && result.pageChecksumResult == NULL),
             true, "    recopy file to encrypted repo success");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Compress on the repo side so encryption must also be done on the repo side
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, true, 1, backupLabel, false,
+                backupFilterSideRepo, backupFilterSideDb, cipherTypeAes256Cbc, strNew("12345678")),
+            "pg file compressed and encrypted on repo side");
+        TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
+        TEST_RESULT_UINT(result.repoSize, 48, "    repo size set");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_STR(strPtr(result.copyChecksum), "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "    check checksum");
+        TEST_RESULT_BOOL(result.pageChecksumResult != NULL, true, "    check page checksum result");
+
+        StorageRead *read = storageNewReadNP(storageRepo(), strNewFmt("%s." GZIP_EXT, strPtr(backupPathFile)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("12345678"), NULL));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), gzipDecompressNew(false));
+        TEST_RESULT_STR(strPtr(strNewBuf(storageGetNP(read))), "atestfile", "    check repo");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Compress on the db side and encrypt on the repo side
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, NULL, false, 0, pgFile, false, true, 1, backupLabel, false,
+                backupFilterSideDb, backupFilterSideRepo, cipherTypeAes256Cbc, strNew("12345678")),
+            "pg file compressed on db side and encrypted on repo side");
+        TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
+        TEST_RESULT_UINT(result.repoSize, 48, "    repo size set");
+        TEST_RESULT_STR(strPtr(result.copyChecksum), "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "    check checksum");
+
+        read = storageNewReadNP(storageRepo(), strNewFmt("%s." GZIP_EXT, strPtr(backupPathFile)));
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTRDEF("12345678"), NULL));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), gzipDecompressNew(false));
+        TEST_RESULT_STR(strPtr(strNewBuf(storageGetNP(read))), "atestfile", "    check repo");
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
-        // cipherType, cipherPass
+        // cipherType, cipherPass, compress and encrypt on repo side
         paramList = varLstNew();
         varLstAdd(paramList, varNewStr(pgFile));                // pgFile
         varLstAdd(paramList, varNewBool(false));                // pgFileIgnoreMissing
@@ -443,10 +502,13 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(0));                    // repoFileCompressLevel
         varLstAdd(paramList, varNewStr(backupLabel));           // backupLabel
         varLstAdd(paramList, varNewBool(false));                // delta
+        varLstAdd(paramList, varNewBool(true));                 // compressSide
+        varLstAdd(paramList, varNewBool(true));                 // cipherSide
         varLstAdd(paramList, varNewStrZ("12345678"));           // cipherPass
 
         TEST_RESULT_BOOL(
-            backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true, "protocol backup file - recopy, encrypt");
+            backupProtocol(PROTOCOL_COMMAND_BACKUP_FILE_STR, paramList, server), true,
+            "protocol backup file - recopy, encrypt on repo side");
         TEST_RESULT_STR(
             strPtr(strNewBuf(serverWrite)), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n",
             "    check result");
@@ -96,6 +96,28 @@ testRun(void)
                 strNew(STORAGE_REPO_ARCHIVE "/9.2-1/000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa")),
             buffer);
 
+        TEST_RESULT_VOID(cmdCheck(), "check");
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   INFO: WAL segment 000000010000000100000001 successfully archived to '%s/repo/archive/test1/9.2-1/"
+                        "0000000100000001/000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa'\n"
+                    "P00   WARN: archive index does not include WAL segment 000000010000000100000001\n"
+                    "            HINT: info and expire will list the archive until archive-push updates the index.",
+                    testPath())));
+
+        // WAL segment is found and included in the archive index
+        harnessPqScriptSet((HarnessPq [])
+        {
+            HRNPQ_MACRO_OPEN_92(1, "dbname='postgres' port=5432", strPtr(pg1Path), false),
+            HRNPQ_MACRO_CREATE_RESTORE_POINT(1, "1/1"),
+            HRNPQ_MACRO_WAL_SWITCH(1, "xlog", "000000010000000100000001"),
+            HRNPQ_MACRO_CLOSE(1),
+            HRNPQ_MACRO_DONE()
+        });
+
+        archiveIndexUpdate(storageRepoWrite(), strNew(STORAGE_REPO_ARCHIVE "/9.2-1"), strLstNew());
+
         TEST_RESULT_VOID(cmdCheck(), "check");
         harnessLogResult(
             strPtr(
@@ -4,6 +4,9 @@ Test Common Command Routines
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "common/regExp.h"
+#include "common/stat.h"
+#include "storage/helper.h"
 #include "storage/storage.h"
 #include "version.h"
 
@@ -116,13 +119,138 @@ testRun(void)
 
         cfgOptionSet(cfgOptLogTimestamp, cfgSourceParam, varNewBool(true));
 
-        tlsClientNew(strNew("BOGUS"), 443, 1000, true, NULL, NULL);
+        tlsClientNew(strNew("BOGUS"), 443, 1000, true, NULL, NULL, NULL, NULL);
         httpClientNew(strNew("BOGUS"), 443, 1000, true, NULL, NULL);
 
         TEST_RESULT_VOID(cmdEnd(0, NULL), "command end with success");
         harnessLogResultRegExp(
             "P00   INFO: http statistics: objects 1, sessions 0, requests 0, retries 0, closes 0\n"
             "P00   INFO\\: archive-get command end: completed successfully \\([0-9]+ms\\)");
+
+        // Memory statistics are logged at debug level
+        // -------------------------------------------------------------------------------------------------------------------------
+        harnessLogLevelSet(logLevelDebug);
+
+        TEST_RESULT_VOID(cmdBegin(false), "command begin enables memory statistics");
+        harnessLogResult("P00   INFO: archive-get command begin");
+
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end with memory statistics");
+        harnessLogResultRegExp(
+            "P00  DEBUG\\:     command/command\\:\\:cmdEnd\\: memory statistics\\: peak [0-9.]+[KMG]?B, largest contexts\\:"
+                " [A-Za-z]+ [0-9.]+[KMG]?B \\([0-9]+\\)(, [A-Za-z]+ [0-9.]+[KMG]?B \\([0-9]+\\)){0,4}\n");
+
+        harnessLogLevelReset();
+
+        // Write metric snapshots
+        // -------------------------------------------------------------------------------------------------------------------------
+        cfgInit();
+        cfgCommandSet(cfgCmdArchiveGet);
+
+        cfgOptionValidSet(cfgOptMetricPath, true);
+        cfgOptionSet(cfgOptMetricPath, cfgSourceParam, varNewStr(strNewFmt("%s/metric", testPath())));
+        cfgOptionValidSet(cfgOptStanza, true);
+        cfgOptionSet(cfgOptStanza, cfgSourceParam, varNewStrZ("db"));
+
+        harnessLogLevelSet(logLevelWarn);
+
+        TEST_RESULT_VOID(cmdBegin(true), "command begin with metric path");
+        statAdd(STRDEF("test.byte"), 100);
+
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end writes metrics");
+        TEST_RESULT_BOOL(
+            regExpMatchOne(
+                STRDEF(
+                    "^\\{\"command\":\"archive-get\",\"process\":0,\"stanza\":\"db\",\"time\":[0-9]+,"
+                        "\"stat\":\\{.*\"test.byte\":\\{\"count\":1,\"max\":100,\"total\":100\\}.*\\}\\}\n$"),
+                strNewBuf(storageGetNP(storageNewReadNP(storageLocal(), strNewFmt("%s/metric/db-archive-get.json", testPath()))))),
+            true, "check json");
+        TEST_RESULT_BOOL(
+            strBeginsWithZ(
+                strNewBuf(storageGetNP(storageNewReadNP(storageLocal(), strNewFmt("%s/metric/db-archive-get.prom", testPath())))),
+                "# TYPE pgbackrest_"),
+            true, "check prometheus");
+
+        // Local processes write their own snapshots and no stanza is required
+        cfgCommandSet(cfgCmdLocal);
+        cfgOptionSet(cfgOptStanza, cfgSourceParam, NULL);
+        cfgOptionValidSet(cfgOptCommand, true);
+        cfgOptionSet(cfgOptCommand, cfgSourceParam, varNewStrZ("backup"));
+        cfgOptionValidSet(cfgOptProcess, true);
+        cfgOptionSet(cfgOptProcess, cfgSourceParam, varNewInt(2));
+
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "local command end writes metrics");
+        TEST_RESULT_BOOL(
+            strBeginsWithZ(
+                strNewBuf(
+                    storageGetNP(
+                        storageNewReadNP(storageLocal(), strNewFmt("%s/metric/all-backup-local-002.json", testPath())))),
+                "{\"command\":\"local\",\"process\":2,\"stanza\":null,"),
+            true, "check json");
+        TEST_RESULT_BOOL(
+            strPtr(
+                strNewBuf(
+                    storageGetNP(
+                        storageNewReadNP(storageLocal(), strNewFmt("%s/metric/all-backup-local-002.prom", testPath())))))[0] == '#',
+            true, "check prometheus");
+
+        // Remote processes are named like their log files so parallel remotes do not overwrite each other's snapshots
+        cfgCommandSet(cfgCmdRemote);
+
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "remote command end writes metrics");
+        TEST_RESULT_BOOL(
+            strBeginsWithZ(
+                strNewBuf(
+                    storageGetNP(
+                        storageNewReadNP(storageLocal(), strNewFmt("%s/metric/all-backup-remote-002.json", testPath())))),
+                "{\"command\":\"remote\",\"process\":2,\"stanza\":null,"),
+            true, "check json");
+        TEST_RESULT_BOOL(
+            regExpMatchOne(
+                STRDEF("\\{command=\"remote\",process=\"2\",stanza=\"\"\\}"),
+                strNewBuf(
+                    storageGetNP(
+                        storageNewReadNP(storageLocal(), strNewFmt("%s/metric/all-backup-remote-002.prom", testPath()))))),
+            true, "check prometheus");
+
+        // Errors writing snapshots are only warnings
+        storagePutNP(storageNewWriteNP(storageLocalWrite(), strNewFmt("%s/file", testPath())), NULL);
+        cfgOptionSet(cfgOptMetricPath, cfgSourceParam, varNewStr(strNewFmt("%s/file/metric", testPath())));
+
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end metric write error");
+        harnessLogResultRegExp("P00   WARN: unable to write metrics: .*Not a directory");
+
+        // Write profile to the log path.  Remote processes write their own profile.
+        // -------------------------------------------------------------------------------------------------------------------------
+        cfgCommandSet(cfgCmdRemote);
+        cfgOptionValidSet(cfgOptMetricPath, false);
+        cfgOptionValidSet(cfgOptProfile, true);
+        cfgOptionSet(cfgOptProfile, cfgSourceParam, BOOL_TRUE_VAR);
+        cfgOptionValidSet(cfgOptLogPath, true);
+        cfgOptionSet(cfgOptLogPath, cfgSourceParam, varNewStr(strNewFmt("%s/log", testPath())));
+
+        TEST_RESULT_VOID(cmdBegin(false), "command begin starts profile");
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end writes profile");
+        TEST_RESULT_BOOL(
+            storageExistsNP(storageLocal(), strNewFmt("%s/log/all-backup-remote-002.profile", testPath())), true,
+            "check profile");
+
+        // Errors writing the profile are only warnings
+        cfgOptionSet(cfgOptLogPath, cfgSourceParam, varNewStr(strNewFmt("%s/file/log", testPath())));
+
+        TEST_RESULT_VOID(cmdBegin(false), "command begin starts profile");
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end profile write error");
+        harnessLogResultRegExp("P00   WARN: unable to write profile: .*Not a directory");
+
+        // No profile is written when disabled
+        cfgOptionSet(cfgOptProfile, cfgSourceParam, BOOL_FALSE_VAR);
+        cfgOptionSet(cfgOptLogPath, cfgSourceParam, varNewStr(strNewFmt("%s/log-disabled", testPath())));
+
+        TEST_RESULT_VOID(cmdBegin(false), "command begin without profile");
+        TEST_RESULT_VOID(cmdEnd(0, NULL), "command end without profile");
+        TEST_RESULT_BOOL(
+            storagePathExistsNP(storageLocal(), strNewFmt("%s/log-disabled", testPath())), false, "check no profile");
+
+        harnessLogLevelReset();
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
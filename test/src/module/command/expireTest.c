@@ -600,6 +600,45 @@ testRun(void)
             "P00   INFO: full backup total < 4 - using oldest full backup for 9.4-1 archive retention\n"
             "P00   INFO: full backup total < 4 - using oldest full backup for 10-2 archive retention");
 
+        TEST_RESULT_STR(
+            strPtr(
+                strNewBuf(
+                    storageGetNP(
+                        storageNewReadNP(storageTest, strNewFmt("%s/9.4-1/" INFO_ARCHIVE_INDEX_FILE, strPtr(archiveStanzaPath)))))),
+            "{\"format\":1,\"timeline\":{"
+                "\"00000001\":{\"max\":\"000000010000000000000010\",\"min\":\"000000010000000000000002\"},"
+                "\"00000002\":{\"max\":\"000000020000000000000010\",\"min\":\"000000020000000000000001\"}}}",
+            "  archive index updated with new oldest WAL");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        // WAL older than the archive index is not found when the index shows that there is nothing to expire
+        archiveGenerate(storageTest, archiveStanzaPath, 1, 1, "9.4-1", "0000000100000000");
+
+        TEST_RESULT_VOID(removeExpiredArchive(infoBackup), "archive index shows nothing to expire");
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(
+                storageTest, strNewFmt("%s/%s/%s", strPtr(archiveStanzaPath), "9.4-1", "0000000100000000")), sortOrderAsc), ", ")),
+            strPtr(archiveExpectList(1, 10, "0000000100000000")),
+            "  9.4-1/0000000100000000/000000010000000000000001 not removed");
+        harnessLogResult(
+            "P00   INFO: full backup total < 4 - using oldest full backup for 9.4-1 archive retention\n"
+            "P00   INFO: full backup total < 4 - using oldest full backup for 10-2 archive retention");
+
+        // The archive is listed when the archive index is missing
+        storageRemoveNP(storageTest, strNewFmt("%s/9.4-1/" INFO_ARCHIVE_INDEX_FILE, strPtr(archiveStanzaPath)));
+
+        TEST_RESULT_VOID(removeExpiredArchive(infoBackup), "archive index missing");
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(
+                storageTest, strNewFmt("%s/%s/%s", strPtr(archiveStanzaPath), "9.4-1", "0000000100000000")), sortOrderAsc), ", ")),
+            strPtr(archiveExpectList(2, 10, "0000000100000000")),
+            "  9.4-1/0000000100000000/000000010000000000000001 removed");
+        harnessLogResult(
+            "P00   INFO: full backup total < 4 - using oldest full backup for 9.4-1 archive retention\n"
+            "P00   INFO: full backup total < 4 - using oldest full backup for 10-2 archive retention");
+
         //--------------------------------------------------------------------------------------------------------------------------
         argList = strLstDup(argListAvoidWarn);
         strLstAddZ(argList, "--repo1-retention-archive=2");
@@ -33,11 +33,13 @@ testRun(void)
         "    help            Get help.\n"
         "    info            Retrieve information about backups.\n"
         "    restore         Restore a database cluster.\n"
+        "    server          pgBackRest TLS server.\n"
         "    stanza-create   Create the required stanza data.\n"
         "    stanza-delete   Delete a stanza.\n"
         "    stanza-upgrade  Upgrade a stanza.\n"
         "    start           Allow pgBackRest processes to run.\n"
         "    stop            Stop pgBackRest processes from running.\n"
+        "    verify          Verify contents of the repository.\n"
         "    version         Get version.\n"
         "\n"
         "Use 'pgbackrest help [command]' for more information.\n",
@@ -164,6 +166,7 @@ testRun(void)
             "  --delta                          restore or backup using checksums [default=n]\n"
             "  --lock-path                      path where lock files are stored\n"
             "                                   [default=/tmp/pgbackrest]\n"
+            "  --metric-path                    path where metric snapshots are written\n"
             "  --neutral-umask                  use a neutral umask [default=y]\n"
             "  --process-max                    max processes to use for compress/transfer\n"
             "                                   [default=1]\n"
@@ -179,15 +182,22 @@ testRun(void)
             "                                   [default=/var/log/pgbackrest]\n"
             "  --log-subprocess                 enable logging in subprocesses [default=n]\n"
             "  --log-timestamp                  enable timestamp in logging [default=y]\n"
+            "  --profile                        sample where processes spend time [default=n]\n"
             "\n",
             "Repository Options:\n"
             "\n"
+            "  --repo-cache-path                local cache for repository files\n"
+            "  --repo-cache-size                maximum size of the repository cache\n"
+            "                                   [default=1073741824]\n"
             "  --repo-cipher-pass               repository cipher passphrase\n"
             "                                   [current=<redacted>]\n"
             "  --repo-cipher-type               cipher used to encrypt the repository\n"
             "                                   [current=aes-256-cbc, default=none]\n"
             "  --repo-host                      repository host when operating remotely via\n"
-            "                                   SSH [current=backup.example.net]\n"
+            "                                   SSH or TLS [current=backup.example.net]\n"
+            "  --repo-host-ca-file              repository host certificate authority file\n"
+            "  --repo-host-ca-path              repository host certificate authority path\n"
+            "  --repo-host-cert-file            repository host certificate file\n"
             "  --repo-host-cmd                  pgBackRest exe path on the repository host\n"
             "  --repo-host-config               pgBackRest repository host configuration\n"
             "                                   file\n"
@@ -196,7 +206,9 @@ testRun(void)
             "                                   include path [default=/etc/pgbackrest/conf.d]\n"
             "  --repo-host-config-path          pgBackRest repository host configuration\n"
             "                                   path [default=/etc/pgbackrest]\n"
+            "  --repo-host-key-file             repository host key file\n"
             "  --repo-host-port                 repository host port when repo-host is set\n"
+            "  --repo-host-type                 repository host protocol type [default=ssh]\n"
             "  --repo-host-user                 repository host user when repo-host is set\n"
             "                                   [default=pgbackrest]\n"
             "  --repo-path                      path where backups and archive are stored\n"
@@ -208,6 +220,8 @@ testRun(void)
             "  --repo-s3-host                   s3 repository host\n"
             "  --repo-s3-key                    s3 repository access key\n"
             "  --repo-s3-key-secret             s3 repository secret access key\n"
+            "  --repo-s3-list-parallel          s3 repository concurrent list requests\n"
+            "                                   [default=4]\n"
             "  --repo-s3-port                   s3 repository port [default=443]\n"
             "  --repo-s3-region                 s3 repository region\n"
             "  --repo-s3-token                  s3 repository security token\n"
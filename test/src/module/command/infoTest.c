@@ -651,6 +651,53 @@ testRun(void)
             "        wal archive min/max (9.4-1): none present\n"
             , "text - multiple stanzas, one with valid backups, archives in latest DB");
 
+        // Archive index is used when it covers the backups
+        //--------------------------------------------------------------------------------------------------------------------------
+        argList2 = strLstDup(argListText);
+        strLstAddZ(argList2, "--stanza=stanza1");
+        harnessCfgLoad(strLstSize(argList2), strLstPtr(argList2));
+
+        String *archiveIndexFile = strNewFmt("%s/9.4-1/" INFO_ARCHIVE_INDEX_FILE, strPtr(archiveStanza1Path));
+
+        storagePutNP(
+            storageNewWriteNP(storageLocalWrite(), archiveIndexFile),
+            BUFSTRDEF(
+                "{\"format\":1,\"timeline\":{"
+                    "\"00000001\":{\"max\":\"000000010000000000000004\",\"min\":\"000000010000000000000001\"},"
+                    "\"00000002\":{\"max\":\"000000020000000000000005\",\"min\":\"000000020000000000000001\"}}}"));
+
+        TEST_RESULT_BOOL(
+            strstr(
+                strPtr(infoRender()), "wal archive min/max (9.4-1): 000000010000000000000001/000000020000000000000005\n") != NULL,
+            true, "text - archive min/max from index");
+
+        // Archive index is not used when it is missing a segment that was pushed while expire was rebuilding it
+        storagePutNP(
+            storageNewWriteNP(storageLocalWrite(), archiveIndexFile),
+            BUFSTRDEF(
+                "{\"format\":1,\"timeline\":{"
+                    "\"00000001\":{\"max\":\"000000010000000000000004\",\"min\":\"000000010000000000000001\"},"
+                    "\"00000002\":{\"max\":\"000000020000000000000002\",\"min\":\"000000020000000000000001\"}}}"));
+
+        TEST_RESULT_BOOL(
+            strstr(
+                strPtr(infoRender()), "wal archive min/max (9.4-1): 000000010000000000000002/000000020000000000000003\n") != NULL,
+            true, "text - archive min/max from listing when index is not current");
+
+        // Archive index is not used when it does not cover the backups
+        storagePutNP(
+            storageNewWriteNP(storageLocalWrite(), archiveIndexFile),
+            BUFSTRDEF(
+                "{\"format\":1,\"timeline\":{"
+                    "\"00000001\":{\"max\":\"000000010000000000000004\",\"min\":\"000000010000000000000003\"}}}"));
+
+        TEST_RESULT_BOOL(
+            strstr(
+                strPtr(infoRender()), "wal archive min/max (9.4-1): 000000010000000000000002/000000020000000000000003\n") != NULL,
+            true, "text - archive min/max from listing when index is stale");
+
+        storageRemoveNP(storageLocalWrite(), archiveIndexFile);
+
         // Stanza not found
         //--------------------------------------------------------------------------------------------------------------------------
         argList2 = strLstDup(argList);
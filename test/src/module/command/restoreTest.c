@@ -242,5 +242,179 @@ testRun(void)
         TEST_RESULT_BOOL(restoreProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid function");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("restorePath()"))
+    {
+        // Load Parameters
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAddZ(argList, "restore");
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+        const String *user = strNew(testUser());
+        const String *group = strNew(testGroup());
+
+        // Create the pg path
+        storagePathCreateP(storagePgWrite(), NULL, .mode = 0700);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        KeyValue *entryKv = kvNew();
+        RestorePathResult result = {0};
+
+        TEST_ASSIGN(result, restorePath(strNew("base"), 0750, user, group, true, true, entryKv), "create missing path");
+        TEST_RESULT_UINT(result.fileRemoved + result.linkRemoved + result.pathRemoved, 0, "    nothing removed");
+
+        StorageInfo info = storageInfoNP(storagePg(), strNew("base"));
+        TEST_RESULT_INT(info.type, storageTypePath, "    check type");
+        TEST_RESULT_UINT(info.mode, 0750, "    check mode");
+
+        TEST_ASSIGN(result, restorePath(strNew("base"), 0700, user, group, true, false, entryKv), "fix mode");
+        TEST_RESULT_UINT(storageInfoNP(storagePg(), strNew("base")).mode, 0700, "    check mode");
+
+        TEST_ASSIGN(result, restorePath(strNew("base"), 0750, user, group, false, false, entryKv), "do not fix mode");
+        TEST_RESULT_UINT(storageInfoNP(storagePg(), strNew("base")).mode, 0700, "    check mode");
+
+        TEST_ASSIGN(result, restorePath(strNew("base"), 0700, strNew(BOGUS_STR), group, true, false, entryKv), "fix owner");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("global")), BUFSTRDEF("FILE"));
+
+        TEST_ASSIGN(result, restorePath(strNew("global"), 0700, user, group, true, true, entryKv), "replace file with path");
+        TEST_RESULT_UINT(result.fileRemoved, 1, "    file removed");
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(result.messageList, "\n")),
+            strPtr(strNewFmt("remove file %s/pg/global - path expected", testPath())), "    check messages");
+        TEST_RESULT_INT(storageInfoNP(storagePg(), strNew("global")).type, storageTypePath, "    check type");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteP(storagePgWrite(), strNew("base/keep"), .modeFile = 0600), BUFSTRDEF("KEEP"));
+        storagePutNP(storageNewWriteP(storagePgWrite(), strNew("base/mode"), .modeFile = 0600), BUFSTRDEF("MODE"));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("base/remove")), BUFSTRDEF("REMOVE"));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("base/preserve")), BUFSTRDEF("PRESERVE"));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("base/remove-path/file")), BUFSTRDEF("FILE"));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("base/remove-path/sub/file")), BUFSTRDEF("FILE"));
+        storagePutNP(storageNewWriteNP(storagePgWrite(), strNew("base/wrong-type/file")), BUFSTRDEF("FILE"));
+        storagePathCreateNP(storagePgWrite(), strNew("base/sub"));
+
+        THROW_ON_SYS_ERROR(
+            symlink("../global", strPtr(strNewFmt("%s/pg/base/remove-link", testPath()))) == -1, FileOpenError,
+            "unable to create link");
+        THROW_ON_SYS_ERROR(
+            symlink("../../global", strPtr(strNewFmt("%s/pg/base/remove-path/link", testPath()))) == -1, FileOpenError,
+            "unable to create link");
+        THROW_ON_SYS_ERROR(
+            symlink("../global", strPtr(strNewFmt("%s/pg/base/link-changed", testPath()))) == -1, FileOpenError,
+            "unable to create link");
+        THROW_ON_SYS_ERROR(
+            symlink("../global", strPtr(strNewFmt("%s/pg/base/link-same", testPath()))) == -1, FileOpenError,
+            "unable to create link");
+
+        KeyValue *fileKv = kvPutKv(entryKv, VARSTRDEF("keep"));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_FILE));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_MODE), VARSTRDEF("0600"));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_USER), VARSTR(user));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_GROUP), VARSTR(group));
+
+        fileKv = kvPutKv(entryKv, VARSTRDEF("mode"));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_FILE));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_MODE), VARSTRDEF("0640"));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_USER), VARSTR(user));
+        kvPut(fileKv, VARSTRDEF(RESTORE_PATH_KEY_GROUP), VARSTR(group));
+
+        kvPut(entryKv, VARSTRDEF("preserve"), NULL);
+
+        KeyValue *pathKv = kvPutKv(entryKv, VARSTRDEF("sub"));
+        kvPut(pathKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_PATH));
+
+        pathKv = kvPutKv(entryKv, VARSTRDEF("wrong-type"));
+        kvPut(pathKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_LINK));
+        kvPut(pathKv, VARSTRDEF(RESTORE_PATH_KEY_DESTINATION), VARSTRDEF("../global"));
+        kvPut(pathKv, VARSTRDEF(RESTORE_PATH_KEY_USER), VARSTR(user));
+        kvPut(pathKv, VARSTRDEF(RESTORE_PATH_KEY_GROUP), VARSTR(group));
+
+        KeyValue *linkKv = kvPutKv(entryKv, VARSTRDEF("link-changed"));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_LINK));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_DESTINATION), VARSTRDEF("../base"));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_USER), VARSTR(user));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_GROUP), VARSTR(group));
+
+        linkKv = kvPutKv(entryKv, VARSTRDEF("link-same"));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_LINK));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_DESTINATION), VARSTRDEF("../global"));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_USER), VARSTR(user));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_GROUP), VARSTR(group));
+
+        linkKv = kvPutKv(entryKv, VARSTRDEF("link-new"));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_TYPE), VARSTRDEF(RESTORE_PATH_TYPE_LINK));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_DESTINATION), VARSTRDEF("../global"));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_USER), VARSTR(user));
+        kvPut(linkKv, VARSTRDEF(RESTORE_PATH_KEY_GROUP), VARSTR(group));
+
+        TEST_ASSIGN(result, restorePath(strNew("base"), 0700, user, group, true, true, entryKv), "clean path");
+        TEST_RESULT_UINT(result.fileRemoved, 4, "    files removed, including files in removed paths");
+        TEST_RESULT_UINT(result.linkRemoved, 2, "    links removed, including links in removed paths");
+        TEST_RESULT_UINT(result.pathRemoved, 3, "    paths removed, including paths in removed paths");
+        const char *basePath = strPtr(strNewFmt("%s/pg/base", testPath()));
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(result.messageList, "\n")),
+            strPtr(
+                strNewFmt(
+                    "remove file %s/wrong-type/file\n"
+                    "remove path %s/wrong-type\n"
+                    "remove file %s/remove-path/sub/file\n"
+                    "remove path %s/remove-path/sub\n"
+                    "remove link %s/remove-path/link\n"
+                    "remove file %s/remove-path/file\n"
+                    "remove path %s/remove-path\n"
+                    "remove link %s/remove-link\n"
+                    "remove file %s/remove\n"
+                    "preserve file %s/preserve\n"
+                    "set mode 0640 on %s/mode\n"
+                    "remove link %s/link-changed - destination changed",
+                    basePath, basePath, basePath, basePath, basePath, basePath, basePath, basePath, basePath, basePath,
+                    basePath, basePath)),
+            "    check messages");
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storagePg(), strNew("base")), sortOrderAsc), ", ")),
+            "keep, link-changed, link-new, link-same, mode, preserve, sub, wrong-type", "    check contents");
+        TEST_RESULT_UINT(storageInfoNP(storagePg(), strNew("base/mode")).mode, 0640, "    check file mode");
+        TEST_RESULT_STR(
+            strPtr(storageInfoNP(storagePg(), strNew("base/link-changed")).linkDestination), "../base", "    check link changed");
+        TEST_RESULT_STR(
+            strPtr(storageInfoNP(storagePg(), strNew("base/link-new")).linkDestination), "../global", "    check link new");
+        TEST_RESULT_STR(
+            strPtr(storageInfoNP(storagePg(), strNew("base/wrong-type")).linkDestination), "../global",
+            "    check link replaced path");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(strNewFmt("%s/pg/base", testPath())));
+        varLstAdd(paramList, varNewStrZ("0700"));
+        varLstAdd(paramList, varNewStr(user));
+        varLstAdd(paramList, varNewStr(group));
+        varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewKv(kvNew()));
+
+        TEST_RESULT_BOOL(restoreProtocol(PROTOCOL_COMMAND_RESTORE_PATH_STR, paramList, server), true, "protocol restore path");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(serverWrite)),
+            strPtr(
+                strNewFmt(
+                    "{\"out\":[3,4,1,[\"remove link %s/wrong-type\",\"remove path %s/sub\",\"remove file %s/preserve\","
+                    "\"remove file %s/mode\",\"remove link %s/link-same\",\"remove link %s/link-new\","
+                    "\"remove link %s/link-changed\",\"remove file %s/keep\"]]}\n",
+                    basePath, basePath, basePath, basePath, basePath, basePath, basePath, basePath)),
+            "    check result");
+        bufUsedSet(serverWrite, 0);
+
+        TEST_RESULT_UINT(strLstSize(storageListNP(storagePg(), strNew("base"))), 0, "    check path is empty");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -0,0 +1,234 @@
+/***********************************************************************************************************************************
+Test Server Command
+***********************************************************************************************************************************/
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/io/tls/client.h"
+#include "common/type/json.h"
+#include "config/protocol.h"
+#include "protocol/helper.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessConfig.h"
+#include "common/harnessFork.h"
+#include "common/harnessTls.h"
+
+/***********************************************************************************************************************************
+Path and prefix for test certificates
+***********************************************************************************************************************************/
+#define TEST_CERTIFICATE_PREFIX                                     "test/certificate/pgbackrest-test"
+
+/***********************************************************************************************************************************
+Send remote parameters to the server and return the response
+***********************************************************************************************************************************/
+static String *
+testServerRequest(const char *param)
+{
+    String *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TlsClient *client = tlsClientNew(
+            strNew(TLS_TEST_HOST), TLS_TEST_PORT, 5000, true, strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()),
+            NULL, strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath()),
+            strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath()));
+        tlsClientOpen(client);
+
+        ioWriteStrLine(tlsClientIoWrite(client), STR(param));
+        ioWriteFlush(tlsClientIoWrite(client));
+
+        String *response = ioReadLine(tlsClientIoRead(client));
+
+        memContextSwitch(MEM_CONTEXT_OLD());
+        result = strDup(response);
+        memContextSwitch(MEM_CONTEXT_TEMP());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    return result;
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    Storage *storageTest = storagePosixNew(
+        strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+    // *****************************************************************************************************************************
+    if (testBegin("cmdServer()"))
+    {
+        // The remote loads the server config so make sure it does not log
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("pgbackrest.conf")),
+            BUFSTRDEF(
+                "[global]\n"
+                "log-level-console=off\n"
+                "log-level-file=off\n"
+                "log-level-stderr=off\n"
+                "\n"
+                "[test1]\n"
+                "repo1-path=/server/repo\n"));
+        storagePathCreateNP(storageTest, strNew("conf.d"));
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                StringList *argList = strLstNew();
+                strLstAddZ(argList, "pgbackrest");
+                strLstAdd(argList, strNewFmt("--config=%s/pgbackrest.conf", testPath()));
+                strLstAdd(argList, strNewFmt("--config-include-path=%s/conf.d", testPath()));
+                strLstAdd(argList, strNewFmt("--config-path=%s", testPath()));
+                strLstAddZ(argList, "--tls-server-address=127.0.0.1");
+                strLstAddZ(argList, "--tls-server-auth=*.test.pgbackrest.org=test1,test3");
+                strLstAdd(argList, strNewFmt("--tls-server-ca-file=%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()));
+                strLstAdd(argList, strNewFmt("--tls-server-cert-file=%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath()));
+                strLstAdd(argList, strNewFmt("--tls-server-key-file=%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath()));
+                strLstAddZ(argList, "--tls-server-port=9443");
+                strLstAddZ(argList, "server");
+                harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+                // The remote started for the last connection also returns here when it is done
+                cmdServer(13);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // Client without a certificate is rejected but the server keeps running
+                // -----------------------------------------------------------------------------------------------------------------
+                TlsClient *client = tlsClientNew(
+                    strNew(TLS_TEST_HOST), TLS_TEST_PORT, 5000, true,
+                    strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL);
+                bool errorFound = false;
+
+                TRY_BEGIN()
+                {
+                    tlsClientOpen(client);
+                    ioReadLine(tlsClientIoRead(client));
+                }
+                CATCH_ANY()
+                {
+                    errorFound = true;
+                }
+                TRY_END();
+
+                TEST_RESULT_BOOL(errorFound, true, "client without certificate");
+                tlsClientFree(client);
+
+                // Connect without negotiating TLS.  Negotiation is done in the child so the server keeps accepting connections.
+                // -----------------------------------------------------------------------------------------------------------------
+                struct sockaddr_in serverAddress = {.sin_family = AF_INET, .sin_port = htons(TLS_TEST_PORT)};
+                inet_pton(AF_INET, "127.0.0.1", &serverAddress.sin_addr);
+
+                int stalled = socket(AF_INET, SOCK_STREAM, 0);
+                TEST_RESULT_INT(
+                    connect(stalled, (struct sockaddr *)&serverAddress, sizeof(serverAddress)), 0, "connect stalled client");
+
+                // Invalid parameters
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[]")), "{\"err\":43,\"out\":\"remote parameters are required\"}", "no parameters");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--stanza=test1\",\"backup\"]")),
+                    "{\"err\":48,\"out\":\"command 'backup' is not allowed, expected 'remote'\"}", "command is not remote");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"bogus\",\"remote\"]")), "{\"err\":31,\"out\":\"invalid parameter 'bogus'\"}",
+                    "invalid parameter");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--config=/etc/bogus.conf\",\"remote\"]")),
+                    "{\"err\":31,\"out\":\"option '--config=/etc/bogus.conf' is not allowed\"}", "config option not allowed");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--no-config\",\"remote\"]")),
+                    "{\"err\":31,\"out\":\"option '--no-config' is not allowed\"}", "negated config option not allowed");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--config-path=/etc\",\"remote\"]")),
+                    "{\"err\":31,\"out\":\"option '--config-path=/etc' is not allowed\"}", "config path option not allowed");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--no-conf\",\"remote\"]")),
+                    "{\"err\":31,\"out\":\"invalid option '--no-conf'\"}", "abbreviated option not allowed");
+
+                // Authorization
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--process=0\",\"remote\"]")),
+                    "{\"err\":72,\"out\":\"client '*.test.pgbackrest.org' is not authorized for all stanzas\"}",
+                    "stanza required when not authorized for all");
+                TEST_RESULT_STR(
+                    strPtr(testServerRequest("[\"--stanza=\\\"test2\\\"\",\"remote\"]")),
+                    "{\"err\":72,\"out\":\"client '*.test.pgbackrest.org' is not authorized for stanza 'test2'\"}",
+                    "quotes are removed before authorization");
+
+                // Closing the stalled client ends its negotiation
+                close(stalled);
+
+                StringList *argBaseList = strLstNew();
+                strLstAddZ(argBaseList, "pgbackrest");
+                strLstAddZ(argBaseList, "--protocol-timeout=10");
+                strLstAddZ(argBaseList, "--repo1-host=" TLS_TEST_HOST);
+                strLstAdd(argBaseList, strNewFmt("--repo1-host-ca-file=%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()));
+                strLstAdd(argBaseList, strNewFmt("--repo1-host-cert-file=%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath()));
+                strLstAdd(argBaseList, strNewFmt("--repo1-host-key-file=%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath()));
+                strLstAddZ(argBaseList, "--repo1-host-port=9443");
+                strLstAddZ(argBaseList, "--repo1-host-type=tls");
+                strLstAddZ(argBaseList, "--repo1-path=/path with space");
+                strLstAddZ(argBaseList, "info");
+
+                StringList *argList = strLstDup(argBaseList);
+                strLstInsertZ(argList, 1, "--stanza=test2");
+                harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+                TEST_ERROR(
+                    protocolRemoteGet(protocolStorageTypeRepo, 1), HostInvalidError,
+                    "unable to start remote on '" TLS_TEST_HOST ":9443': client '*.test.pgbackrest.org' is not authorized for"
+                        " stanza 'test2'");
+
+                // Start remote
+                // -----------------------------------------------------------------------------------------------------------------
+                argList = strLstDup(argBaseList);
+                strLstInsertZ(argList, 1, "--stanza=test1");
+                harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+                ProtocolClient *remote = NULL;
+                TEST_ASSIGN(remote, protocolRemoteGet(protocolStorageTypeRepo, 1), "get remote");
+
+                VariantList *param = varLstNew();
+                varLstAdd(param, varNewStr(CFGOPT_REPO1_PATH_STR));
+
+                TEST_RESULT_STR(
+                    strPtr(varStr(varLstGet(configProtocolOption(remote, param), 0))), "/server/repo",
+                    "    repo path from the client is ignored");
+
+                TEST_RESULT_VOID(protocolFree(), "free remote");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        // The server and remotes share the log with the test
+        harnessLogResultRegExp(
+            "^P00   INFO: listening on '127\\.0\\.0\\.1:9443'\n"
+            "P00   WARN: unable to accept connection: unable to negotiate TLS connection with '127\\.0\\.0\\.1:[0-9]+': [^\n]+\n"
+            "P00   WARN: unable to start remote: remote parameters are required\n"
+            "P00   WARN: unable to start remote: command 'backup' is not allowed, expected 'remote'\n"
+            "P00   WARN: unable to start remote: invalid parameter 'bogus'\n"
+            "P00   WARN: unable to start remote: option '--config=/etc/bogus\\.conf' is not allowed\n"
+            "P00   WARN: unable to start remote: option '--no-config' is not allowed\n"
+            "P00   WARN: unable to start remote: option '--config-path=/etc' is not allowed\n"
+            "P00   WARN: unable to start remote: invalid option '--no-conf'\n"
+            "P00   WARN: unable to start remote: client '\\*\\.test\\.pgbackrest\\.org' is not authorized for all stanzas\n"
+            "P00   WARN: unable to start remote: client '\\*\\.test\\.pgbackrest\\.org' is not authorized for stanza 'test2'\n"
+            "P00   WARN: unable to accept connection: unable to negotiate TLS connection with '127\\.0\\.0\\.1:[0-9]+': [^\n]+\n"
+            "P00   WARN: unable to start remote: client '\\*\\.test\\.pgbackrest\\.org' is not authorized for stanza 'test2'$");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -24,6 +24,7 @@ testRun(void)
         StringList *argList = strLstNew();
         strLstAddZ(argList, "pgbackrest");
         strLstAdd(argList, strNewFmt("--repo-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--spool-path=%s/spool", testPath()));
         strLstAddZ(argList, "--output=text");
         strLstAddZ(argList, "--sort=none");
         strLstAddZ(argList, "ls");
@@ -95,6 +96,18 @@ testRun(void)
                 "}",
             "    check output");
 
+        output = bufNew(0);
+        cfgOptionSet(cfgOptOutput, cfgSourceParam, VARSTRDEF("json-lines"));
+        TEST_RESULT_VOID(storageListRender(ioBufferWriteNew(output)), "path and file (json-lines)");
+        TEST_RESULT_STR_Z(
+            strNewBuf(output),
+                "{\"name\":\".\",\"type\":\"path\"}\n"
+                "{\"name\":\"aaa\",\"type\":\"file\",\"size\":8}\n"
+                "{\"name\":\"bbb\",\"type\":\"path\"}\n"
+                "{\"name\":\"link\",\"type\":\"link\",\"destination\":\"../bbb\"}\n"
+                "{\"name\":\"pipe\",\"type\":\"special\"}",
+            "    check output");
+
         // Reverse sort
         // -------------------------------------------------------------------------------------------------------------------------
         cfgOptionSet(cfgOptSort, cfgSourceParam, VARSTRDEF("desc"));
@@ -114,6 +127,25 @@ testRun(void)
         TEST_RESULT_VOID(storageListRender(ioBufferWriteNew(output)), "filter");
         TEST_RESULT_STR(strPtr(strNewBuf(output)), "pipe\nlink\nbbb/ccc\nbbb\naaa", "    check output");
 
+        // Sort in runs written to the spool path
+        // -------------------------------------------------------------------------------------------------------------------------
+        cfgOptionSet(cfgOptSortMax, cfgSourceParam, VARINT64(2));
+
+        output = bufNew(0);
+        TEST_RESULT_VOID(storageListRender(ioBufferWriteNew(output)), "sort in runs (desc)");
+        TEST_RESULT_STR(strPtr(strNewBuf(output)), "pipe\nlink\nbbb/ccc\nbbb\naaa", "    check output");
+
+        cfgOptionSet(cfgOptSort, cfgSourceParam, VARSTRDEF("asc"));
+
+        output = bufNew(0);
+        TEST_RESULT_VOID(storageListRender(ioBufferWriteNew(output)), "sort in runs (asc)");
+        TEST_RESULT_STR(strPtr(strNewBuf(output)), "aaa\nbbb\nbbb/ccc\nlink\npipe", "    check output");
+        TEST_RESULT_STR_Z(
+            strLstJoin(storageListNP(storageTest, strNew("spool")), ","), "", "    check runs were removed");
+
+        cfgOptionSet(cfgOptSort, cfgSourceParam, VARSTRDEF("desc"));
+        cfgOptionSet(cfgOptSortMax, cfgSourceParam, VARINT64(100000));
+
         // Filter
         // -------------------------------------------------------------------------------------------------------------------------
         cfgOptionValidSet(cfgOptFilter, true);
@@ -0,0 +1,633 @@
+/***********************************************************************************************************************************
+Test Verify Command
+***********************************************************************************************************************************/
+#include "common/compress/gzip/compress.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
+#include "common/io/io.h"
+#include "info/manifestBin.h"
+#include "postgres/interface.h"
+#include "postgres/version.h"
+#include "protocol/helper.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessConfig.h"
+#include "common/harnessInfo.h"
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // Create default storage object for testing
+    Storage *storageTest = storagePosixNew(
+        strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+    // Start a protocol server to test the protocol directly
+    Buffer *serverWrite = bufNew(8192);
+    IoWrite *serverWriteIo = ioBufferWriteNew(serverWrite);
+    ioWriteOpen(serverWriteIo);
+
+    ProtocolServer *server = protocolServerNew(
+        strNew("test"), strNew("test"), ioBufferReadNew(bufNew(0)), serverWriteIo);
+
+    bufUsedSet(serverWrite, 0);
+
+    // *****************************************************************************************************************************
+    if (testBegin("verifyFile() and verifyProtocol()"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=db");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAddZ(argList, "verify");
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+        // Create a plain repo file
+        storagePutNP(storageNewWriteNP(storageRepoWrite(), strNew("plain")), BUFSTRDEF("atestfile"));
+
+        VerifyFileResult result = {0};
+
+        TEST_ASSIGN(
+            result,
+            verifyFile(strNew("plain"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 9, false, cipherTypeNone, NULL),
+            "verify plain file");
+        TEST_RESULT_UINT(result.fileResult, verifyOk, "    check result");
+        TEST_RESULT_UINT(result.fileSize, 9, "    check size");
+
+        TEST_ASSIGN(
+            result,
+            verifyFile(strNew("plain"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, false, cipherTypeNone, NULL),
+            "verify plain file without size check");
+        TEST_RESULT_UINT(result.fileResult, verifyOk, "    check result");
+
+        TEST_ASSIGN(
+            result,
+            verifyFile(strNew("plain"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 8, false, cipherTypeNone, NULL),
+            "verify plain file with wrong size");
+        TEST_RESULT_UINT(result.fileResult, verifySizeInvalid, "    check result");
+
+        TEST_ASSIGN(
+            result,
+            verifyFile(strNew("plain"), strNew("ffffffffffffffffffffffffffffffffffffffff"), true, 9, false, cipherTypeNone, NULL),
+            "verify plain file with wrong checksum");
+        TEST_RESULT_UINT(result.fileResult, verifyChecksumMismatch, "    check result");
+
+        TEST_ASSIGN(
+            result,
+            verifyFile(strNew("missing"), strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 9, false, cipherTypeNone, NULL),
+            "verify missing file");
+        TEST_RESULT_UINT(result.fileResult, verifyFileMissing, "    check result");
+        TEST_RESULT_UINT(result.fileSize, 0, "    check size");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Create a compressed encrypted repo file
+        StorageWrite *ceRepoFile = storageNewWriteNP(storageRepoWrite(), strNew("compress-encrypt.gz"));
+        IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(ceRepoFile));
+        ioFilterGroupAdd(filterGroup, gzipCompressNew(3, false));
+        ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+
+        storagePutNP(ceRepoFile, BUFSTRDEF("acefile"));
+
+        TEST_ASSIGN(
+            result,
+            verifyFile(
+                strNew("compress-encrypt.gz"), strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), true, 7, true,
+                cipherTypeAes256Cbc, strNew("pass")),
+            "verify compressed encrypted file");
+        TEST_RESULT_UINT(result.fileResult, verifyOk, "    check result");
+        TEST_RESULT_UINT(result.fileSize, 7, "    check size");
+
+        TEST_ERROR(
+            verifyFile(
+                strNew("compress-encrypt.gz"), strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), true, 7, true,
+                cipherTypeAes256Cbc, strNew("badpass")),
+            CryptoError, "unable to flush");
+
+        // Check protocol function directly
+        // -------------------------------------------------------------------------------------------------------------------------
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewStrZ("compress-encrypt.gz"));
+        varLstAdd(paramList, varNewStrZ("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"));
+        varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewUInt64(7));
+        varLstAdd(paramList, varNewBool(true));
+        varLstAdd(paramList, varNewUInt64(cipherTypeAes256Cbc));
+        varLstAdd(paramList, varNewStrZ("pass"));
+
+        TEST_RESULT_BOOL(verifyProtocol(PROTOCOL_COMMAND_VERIFY_FILE_STR, paramList, server), true, "protocol verify file");
+        TEST_RESULT_STR(strPtr(strNewBuf(serverWrite)), "{\"out\":[0,7]}\n", "    check result");
+
+        bufUsedSet(serverWrite, 0);
+
+        // Check invalid protocol function
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(verifyProtocol(strNew(BOGUS_STR), paramList, server), false, "invalid function");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("cmdVerify()"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=db");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAddZ(argList, "--log-level-console=detail");
+        strLstAddZ(argList, "verify");
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+        harnessLogLevelSet(logLevelDetail);
+
+        // Create archive.info and backup.info
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/archive/db/archive.info")),
+            harnessInfoChecksumZ(
+                "[db]\n"
+                "db-id=1\n"
+                "db-system-id=6625592122879095702\n"
+                "db-version=\"9.4\"\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-id\":6625592122879095702,\"db-version\":\"9.4\"}\n"));
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/backup.info")),
+            harnessInfoChecksumZ(
+                "[backup:current]\n"
+                "20190818-084502F={"
+                "\"backrest-format\":5,\"backrest-version\":\"2.16\","
+                "\"backup-archive-start\":\"000000010000000000000001\",\"backup-archive-stop\":\"000000010000000000000003\","
+                "\"backup-info-repo-size\":9,\"backup-info-repo-size-delta\":9,"
+                "\"backup-info-size\":9,\"backup-info-size-delta\":9,"
+                "\"backup-timestamp-start\":1566117902,\"backup-timestamp-stop\":1566117905,\"backup-type\":\"full\","
+                "\"db-id\":1,\"option-archive-check\":true,\"option-archive-copy\":false,\"option-backup-standby\":false,"
+                "\"option-checksum-page\":true,\"option-compress\":false,\"option-hardlink\":false,\"option-online\":true}\n"
+                "\n"
+                "[db]\n"
+                "db-catalog-version=201409291\n"
+                "db-control-version=942\n"
+                "db-id=1\n"
+                "db-system-id=6625592122879095702\n"
+                "db-version=\"9.4\"\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-catalog-version\":201409291,\"db-control-version\":942,\"db-system-id\":6625592122879095702,"
+                    "\"db-version\":\"9.4\"}\n"));
+
+        // Create WAL segments.  Segment 2 is compressed and segment 3 is missing.
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew(
+                    "repo/archive/db/9.4-1/0000000100000000/"
+                        "000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67")),
+            BUFSTRDEF("atestfile"));
+
+        StorageWrite *walCompressed = storageNewWriteNP(
+            storageTest,
+            strNew(
+                "repo/archive/db/9.4-1/0000000100000000/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770.gz"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(walCompressed)), gzipCompressNew(3, false));
+        storagePutNP(walCompressed, BUFSTRDEF("acefile"));
+
+        // Create the manifest and backup files.  The referenced file is stored in a prior backup so it is not verified here.
+        Buffer *manifestContent = harnessInfoChecksumZ(
+            "[backup]\n"
+            "backup-label=\"20190818-084502F\"\n"
+            "\n"
+            "[target:file]\n"
+            "pg_data/PG_VERSION={\"checksum\":\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",\"size\":9"
+                ",\"timestamp\":1565282114}\n"
+            "pg_data/base/1={\"checksum\":\"ffffffffffffffffffffffffffffffffffffffff\",\"reference\":\"20190818-084400F\""
+                ",\"size\":7,\"timestamp\":1565282114}\n"
+            "pg_data/zero={\"size\":0,\"timestamp\":1565282114}\n");
+
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest")), manifestContent);
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/pg_data/PG_VERSION")), BUFSTRDEF("atestfile"));
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/pg_data/zero")), NULL);
+
+        TEST_ERROR(cmdVerify(), RepoInvalidError, "verify found 1 error(s) in the repository");
+        harnessLogResultRegExp(
+            "^P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P00   INFO: verify archive '9\\.4-1' \\(2 WAL segment\\(s\\)\\)\n"
+            "P00   WARN: WAL segment '000000010000000000000003' required by backup '20190818-084502F' is missing from archive"
+                " '9\\.4-1'\n"
+            "P00   INFO: verify backup '20190818-084502F' \\(2 file\\(s\\)\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz' \\(7B\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/PG_VERSION' \\(9B\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/zero' \\(0B\\)\n"
+            "P00   INFO: verified 4 file\\(s\\), 25B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Add the missing segment and corrupt a backup file
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew(
+                    "repo/archive/db/9.4-1/0000000100000000/"
+                        "000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67")),
+            BUFSTRDEF("atestfile"));
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/pg_data/PG_VERSION")), BUFSTRDEF("btestfile"));
+        storageRemoveNP(storageTest, strNew("repo/backup/db/20190818-084502F/pg_data/zero"));
+
+        TEST_ERROR(cmdVerify(), RepoInvalidError, "verify found 2 error(s) in the repository");
+        harnessLogResultRegExp(
+            "^P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz' \\(7B\\)\n"
+            "P00   INFO: verify archive '9\\.4-1' \\(3 WAL segment\\(s\\)\\)\n"
+            "P00   INFO: verify backup '20190818-084502F' \\(2 file\\(s\\)\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01   WARN: '20190818-084502F/pg_data/PG_VERSION' has an invalid checksum\n"
+            "P01   WARN: '20190818-084502F/pg_data/zero' is missing\n"
+            "P00   INFO: verified 5 file\\(s\\), 34B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Repair the backup
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/pg_data/PG_VERSION")), BUFSTRDEF("atestfile"));
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/pg_data/zero")), NULL);
+
+        TEST_RESULT_VOID(cmdVerify(), "verify repository");
+        harnessLogResultRegExp(
+            "^P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz' \\(7B\\)\n"
+            "P00   INFO: verify archive '9\\.4-1' \\(3 WAL segment\\(s\\)\\)\n"
+            "P00   INFO: verify backup '20190818-084502F' \\(2 file\\(s\\)\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/PG_VERSION' \\(9B\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/zero' \\(0B\\)\n"
+            "P00   INFO: verified 5 file\\(s\\), 34B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Verify from the binary manifest when the text manifest is missing
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *manifestBin = manifestBinFromText(manifestContent);
+
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest.bin")), manifestBin);
+        storageRemoveNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest"));
+
+        TEST_RESULT_VOID(cmdVerify(), "verify repository");
+        harnessLogResultRegExp(
+            "^P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz' \\(7B\\)\n"
+            "P00   INFO: verify archive '9\\.4-1' \\(3 WAL segment\\(s\\)\\)\n"
+            "P00   INFO: verify backup '20190818-084502F' \\(2 file\\(s\\)\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/PG_VERSION' \\(9B\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/zero' \\(0B\\)\n"
+            "P00   INFO: verified 5 file\\(s\\), 34B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Corrupt binary manifest
+        // -------------------------------------------------------------------------------------------------------------------------
+        Buffer *manifestBinInvalid = bufDup(manifestBin);
+        bufPtr(manifestBinInvalid)[bufUsed(manifestBinInvalid) - HASH_TYPE_SHA1_SIZE - 2] = 'X';
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest.bin")), manifestBinInvalid);
+
+        TEST_ERROR(cmdVerify(), RepoInvalidError, "verify found 1 error(s) in the repository");
+        harnessLogResultRegExp(
+            "^P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz' \\(7B\\)\n"
+            "P00   INFO: verify archive '9\\.4-1' \\(3 WAL segment\\(s\\)\\)\n"
+            "P00   WARN: unable to verify backup '20190818-084502F': binary manifest checksum does not match\n"
+            "P01 DETAIL: verified '9\\.4-1/000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+            "P00   INFO: verified 3 file\\(s\\), 25B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Remove the manifest and its copy.  The binary manifest is from a host with a different layout so it cannot be used.
+        // -------------------------------------------------------------------------------------------------------------------------
+        manifestBinInvalid = bufDup(manifestBin);
+        memset(bufPtr(manifestBinInvalid) + 12, 0xFF, sizeof(uint32_t));
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest.bin")), manifestBinInvalid);
+
+        TEST_ERROR(cmdVerify(), RepoInvalidError, "verify found 1 error(s) in the repository");
+        harnessLogResultRegExp(
+            strPtr(
+                strNewFmt(
+                    "P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+                    "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz'"
+                        " \\(7B\\)\n"
+                    "P00   INFO: verify archive '9\\.4-1' \\(3 WAL segment\\(s\\)\\)\n"
+                    "P00 DETAIL: unable to use binary manifest '%s/repo/backup/db/20190818-084502F/backup\\.manifest\\.bin':"
+                        " binary manifest version 1 with record size 4294967295 is not supported\n"
+                    "P00   WARN: unable to verify backup '20190818-084502F': unable to load manifest"
+                        " '%s/repo/backup/db/20190818-084502F/backup\\.manifest' or"
+                        " '%s/repo/backup/db/20190818-084502F/backup\\.manifest\\.copy':\n"
+                    "            FileMissingError: unable to open missing file"
+                        " '%s/repo/backup/db/20190818-084502F/backup\\.manifest' for read\n"
+                    "            FileMissingError: unable to open missing file"
+                        " '%s/repo/backup/db/20190818-084502F/backup\\.manifest\\.copy' for read\n"
+                    "P01 DETAIL: verified '9\\.4-1/000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+                    "P00   INFO: verified 3 file\\(s\\), 25B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$",
+                    testPath(), testPath(), testPath(), testPath(), testPath())));
+
+        storageRemoveNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest.bin"));
+
+        // Check errors in the archive and backups that do not depend on file contents
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/archive/db/archive.info")),
+            harnessInfoChecksumZ(
+                "[db]\n"
+                "db-id=2\n"
+                "db-system-id=6625592122879095703\n"
+                "db-version=\"11\"\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-id\":6625592122879095702,\"db-version\":\"9.4\"}\n"
+                "2={\"db-id\":6625592122879095703,\"db-version\":\"11\"}\n"));
+
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/backup.info")),
+            harnessInfoChecksumZ(
+                "[backup:current]\n"
+                "20190818-084502F={"
+                "\"backrest-format\":5,\"backrest-version\":\"2.16\","
+                "\"backup-archive-start\":\"000000010000000000000001\",\"backup-archive-stop\":\"000000010000000000000001\","
+                "\"backup-info-repo-size\":9,\"backup-info-repo-size-delta\":9,"
+                "\"backup-info-size\":9,\"backup-info-size-delta\":9,"
+                "\"backup-timestamp-start\":1566117902,\"backup-timestamp-stop\":1566117905,\"backup-type\":\"full\","
+                "\"db-id\":1,\"option-archive-check\":true,\"option-archive-copy\":false,\"option-backup-standby\":false,"
+                "\"option-checksum-page\":true,\"option-compress\":false,\"option-hardlink\":false,\"option-online\":true}\n"
+                "20190819-084502F={"
+                "\"backrest-format\":5,\"backrest-version\":\"2.16\","
+                "\"backup-archive-start\":\"00000001000000000000007F\",\"backup-archive-stop\":\"000000010000000100000000\","
+                "\"backup-info-repo-size\":9,\"backup-info-repo-size-delta\":9,"
+                "\"backup-info-size\":9,\"backup-info-size-delta\":9,"
+                "\"backup-timestamp-start\":1566204302,\"backup-timestamp-stop\":1566204305,\"backup-type\":\"full\","
+                "\"db-id\":2,\"option-archive-check\":true,\"option-archive-copy\":false,\"option-backup-standby\":false,"
+                "\"option-checksum-page\":true,\"option-compress\":false,\"option-hardlink\":false,\"option-online\":true}\n"
+                "20190820-084502F={"
+                "\"backrest-format\":5,\"backrest-version\":\"2.16\","
+                "\"backup-archive-start\":\"000000010000000000000001\",\"backup-archive-stop\":\"000000010000000000000001\","
+                "\"backup-info-repo-size\":9,\"backup-info-repo-size-delta\":9,"
+                "\"backup-info-size\":9,\"backup-info-size-delta\":9,"
+                "\"backup-timestamp-start\":1566290702,\"backup-timestamp-stop\":1566290705,\"backup-type\":\"full\","
+                "\"db-id\":3,\"option-archive-check\":true,\"option-archive-copy\":false,\"option-backup-standby\":false,"
+                "\"option-checksum-page\":true,\"option-compress\":false,\"option-hardlink\":false,\"option-online\":true}\n"
+                "20190821-084502F={"
+                "\"backrest-format\":5,\"backrest-version\":\"2.16\","
+                "\"backup-archive-start\":\"000000010000000000000001\",\"backup-archive-stop\":\"000000010000000000000001\","
+                "\"backup-info-repo-size\":9,\"backup-info-repo-size-delta\":9,"
+                "\"backup-info-size\":9,\"backup-info-size-delta\":9,"
+                "\"backup-timestamp-start\":1566377102,\"backup-timestamp-stop\":1566377105,\"backup-type\":\"full\","
+                "\"db-id\":4,\"option-archive-check\":true,\"option-archive-copy\":false,\"option-backup-standby\":false,"
+                "\"option-checksum-page\":true,\"option-compress\":false,\"option-hardlink\":false,\"option-online\":true}\n"
+                "\n"
+                "[db]\n"
+                "db-catalog-version=201409291\n"
+                "db-control-version=942\n"
+                "db-id=3\n"
+                "db-system-id=6625592122879095704\n"
+                "db-version=\"9.6\"\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-catalog-version\":201409291,\"db-control-version\":942,\"db-system-id\":6625592122879095702,"
+                    "\"db-version\":\"9.4\"}\n"
+                "2={\"db-catalog-version\":201809051,\"db-control-version\":1100,\"db-system-id\":6625592122879095703,"
+                    "\"db-version\":\"11\"}\n"
+                "3={\"db-catalog-version\":201608131,\"db-control-version\":960,\"db-system-id\":6625592122879095704,"
+                    "\"db-version\":\"9.6\"}\n"));
+
+        // Segment 1 is stored twice and the second copy claims to be compressed but is not
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest,
+                strNew(
+                    "repo/archive/db/9.4-1/0000000100000000/"
+                        "000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67.gz")),
+            BUFSTRDEF("atestfile"));
+
+        // The 32MB segment size is read from the WAL header so segment 1/80 is not required
+        Buffer *walBuffer = bufNew(PG_WAL_HEADER_SIZE);
+        bufUsedSet(walBuffer, bufSize(walBuffer));
+        memset(bufPtr(walBuffer), 0, bufSize(walBuffer));
+        pgWalTestToBuffer(
+            (PgWal){.version = PG_VERSION_11, .systemId = 6625592122879095703, .walSegmentSize = 32 * 1024 * 1024}, walBuffer);
+        const char *walChecksum = strPtr(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer)));
+
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest, strNewFmt("repo/archive/db/11-2/0000000100000000/00000001000000000000007F-%s", walChecksum)),
+            walBuffer);
+        storagePutNP(
+            storageNewWriteNP(
+                storageTest, strNewFmt("repo/archive/db/11-2/0000000100000001/000000010000000100000000-%s", walChecksum)),
+            walBuffer);
+
+        // A file with contents must have a checksum
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190818-084502F/backup.manifest")),
+            harnessInfoChecksumZ(
+                "[target:file]\n"
+                "pg_data/PG_VERSION={\"size\":9,\"timestamp\":1565282114}\n"));
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190819-084502F/backup.manifest")),
+            harnessInfoChecksumZ(
+                "[backup]\n"
+                "backup-label=\"20190819-084502F\"\n"));
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190820-084502F/backup.manifest.copy")),
+            harnessInfoChecksumZ(
+                "[backup]\n"
+                "backup-label=\"20190820-084502F\"\n"));
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo/backup/db/20190821-084502F/backup.manifest")),
+            harnessInfoChecksumZ(
+                "[backup]\n"
+                "backup-label=\"20190821-084502F\"\n"));
+
+        TEST_ERROR(cmdVerify(), RepoInvalidError, "verify found 5 error(s) in the repository");
+        harnessLogResultRegExp(
+            strPtr(
+                strNewFmt(
+                    "^P01 DETAIL: verified '11-2/00000001000000000000007F-%s' \\(512B\\)\n"
+                    "P00   INFO: verify archive '11-2' \\(2 WAL segment\\(s\\)\\)\n"
+                    "P01 DETAIL: verified '11-2/000000010000000100000000-%s' \\(512B\\)\n"
+                    "P00   WARN: duplicate WAL segment '000000010000000000000001' in archive '9\\.4-1'\n"
+                    "P01 DETAIL: verified '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+                    "P01   WARN: unable to verify '9\\.4-1/000000010000000000000001-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\\.gz':"
+                        " \\[29\\] raised from local-1 protocol: zlib threw error: \\[-3\\] data error\n"
+                    "P01 DETAIL: verified '9\\.4-1/000000010000000000000002-d1cd8a7d11daa26814b93eb604e1d49ab4b43770\\.gz'"
+                        " \\(7B\\)\n"
+                    "P00   INFO: verify archive '9\\.4-1' \\(3 WAL segment\\(s\\)\\)\n"
+                    "P00   INFO: verify backup '20190818-084502F' \\(1 file\\(s\\)\\)\n"
+                    "P00   WARN: '20190818-084502F/pg_data/PG_VERSION' has no checksum in the manifest\n"
+                    "P00   INFO: verify backup '20190819-084502F' \\(0 file\\(s\\)\\)\n"
+                    "P00   WARN: archive '9\\.6-3' required by backup '20190820-084502F' not found\n"
+                    "P00   INFO: verify backup '20190820-084502F' \\(0 file\\(s\\)\\)\n"
+                    "P00   WARN: archive '<unknown>' required by backup '20190821-084502F' not found\n"
+                    "P00   INFO: verify backup '20190821-084502F' \\(0 file\\(s\\)\\)\n"
+                    "P01 DETAIL: verified '9\\.4-1/000000010000000000000003-9bc8ab2dda60ef4beed07d1e19ce0676d5edde67' \\(9B\\)\n"
+                    "P00   INFO: verified 5 file\\(s\\), 1KB in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$",
+                    walChecksum, walChecksum)));
+
+        // Verify an encrypted repo from the binary manifest
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Free the local processes since they were started with the prior repo path
+        protocolFree();
+
+        argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=db");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo-cipher", testPath()));
+        strLstAddZ(argList, "--repo1-cipher-type=aes-256-cbc");
+        strLstAddZ(argList, "--log-level-console=detail");
+        strLstAddZ(argList, "verify");
+        setenv("PGBACKREST_REPO1_CIPHER_PASS", "repopass", true);
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+        unsetenv("PGBACKREST_REPO1_CIPHER_PASS");
+
+        StorageWrite *write = storageNewWriteNP(storageTest, strNew("repo-cipher/archive/db/archive.info"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("repopass"), NULL));
+        storagePutNP(
+            write,
+            harnessInfoChecksumZ(
+                "[cipher]\n"
+                "cipher-pass=\"archivepass\"\n"
+                "\n"
+                "[db]\n"
+                "db-id=1\n"
+                "db-system-id=6625592122879095702\n"
+                "db-version=\"9.4\"\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-id\":6625592122879095702,\"db-version\":\"9.4\"}\n"));
+
+        // The backup is offline so no WAL is required
+        write = storageNewWriteNP(storageTest, strNew("repo-cipher/backup/db/backup.info"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("repopass"), NULL));
+        storagePutNP(
+            write,
+            harnessInfoChecksumZ(
+                "[backup:current]\n"
+                "20190818-084502F={"
+                "\"backrest-format\":5,\"backrest-version\":\"2.16\","
+                "\"backup-info-repo-size\":9,\"backup-info-repo-size-delta\":9,"
+                "\"backup-info-size\":9,\"backup-info-size-delta\":9,"
+                "\"backup-timestamp-start\":1566117902,\"backup-timestamp-stop\":1566117905,\"backup-type\":\"full\","
+                "\"db-id\":1,\"option-archive-check\":false,\"option-archive-copy\":false,\"option-backup-standby\":false,"
+                "\"option-checksum-page\":true,\"option-compress\":false,\"option-hardlink\":false,\"option-online\":false}\n"
+                "\n"
+                "[cipher]\n"
+                "cipher-pass=\"manifestpass\"\n"
+                "\n"
+                "[db]\n"
+                "db-catalog-version=201409291\n"
+                "db-control-version=942\n"
+                "db-id=1\n"
+                "db-system-id=6625592122879095702\n"
+                "db-version=\"9.4\"\n"
+                "\n"
+                "[db:history]\n"
+                "1={\"db-catalog-version\":201409291,\"db-control-version\":942,\"db-system-id\":6625592122879095702,"
+                    "\"db-version\":\"9.4\"}\n"));
+
+        // Only the binary manifest is required.  It contains the passphrase for the backup files.
+        manifestContent = harnessInfoChecksumZ(
+            "[cipher]\n"
+            "cipher-pass=\"filepass\"\n"
+            "\n"
+            "[target:file]\n"
+            "pg_data/PG_VERSION={\"checksum\":\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",\"size\":9,\"timestamp\":1565282114}\n");
+
+        write = storageNewWriteNP(storageTest, strNew("repo-cipher/backup/db/20190818-084502F/backup.manifest.bin"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("manifestpass"), NULL));
+        storagePutNP(write, manifestBinFromText(manifestContent));
+
+        write = storageNewWriteNP(storageTest, strNew("repo-cipher/backup/db/20190818-084502F/pg_data/PG_VERSION"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("filepass"), NULL));
+        storagePutNP(write, BUFSTRDEF("atestfile"));
+
+        TEST_RESULT_VOID(cmdVerify(), "verify encrypted repository");
+        harnessLogResultRegExp(
+            "^P00   INFO: verify archive '9\\.4-1' \\(0 WAL segment\\(s\\)\\)\n"
+            "P00   INFO: verify backup '20190818-084502F' \\(1 file\\(s\\)\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/PG_VERSION' \\(9B\\)\n"
+            "P00   INFO: verified 1 file\\(s\\), 9B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Verify an encrypted repo from the text manifest
+        // -------------------------------------------------------------------------------------------------------------------------
+        storageRemoveNP(storageTest, strNew("repo-cipher/backup/db/20190818-084502F/backup.manifest.bin"));
+
+        write = storageNewWriteNP(storageTest, strNew("repo-cipher/backup/db/20190818-084502F/backup.manifest"));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("manifestpass"), NULL));
+        storagePutNP(write, manifestContent);
+
+        TEST_RESULT_VOID(cmdVerify(), "verify encrypted repository");
+        harnessLogResultRegExp(
+            "^P00   INFO: verify archive '9\\.4-1' \\(0 WAL segment\\(s\\)\\)\n"
+            "P00   INFO: verify backup '20190818-084502F' \\(1 file\\(s\\)\\)\n"
+            "P01 DETAIL: verified '20190818-084502F/pg_data/PG_VERSION' \\(9B\\)\n"
+            "P00   INFO: verified 1 file\\(s\\), 9B in [0-9]+\\.[0-9]{3}s \\([0-9]+(\\.[0-9]+)?[KMGT]?B/s\\)$");
+
+        // Read the WAL segment size from a compressed and encrypted segment
+        // -------------------------------------------------------------------------------------------------------------------------
+        VerifyState state = {.memContext = memContextCurrent()};
+
+        write = storageNewWriteNP(storageTest, strNew("repo-cipher/archive/db/11-1/0000000100000000/000000010000000000000001.gz"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), gzipCompressNew(3, false));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(write)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("filepass"), NULL));
+        storagePutNP(write, walBuffer);
+
+        TEST_RESULT_UINT(
+            verifyWalSegmentSize(
+                &state, strNew(STORAGE_REPO_ARCHIVE "/11-1/000000010000000000000001.gz"), true, cipherTypeAes256Cbc,
+                strNew("filepass")),
+            32 * 1024 * 1024, "WAL segment size from compressed and encrypted segment");
+        TEST_RESULT_UINT(state.errorTotal, 0, "    check no errors");
+
+        // Errors reading the WAL segment size fall back to the default
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo-cipher/archive/db/11-1/0000000100000000/000000010000000000000002")),
+            BUFSTRDEF("atestfile"));
+
+        TEST_RESULT_UINT(
+            verifyWalSegmentSize(
+                &state, strNew(STORAGE_REPO_ARCHIVE "/11-1/000000010000000000000002"), false, cipherTypeNone, NULL),
+            VERIFY_WAL_SEGMENT_SIZE_DEFAULT, "WAL segment size from short segment");
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   WARN: unable to read WAL segment size from '<REPO:ARCHIVE>/11-1/000000010000000000000002': [42] unable"
+                        " to read 512 byte(s) from '%s/repo-cipher/archive/db/11-1/0000000100000000/000000010000000000000002'",
+                    testPath())));
+
+        memset(bufPtr(walBuffer), 0, bufSize(walBuffer));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .walSegmentSize = 3 * 1024 * 1024}, walBuffer);
+        storagePutNP(
+            storageNewWriteNP(storageTest, strNew("repo-cipher/archive/db/11-1/0000000100000000/000000010000000000000003")),
+            walBuffer);
+
+        TEST_RESULT_UINT(
+            verifyWalSegmentSize(
+                &state, strNew(STORAGE_REPO_ARCHIVE "/11-1/000000010000000000000003"), false, cipherTypeNone, NULL),
+            VERIFY_WAL_SEGMENT_SIZE_DEFAULT, "WAL segment size from segment with invalid size");
+        harnessLogResult(
+            "P00   WARN: unable to read WAL segment size from '<REPO:ARCHIVE>/11-1/000000010000000000000003': [29] invalid WAL"
+                " segment size 3145728");
+        TEST_RESULT_UINT(state.errorTotal, 2, "    check errors");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -1,6 +1,8 @@
 /***********************************************************************************************************************************
 Execute Process
 ***********************************************************************************************************************************/
+#include <fcntl.h>
+
 #include "common/harnessFork.h"
 
 /***********************************************************************************************************************************
@@ -31,12 +33,27 @@ testRun(void)
         TEST_RESULT_INT(execHandleRead(exec), exec->handleRead, "check read handle");
         TEST_RESULT_VOID(execOpen(exec), "open cat exec");
 
+        TEST_RESULT_INT(fcntl(exec->handleRead, F_GETPIPE_SZ), 1024 * 1024, "    check read pipe is enlarged");
+
         String *message = strNew("ACKBYACK");
         TEST_RESULT_VOID(ioWriteStrLine(execIoWrite(exec), message), "write cat exec");
         ioWriteFlush(execIoWrite(exec));
         TEST_RESULT_STR(strPtr(ioReadLine(execIoRead(exec))), strPtr(message), "read cat exec");
         TEST_RESULT_VOID(execFree(exec), "free exec");
 
+        // Pipes are scaled down by process max but not made smaller than the default.  This assumes the default per-user limit.
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(execProcessMaxSet(16), "set process max");
+        TEST_RESULT_UINT(execPipeSize(), 512 * 1024, "    check pipe size");
+
+        TEST_RESULT_VOID(execProcessMaxSet(1024), "set process max");
+        TEST_ASSIGN(exec, execNew(strNew("cat"), NULL, strNew("cat"), 1000), "new cat exec");
+        TEST_RESULT_VOID(execOpen(exec), "open cat exec");
+        TEST_RESULT_INT(fcntl(exec->handleRead, F_GETPIPE_SZ), 64 * 1024, "    check read pipe is not shrunk");
+        TEST_RESULT_VOID(execFree(exec), "free exec");
+
+        execProcessMaxSet(1);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(exec, execNew(strNew("cat"), NULL, strNew("cat"), 1000), "new cat exec");
         TEST_RESULT_VOID(execOpen(exec), "open cat exec");
@@ -100,7 +117,7 @@ testRun(void)
 
         TEST_ERROR(execFreeResource(exec), ExecuteError, "sleep did not exit when expected");
 
-        TEST_ERROR(ioReadLine(execIoRead(exec)), FileReadError, "unable to select from sleep read: [9] Bad file descriptor");
+        TEST_ERROR(ioReadLine(execIoRead(exec)), FileReadError, "unable to read from sleep read: [9] Bad file descriptor");
         ioWriteStrLine(execIoWrite(exec), strNew(""));
         TEST_ERROR(ioWriteFlush(execIoWrite(exec)), FileWriteError, "unable to write to sleep write: [9] Bad file descriptor");
 
@@ -289,6 +289,36 @@ testHttpServer(void)
             "0\r\n"
             "\r\n");
 
+        // Request written before the response is read
+        harnessTlsServerExpect(
+            "GET /async HTTP/1.1\r\n"
+            "\r\n");
+
+        harnessTlsServerReply(
+            "HTTP/1.1 200 OK\r\n"
+            "content-length:5\r\n"
+            "\r\n"
+            "ASYNC");
+
+        // Request retried when the response cannot be read
+        harnessTlsServerExpect(
+            "GET /async HTTP/1.1\r\n"
+            "\r\n");
+
+        harnessTlsServerClose();
+
+        harnessTlsServerAccept();
+
+        harnessTlsServerExpect(
+            "GET /async HTTP/1.1\r\n"
+            "\r\n");
+
+        harnessTlsServerReply(
+            "HTTP/1.1 200 OK\r\n"
+            "content-length:5\r\n"
+            "\r\n"
+            "RETRY");
+
         harnessTlsServerClose();
 
         exit(0);
@@ -416,6 +446,20 @@ testRun(void)
             httpClientRequest(client, strNew("GET"), strNew("/"), NULL, NULL, NULL, false), HostConnectError,
             "unable to connect to 'localhost:9443': [111] Connection refused");
 
+        // Request discarded before the response is read
+        TEST_RESULT_VOID(httpClientRequestWrite(client, strNew("GET"), strNew("/"), NULL, NULL, NULL), "write request");
+        TEST_RESULT_BOOL(httpClientBusy(client), true, "    client is busy");
+        TEST_RESULT_VOID(httpClientDone(client), "    discard request");
+        TEST_RESULT_BOOL(httpClientBusy(client), false, "    client is not busy");
+
+        // Write errors are reported when the response is read
+        TEST_RESULT_VOID(httpClientRequestWrite(client, strNew("GET"), strNew("/"), NULL, NULL, NULL), "write request");
+        TEST_RESULT_BOOL(httpClientBusy(client), true, "    client is busy");
+        TEST_ERROR(
+            httpClientResponseRead(client, true), HostConnectError,
+            "unable to connect to 'localhost:9443': [111] Connection refused");
+        TEST_RESULT_BOOL(httpClientBusy(client), false, "    client is not busy");
+
         // Start http test server
         testHttpServer();
 
@@ -564,6 +608,21 @@ testRun(void)
         TEST_RESULT_VOID(ioRead(httpClientIoRead(client), buffer),  "    read response");
         TEST_RESULT_STR(strPtr(strNewBuf(buffer)),  "01234567890123456789012345678901012", "    check response");
 
+        // Read the rest of the content so the connection is kept for the next request
+        buffer = bufNew(32);
+        TEST_RESULT_VOID(ioRead(httpClientIoRead(client), buffer),  "    read rest of response");
+        TEST_RESULT_STR(strPtr(strNewBuf(buffer)),  "3456789012345", "    check response");
+        TEST_RESULT_BOOL(ioReadEof(httpClientIoRead(client)), true, "    io is eof");
+
+        // Request written before the response is read
+        TEST_RESULT_VOID(httpClientRequestWrite(client, strNew("GET"), strNew("/async"), NULL, NULL, NULL), "write request");
+        TEST_RESULT_STR(strPtr(strNewBuf(httpClientResponseRead(client, true))), "ASYNC", "    read response");
+        TEST_RESULT_BOOL(httpClientBusy(client), false, "    client is not busy");
+
+        // Request retried when the response cannot be read
+        TEST_RESULT_VOID(httpClientRequestWrite(client, strNew("GET"), strNew("/async"), NULL, NULL, NULL), "write request");
+        TEST_RESULT_STR(strPtr(strNewBuf(httpClientResponseRead(client, true))), "RETRY", "    read response with retry");
+
         TEST_RESULT_BOOL(httpClientStatStr() != NULL, true, "check statistics exist");
 
         TEST_RESULT_VOID(httpClientFree(client), "free client");
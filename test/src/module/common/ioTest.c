@@ -2,11 +2,27 @@
 Test IO
 ***********************************************************************************************************************************/
 #include <fcntl.h>
+#include <signal.h>
+#include <sys/time.h>
 
 #include "common/type/json.h"
 
 #include "common/harnessFork.h"
 
+/***********************************************************************************************************************************
+Size of a buffer that is larger than the default pipe size
+***********************************************************************************************************************************/
+#define TEST_PIPE_BUFFER_SIZE                                       (256 * 1024)
+
+/***********************************************************************************************************************************
+Signal handler that does nothing so blocking calls are interrupted
+***********************************************************************************************************************************/
+static void
+testSignalNoOp(int signalType)
+{
+    (void)signalType;
+}
+
 /***********************************************************************************************************************************
 Test functions for IoRead that are not covered by testing the IoBufferRead object
 ***********************************************************************************************************************************/
@@ -248,6 +264,66 @@ testRun(void)
         TEST_RESULT_SIZE(ioBufferSize(), 16384, "check buffer size");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("ioBufferPoolGet() and ioBufferPoolPut()"))
+    {
+        ioBufferSizeSet(16);
+
+        Buffer *buffer = NULL;
+        TEST_ASSIGN(buffer, ioBufferPoolGet(), "get new buffer");
+        TEST_RESULT_SIZE(bufSize(buffer), 16, "    check size");
+        TEST_RESULT_UINT(ioBufferPool.size, 0, "    pool is empty");
+
+        bufCat(buffer, BUFSTRDEF("ABC"));
+        bufLimitSet(buffer, 4);
+
+        TEST_RESULT_VOID(ioBufferPoolPut(buffer), "return buffer");
+        TEST_RESULT_UINT(ioBufferPool.size, 1, "    pool has one buffer");
+        TEST_RESULT_PTR(ioBufferPool.list[0], buffer, "    pool has returned buffer");
+
+        TEST_RESULT_PTR(ioBufferPoolGet(), buffer, "get pooled buffer");
+        TEST_RESULT_SIZE(bufUsed(buffer), 0, "    check used is zero");
+        TEST_RESULT_SIZE(bufSize(buffer), 16, "    check limit is cleared");
+        TEST_RESULT_UINT(ioBufferPool.size, 0, "    pool is empty");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(ioBufferPoolPut(bufNew(8)), "return buffer that does not match buffer size");
+        TEST_RESULT_UINT(ioBufferPool.size, 0, "    buffer is freed");
+
+        TEST_RESULT_VOID(ioBufferPoolPut(buffer), "return buffer");
+        ioBufferSizeSet(32);
+
+        TEST_ASSIGN(buffer, ioBufferPoolGet(), "get buffer after buffer size changed");
+        TEST_RESULT_SIZE(bufSize(buffer), 32, "    check size");
+        TEST_RESULT_UINT(ioBufferPool.size, 0, "    mismatched buffer is freed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        for (unsigned int bufferIdx = 0; bufferIdx < IO_BUFFER_POOL_MAX + 1; bufferIdx++)
+            ioBufferPoolPut(bufNew(32));
+
+        TEST_RESULT_UINT(ioBufferPool.size, IO_BUFFER_POOL_MAX, "pool does not grow past max");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioBufferSizeSet(4);
+
+        IoFilterGroup *filterGroup = ioFilterGroupNew();
+        ioFilterGroupAdd(filterGroup, ioSizeNew());
+        ioFilterGroupAdd(filterGroup, ioBufferNew());
+        ioFilterGroupAdd(filterGroup, ioSizeNew());
+        ioFilterGroupAdd(filterGroup, ioBufferNew());
+
+        TEST_RESULT_VOID(ioFilterGroupOpen(filterGroup), "open filter group");
+        TEST_RESULT_UINT(ioBufferPool.size, 0, "    mismatched buffers are freed");
+
+        Buffer *output = bufNew(4);
+        ioFilterGroupProcess(filterGroup, BUFSTRDEF("ABC"), output);
+        ioFilterGroupProcess(filterGroup, NULL, output);
+        TEST_RESULT_STR(strPtr(strNewBuf(output)), "ABC", "    check output");
+
+        TEST_RESULT_VOID(ioFilterGroupClose(filterGroup), "close filter group");
+        TEST_RESULT_UINT(ioBufferPool.size, 1, "    local buffer returned once");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("IoRead, IoBufferRead, IoBuffer, IoSize, IoFilter, IoFilterGroup, and ioReadBuf()"))
     {
@@ -548,6 +624,23 @@ testRun(void)
                 sleepMSec(500);
                 TEST_RESULT_VOID(ioWrite(write, buffer), "write buffer");
                 ioWriteFlush(write);
+
+                // Write a buffer larger than the pipe to a non-blocking handle so the write is partial and must wait for the other
+                // side to read.  Interrupt poll() with a signal to check that it is retried.
+                int handle = ioWriteHandle(write);
+                THROW_ON_SYS_ERROR(fcntl(handle, F_SETFL, fcntl(handle, F_GETFL) | O_NONBLOCK) == -1, KernelError, "nonblock");
+
+                struct sigaction action = {.sa_handler = testSignalNoOp};
+                sigaction(SIGALRM, &action, NULL);
+                setitimer(ITIMER_REAL, &(struct itimerval){.it_value = {.tv_usec = 250000}}, NULL);
+
+                Buffer *bufferLarge = bufNew(TEST_PIPE_BUFFER_SIZE);
+                memset(bufPtr(bufferLarge), 'X', bufSize(bufferLarge));
+                bufUsedSet(bufferLarge, bufSize(bufferLarge));
+
+                TEST_RESULT_VOID(ioHandleWrite(ioWriteDriver(write), bufferLarge), "write buffer larger than pipe");
+
+                signal(SIGALRM, SIG_DFL);
             }
             HARNESS_FORK_CHILD_END();
 
@@ -563,12 +656,18 @@ testRun(void)
                 // Read a string
                 TEST_RESULT_STR(strPtr(ioReadLine(read)), "test string 1", "read test string");
 
-                // Only part of the buffer is written before timeout
+                // Only part of the buffer is written before timeout.  Interrupt poll() with a signal to check that it is retried.
                 Buffer *buffer = bufNew(16);
 
+                struct sigaction action = {.sa_handler = testSignalNoOp};
+                sigaction(SIGALRM, &action, NULL);
+                setitimer(ITIMER_REAL, &(struct itimerval){.it_value = {.tv_usec = 250000}}, NULL);
+
                 TEST_ERROR(ioRead(read, buffer), FileReadError, "unable to read data from read test after 1000ms");
                 TEST_RESULT_UINT(bufSize(buffer), 16, "buffer is only partially read");
 
+                signal(SIGALRM, SIG_DFL);
+
                 // Read a buffer that is transmitted in two parts with blocking on the read side
                 buffer = bufNew(16);
                 bufLimitSet(buffer, 12);
@@ -578,6 +677,18 @@ testRun(void)
                 TEST_RESULT_UINT(ioRead(read, buffer), 4, "read buffer");
                 TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "1234567812345678", "check buffer");
 
+                // Read the buffer larger than the pipe after the writer has had to wait
+                buffer = bufNew(8);
+                TEST_RESULT_UINT(ioRead(read, buffer), 8, "read buffer");
+                TEST_RESULT_STR(strPtr(strNewBuf(buffer)), "12345678", "check buffer");
+
+                sleepMSec(500);
+
+                buffer = bufNew(TEST_PIPE_BUFFER_SIZE);
+                TEST_RESULT_UINT(ioRead(read, buffer), TEST_PIPE_BUFFER_SIZE, "read buffer larger than pipe");
+                TEST_RESULT_BOOL(
+                    bufPtr(buffer)[0] == 'X' && bufPtr(buffer)[TEST_PIPE_BUFFER_SIZE - 1] == 'X', true, "    check buffer");
+
                 // Check EOF
                 buffer = bufNew(16);
 
@@ -593,6 +704,28 @@ testRun(void)
             ioHandleWriteOneStr(999999, strNew("test")), FileWriteError,
             "unable to write to handle: [9] Bad file descriptor");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        int handleClosed = open("/dev/null", O_RDONLY);
+        close(handleClosed);
+
+        TEST_ERROR(
+            ioHandleReadNew(strNew("closed"), handleClosed, 1000), FileOpenError,
+            "unable to set closed non-blocking: [9] Bad file descriptor");
+
+        int pipeHandle[2];
+        THROW_ON_SYS_ERROR(pipe(pipeHandle) == -1, KernelError, "unable to create pipe");
+
+        IoRead *read = ioHandleReadNew(strNew("closed"), pipeHandle[0], 1000);
+        close(pipeHandle[0]);
+        close(pipeHandle[1]);
+
+        TEST_ERROR(
+            ioHandleRead(ioReadDriver(read), bufNew(16), true), FileReadError,
+            "unable to read from closed: [9] Bad file descriptor");
+        TEST_ERROR(
+            ioHandleWrite(ioWriteDriver(ioHandleWriteNew(strNew("closed"), pipeHandle[1])), BUFSTRDEF("X")), FileWriteError,
+            "unable to write to closed: [9] Bad file descriptor");
+
         // -------------------------------------------------------------------------------------------------------------------------
         String *fileName = strNewFmt("%s/test.txt", testPath());
         int fileHandle = open(strPtr(fileName), O_CREAT | O_TRUNC | O_WRONLY, 0700);
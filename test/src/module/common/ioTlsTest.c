@@ -1,12 +1,24 @@
 /***********************************************************************************************************************************
-Test Tls Client
+Test Tls Client, Server, and Session
 ***********************************************************************************************************************************/
+#include <signal.h>
+#include <sys/time.h>
 #include <unistd.h>
 
 #include "common/time.h"
 
+#include "common/harnessFork.h"
 #include "common/harnessTls.h"
 
+/***********************************************************************************************************************************
+Signal handler that does nothing so blocking calls are interrupted
+***********************************************************************************************************************************/
+static void
+testSignalNoOp(int signalType)
+{
+    (void)signalType;
+}
+
 /***********************************************************************************************************************************
 Path and prefix for test certificates
 ***********************************************************************************************************************************/
@@ -83,7 +95,7 @@ testTlsServer(void)
         harnessTlsServerReply("0123456789AB");
         harnessTlsServerClose();
 
-        // Need data in read buffer to test tlsWriteContinue()
+        // Need data in read buffer to test tlsSessionWriteContinue()
         harnessTlsServerAccept();
         harnessTlsServerReply("0123456789AB");
         harnessTlsServerClose();
@@ -119,15 +131,21 @@ testRun(void)
 
     // Additional coverage not provided by other tests
     // *****************************************************************************************************************************
-    if (testBegin("tlsError()"))
+    if (testBegin("tlsSessionError()"))
     {
-        TlsClient *client = NULL;
+        cryptoInit();
+        SSL_CTX *context = SSL_CTX_new(SSLv23_method());
+        TlsSession *session = NULL;
 
-        TEST_ASSIGN(client, tlsClientNew(strNew("99.99.99.99.99"), 9443, 0, true, NULL, NULL), "new client");
+        TEST_ASSIGN(session, tlsSessionNew(strNew("test"), SSL_new(context), -1, 0), "new session");
 
-        TEST_RESULT_BOOL(tlsError(client, SSL_ERROR_WANT_READ), true, "continue after want read");
-        TEST_RESULT_BOOL(tlsError(client, SSL_ERROR_ZERO_RETURN), false, "check connection closed error");
-        TEST_ERROR(tlsError(client, SSL_ERROR_WANT_X509_LOOKUP), ServiceError, "tls error [4]");
+        TEST_RESULT_BOOL(tlsSessionError(session, SSL_ERROR_WANT_READ), true, "continue after want read");
+        TEST_ERROR(tlsSessionError(session, SSL_ERROR_WANT_X509_LOOKUP), ServiceError, "tls error [4]");
+        TEST_RESULT_BOOL(tlsSessionError(session, SSL_ERROR_ZERO_RETURN), false, "check connection closed error");
+        TEST_RESULT_BOOL(tlsSessionClosed(session), true, "    check session is closed");
+
+        TEST_RESULT_VOID(tlsSessionFree(session), "free session");
+        SSL_CTX_free(context);
     }
 
     // *****************************************************************************************************************************
@@ -137,11 +155,11 @@ testRun(void)
 
         // Connection errors
         // -------------------------------------------------------------------------------------------------------------------------
-        TEST_ASSIGN(client, tlsClientNew(strNew("99.99.99.99.99"), 9443, 0, true, NULL, NULL), "new client");
+        TEST_ASSIGN(client, tlsClientNew(strNew("99.99.99.99.99"), 9443, 0, true, NULL, NULL, NULL, NULL), "new client");
         TEST_ERROR(
             tlsClientOpen(client), HostConnectError, "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
 
-        TEST_ASSIGN(client, tlsClientNew(strNew("localhost"), 9443, 100, true, NULL, NULL), "new client");
+        TEST_ASSIGN(client, tlsClientNew(strNew("localhost"), 9443, 100, true, NULL, NULL, NULL, NULL), "new client");
         TEST_ERROR(tlsClientOpen(client), HostConnectError, "unable to connect to 'localhost:9443': [111] Connection refused");
 
         // Certificate location and validation errors
@@ -158,36 +176,36 @@ testRun(void)
         testTlsServerAltName();
 
         TEST_ERROR(
-            tlsClientOpen(tlsClientNew(strNew("localhost"), 9443, 500, true, strNew("bogus.crt"), strNew("/bogus"))),
+            tlsClientOpen(tlsClientNew(strNew("localhost"), 9443, 500, true, strNew("bogus.crt"), strNew("/bogus"), NULL, NULL)),
             CryptoError, "unable to set user-defined CA certificate location: [33558530] No such file or directory");
         TEST_ERROR(
-            tlsClientOpen(tlsClientNew(strNew("localhost"), 9443, 500, true, NULL, strNew("/bogus"))),
+            tlsClientOpen(tlsClientNew(strNew("localhost"), 9443, 500, true, NULL, strNew("/bogus"), NULL, NULL)),
             CryptoError, "unable to verify certificate presented by 'localhost:9443': [20] unable to get local issuer certificate");
 
         TEST_RESULT_VOID(
             tlsClientOpen(
                 tlsClientNew(strNew("test.pgbackrest.org"), 9443, 500, true,
-                strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
             "success on valid ca file and match common name");
         TEST_RESULT_VOID(
             tlsClientOpen(
                 tlsClientNew(strNew("host.test2.pgbackrest.org"), 9443, 500, true,
-                strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
             "success on valid ca file and match alt name");
         TEST_ERROR(
             tlsClientOpen(
                 tlsClientNew(strNew("test3.pgbackrest.org"), 9443, 500, true,
-                strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL)),
+                strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath()), NULL, NULL, NULL)),
             CryptoError, "unable to find hostname 'test3.pgbackrest.org' in certificate common name or subject alternative names");
 
         TEST_ERROR(
             tlsClientOpen(
                 tlsClientNew(strNew("localhost"), 9443, 500, true, strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath()),
-                NULL)),
+                NULL, NULL, NULL)),
             CryptoError, "unable to verify certificate presented by 'localhost:9443': [20] unable to get local issuer certificate");
 
         TEST_RESULT_VOID(
-            tlsClientOpen(tlsClientNew(strNew("localhost"), 9443, 500, false, NULL, NULL)), "success on no verify");
+            tlsClientOpen(tlsClientNew(strNew("localhost"), 9443, 500, false, NULL, NULL, NULL, NULL)), "success on no verify");
     }
     // *****************************************************************************************************************************
     if (testBegin("TlsClient general usage"))
@@ -201,7 +219,7 @@ testRun(void)
         testTlsServer();
         ioBufferSizeSet(12);
 
-        TEST_ASSIGN(client, tlsClientNew(strNew(TLS_TEST_HOST), 9443, 500, true, NULL, NULL), "new client");
+        TEST_ASSIGN(client, tlsClientNew(strNew(TLS_TEST_HOST), 9443, 500, true, NULL, NULL, NULL, NULL), "new client");
         TEST_RESULT_VOID(tlsClientOpen(client), "open client");
 
         const Buffer *input = BUFSTRDEF("some protocol info");
@@ -221,11 +239,18 @@ testRun(void)
         TEST_RESULT_STR(strPtr(strNewBuf(output)), "AND MORE", "    check output");
         TEST_RESULT_BOOL(ioReadEof(tlsClientIoRead(client)), false, "    check eof = false");
 
+        // Interrupt select() with a signal to check that it is retried
+        struct sigaction action = {.sa_handler = testSignalNoOp};
+        sigaction(SIGALRM, &action, NULL);
+        setitimer(ITIMER_REAL, &(struct itimerval){.it_value = {.tv_usec = 250000}}, NULL);
+
         output = bufNew(12);
         TEST_ERROR(
             ioRead(tlsClientIoRead(client), output), FileReadError,
             "timeout after 500ms waiting for read from 'tls.test.pgbackrest.org:9443'");
 
+        signal(SIGALRM, SIG_DFL);
+
         // -------------------------------------------------------------------------------------------------------------------------
         input = BUFSTRDEF("more protocol info");
         TEST_RESULT_VOID(tlsClientOpen(client), "open client again (it is already open)");
@@ -243,12 +268,25 @@ testRun(void)
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_VOID(tlsClientOpen(client), "open client again (was closed by server)");
-        TEST_RESULT_BOOL(tlsWriteContinue(client, -1, SSL_ERROR_WANT_READ, 1), true, "continue on WANT_READ");
-        TEST_RESULT_BOOL(tlsWriteContinue(client, 0, SSL_ERROR_NONE, 1), true, "continue on WANT_READ");
+        TEST_RESULT_BOOL(tlsSessionWriteContinue(client->session, -1, SSL_ERROR_WANT_READ, 1), true, "continue on WANT_READ");
+        TEST_RESULT_BOOL(tlsSessionWriteContinue(client->session, 0, SSL_ERROR_NONE, 1), true, "continue on WANT_READ");
         TEST_ERROR(
-            tlsWriteContinue(client, 77, 0, 88), FileWriteError,
+            tlsSessionWriteContinue(client->session, 77, 0, 88), FileWriteError,
             "unable to write to tls, write size 77 does not match expected size 88");
-        TEST_ERROR(tlsWriteContinue(client, 0, SSL_ERROR_ZERO_RETURN, 1), FileWriteError, "unable to write to tls [6]");
+        TEST_ERROR(
+            tlsSessionWriteContinue(client->session, 0, SSL_ERROR_ZERO_RETURN, 1), FileWriteError, "unable to write to tls [6]");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        int socket = client->session->socket;
+        int socketClosed = dup(socket);
+        close(socketClosed);
+        client->session->socket = socketClosed;
+
+        TEST_ERROR(
+            tlsSessionReadWait(client->session), AssertError,
+            "unable to select from 'tls.test.pgbackrest.org:9443': [9] Bad file descriptor");
+
+        client->session->socket = socket;
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_BOOL(tlsClientStatStr() != NULL, true, "check statistics exist");
@@ -256,5 +294,124 @@ testRun(void)
         TEST_RESULT_VOID(tlsClientFree(client), "free client");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("TlsServer and TlsSession"))
+    {
+        const String *caFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath());
+        const String *certFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath());
+        const String *keyFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath());
+        const String *address = strNew("127.0.0.1");
+
+        // Server errors
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR_FMT(
+            tlsServerNew(address, TLS_TEST_PORT, strNew("bogus.crt"), keyFile, caFile, 500), CryptoError,
+            "unable to load cert file 'bogus.crt': [33558530] No such file or directory");
+        TEST_ERROR_FMT(
+            tlsServerNew(address, TLS_TEST_PORT, certFile, strNew("bogus.key"), caFile, 500), CryptoError,
+            "unable to load key file 'bogus.key': [33558530] No such file or directory");
+        TEST_ERROR_FMT(
+            tlsServerNew(address, TLS_TEST_PORT, caFile, keyFile, caFile, 500), CryptoError,
+            "unable to load key file '%s': [%s] key values mismatch", strPtr(keyFile), "185073780");
+        TEST_ERROR_FMT(
+            tlsServerNew(address, TLS_TEST_PORT, certFile, keyFile, strNew("bogus-ca.crt"), 500), CryptoError,
+            "unable to load CA file 'bogus-ca.crt': [33558530] No such file or directory");
+        TEST_ERROR(
+            tlsServerNew(strNew("99.99.99.99.99"), TLS_TEST_PORT, certFile, keyFile, caFile, 500), HostConnectError,
+            "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
+
+        TlsServer *server = NULL;
+        TEST_ASSIGN(server, tlsServerNew(address, TLS_TEST_PORT, certFile, keyFile, caFile, 500), "new server");
+
+        TEST_ERROR(
+            tlsServerNew(address, TLS_TEST_PORT, certFile, keyFile, caFile, 500), HostConnectError,
+            "unable to bind to '127.0.0.1:9443': [98] Address already in use");
+
+        // Client errors
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR(
+            tlsClientNew(strNew(TLS_TEST_HOST), TLS_TEST_PORT, 500, true, caFile, NULL, strNew("bogus.crt"), keyFile), CryptoError,
+            "unable to load cert file 'bogus.crt': [33558530] No such file or directory");
+        TEST_ERROR(
+            tlsClientNew(strNew(TLS_TEST_HOST), TLS_TEST_PORT, 500, true, caFile, NULL, certFile, strNew("bogus.key")), CryptoError,
+            "unable to load key file 'bogus.key': [33558530] No such file or directory");
+
+        // The listen socket is inherited so the client can connect as soon as the child is forked
+        // -------------------------------------------------------------------------------------------------------------------------
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Client does not present a certificate.  The client port is not known so only check the beginning of the message.
+                bool errorFound = false;
+
+                TRY_BEGIN()
+                {
+                    tlsServerSession(server, tlsServerAccept(server));
+                }
+                CATCH(CryptoError)
+                {
+                    errorFound = strBeginsWithZ(STR(errorMessage()), "unable to negotiate TLS connection with '127.0.0.1:");
+                }
+                TRY_END();
+
+                TEST_RESULT_BOOL(errorFound, true, "client without certificate is rejected");
+
+                // Client presents a certificate and exchanges data
+                TlsSession *session = NULL;
+                TEST_ASSIGN(session, tlsServerSession(server, tlsServerAccept(server)), "accept session");
+                TEST_RESULT_STR(strPtr(tlsSessionPeerName(session)), "*.test.pgbackrest.org", "    check peer name");
+                TEST_RESULT_STR(strPtr(ioReadLine(tlsSessionIoRead(session))), "request", "    read request");
+
+                ioWriteStrLine(tlsSessionIoWrite(session), strNew("response"));
+                ioWriteFlush(tlsSessionIoWrite(session));
+
+                TEST_RESULT_VOID(tlsSessionFree(session), "    free session");
+                TEST_RESULT_VOID(tlsServerFree(server), "free server");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TlsClient *client = NULL;
+
+                TEST_ASSIGN(
+                    client, tlsClientNew(strNew(TLS_TEST_HOST), TLS_TEST_PORT, 500, true, caFile, NULL, NULL, NULL),
+                    "new client without cert");
+
+                // Depending on the TLS version the error is raised on open or on the first read
+                bool errorFound = false;
+
+                TRY_BEGIN()
+                {
+                    tlsClientOpen(client);
+                    ioReadLine(tlsClientIoRead(client));
+                }
+                CATCH_ANY()
+                {
+                    errorFound = true;
+                }
+                TRY_END();
+
+                TEST_RESULT_BOOL(errorFound, true, "    check connection failed");
+
+                TEST_ASSIGN(
+                    client, tlsClientNew(strNew(TLS_TEST_HOST), TLS_TEST_PORT, 500, true, caFile, NULL, certFile, keyFile),
+                    "new client with cert");
+                TEST_RESULT_VOID(tlsClientOpen(client), "open client");
+
+                ioWriteStrLine(tlsClientIoWrite(client), strNew("request"));
+                ioWriteFlush(tlsClientIoWrite(client));
+                TEST_RESULT_STR(strPtr(ioReadLine(tlsClientIoRead(client))), "response", "read response");
+
+                TEST_RESULT_VOID(tlsClientFree(client), "free client");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_VOID(tlsServerFree(server), "free server");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
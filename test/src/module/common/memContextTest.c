@@ -411,6 +411,157 @@ testRun(void)
         MEM_CONTEXT_NEW_END();
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("memContextStatEnable(), memContextStat(), memContextStatPeakReset(), and memContextStatNameTop()"))
+    {
+        MemContextStatName statNameList[3];
+
+        // Start with no freed or active contexts
+        memContextFree(memContextTop());
+        memContextStatNameListSize = 0;
+        TEST_RESULT_UINT(memContextStatNameTop(statNameList, 3), 0, "no names");
+
+        // Totals are not kept while disabled and are calculated when enabled
+        MemContext *parent = memContextNew("parent");
+
+        MEM_CONTEXT_BEGIN(parent)
+        {
+            memContextNew("child-disabled");
+            memNew(10);
+        }
+        MEM_CONTEXT_END();
+
+        TEST_RESULT_UINT(memContextStat(parent).size, 0, "disabled context size");
+
+        TEST_RESULT_VOID(memContextStatEnable(true), "enable statistics");
+        TEST_RESULT_UINT(memContextStat(parent).size, 10, "enabled context size");
+        TEST_RESULT_UINT(memContextStat(parent).allocTotal, 1, "enabled context allocations");
+        TEST_RESULT_UINT(memContextStat(parent).peak, 10, "enabled context peak");
+        TEST_RESULT_VOID(memContextStatEnable(true), "enable statistics again");
+
+        memContextFree(parent);
+        memContextStatNameListSize = 0;
+
+        parent = memContextNew("parent");
+        TEST_RESULT_UINT(memContextStat(parent).size, 0, "empty context size");
+
+        MemContext *child = NULL;
+        void *buffer = NULL;
+
+        MEM_CONTEXT_BEGIN(parent)
+        {
+            memNew(100);
+
+            MEM_CONTEXT_NEW_BEGIN("child")
+            {
+                child = MEM_CONTEXT_NEW();
+                buffer = memNewRaw(1000);
+                memNew(50);
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+
+        TEST_RESULT_UINT(memContextStat(child).size, 1050, "child size");
+        TEST_RESULT_UINT(memContextStat(child).allocTotal, 2, "child allocations");
+        TEST_RESULT_UINT(memContextStat(parent).size, 1150, "parent size includes child");
+        TEST_RESULT_UINT(memContextStat(parent).allocTotal, 3, "parent allocations include child");
+        TEST_RESULT_UINT(memContextStat(parent).peak, 1150, "parent peak");
+
+        // Shrink and grow an allocation
+        MEM_CONTEXT_BEGIN(child)
+        {
+            buffer = memGrowRaw(buffer, 500);
+            TEST_RESULT_UINT(memContextStat(parent).size, 650, "parent size after shrink");
+            TEST_RESULT_UINT(memContextStat(parent).peak, 1150, "parent peak after shrink");
+
+            buffer = memGrowRaw(buffer, 1500);
+            TEST_RESULT_UINT(memContextStat(parent).size, 1650, "parent size after grow");
+            TEST_RESULT_UINT(memContextStat(parent).peak, 1650, "parent peak after grow");
+
+            memFree(buffer);
+            TEST_RESULT_UINT(memContextStat(child).size, 50, "child size after free");
+            TEST_RESULT_UINT(memContextStat(child).allocTotal, 1, "child allocations after free");
+        }
+        MEM_CONTEXT_END();
+
+        TEST_RESULT_UINT(memContextStat(parent).size, 150, "parent size after free");
+
+        TEST_RESULT_VOID(memContextStatPeakReset(parent), "reset parent peak");
+        TEST_RESULT_UINT(memContextStat(parent).peak, 150, "parent peak after reset");
+
+        // Move the child to top
+        TEST_RESULT_VOID(memContextMove(child, memContextTop()), "move child to top");
+        TEST_RESULT_UINT(memContextStat(parent).size, 100, "parent size after move");
+        TEST_RESULT_UINT(memContextStat(parent).allocTotal, 1, "parent allocations after move");
+
+        // Largest contexts include active contexts
+        TEST_RESULT_UINT(memContextStatNameTop(statNameList, 3), 2, "active names");
+        TEST_RESULT_STR(statNameList[0].name, "child", "    check name");
+        TEST_RESULT_UINT(statNameList[0].peak, 1550, "    check peak");
+        TEST_RESULT_STR(statNameList[1].name, "parent", "    check name");
+        TEST_RESULT_UINT(statNameList[1].peak, 150, "    check peak");
+
+        // Freed contexts are still reported and contexts with the same name are combined
+        size_t topSize = memContextStat(memContextTop()).size;
+
+        memContextFree(child);
+        TEST_RESULT_UINT(memContextStat(memContextTop()).size, topSize - 50, "top size after child free");
+
+        // Use a copy of the name to check that names are compared by value
+        char name[] = "child";
+
+        MEM_CONTEXT_BEGIN(parent)
+        {
+            MEM_CONTEXT_NEW_BEGIN(name)
+            {
+                child = MEM_CONTEXT_NEW();
+                memNew(2000);
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+
+        memContextFree(child);
+
+        memContextFree(parent);
+
+        TEST_RESULT_UINT(memContextStatNameTop(statNameList, 3), 2, "freed names");
+        TEST_RESULT_STR(statNameList[0].name, "parent", "    check name");
+        TEST_RESULT_UINT(statNameList[0].total, 1, "    check total");
+        TEST_RESULT_UINT(statNameList[0].peak, 2100, "    check peak includes child");
+        TEST_RESULT_STR(statNameList[1].name, "child", "    check name");
+        TEST_RESULT_UINT(statNameList[1].total, 2, "    check total");
+        TEST_RESULT_UINT(statNameList[1].peak, 2000, "    check peak");
+
+        // Names are ignored when the list is full
+        for (unsigned int nameIdx = 0; nameIdx < MEM_CONTEXT_STAT_NAME_MAX; nameIdx++)
+            memContextStatNameList[nameIdx] = (MemContextStatName){.name = "full"};
+
+        memContextStatNameListSize = MEM_CONTEXT_STAT_NAME_MAX;
+
+        memContextFree(memContextNew("ignored"));
+        TEST_RESULT_UINT(memContextStatNameListSize, MEM_CONTEXT_STAT_NAME_MAX, "name not added");
+
+        memContextStatNameListSize = 0;
+
+        // Totals are not updated once disabled
+        TEST_RESULT_VOID(memContextStatEnable(false), "disable statistics");
+
+        parent = memContextNew("parent");
+
+        MEM_CONTEXT_BEGIN(parent)
+        {
+            memNew(10);
+        }
+        MEM_CONTEXT_END();
+
+        TEST_RESULT_UINT(memContextStat(parent).size, 0, "disabled context size");
+
+        memContextFree(parent);
+        TEST_RESULT_UINT(memContextStatNameListSize, 0, "name not added while disabled");
+    }
+
     memContextFree(memContextTop());
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -0,0 +1,125 @@
+/***********************************************************************************************************************************
+Test Sampling Profiler
+***********************************************************************************************************************************/
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("profileSample() and profileToFolded()"))
+    {
+        TEST_RESULT_STR_Z(profileToFolded(), "", "no samples before start");
+
+        // Start and stop immediately so the table is allocated but no samples are taken by the timer
+        TEST_RESULT_VOID(profileStart(), "start");
+        TEST_RESULT_VOID(profileStop(), "stop");
+        TEST_RESULT_STR_Z(profileToFolded(), "", "no samples");
+
+        // Samples with the same stack are counted together
+        // -------------------------------------------------------------------------------------------------------------------------
+        stackTracePush("file1.c", "function1", logLevelDebug);
+        profileSample();
+        profileSample();
+
+        stackTracePush("file2.c", "function2", logLevelDebug);
+        profileSample();
+
+        stackTracePop("file2.c", "function2", false);
+        stackTracePop("file1.c", "function1", false);
+
+        profileSample();
+
+        TEST_RESULT_STR_Z(
+            profileToFolded(),
+            "pgbackrest;test:main;test/module/common/profileTest:testRun 1\n"
+            "pgbackrest;test:main;test/module/common/profileTest:testRun;file1:function1 2\n"
+            "pgbackrest;test:main;test/module/common/profileTest:testRun;file1:function1;file2:function2 1\n",
+            "check samples");
+
+        // Deep stacks are truncated.  A stack with the max functions is different than a truncated stack with the same functions.
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(profileStart(), "start");
+        TEST_RESULT_VOID(profileStop(), "stop");
+
+        unsigned int frameTotal = stackTraceFrame(NULL, 0);
+
+        for (unsigned int frameIdx = frameTotal; frameIdx < PROFILE_FRAME_MAX; frameIdx++)
+            stackTracePush("deep.c", "deep", logLevelDebug);
+
+        profileSample();
+
+        stackTracePush("deep.c", "deep", logLevelDebug);
+        profileSample();
+
+        for (unsigned int frameIdx = frameTotal; frameIdx <= PROFILE_FRAME_MAX; frameIdx++)
+            stackTracePop("deep.c", "deep", false);
+
+        StringList *lineList = strLstNewSplitZ(profileToFolded(), "\n");
+
+        TEST_RESULT_UINT(strLstSize(lineList), 3, "check lines");
+        TEST_RESULT_BOOL(strEndsWithZ(strLstGet(lineList, 0), ";deep:deep 1"), true, "    check max functions");
+        TEST_RESULT_BOOL(strEndsWithZ(strLstGet(lineList, 1), ";deep:deep;[truncated] 1"), true, "    check truncated");
+        TEST_RESULT_STR_Z(strLstGet(lineList, 2), "", "    check trailing linefeed");
+
+        // Samples are dropped when the table is full
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(profileStart(), "start");
+        TEST_RESULT_VOID(profileStop(), "stop");
+
+        // Add a shallower stack so full slots with a different number of functions are probed
+        profileSample();
+
+        char functionName[PROFILE_STACK_MAX + 2][16];
+
+        for (unsigned int stackIdx = 0; stackIdx < PROFILE_STACK_MAX + 2; stackIdx++)
+        {
+            snprintf(functionName[stackIdx], sizeof(functionName[stackIdx]), "function%04u", stackIdx);
+
+            stackTracePush("file.c", functionName[stackIdx], logLevelDebug);
+            profileSample();
+            stackTracePop("file.c", functionName[stackIdx], false);
+        }
+
+        lineList = strLstNewSplitZ(profileToFolded(), "\n");
+
+        TEST_RESULT_UINT(strLstSize(lineList), PROFILE_STACK_MAX + 2, "check lines");
+        TEST_RESULT_STR_Z(strLstGet(lineList, 0), "pgbackrest;[dropped] 3", "    check dropped");
+        TEST_RESULT_STR_Z(
+            strLstGet(lineList, 1), "pgbackrest;test:main;test/module/common/profileTest:testRun 1", "    check first stack");
+        TEST_RESULT_STR_Z(
+            strLstGet(lineList, 2), "pgbackrest;test:main;test/module/common/profileTest:testRun;file:function0000 1",
+            "    check second stack");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("profileStart() and profileStop()"))
+    {
+        TEST_RESULT_VOID(profileStart(), "start");
+
+        // Use CPU until the timer takes a sample
+        TimeMSec timeBegin = timeMSec();
+        volatile uint64_t spin = 0;
+
+        while (strEmpty(profileToFolded()) && timeMSec() - timeBegin < 10000)
+        {
+            for (unsigned int spinIdx = 0; spinIdx < 1000000; spinIdx++)
+                spin++;
+        }
+
+        TEST_RESULT_VOID(profileStop(), "stop");
+        TEST_RESULT_BOOL(strBeginsWithZ(profileToFolded(), "pgbackrest;test:main;"), true, "check sample");
+
+        // Starting again discards the prior samples
+        TEST_RESULT_VOID(profileStart(), "start again");
+        TEST_RESULT_VOID(profileStart(), "start while running");
+        TEST_RESULT_VOID(profileStop(), "stop");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -23,6 +23,49 @@ testRun(void)
         TEST_RESULT_VOID(regExpFree(regExp), "free regexp");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("regExpNew() and regExpMatch() with literal expressions"))
+    {
+        RegExp *regExp = NULL;
+        TEST_ASSIGN(regExp, regExpNew(strNew("^abc$")), "new exact literal");
+        TEST_RESULT_BOOL(regExp->literal, true, "    is literal");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("abc")), true, "    match");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("abcd")), false, "    no match");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("^abc")), "new prefix literal");
+        TEST_RESULT_BOOL(regExp->literal, true, "    is literal");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("abcd")), true, "    match");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("xabc")), false, "    no match");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("\\.gz$")), "new suffix literal with escape");
+        TEST_RESULT_BOOL(regExp->literal, true, "    is literal");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("file.gz")), true, "    match");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("filexgz")), false, "    no match");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("b-c")), "new contains literal");
+        TEST_RESULT_BOOL(regExp->literal, true, "    is literal");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("ab-cd")), true, "    match");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("abcd")), false, "    no match");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("")), "new empty literal");
+        TEST_RESULT_BOOL(regExp->literal, true, "    is literal");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("abc")), true, "    match");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("^a.c$")), "new expression with special character");
+        TEST_RESULT_BOOL(regExp->literal, false, "    is not literal");
+        TEST_RESULT_BOOL(regExpMatch(regExp, strNew("abc")), true, "    match");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("a$c")), "new expression with $ before the end");
+        TEST_RESULT_BOOL(regExp->literal, false, "    is not literal");
+
+        TEST_ASSIGN(regExp, regExpNew(strNew("\\d")), "new expression with escaped regular character");
+        TEST_RESULT_BOOL(regExp->literal, false, "    is not literal");
+
+        TEST_RESULT_VOID(regExpFree(regExp), "free regexp");
+
+        TEST_ERROR(regExpNew(strNew("a\\")), FormatError, "Trailing backslash");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("regExpPrefix()"))
     {
@@ -53,6 +96,15 @@ testRun(void)
         TEST_ERROR(regExpMatchOne(strNew("[[["), strNew("")), FormatError, "Unmatched [ or [^");
         TEST_RESULT_BOOL(regExpMatchOne(strNew("^abc"), strNew("abcdef")), true, "match regexp");
         TEST_RESULT_BOOL(regExpMatchOne(strNew("^abc"), strNew("bcdef")), false, "no match regexp");
+
+        TEST_RESULT_UINT(lstSize(regExpCache.list), 1, "expression is cached once");
+
+        for (unsigned int expressionIdx = 0; expressionIdx < REGEXP_CACHE_MAX; expressionIdx++)
+            regExpMatchOne(strNewFmt("^%u", expressionIdx), strNew("0"));
+
+        TEST_RESULT_UINT(lstSize(regExpCache.list), REGEXP_CACHE_MAX, "cache is full");
+        TEST_RESULT_STR(
+            strPtr(((RegExpCacheEntry *)lstGet(regExpCache.list, 0))->expression), "^0", "oldest expression was removed");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
@@ -172,6 +172,16 @@ testRun(void)
                     "stack trace");
 #endif
 
+                // Get functions on the stack for the profiler
+                StackTraceFrame frameList[8];
+
+                TEST_RESULT_UINT(stackTraceFrame(frameList, 2), 5, "get first frames");
+                TEST_RESULT_STR(frameList[0].fileName, "file1.c", "    check first file");
+                TEST_RESULT_STR(frameList[1].functionName, "function2", "    check second function");
+
+                TEST_RESULT_UINT(stackTraceFrame(frameList, 8), 5, "get all frames");
+                TEST_RESULT_STR(frameList[4].functionName, "function4", "    check last function");
+
                 stackTracePop("file4.c", "function4", false);
                 assert(stackSize == 4);
 
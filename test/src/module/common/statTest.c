@@ -0,0 +1,109 @@
+/***********************************************************************************************************************************
+Test Statistics Collector
+***********************************************************************************************************************************/
+
+/***********************************************************************************************************************************
+Callback to test snapshot writes
+***********************************************************************************************************************************/
+static unsigned int testCallbackTotal = 0;
+
+static void
+testCallback(void)
+{
+    testCallbackTotal++;
+
+    // Adding a statistic in the callback must not call the callback again
+    statInc(STRDEF("callback"));
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("statAdd(), statInc(), statTimeAdd(), and statGet()"))
+    {
+        TEST_RESULT_UINT(statGet(STRDEF("missing")).count, 0, "missing statistic before init");
+        TEST_RESULT_STR(strPtr(statToJson()), "{}", "empty json");
+        TEST_RESULT_STR(strPtr(statToPrometheus(NULL)), "", "empty prometheus");
+
+        TEST_RESULT_VOID(statAdd(STRDEF("file.byte"), 100), "add");
+        TEST_RESULT_VOID(statAdd(STRDEF("file.byte"), 300), "add");
+        TEST_RESULT_VOID(statAdd(STRDEF("file.byte"), 200), "add");
+        TEST_RESULT_VOID(statInc(STRDEF("a.count")), "inc");
+        TEST_RESULT_VOID(statInc(STRDEF("z-count")), "inc");
+        TEST_RESULT_VOID(statTimeAdd(STRDEF("file.ms"), timeMSec() + 10000), "time add with clock going backwards");
+
+        StatValue value = statGet(STRDEF("file.byte"));
+        TEST_RESULT_UINT(value.count, 3, "check count");
+        TEST_RESULT_UINT(value.total, 600, "check total");
+        TEST_RESULT_UINT(value.max, 300, "check max");
+
+        TEST_RESULT_UINT(statGet(STRDEF("missing")).count, 0, "missing statistic");
+        TEST_RESULT_UINT(statGet(STRDEF("file.ms")).max, 0, "time is zero");
+
+        TEST_RESULT_STR(
+            strPtr(statToJson()),
+            "{\"a.count\":{\"count\":1,\"max\":1,\"total\":1},\"file.byte\":{\"count\":3,\"max\":300,\"total\":600},"
+                "\"file.ms\":{\"count\":1,\"max\":0,\"total\":0},\"z-count\":{\"count\":1,\"max\":1,\"total\":1}}",
+            "json");
+
+        TEST_RESULT_STR(
+            strPtr(statToPrometheus(STRDEF("stanza=\"db\""))),
+            "# TYPE pgbackrest_a_count_count_total counter\n"
+            "pgbackrest_a_count_count_total{stanza=\"db\"} 1\n"
+            "# TYPE pgbackrest_a_count_max gauge\n"
+            "pgbackrest_a_count_max{stanza=\"db\"} 1\n"
+            "# TYPE pgbackrest_a_count_total counter\n"
+            "pgbackrest_a_count_total{stanza=\"db\"} 1\n"
+            "# TYPE pgbackrest_file_byte_count_total counter\n"
+            "pgbackrest_file_byte_count_total{stanza=\"db\"} 3\n"
+            "# TYPE pgbackrest_file_byte_max gauge\n"
+            "pgbackrest_file_byte_max{stanza=\"db\"} 300\n"
+            "# TYPE pgbackrest_file_byte_total counter\n"
+            "pgbackrest_file_byte_total{stanza=\"db\"} 600\n"
+            "# TYPE pgbackrest_file_ms_count_total counter\n"
+            "pgbackrest_file_ms_count_total{stanza=\"db\"} 1\n"
+            "# TYPE pgbackrest_file_ms_max gauge\n"
+            "pgbackrest_file_ms_max{stanza=\"db\"} 0\n"
+            "# TYPE pgbackrest_file_ms_total counter\n"
+            "pgbackrest_file_ms_total{stanza=\"db\"} 0\n"
+            "# TYPE pgbackrest_z_count_count_total counter\n"
+            "pgbackrest_z_count_count_total{stanza=\"db\"} 1\n"
+            "# TYPE pgbackrest_z_count_max gauge\n"
+            "pgbackrest_z_count_max{stanza=\"db\"} 1\n"
+            "# TYPE pgbackrest_z_count_total counter\n"
+            "pgbackrest_z_count_total{stanza=\"db\"} 1\n",
+            "prometheus with label");
+
+        TEST_RESULT_VOID(statTimeAdd(STRDEF("file.ms"), timeMSec() - 1000), "time add");
+        TEST_RESULT_BOOL(statGet(STRDEF("file.ms")).max >= 1000, true, "check time");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("statCallbackSet()"))
+    {
+        TEST_RESULT_VOID(statCallbackSet(testCallback, 60000), "set callback with long interval");
+        TEST_RESULT_VOID(statInc(STRDEF("test")), "inc");
+        TEST_RESULT_UINT(testCallbackTotal, 0, "callback not called");
+
+        TEST_RESULT_VOID(statCallbackSet(testCallback, 0), "set callback with no interval");
+        TEST_RESULT_VOID(statInc(STRDEF("test")), "inc");
+        TEST_RESULT_UINT(testCallbackTotal, 1, "callback called");
+        TEST_RESULT_UINT(statGet(STRDEF("callback")).count, 1, "callback added statistic");
+
+        TEST_RESULT_VOID(statInc(STRDEF("test")), "inc");
+        TEST_RESULT_UINT(testCallbackTotal, 2, "callback called again");
+
+        TEST_RESULT_VOID(statCallbackSet(NULL, 0), "clear callback");
+        TEST_RESULT_VOID(statInc(STRDEF("test")), "inc");
+        TEST_RESULT_UINT(testCallbackTotal, 2, "callback not called");
+        TEST_RESULT_UINT(statGet(STRDEF("test")).count, 4, "check count");
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -155,5 +155,90 @@ testRun(void)
         TEST_RESULT_INT(*((int *)lstGet(list, 3)), 2, "sort value 3");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("lstFind*() on sorted lists, lstSortOrder(), and lstComparator()"))
+    {
+        List *list = lstNewP(sizeof(int), .comparator = testComparator);
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderNone, "new list is not sorted");
+        TEST_RESULT_PTR(lstComparator(list), testComparator, "check comparator");
+
+        int value;
+        value = 3; lstAdd(list, &value);
+        value = 7; lstAdd(list, &value);
+        value = 1; lstAdd(list, &value);
+        value = 5; lstAdd(list, &value);
+        value = 5; lstAdd(list, &value);
+        value = 5; lstAdd(list, &value);
+
+        TEST_RESULT_PTR(lstSort(list, sortOrderAsc), list, "sort asc");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderAsc, "    list is sorted asc");
+
+        value = 1;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 0, "    find first");
+        value = 7;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 5, "    find last");
+        value = 5;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 2, "    find first duplicate");
+        value = 4;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), LIST_NOT_FOUND, "    value not found");
+
+        TEST_RESULT_PTR(lstSort(list, sortOrderNone), list, "sort none");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderAsc, "    list is still sorted asc");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        value = 8;
+        TEST_RESULT_VOID(lstAdd(list, &value), "add item in order");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderAsc, "    list is still sorted asc");
+
+        value = 0;
+        TEST_RESULT_VOID(lstInsert(list, 0, &value), "insert item in order");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderAsc, "    list is still sorted asc");
+
+        value = 9;
+        TEST_RESULT_VOID(lstInsert(list, 1, &value), "insert item out of order");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderNone, "    list is no longer sorted");
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 1, "    find with linear search");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_PTR(lstSort(list, sortOrderDesc), list, "sort desc");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderDesc, "    list is sorted desc");
+
+        value = 9;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 0, "    find first");
+        value = 5;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), 3, "    find first duplicate");
+        value = 0;
+        TEST_RESULT_UINT(lstFindIdx(list, &value), lstSize(list) - 1, "    find last");
+        value = 6;
+        TEST_RESULT_PTR(lstFind(list, &value), NULL, "    value not found");
+
+        value = 10;
+        TEST_RESULT_VOID(lstAdd(list, &value), "add item out of order");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderNone, "    list is no longer sorted");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        lstSort(list, sortOrderAsc);
+
+        TEST_RESULT_PTR(lstComparatorSet(list, testComparator), list, "set same comparator");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderAsc, "    list is still sorted");
+        TEST_RESULT_PTR(lstComparatorSet(list, lstComparatorStr), list, "set new comparator");
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderNone, "    list is no longer sorted");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR(
+            lstNewP(sizeof(int), .sortOrder = sortOrderAsc), AssertError,
+            "assertion 'param.sortOrder == sortOrderNone || param.comparator != NULL' failed");
+
+        TEST_ASSIGN(list, lstNewP(sizeof(int), .comparator = testComparator, .sortOrder = sortOrderAsc), "new sorted list");
+
+        for (value = 0; value < 100; value += 2)
+            lstAdd(list, &value);
+
+        TEST_RESULT_UINT(lstSortOrder(list), sortOrderAsc, "    list is sorted asc");
+
+        for (value = 0; value < 100; value++)
+            TEST_RESULT_UINT(lstFindIdx(list, &value), value % 2 == 0 ? (unsigned int)value / 2 : LIST_NOT_FOUND, "find %d", value);
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
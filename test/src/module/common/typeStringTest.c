@@ -6,6 +6,15 @@ Test Strings
 // Declare a static const string for testing
 STRING_STATIC(TEST_STRING, "a very interesting string!");
 
+/***********************************************************************************************************************************
+Test comparator that only compares the first character
+***********************************************************************************************************************************/
+static int
+testComparatorStrFirst(const void *item1, const void *item2)
+{
+    return strPtr(*(String **)item1)[0] - strPtr(*(String **)item2)[0];
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -391,6 +400,27 @@ testRun(void)
         TEST_RESULT_BOOL(strLstExists(list, STRDEF("C")), true, "string exists");
         TEST_RESULT_BOOL(strLstExistsZ(list, "B"), false, "string does not exist");
         TEST_RESULT_BOOL(strLstExistsZ(list, "C"), true, "string exists");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        strLstAddZ(list, "B");
+        strLstSort(list, sortOrderDesc);
+
+        TEST_RESULT_BOOL(strLstExists(list, STRDEF("D")), false, "string does not exist in sorted list");
+        TEST_RESULT_BOOL(strLstExists(list, STRDEF("B")), true, "string exists in sorted list");
+        TEST_RESULT_BOOL(strLstExistsZ(list, "D"), false, "string does not exist in sorted list");
+        TEST_RESULT_BOOL(strLstExistsZ(list, "A"), true, "string exists in sorted list");
+
+        StringList *listDup = NULL;
+        TEST_ASSIGN(listDup, strLstDup(list), "duplicate sorted list");
+        TEST_RESULT_UINT(lstSortOrder((List *)listDup), sortOrderDesc, "    duplicate is sorted");
+        TEST_RESULT_BOOL(strLstExistsZ(listDup, "C"), true, "    string exists in duplicate");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        strLstComparatorSet(list, testComparatorStrFirst);
+        strLstSort(list, sortOrderAsc);
+
+        TEST_RESULT_BOOL(strLstExistsZ(list, "A"), true, "string exists in list sorted with custom comparator");
+        TEST_RESULT_BOOL(strLstExistsZ(list, "AA"), false, "string does not exist in list sorted with custom comparator");
     }
 
     // *****************************************************************************************************************************
@@ -490,5 +520,59 @@ testRun(void)
         TEST_RESULT_STR(strPtr(strLstToLog(list)), "{[\"item1\", \"item2\", \"item3\"]}", "format 3 item list");
     }
 
+
+    // *****************************************************************************************************************************
+    if (testBegin("StringSet"))
+    {
+        StringSet *set = NULL;
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            TEST_ASSIGN(set, strSetNew(), "new set");
+            TEST_RESULT_UINT(strSetSize(set), 0, "    set is empty");
+            TEST_RESULT_STR(strPtr(strSetToLog(set)), "{size: 0}", "    check log");
+            TEST_RESULT_BOOL(strSetExists(set, STRDEF("a")), false, "    string does not exist in empty set");
+
+            TEST_RESULT_PTR(strSetMove(set, MEM_CONTEXT_OLD()), set, "    move set");
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        TEST_RESULT_BOOL(strSetAdd(set, STRDEF("a")), true, "add string");
+        TEST_RESULT_BOOL(strSetAdd(set, STRDEF("a")), false, "add duplicate string");
+        TEST_RESULT_BOOL(strSetAdd(set, STRDEF("")), true, "add empty string");
+        TEST_RESULT_UINT(strSetSize(set), 2, "    set has two strings");
+        TEST_RESULT_BOOL(strSetExists(set, STRDEF("a")), true, "    string exists");
+        TEST_RESULT_BOOL(strSetExists(set, STRDEF("")), true, "    empty string exists");
+        TEST_RESULT_BOOL(strSetExists(set, STRDEF("b")), false, "    string does not exist");
+
+        // Add enough strings to grow the set several times
+        for (unsigned int setIdx = 0; setIdx < 1000; setIdx++)
+            strSetAdd(set, strNewFmt("%08X", setIdx));
+
+        TEST_RESULT_UINT(strSetSize(set), 1002, "add strings to grow set");
+
+        for (unsigned int setIdx = 0; setIdx < 1000; setIdx++)
+        {
+            if (!strSetExists(set, strNewFmt("%08X", setIdx)))
+                THROW_FMT(AssertError, "'%08X' does not exist", setIdx);
+        }
+
+        TEST_RESULT_BOOL(strSetExists(set, STRDEF("00001000")), false, "    string does not exist");
+        TEST_RESULT_STR(strPtr(strSetToLog(set)), "{size: 1002}", "    check log");
+
+        TEST_RESULT_VOID(strSetFree(set), "free set");
+        TEST_RESULT_VOID(strSetFree(NULL), "free null set");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        StringList *list = strLstNew();
+        strLstAddZ(list, "b");
+        strLstAddZ(list, "a");
+        strLstAddZ(list, "b");
+
+        TEST_ASSIGN(set, strSetNewStrLst(list), "new set from list");
+        TEST_RESULT_UINT(strSetSize(set), 2, "    duplicates are added once");
+        TEST_RESULT_BOOL(strSetExists(set, STRDEF("a")), true, "    string exists");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -606,6 +606,12 @@ testRun(void)
             sizeof(optionResolveOrder) / sizeof(ConfigOption), CFG_OPTION_TOTAL,
             "check that the option resolve list contains an entry for every option");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_INT(configParseOptionId(strNew(CFGOPT_CONFIG)), cfgOptConfig, "find option");
+        TEST_RESULT_INT(configParseOptionId(strNew("no-" CFGOPT_CONFIG)), cfgOptConfig, "find negated option");
+        TEST_RESULT_INT(configParseOptionId(strNew("db-path")), cfgOptPgPath, "find deprecated option");
+        TEST_RESULT_INT(configParseOptionId(strNew("no-conf")), -1, "abbreviated option is not found");
+
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
         strLstAdd(argList, strNew(TEST_BACKREST_EXE));
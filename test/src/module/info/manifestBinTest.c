@@ -0,0 +1,314 @@
+/***********************************************************************************************************************************
+Test Binary Manifest
+***********************************************************************************************************************************/
+#include "common/io/bufferRead.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessInfo.h"
+
+/***********************************************************************************************************************************
+Update the checksum after the binary manifest has been modified so the structure checks can be reached
+***********************************************************************************************************************************/
+static Buffer *
+testChecksumUpdate(Buffer *manifest)
+{
+    const size_t checksumOffset = bufUsed(manifest) - HASH_TYPE_SHA1_SIZE;
+
+    memcpy(
+        bufPtr(manifest) + checksumOffset,
+        bufPtr(cryptoHashOne(HASH_TYPE_SHA1_STR, BUF(bufPtr(manifest), checksumOffset))), HASH_TYPE_SHA1_SIZE);
+
+    return manifest;
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    // Create default storage object for testing
+    Storage *storageTest = storagePosixNew(
+        strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+    // *****************************************************************************************************************************
+    if (testBegin("manifestBinWriteNew(), manifestBinWriteCallback(), manifestBinWriteResult()"))
+    {
+        // Files are out of order to check that they are sorted
+        // -------------------------------------------------------------------------------------------------------------------------
+        const Buffer *contentLoad = harnessInfoChecksumZ
+        (
+            "[backup]\n"
+            "backup-label=\"20190818-084502F_20190818-084512I\"\n"
+            "\n"
+            "[target:file]\n"
+            "pg_data/base/1/2={\"checksum\":\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",\"checksum-page\":false,"
+                "\"checksum-page-error\":[1],\"master\":false,\"reference\":\"20190818-084502F\",\"repo-size\":3,\"size\":8192,"
+                "\"timestamp\":1565282101}\n"
+            "pg_data/PG_VERSION={\"checksum\":\"ffffffffffffffffffffffffffffffffffffffff\",\"group\":\"group2\",\"mode\":\"0644\","
+                "\"size\":4,\"timestamp\":1565282100}\n"
+            "pg_data/base/1/1={\"checksum-page\":true,\"group\":false,\"size\":0,\"timestamp\":1565282102,\"user\":false}\n"
+            "pg_data/global/pg_control={\"checksum\":\"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\",\"master\":true,"
+                "\"reference\":\"20190818-084502F\",\"size\":8192,\"timestamp\":1565282103,\"user\":\"user2\"}\n"
+            "\n"
+            "[target:file:default]\n"
+            "group=\"postgres\"\n"
+            "master=true\n"
+            "mode=\"0600\"\n"
+            "user=\"postgres\"\n"
+            "ignore=true\n"
+        );
+
+        ManifestBinWrite *manifestWrite = NULL;
+        TEST_ASSIGN(manifestWrite, manifestBinWriteNew(), "new writer");
+        TEST_RESULT_VOID(
+            infoNewLoad(ioBufferReadNew(contentLoad), manifestBinWriteCallback, manifestWrite), "load text manifest");
+
+        Buffer *manifestBuffer = NULL;
+        TEST_ASSIGN(manifestBuffer, manifestBinWriteResult(manifestWrite), "write binary manifest");
+        TEST_RESULT_VOID(manifestBinWriteFree(manifestWrite), "free writer");
+
+        ManifestBin *manifest = NULL;
+        TEST_ASSIGN(manifest, manifestBinNew(manifestBuffer), "load binary manifest");
+        TEST_RESULT_UINT(manifestBinFileTotal(manifest), 4, "    check total");
+        TEST_RESULT_PTR(manifestBinCipherPass(manifest), NULL, "    check no cipher pass");
+
+        ManifestBinFile file = manifestBinFile(manifest, 0);
+        TEST_RESULT_STR(file.name, "pg_data/PG_VERSION", "    check name");
+        TEST_RESULT_STR(file.checksum, "ffffffffffffffffffffffffffffffffffffffff", "    check checksum");
+        TEST_RESULT_STR(file.reference, NULL, "    check reference");
+        TEST_RESULT_STR(file.user, "postgres", "    check default user");
+        TEST_RESULT_STR(file.group, "group2", "    check group");
+        TEST_RESULT_STR(file.mode, "0644", "    check mode");
+        TEST_RESULT_UINT(file.size, 4, "    check size");
+        TEST_RESULT_UINT(file.sizeRepo, 4, "    check repo size");
+        TEST_RESULT_INT(file.timestamp, 1565282100, "    check timestamp");
+        TEST_RESULT_BOOL(file.master, true, "    check default master");
+        TEST_RESULT_BOOL(file.checksumPage, false, "    check checksum page");
+        TEST_RESULT_BOOL(file.checksumPageError, false, "    check checksum page error");
+
+        file = manifestBinFile(manifest, 1);
+        TEST_RESULT_STR(file.name, "pg_data/base/1/1", "    check name");
+        TEST_RESULT_STR(file.checksum, NULL, "    check no checksum");
+        TEST_RESULT_STR(file.user, NULL, "    check no user");
+        TEST_RESULT_STR(file.group, NULL, "    check no group");
+        TEST_RESULT_STR(file.mode, "0600", "    check default mode");
+        TEST_RESULT_BOOL(file.checksumPage, true, "    check checksum page");
+        TEST_RESULT_BOOL(file.checksumPageError, false, "    check checksum page error");
+
+        file = manifestBinFile(manifest, 2);
+        TEST_RESULT_STR(file.name, "pg_data/base/1/2", "    check name");
+        TEST_RESULT_STR(file.reference, "20190818-084502F", "    check reference");
+        TEST_RESULT_UINT(file.size, 8192, "    check size");
+        TEST_RESULT_UINT(file.sizeRepo, 3, "    check repo size");
+        TEST_RESULT_BOOL(file.master, false, "    check master");
+        TEST_RESULT_BOOL(file.checksumPage, true, "    check checksum page");
+        TEST_RESULT_BOOL(file.checksumPageError, true, "    check checksum page error");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/global/pg_control", &file), true, "find last file");
+        TEST_RESULT_STR(file.reference, "20190818-084502F", "    check reference");
+        TEST_RESULT_STR(file.user, "user2", "    check user");
+        TEST_RESULT_STR(file.group, "postgres", "    check default group");
+        TEST_RESULT_BOOL(file.master, true, "    check master");
+
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/PG_VERSION", &file), true, "find first file");
+        TEST_RESULT_STR(file.name, "pg_data/PG_VERSION", "    check name");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/base/1/1", &file), true, "find middle file");
+        TEST_RESULT_STR(file.name, "pg_data/base/1/1", "    check name");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/base/1/15", &file), false, "file not found");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/A", &file), false, "file before first not found");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/z", &file), false, "file after last not found");
+
+        TEST_RESULT_VOID(manifestBinFree(manifest), "free manifest");
+
+        // Manifest without defaults
+        // -------------------------------------------------------------------------------------------------------------------------
+        contentLoad = harnessInfoChecksumZ
+        (
+            "[target:file]\n"
+            "pg_data/PG_VERSION={\"size\":0,\"timestamp\":1565282100}\n"
+        );
+
+        manifestWrite = manifestBinWriteNew();
+        infoNewLoad(ioBufferReadNew(contentLoad), manifestBinWriteCallback, manifestWrite);
+
+        TEST_ASSIGN(manifest, manifestBinNew(manifestBinWriteResult(manifestWrite)), "load binary manifest");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/PG_VERSION", &file), true, "find file");
+        TEST_RESULT_STR(file.user, NULL, "    check no user");
+        TEST_RESULT_STR(file.group, NULL, "    check no group");
+        TEST_RESULT_STR(file.mode, NULL, "    check no mode");
+        TEST_RESULT_BOOL(file.master, false, "    check not master");
+
+        // Empty manifest
+        // -------------------------------------------------------------------------------------------------------------------------
+        manifestWrite = manifestBinWriteNew();
+
+        TEST_ASSIGN(manifest, manifestBinNew(manifestBinWriteResult(manifestWrite)), "load empty binary manifest");
+        TEST_RESULT_UINT(manifestBinFileTotal(manifest), 0, "    check total");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/PG_VERSION", &file), false, "file not found");
+
+        // Invalid checksum in the text manifest
+        // -------------------------------------------------------------------------------------------------------------------------
+        contentLoad = harnessInfoChecksumZ
+        (
+            "[target:file]\n"
+            "pg_data/PG_VERSION={\"checksum\":\"ffff\",\"size\":4,\"timestamp\":1565282100}\n"
+        );
+
+        TEST_ERROR(
+            infoNewLoad(ioBufferReadNew(contentLoad), manifestBinWriteCallback, manifestBinWriteNew()), FormatError,
+            "invalid checksum 'ffff' for 'pg_data/PG_VERSION'");
+
+        // Invalid binary manifests
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_ERROR(manifestBinNew(BUFSTRDEF("PGBRMANB")), FormatError, "invalid binary manifest header");
+
+        Buffer *invalid = bufDup(manifestBuffer);
+        bufPtr(invalid)[0] = 'X';
+        TEST_ERROR(manifestBinNew(invalid), FormatError, "invalid binary manifest header");
+
+        // Version and record size are in host byte order following the magic
+        uint32_t recordSize;
+        memcpy(&recordSize, bufPtr(manifestBuffer) + 12, sizeof(uint32_t));
+
+        uint32_t invalidValue = 99;
+        invalid = bufDup(manifestBuffer);
+        memcpy(bufPtr(invalid) + 8, &invalidValue, sizeof(uint32_t));
+        TEST_ERROR_FMT(
+            manifestBinNew(invalid), VersionNotSupportedError, "binary manifest version 99 with record size %u is not supported",
+            recordSize);
+
+        invalid = bufDup(manifestBuffer);
+        memcpy(bufPtr(invalid) + 12, &invalidValue, sizeof(uint32_t));
+        TEST_ERROR(
+            manifestBinNew(invalid), VersionNotSupportedError, "binary manifest version 1 with record size 99 is not supported");
+
+        invalid = bufDup(manifestBuffer);
+        bufUsedSet(invalid, bufUsed(invalid) - 1);
+        TEST_ERROR(manifestBinNew(invalid), FormatError, "binary manifest size does not match header");
+
+        invalid = bufDup(manifestBuffer);
+        memset(bufPtr(invalid) + 16, 0xFF, 8);
+        TEST_ERROR(manifestBinNew(invalid), FormatError, "binary manifest size does not match header");
+
+        invalid = bufDup(manifestBuffer);
+        memset(bufPtr(invalid) + 24, 0, 8);
+        TEST_ERROR(manifestBinNew(invalid), FormatError, "binary manifest size does not match header");
+
+        invalid = bufDup(manifestBuffer);
+        memset(bufPtr(invalid) + 28, 0xFF, 4);
+        TEST_ERROR(manifestBinNew(invalid), FormatError, "binary manifest size does not match header");
+
+        invalid = bufDup(manifestBuffer);
+        bufPtr(invalid)[bufUsed(invalid) - HASH_TYPE_SHA1_SIZE - 2] = 'X';
+        TEST_ERROR(manifestBinNew(invalid), ChecksumError, "binary manifest checksum does not match");
+
+        // Offsets are checked even when the checksum matches since the checksum is not keyed
+        invalid = bufDup(manifestBuffer);
+        bufPtr(invalid)[bufUsed(invalid) - HASH_TYPE_SHA1_SIZE - 1] = 'X';
+        TEST_ERROR(manifestBinNew(testChecksumUpdate(invalid)), FormatError, "binary manifest string table is invalid");
+
+        invalid = bufDup(manifestBuffer);
+        memset(bufPtr(invalid) + 32, 0x7F, 4);
+        TEST_ERROR(manifestBinNew(testChecksumUpdate(invalid)), FormatError, "binary manifest string table is invalid");
+
+        // The header is 40 bytes and the name is the first offset in the record after size, repo size, and timestamp
+        const size_t recordOffset = 40;
+        const size_t nameOffset = recordOffset + 24;
+
+        invalid = bufDup(manifestBuffer);
+        memset(bufPtr(invalid) + nameOffset, 0, sizeof(uint32_t));
+        TEST_ERROR(manifestBinNew(testChecksumUpdate(invalid)), FormatError, "binary manifest record 0 is invalid");
+
+        for (unsigned int offsetIdx = 0; offsetIdx < 5; offsetIdx++)
+        {
+            invalid = bufDup(manifestBuffer);
+            memset(bufPtr(invalid) + recordOffset + recordSize + nameOffset - recordOffset + offsetIdx * 4, 0x7F, sizeof(uint32_t));
+            TEST_ERROR(manifestBinNew(testChecksumUpdate(invalid)), FormatError, "binary manifest record 1 is invalid");
+        }
+
+        // The checksum follows name, reference, user, group, mode, and flag
+        invalid = bufDup(manifestBuffer);
+        bufPtr(invalid)[nameOffset + 24 + HASH_TYPE_SHA1_SIZE_HEX] = 'X';
+        TEST_ERROR(manifestBinNew(testChecksumUpdate(invalid)), FormatError, "binary manifest record 0 is invalid");
+
+        // Map binary manifest from a file
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storageTest, strNew("backup.manifest.bin")), manifestBuffer);
+
+        TEST_ASSIGN(
+            manifest, manifestBinNewMap(strNewFmt("%s/backup.manifest.bin", testPath()), true), "map binary manifest");
+        TEST_RESULT_UINT(manifestBinFileTotal(manifest), 4, "    check total");
+        TEST_RESULT_BOOL(manifestBinFileFind(manifest, "pg_data/base/1/2", &file), true, "find file");
+        TEST_RESULT_UINT(file.sizeRepo, 3, "    check repo size");
+        TEST_RESULT_VOID(manifestBinFree(manifest), "free manifest");
+
+        // The checksum is not checked when it is skipped
+        invalid = bufDup(manifestBuffer);
+        bufPtr(invalid)[bufUsed(invalid) - 1] ^= 0xFF;
+        storagePutNP(storageNewWriteNP(storageTest, strNew("backup.manifest.bin")), invalid);
+
+        TEST_ERROR(
+            manifestBinNewMap(strNewFmt("%s/backup.manifest.bin", testPath()), true), ChecksumError,
+            "binary manifest checksum does not match");
+        TEST_ASSIGN(
+            manifest, manifestBinNewMap(strNewFmt("%s/backup.manifest.bin", testPath()), false), "map without checksum");
+        TEST_RESULT_UINT(manifestBinFileTotal(manifest), 4, "    check total");
+        TEST_RESULT_VOID(manifestBinFree(manifest), "free manifest");
+
+        // Records are validated when they are fetched when the checksum is skipped
+        invalid = bufDup(manifestBuffer);
+        memset(bufPtr(invalid) + nameOffset, 0, sizeof(uint32_t));
+        storagePutNP(storageNewWriteNP(storageTest, strNew("backup.manifest.bin")), invalid);
+
+        TEST_ASSIGN(
+            manifest, manifestBinNewMap(strNewFmt("%s/backup.manifest.bin", testPath()), false), "map invalid record");
+        TEST_RESULT_STR(manifestBinFile(manifest, 1).name, "pg_data/base/1/1", "    check valid record");
+        TEST_ERROR(manifestBinFile(manifest, 0), FormatError, "binary manifest record 0 is invalid");
+        TEST_ERROR(manifestBinFileFind(manifest, "pg_data/PG_VERSION", &file), FormatError, "binary manifest record 0 is invalid");
+        TEST_RESULT_VOID(manifestBinFree(manifest), "free manifest");
+
+        storagePutNP(storageNewWriteNP(storageTest, strNew("backup.manifest.bin")), bufNew(0));
+
+        TEST_ERROR(
+            manifestBinNewMap(strNewFmt("%s/backup.manifest.bin", testPath()), false), FormatError,
+            "invalid binary manifest header");
+
+        TEST_ERROR_FMT(
+            manifestBinNewMap(strNewFmt("%s/missing", testPath()), false), FileOpenError,
+            "unable to open '%s/missing' for read: [2] No such file or directory", testPath());
+
+        TEST_ERROR_FMT(
+            manifestBinNewMap(strNew(testPath()), false), FileReadError, "unable to map '%s': [19] No such device", testPath());
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("manifestBinFromText()"))
+    {
+        ManifestBin *manifest = NULL;
+
+        TEST_ASSIGN(
+            manifest,
+            manifestBinNew(
+                manifestBinFromText(
+                    harnessInfoChecksumZ(
+                        "[cipher]\n"
+                        "cipher-pass=\"filepass\"\n"
+                        "\n"
+                        "[target:file]\n"
+                        "pg_data/PG_VERSION={\"size\":0,\"timestamp\":1565282100,\"user\":\"filepass\"}\n"))),
+            "convert text manifest");
+        TEST_RESULT_STR(manifestBinCipherPass(manifest), "filepass", "    check cipher pass");
+        TEST_RESULT_UINT(manifestBinFileTotal(manifest), 1, "    check total");
+        TEST_RESULT_STR(manifestBinFile(manifest, 0).user, "filepass", "    check user shares the string");
+
+        TEST_ASSIGN(
+            manifest, manifestBinNew(manifestBinFromText(harnessInfoChecksumZ("[target:file]\n"))), "convert unencrypted manifest");
+        TEST_RESULT_PTR(manifestBinCipherPass(manifest), NULL, "    check no cipher pass");
+
+        TEST_ERROR(
+            manifestBinFromText(BUFSTRDEF("[target:file]\n")), ChecksumError,
+            "invalid checksum, actual '8a456f046f11cb56504a01eb76372f239788d018' but no checksum found");
+    }
+}
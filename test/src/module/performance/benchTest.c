@@ -0,0 +1,237 @@
+/***********************************************************************************************************************************
+Benchmark Filters and Core Types
+
+Benchmark the filters and parsers that process every byte of a backup so changes that affect their performance can be measured.
+Results are written by hrnBenchComplete() and compared with the stored baseline when one exists.
+***********************************************************************************************************************************/
+#include "command/backup/pageChecksum.h"
+#include "common/compress/gzip/compress.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
+#include "common/exec.h"
+#include "common/harnessBench.h"
+#include "common/ini.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
+#include "common/io/filter/size.h"
+#include "common/io/io.h"
+#include "common/type/json.h"
+#include "postgres/interface.h"
+#include "postgres/pageChecksum.h"
+
+/***********************************************************************************************************************************
+Size of the buffer processed by each filter benchmark
+***********************************************************************************************************************************/
+#define TEST_BUFFER_SIZE                                            (4 * 1024 * 1024)
+
+/***********************************************************************************************************************************
+Size of the stream read from a child process by the pipe benchmark
+***********************************************************************************************************************************/
+#define TEST_PIPE_SIZE                                              (64 * 1024 * 1024)
+
+/***********************************************************************************************************************************
+Page header used to generate pages with valid checksums
+***********************************************************************************************************************************/
+typedef struct PageHeaderData
+{
+    uint32_t pd_lsn_walid;                                          // lsn high bits
+    uint32_t pd_lsn_xrecoff;                                        // lsn low bits
+    uint16_t pd_checksum;                                           // checksum
+    uint16_t pd_flags;                                              // flag bits
+    uint16_t pd_lower;                                              // offset to start of free space
+    uint16_t pd_upper;                                              // offset to end of free space
+} PageHeaderData;
+
+/***********************************************************************************************************************************
+Write a buffer through a filter
+***********************************************************************************************************************************/
+static void
+testFilterWrite(IoFilter *filter, const Buffer *input)
+{
+    IoWrite *write = ioBufferWriteNew(bufNew(0));
+    ioFilterGroupAdd(ioWriteFilterGroup(write), filter);
+
+    ioWriteOpen(write);
+    ioWrite(write, input);
+    ioWriteClose(write);
+}
+
+/***********************************************************************************************************************************
+Ini callback that discards values
+***********************************************************************************************************************************/
+static void
+testIniCallback(void *data, const String *section, const String *key, const String *value)
+{
+    (void)data;
+    (void)section;
+    (void)key;
+    (void)value;
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("filters"))
+    {
+        // Generate pages that look like a relation -- valid checksums with data that compresses moderately well
+        Buffer *input = bufNew(TEST_BUFFER_SIZE);
+        bufUsedSet(input, bufSize(input));
+
+        for (unsigned int pageIdx = 0; pageIdx < TEST_BUFFER_SIZE / PG_PAGE_SIZE_DEFAULT; pageIdx++)
+        {
+            unsigned char *page = bufPtr(input) + pageIdx * PG_PAGE_SIZE_DEFAULT;
+
+            for (unsigned int byteIdx = 0; byteIdx < PG_PAGE_SIZE_DEFAULT; byteIdx++)
+                page[byteIdx] = (unsigned char)((byteIdx * 7 + pageIdx) % 61);
+
+            ((PageHeaderData *)page)->pd_lsn_walid = 0;
+            ((PageHeaderData *)page)->pd_lsn_xrecoff = 1;
+            ((PageHeaderData *)page)->pd_upper = 0x100;
+            ((PageHeaderData *)page)->pd_checksum = pageChecksum(page, pageIdx, PG_PAGE_SIZE_DEFAULT);
+        }
+
+        TEST_LOG_FMT("generated %d byte buffer", TEST_BUFFER_SIZE);
+
+        // Split the buffer into chunks the way IoRead/IoWrite would process it
+        List *chunkList = lstNew(sizeof(Buffer *));
+
+        for (size_t inputIdx = 0; inputIdx < TEST_BUFFER_SIZE; inputIdx += ioBufferSize())
+        {
+            Buffer *chunk = bufNewC(bufPtr(input) + inputIdx, ioBufferSize());
+            lstAdd(chunkList, &chunk);
+        }
+
+        HRN_BENCH("ioFilterGroupProcess()", .byte = TEST_BUFFER_SIZE)
+        {
+            IoFilterGroup *filterGroup = ioFilterGroupNew();
+
+            for (unsigned int filterIdx = 0; filterIdx < 8; filterIdx++)
+                ioFilterGroupAdd(filterGroup, ioSizeNew());
+
+            Buffer *output = bufNew(ioBufferSize());
+
+            ioFilterGroupOpen(filterGroup);
+
+            for (unsigned int chunkIdx = 0; chunkIdx < lstSize(chunkList); chunkIdx++)
+            {
+                do
+                {
+                    ioFilterGroupProcess(filterGroup, *(Buffer **)lstGet(chunkList, chunkIdx), output);
+                    bufUsedZero(output);
+                }
+                while (ioFilterGroupInputSame(filterGroup));
+            }
+
+            do
+            {
+                ioFilterGroupProcess(filterGroup, NULL, output);
+                bufUsedZero(output);
+            }
+            while (!ioFilterGroupDone(filterGroup));
+
+            ioFilterGroupClose(filterGroup);
+        }
+
+        HRN_BENCH("gzipCompressNew()", .byte = TEST_BUFFER_SIZE)
+        {
+            testFilterWrite(gzipCompressNew(6, false), input);
+        }
+
+        HRN_BENCH("cipherBlockNew()", .byte = TEST_BUFFER_SIZE)
+        {
+            testFilterWrite(cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("bench"), NULL), input);
+        }
+
+        HRN_BENCH("cryptoHashNew()", .byte = TEST_BUFFER_SIZE)
+        {
+            testFilterWrite(cryptoHashNew(HASH_TYPE_SHA1_STR), input);
+        }
+
+        HRN_BENCH("pageChecksumNew()", .byte = TEST_BUFFER_SIZE)
+        {
+            testFilterWrite(pageChecksumNew(0, PG_SEGMENT_PAGE_DEFAULT, PG_PAGE_SIZE_DEFAULT, 0xFFFFFFFFFFFFFFFF), input);
+        }
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("jsonToVar() and iniLoad()"))
+    {
+        // Generate json similar to the file list sent to local processes. KeyValue searches keys linearly so parse time grows with
+        // the square of the number of keys -- use fewer files than the ini benchmark so the run time is reasonable.
+        String *json = strNew("{");
+
+        for (unsigned int fileIdx = 0; fileIdx < 1000; fileIdx++)
+        {
+            strCatFmt(
+                json,
+                "%s\"pg_data/base/16384/%u\":{\"checksum\":\"1e34fa1c833090d94b9bb14f2a8d3153dca6ea27\",\"size\":8192,"
+                    "\"timestamp\":1565282114,\"reference\":null,\"master\":false}",
+                fileIdx == 0 ? "" : ",", fileIdx);
+        }
+
+        strCat(json, "}");
+
+        TEST_LOG_FMT("generated %zu byte json", strSize(json));
+
+        HRN_BENCH("jsonToVar()", .byte = strSize(json))
+        {
+            CHECK(varKv(jsonToVar(json)) != NULL);
+        }
+
+        // Generate an ini that looks like a backup manifest
+        String *ini = strNew("[target:file]\n");
+
+        for (unsigned int fileIdx = 0; fileIdx < 10000; fileIdx++)
+        {
+            strCatFmt(
+                ini,
+                "pg_data/base/16384/%u={\"checksum\":\"1e34fa1c833090d94b9bb14f2a8d3153dca6ea27\",\"size\":8192,"
+                    "\"timestamp\":1565282114}\n",
+                fileIdx);
+        }
+
+        TEST_LOG_FMT("generated %zu byte ini", strSize(ini));
+
+        HRN_BENCH("iniLoad()", .byte = strSize(ini))
+        {
+            iniLoad(ioBufferReadNew(BUFSTR(ini)), testIniCallback, NULL);
+        }
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("IoHandleRead"))
+    {
+        // Read from a child process the same way the protocol reads from a local process.  The child writes in large blocks so the
+        // result depends on the pipe and the read path rather than the child.
+        StringList *param = strLstNew();
+        strLstAddZ(param, "if=/dev/zero");
+        strLstAddZ(param, "bs=1M");
+        strLstAddZ(param, "status=none");
+
+        Exec *exec = execNew(STRDEF("dd"), param, STRDEF("dd"), 10000);
+        execOpen(exec);
+
+        HRN_BENCH("execIoRead()", .byte = TEST_PIPE_SIZE)
+        {
+            Buffer *buffer = bufNew(ioBufferSize());
+
+            for (size_t size = 0; size < TEST_PIPE_SIZE; size += bufUsed(buffer))
+            {
+                bufUsedZero(buffer);
+                ioRead(execIoRead(exec), buffer);
+            }
+        }
+
+        execFree(exec);
+    }
+
+    hrnBenchComplete("performance-bench");
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -0,0 +1,115 @@
+/***********************************************************************************************************************************
+Test Type Performance
+
+Test the performance of various types and data structures.  Generally speaking, the starting values should be high enough to "blow
+up" in an obvious way if an underlying data structure has a search or insert with worse than expected complexity.
+***********************************************************************************************************************************/
+#include "common/time.h"
+#include "common/type/list.h"
+#include "common/type/stringList.h"
+#include "common/type/stringSet.h"
+
+/***********************************************************************************************************************************
+Number of items to use for each test
+***********************************************************************************************************************************/
+#define TEST_MAX                                                    100000
+
+/***********************************************************************************************************************************
+Test sort comparator
+***********************************************************************************************************************************/
+static int
+testComparator(const void *item1, const void *item2)
+{
+    int int1 = *(int *)item1;
+    int int2 = *(int *)item2;
+
+    if (int1 < int2)
+        return -1;
+
+    if (int1 > int2)
+        return 1;
+
+    return 0;
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("lstFind()"))
+    {
+        // Generate a large list of values (use int instead of string so there are fewer allocations)
+        List *list = lstNewP(sizeof(int), .comparator = testComparator);
+
+        for (int listIdx = 0; listIdx < TEST_MAX; listIdx++)
+            lstAdd(list, &listIdx);
+
+        CHECK(lstSize(list) == TEST_MAX);
+
+        TEST_LOG_FMT("generated %d item list", TEST_MAX);
+
+        // Search for all values with an ascending sort
+        lstSort(list, sortOrderAsc);
+
+        TimeMSec timeBegin = timeMSec();
+
+        for (int listIdx = 0; listIdx < TEST_MAX; listIdx++)
+            CHECK(*(int *)lstFind(list, &listIdx) == listIdx);
+
+        TEST_LOG_FMT("asc search completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+
+        // Search for all values with an descending sort
+        lstSort(list, sortOrderDesc);
+
+        timeBegin = timeMSec();
+
+        for (int listIdx = 0; listIdx < TEST_MAX; listIdx++)
+            CHECK(*(int *)lstFind(list, &listIdx) == listIdx);
+
+        TEST_LOG_FMT("desc search completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("strLstExists() and strSetExists()"))
+    {
+        // Generate a large list of WAL segment names, which is the typical use case for existence checks
+        StringList *list = strLstNew();
+
+        for (unsigned int listIdx = 0; listIdx < TEST_MAX; listIdx++)
+            strLstAdd(list, strNewFmt("0000000100000%03X000000%02X", listIdx / 256, listIdx % 256));
+
+        TEST_LOG_FMT("generated %d item string list", TEST_MAX);
+
+        // Search for all values in a sorted list
+        strLstSort(list, sortOrderAsc);
+
+        TimeMSec timeBegin = timeMSec();
+
+        for (unsigned int listIdx = 0; listIdx < TEST_MAX; listIdx++)
+            CHECK(strLstExists(list, strLstGet(list, listIdx)));
+
+        TEST_LOG_FMT("sorted list search completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+
+        // Build a set from the list and search for all values
+        timeBegin = timeMSec();
+
+        StringSet *set = strSetNewStrLst(list);
+        CHECK(strSetSize(set) == TEST_MAX);
+
+        TEST_LOG_FMT("set build completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+
+        timeBegin = timeMSec();
+
+        for (unsigned int listIdx = 0; listIdx < TEST_MAX; listIdx++)
+            CHECK(strSetExists(set, strLstGet(list, listIdx)));
+
+        TEST_LOG_FMT("set search completed in %ums", (unsigned int)(timeMSec() - timeBegin));
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
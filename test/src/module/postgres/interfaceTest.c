@@ -143,13 +143,14 @@ testRun(void)
 
         //--------------------------------------------------------------------------------------------------------------------------
         memset(bufPtr(result), 0, bufSize(result));
-        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .systemId = 0xECAFECAF}, result);
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_11, .systemId = 0xECAFECAF, .walSegmentSize = 64 * 1024 * 1024}, result);
         storagePutNP(storageNewWriteNP(storageTest, walFile), result);
 
         PgWal info = {0};
         TEST_ASSIGN(info, pgWalFromFile(walFile), "get wal info v11");
         TEST_RESULT_INT(info.systemId, 0xECAFECAF, "   check system id");
         TEST_RESULT_INT(info.version, PG_VERSION_11, "   check version");
+        TEST_RESULT_UINT(info.walSegmentSize, 64 * 1024 * 1024, "   check wal segment size");
 
         //--------------------------------------------------------------------------------------------------------------------------
         memset(bufPtr(result), 0, bufSize(result));
@@ -159,6 +160,7 @@ testRun(void)
         TEST_ASSIGN(info, pgWalFromFile(walFile), "get wal info v8.3");
         TEST_RESULT_INT(info.systemId, 0xEAEAEAEA, "   check system id");
         TEST_RESULT_INT(info.version, PG_VERSION_83, "   check version");
+        TEST_RESULT_UINT(info.walSegmentSize, PG_WAL_SEGMENT_SIZE_DEFAULT, "   check wal segment size");
     }
 
     // *****************************************************************************************************************************
@@ -183,12 +185,13 @@ testRun(void)
         PgWal pgWal =
         {
             .version = PG_VERSION_10,
-            .systemId = 0xFEFEFEFEFE
+            .systemId = 0xFEFEFEFEFE,
+            .walSegmentSize = 16 * 1024 * 1024,
         };
 
         TEST_RESULT_STR(
             strPtr(pgWalToLog(&pgWal)),
-            "{version: 100000, systemId: 1095199817470}", "check log");
+            "{version: 100000, systemId: 1095199817470, walSegmentSize: 16777216}", "check log");
     }
 
     FUNCTION_HARNESS_RESULT_VOID();
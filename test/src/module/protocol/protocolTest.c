@@ -1,10 +1,15 @@
 /***********************************************************************************************************************************
 Test Protocol
 ***********************************************************************************************************************************/
+#include <signal.h>
+#include <sys/time.h>
+#include <unistd.h>
+
 #include "common/io/handleRead.h"
 #include "common/io/handleWrite.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/io/tls/server.h"
 #include "common/regExp.h"
 #include "storage/storage.h"
 #include "storage/posix/storage.h"
@@ -12,6 +17,21 @@ Test Protocol
 
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
+#include "common/harnessTls.h"
+
+/***********************************************************************************************************************************
+Path and prefix for test certificates
+***********************************************************************************************************************************/
+#define TEST_CERTIFICATE_PREFIX                                     "test/certificate/pgbackrest-test"
+
+/***********************************************************************************************************************************
+Signal handler that does nothing so blocking calls are interrupted
+***********************************************************************************************************************************/
+static void
+testSignalNoOp(int signalType)
+{
+    (void)signalType;
+}
 
 /***********************************************************************************************************************************
 Test protocol request handler
@@ -288,6 +308,26 @@ testRun(void)
                         "|pgbackrest --c --command=backup --log-level-file=off --log-level-stderr=error --pg1-path=/path/to/3"
                         " --pg1-port=3333 --pg1-socket-path=/socket3 --process=4 --stanza=test1 --type=db remote")),
             "remote protocol params for db local");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAddZ(argList, "--repo1-host=repo-host");
+        strLstAddZ(argList, "--repo1-host-config=/path/pgbackrest.conf");
+        strLstAddZ(argList, "--repo1-host-config-include-path=/path/include");
+        strLstAddZ(argList, "--repo1-host-config-path=/path/config");
+        strLstAddZ(argList, "--repo1-host-cert-file=/path/client.crt");
+        strLstAddZ(argList, "--repo1-host-key-file=/path/client.key");
+        strLstAddZ(argList, "--repo1-host-type=tls");
+        strLstAddZ(argList, "archive-get");
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(protocolRemoteExecParam(protocolStorageTypeRepo, 1, 0), "|")),
+            "--c|--command=archive-get|--log-level-file=off|--log-level-stderr=error|--process=1|--stanza=test1|--type=backup"
+                "|remote",
+            "tls remote params do not include config options");
     }
 
     // *****************************************************************************************************************************
@@ -694,9 +734,15 @@ testRun(void)
 
                 TEST_RESULT_PTR(protocolParallelResult(parallel), NULL, "check no result");
 
-                // Process jobs
+                // Process jobs.  Interrupt select() with a signal while waiting to check that it is retried.
+                struct sigaction action = {.sa_handler = testSignalNoOp};
+                sigaction(SIGALRM, &action, NULL);
+                setitimer(ITIMER_REAL, &(struct itimerval){.it_value = {.tv_usec = 250000}}, NULL);
+
                 TEST_RESULT_INT(protocolParallelProcess(parallel), 1, "process jobs");
 
+                signal(SIGALRM, SIG_DFL);
+
                 TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
                 TEST_RESULT_STR(strPtr(varStr(protocolParallelJobKey(job))), "job2", "check key is job2");
                 TEST_RESULT_BOOL(
@@ -732,6 +778,10 @@ testRun(void)
                 TEST_RESULT_INT(varIntForce(protocolParallelJobResult(job)), 1, "check result is 1");
 
                 TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+                TEST_ERROR(
+                    protocolParallelJobAdd(
+                        parallel, protocolParallelJobNew(varNewStr(strNew("job4")), protocolCommandNew(strNew("command4")))),
+                    AssertError, "assertion 'this->state != protocolParallelJobStateDone' failed");
 
                 // Free client
                 for (unsigned int clientIdx = 0; clientIdx < clientTotal; clientIdx++)
@@ -743,6 +793,36 @@ testRun(void)
             HARNESS_FORK_PARENT_END();
         }
         HARNESS_FORK_END();
+
+        // Poll error when a client handle is closed
+        // -------------------------------------------------------------------------------------------------------------------------
+        int pipeHandle[2];
+        THROW_ON_SYS_ERROR(pipe(pipeHandle) == -1, KernelError, "unable to create pipe");
+
+        ioHandleWriteOneStr(
+            pipeHandle[1],
+            strNew("{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}\n{}\n"));
+        close(pipeHandle[1]);
+
+        IoRead *read = ioHandleReadNew(strNew("closed read"), pipeHandle[0], 2000);
+        ioReadOpen(read);
+        IoWrite *write = ioBufferWriteNew(bufNew(1024));
+        ioWriteOpen(write);
+
+        ProtocolClient *client = protocolClientNew(strNew("closed"), strNew("test"), read, write);
+        ProtocolParallel *parallel = protocolParallelNew(2000);
+        protocolParallelClientAdd(parallel, client);
+        protocolParallelJobAdd(parallel, protocolParallelJobNew(varNewStr(strNew("job1")), protocolCommandNew(strNew("command1"))));
+
+        TEST_RESULT_UINT(protocolParallelProcess(parallel), 0, "process jobs");
+
+        close(pipeHandle[0]);
+
+        TEST_ERROR(
+            protocolParallelProcess(parallel), AssertError, "unable to poll parallel client(s): [9] Bad file descriptor");
+
+        protocolClientFree(client);
+        protocolParallelFree(parallel);
     }
 
     // *****************************************************************************************************************************
@@ -861,5 +941,107 @@ testRun(void)
         TEST_RESULT_VOID(protocolFree(), "free local and remote protocol objects");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("protocolRemoteGet() with tls"))
+    {
+        const String *caFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX "-ca.crt", testRepoPath());
+        const String *certFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".crt", testRepoPath());
+        const String *keyFile = strNewFmt("%s/" TEST_CERTIFICATE_PREFIX ".key", testRepoPath());
+
+        // Listen on the default server port so the client can connect as soon as the child is forked
+        TlsServer *server = NULL;
+        TEST_ASSIGN(server, tlsServerNew(strNew("127.0.0.1"), 8432, certFile, keyFile, caFile, 5000), "new server");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Reject the first remote
+                TlsSession *session = tlsServerSession(server, tlsServerAccept(server));
+
+                TEST_RESULT_STR(
+                    strPtr(ioReadLine(tlsSessionIoRead(session))),
+                    "[\"--c\",\"--command=info\",\"--log-level-file=off\",\"--log-level-stderr=error\",\"--process=0\","
+                        "\"--protocol-timeout=10\",\"--stanza=db\",\"--type=backup\",\"remote\"]",
+                    "check repo remote params");
+
+                ioWriteStrLine(tlsSessionIoWrite(session), strNew("{\"err\":72,\"out\":\"client is not authorized\"}"));
+                ioWriteFlush(tlsSessionIoWrite(session));
+                tlsSessionFree(session);
+
+                // Start the second remote
+                session = tlsServerSession(server, tlsServerAccept(server));
+
+                TEST_RESULT_STR(
+                    strPtr(ioReadLine(tlsSessionIoRead(session))),
+                    "[\"--c\",\"--command=backup\",\"--log-level-file=off\",\"--log-level-stderr=error\","
+                        "\"--pg1-path=/path/to/pg\",\"--process=0\",\"--protocol-timeout=10\",\"--stanza=db\",\"--type=db\","
+                        "\"remote\"]",
+                    "check pg remote params");
+
+                ioWriteStrLine(tlsSessionIoWrite(session), strNew("{}"));
+                ioWriteFlush(tlsSessionIoWrite(session));
+
+                // Run a protocol server until the client sends exit
+                protocolServerProcess(
+                    protocolServerNew(
+                        strNew("test"), PROTOCOL_SERVICE_REMOTE_STR, tlsSessionIoRead(session), tlsSessionIoWrite(session)));
+
+                tlsSessionFree(session);
+                tlsServerFree(server);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                StringList *argList = strLstNew();
+                strLstAddZ(argList, "/usr/bin/pgbackrest");
+                strLstAddZ(argList, "--stanza=db");
+                strLstAddZ(argList, "--protocol-timeout=10");
+                strLstAddZ(argList, "--repo1-host=" TLS_TEST_HOST);
+                strLstAdd(argList, strNewFmt("--repo1-host-ca-file=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--repo1-host-cert-file=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--repo1-host-key-file=%s", strPtr(keyFile)));
+                strLstAddZ(argList, "--repo1-host-port=8432");
+                strLstAddZ(argList, "--repo1-host-type=tls");
+                strLstAddZ(argList, "info");
+                harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+                TEST_ERROR(
+                    protocolRemoteGet(protocolStorageTypeRepo, 1), HostInvalidError,
+                    "unable to start remote on '" TLS_TEST_HOST ":8432': client is not authorized");
+
+                // Port is not set so the server default is used
+                argList = strLstNew();
+                strLstAddZ(argList, "/usr/bin/pgbackrest");
+                strLstAddZ(argList, "--stanza=db");
+                strLstAddZ(argList, "--protocol-timeout=10");
+                strLstAddZ(argList, "--repo1-retention-full=1");
+                strLstAddZ(argList, "--pg1-host=" TLS_TEST_HOST);
+                strLstAdd(argList, strNewFmt("--pg1-host-ca-file=%s", strPtr(caFile)));
+                strLstAdd(argList, strNewFmt("--pg1-host-cert-file=%s", strPtr(certFile)));
+                strLstAdd(argList, strNewFmt("--pg1-host-key-file=%s", strPtr(keyFile)));
+                strLstAddZ(argList, "--pg1-host-type=tls");
+                strLstAddZ(argList, "--pg1-path=/path/to/pg");
+                strLstAddZ(argList, "backup");
+                harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+                ProtocolClient *client = NULL;
+
+                TEST_ASSIGN(client, protocolRemoteGet(protocolStorageTypePg, 1), "get remote protocol");
+                TEST_RESULT_PTR(protocolHelper.clientRemote[0].client, client, "check position in cache");
+                TEST_RESULT_BOOL(protocolHelper.clientRemote[0].tlsClient != NULL, true, "check tls client");
+                TEST_RESULT_BOOL(protocolHelper.clientRemote[0].exec == NULL, true, "check no exec");
+
+                TEST_RESULT_VOID(protocolFree(), "free remote protocol objects");
+                TEST_RESULT_BOOL(protocolHelper.clientRemote[0].tlsClient == NULL, true, "check tls client freed");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        TEST_RESULT_VOID(tlsServerFree(server), "free server");
+    }
+
     FUNCTION_HARNESS_RESULT_VOID();
 }
@@ -0,0 +1,363 @@
+/***********************************************************************************************************************************
+Test Cache Storage
+***********************************************************************************************************************************/
+#include <string.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+#include "common/io/io.h"
+#include "common/stat.h"
+#include "storage/cache/storage.h"
+#include "storage/posix/storage.h"
+#include "storage/storage.intern.h"
+
+#include "common/harnessConfig.h"
+
+/***********************************************************************************************************************************
+Count info list entries
+***********************************************************************************************************************************/
+static void
+testInfoListCallback(void *data, const StorageInfo *info)
+{
+    (void)info;
+    (*(unsigned int *)data)++;
+}
+
+/***********************************************************************************************************************************
+Recursive info list for a driver that implements it
+***********************************************************************************************************************************/
+static bool
+testInfoListRecurse(void *driver, const String *path, StorageInfoListCallback callback, void *callbackData)
+{
+    (void)driver;
+    (void)path;
+
+    callback(callbackData, &(StorageInfo){.name = STRDEF("file"), .type = storageTypeFile, .exists = true});
+
+    return true;
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    Storage *storageTest = storagePosixNew(strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+    // *****************************************************************************************************************************
+    if (testBegin("storageRepoGet() and StorageCache"))
+    {
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "pgbackrest");
+        strLstAddZ(argList, "--stanza=db");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--repo1-cache-path=%s/cache", testPath()));
+        strLstAddZ(argList, "archive-get");
+        harnessCfgLoad(strLstSize(argList), strLstPtr(argList));
+
+        const Storage *storage = NULL;
+        TEST_ASSIGN(storage, storageRepoGet(strNew(STORAGE_TYPE_POSIX), true), "get cached repo storage");
+
+        // Each repository type is cached in a separate path
+        Storage *storageCache = storagePosixNew(
+            strNewFmt("%s/cache/posix%s/repo", testPath(), testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true,
+            NULL);
+        TEST_RESULT_STR(strPtr(storageType(storage)), "posix", "    check storage type");
+        TEST_RESULT_BOOL(storageFeature(storage, storageFeaturePath), true, "    check path feature");
+        TEST_RESULT_BOOL(storageFeature(storage, storageFeatureCompress), true, "    check compress feature");
+
+        // Writes are cached
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storage, strNew("archive/db/file1")), BUFSTRDEF("WRITE")), "put file");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageTest, strNew("repo/archive/db/file1"))))), "WRITE",
+            "    check repo");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageCache, strNew("archive/db/file1"))))),
+            "WRITE", "    check cache");
+
+        TEST_RESULT_INT(
+            storageInfoNP(storageCache, strNew("archive/db/file1")).timeModified,
+            storageInfoNP(storageTest, strNew("repo/archive/db/file1")).timeModified, "    check cache time matches repo");
+
+        // Reads are served from the cache when the size and time match the repo.  Change the cached file to prove it.
+        // -------------------------------------------------------------------------------------------------------------------------
+        struct utimbuf utimeTest = {.actime = 1000000000, .modtime = 1000000000};
+        THROW_ON_SYS_ERROR(
+            utime(strPtr(strNewFmt("%s/repo/archive/db/file1", testPath())), &utimeTest) != 0, FileWriteError,
+            "unable to set time");
+
+        storagePutNP(
+            storageNewWriteP(storageCache, strNew("archive/db/file1"), .timeModified = 1000000000),
+            BUFSTRDEF("CACHE"));
+
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, strNew("archive/db/file1"))))), "CACHE", "get cached file");
+        TEST_RESULT_UINT(statGet(STRDEF("storage.cache.hit")).total, 1, "    check hit");
+
+        struct stat statTest;
+        THROW_ON_SYS_ERROR(
+            stat(strPtr(storagePathNP(storageCache, strNew("archive/db/file1"))), &statTest) != 0,
+            FileReadError, "unable to stat");
+        TEST_RESULT_BOOL(statTest.st_atime > 1000000000, true, "    check access time updated");
+        TEST_RESULT_INT(statTest.st_mtime, 1000000000, "    check modification time not updated");
+
+        // Cached files that do not match the repo are removed and read from the repo
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(
+            storageNewWriteP(storageTest, strNew("repo/archive/db/file1"), .timeModified = 1000000001), BUFSTRDEF("WRITE"));
+
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, strNew("archive/db/file1"))))), "WRITE",
+            "get file changed in repo");
+        TEST_RESULT_UINT(statGet(STRDEF("storage.cache.stale")).total, 1, "    check stale");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageCache, strNew("archive/db/file1"))))),
+            "WRITE", "    check cache");
+        TEST_RESULT_INT(
+            storageInfoNP(storageCache, strNew("archive/db/file1")).timeModified, 1000000001,
+            "    check cache time");
+
+        storagePutNP(
+            storageNewWriteP(storageTest, strNew("repo/archive/db/file1"), .timeModified = 1000000001), BUFSTRDEF("WRITE-LONGER"));
+
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, strNew("archive/db/file1"))))), "WRITE-LONGER",
+            "get file with new size in repo");
+        TEST_RESULT_UINT(statGet(STRDEF("storage.cache.stale")).total, 2, "    check stale");
+
+        storageRemoveNP(storageTest, strNew("repo/archive/db/file1"));
+
+        TEST_RESULT_PTR(
+            storageGetNP(storageNewReadP(storage, strNew("archive/db/file1"), .ignoreMissing = true)), NULL,
+            "get file removed from repo");
+        TEST_RESULT_BOOL(storageExistsNP(storageCache, strNew("archive/db/file1")), false, "    check cache");
+
+        storagePutNP(storageNewWriteNP(storage, strNew("archive/db/file1")), BUFSTRDEF("WRITE"));
+
+        // Reads from the repo are cached
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/archive/db/file2")), BUFSTRDEF("REPO"));
+
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, strNew("archive/db/file2"))))), "REPO", "get uncached file");
+        TEST_RESULT_UINT(statGet(STRDEF("storage.cache.miss")).total, 4, "    check miss");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storageCache, strNew("archive/db/file2"))))),
+            "REPO", "    check cache");
+
+        TEST_RESULT_PTR(storageGetNP(storageNewReadP(storage, strNew("archive/db/missing"), .ignoreMissing = true)), NULL,
+            "missing file");
+
+        // Files that are not read completely are not cached
+        // -------------------------------------------------------------------------------------------------------------------------
+        // The file is larger than the io buffer so it cannot be read in a single driver read
+        Buffer *buffer = bufNew(ioBufferSize() + 1);
+        memset(bufPtr(buffer), 'P', bufSize(buffer));
+        bufUsedSet(buffer, bufSize(buffer));
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/archive/db/file3")), buffer);
+
+        StorageRead *read = storageNewReadNP(storage, strNew("archive/db/file3"));
+        buffer = bufNew(2);
+
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(read)), true, "open file");
+        TEST_RESULT_UINT(ioRead(storageReadIo(read), buffer), 2, "read part of file");
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(read)), "close file");
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storageCache, strNew("archive/db")), sortOrderAsc), ",")),
+            "file1,file2", "    check file was not cached");
+
+        // Files that change or are removed while they are read are not cached
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/archive/db/file7")), BUFSTRDEF("FILE7"));
+
+        read = storageNewReadNP(storage, strNew("archive/db/file7"));
+        buffer = bufNew(ioBufferSize());
+
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(read)), true, "open file");
+        TEST_RESULT_UINT(ioRead(storageReadIo(read), buffer), 5, "read file");
+        storagePutNP(storageNewWriteNP(storageTest, strNew("repo/archive/db/file7")), BUFSTRDEF("FILE7-CHANGED"));
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(read)), "close file");
+
+        read = storageNewReadNP(storage, strNew("archive/db/file7"));
+        bufUsedZero(buffer);
+
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(read)), true, "open file");
+        TEST_RESULT_UINT(ioRead(storageReadIo(read), buffer), 13, "read file");
+        storageRemoveNP(storageTest, strNew("repo/archive/db/file7"));
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(read)), "close file");
+
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storageCache, strNew("archive/db")), sortOrderAsc), ",")),
+            "file1,file2", "    check files were not cached");
+
+        // Info and manifest files are not cached
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(
+            storagePutNP(storageNewWriteNP(storage, strNew("archive/db/archive.info")), BUFSTRDEF("INFO")), "put info");
+        TEST_RESULT_VOID(
+            storagePutNP(storageNewWriteNP(storage, strNew("backup/db/backup.manifest.copy")), BUFSTRDEF("MANIFEST")),
+            "put manifest copy");
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, strNew("archive/db/archive.info"))))), "INFO", "get info");
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storageCache, strNew("archive/db")), sortOrderAsc), ",")),
+            "file1,file2", "    check info was not cached");
+        TEST_RESULT_BOOL(
+            storagePathExistsNP(storageCache, strNew("backup")), false,
+            "    check manifest was not cached");
+
+        // Functions passed to the repo
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_BOOL(storageExistsNP(storage, strNew("archive/db/file3")), true, "file exists");
+        TEST_RESULT_UINT(storageInfoNP(storage, strNew("archive/db/file3")).size, ioBufferSize() + 1, "file info");
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storage, strNew("archive/db")), sortOrderAsc), ",")),
+            "archive.info,file1,file2,file3", "list files");
+        TEST_RESULT_VOID(storagePathCreateNP(storage, strNew("backup/db/path")), "create path");
+        TEST_RESULT_BOOL(storagePathExistsNP(storage, strNew("backup/db/path")), true, "path exists");
+        TEST_RESULT_VOID(storagePathSyncNP(storage, strNew("backup/db/path")), "sync path");
+
+        unsigned int infoTotal = 0;
+
+        TEST_RESULT_BOOL(storageInfoListNP(storage, strNew("archive/db"), testInfoListCallback, &infoTotal), true,
+            "info list");
+        TEST_RESULT_UINT(infoTotal, 5, "    check total");
+
+        StorageInterface interfaceRecurse = storageInterface(storageTest);
+        interfaceRecurse.infoListRecurse = testInfoListRecurse;
+
+        Storage *storageRecurse = storageCacheNew(
+            storageNew(
+                STRDEF("test"), strNewFmt("%s/repo", testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL,
+                storageDriver(storageTest), interfaceRecurse),
+            strNewFmt("%s/repo", testPath()), true, NULL, strNewFmt("%s/cache", testPath()), 1024 * 1024, NULL, NULL);
+
+        infoTotal = 0;
+
+        TEST_RESULT_BOOL(
+            storageInfoListP(storageRecurse, strNew("archive"), testInfoListCallback, &infoTotal, .recurse = true), true,
+            "info list recursive");
+        TEST_RESULT_UINT(infoTotal, 1, "    check total");
+
+        // Move removes the cached files
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(
+            storageMoveNP(
+                storage, storageNewReadNP(storage, strNew("archive/db/file2")),
+                storageNewWriteNP(storage, strNew("archive/db/file4"))),
+            "move file");
+        TEST_RESULT_BOOL(storageExistsNP(storage, strNew("archive/db/file4")), true, "    check repo");
+        TEST_RESULT_STR(
+            strPtr(strLstJoin(strLstSort(storageListNP(storageCache, strNew("archive/db")), sortOrderAsc), ",")),
+            "file1", "    check cache");
+
+        // Remove removes the cached file
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_VOID(storageRemoveNP(storage, strNew("archive/db/file1")), "remove file");
+        TEST_RESULT_BOOL(storageExistsNP(storageTest, strNew("repo/archive/db/file1")), false, "    check repo");
+        TEST_RESULT_BOOL(
+            storageExistsNP(storageCache, strNew("archive/db/file1")), false, "    check cache");
+
+        // Path remove removes the cached path
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storage, strNew("archive/db/file5")), BUFSTRDEF("FILE5"));
+
+        TEST_RESULT_VOID(storagePathRemoveP(storage, strNew("archive"), .recurse = true), "remove path");
+        TEST_RESULT_BOOL(storagePathExistsNP(storageTest, strNew("repo/archive")), false, "    check repo");
+        TEST_RESULT_BOOL(
+            storagePathExistsNP(storageCache, strNew("archive")), false, "    check cache");
+
+        // Immutable files are served from the cache without checking the repo.  Change the repo files to prove it.
+        // -------------------------------------------------------------------------------------------------------------------------
+        const String *walSegment = strNew(
+            "archive/db2/9.4-1/0000000100000001/000000010000000100000001-abcdabcdabcdabcdabcdabcdabcdabcdabcdabcd.gz");
+        const String *backupFile = strNew("backup/db/20191001-120000F_20191002-120000I/pg_data/PG_VERSION");
+
+        storagePutNP(storageNewWriteNP(storage, walSegment), BUFSTRDEF("WAL"));
+        storagePutNP(storageNewWriteNP(storage, backupFile), BUFSTRDEF("BACKUP"));
+
+        storagePutNP(
+            storageNewWriteP(storageTest, strNewFmt("repo/%s", strPtr(walSegment)), .timeModified = 1000000000),
+            BUFSTRDEF("WAL-CHANGED"));
+        storagePutNP(
+            storageNewWriteP(storageTest, strNewFmt("repo/%s", strPtr(backupFile)), .timeModified = 1000000000),
+            BUFSTRDEF("BACKUP-CHANGED"));
+
+        uint64_t staleTotal = statGet(STRDEF("storage.cache.stale")).total;
+
+        TEST_RESULT_STR(strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, walSegment)))), "WAL", "get cached WAL segment");
+        TEST_RESULT_STR(strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, backupFile)))), "BACKUP", "get cached backup file");
+        TEST_RESULT_UINT(statGet(STRDEF("storage.cache.stale")).total, staleTotal, "    check not stale");
+
+        // Least recently used files are removed when the cache is too large
+        // -------------------------------------------------------------------------------------------------------------------------
+        StringList *excludeList = strLstNew();
+        strLstAddZ(excludeList, "archive.info");
+
+        TEST_ASSIGN(
+            storage,
+            storageCacheNew(
+                storagePosixNew(strNewFmt("%s/repo", testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL),
+                strNewFmt("%s/repo", testPath()), true, NULL, strNewFmt("%s/cache-lru", testPath()), 25, excludeList, NULL),
+            "new cache storage with small size");
+
+        storagePutNP(storageNewWriteNP(storage, strNew("file1")), BUFSTRDEF("1111111111"));
+        storagePutNP(storageNewWriteNP(storage, strNew("file2")), BUFSTRDEF("2222222222"));
+
+        // Set the access times in the past.  The modification times must still match the repo.
+        for (unsigned int fileIdx = 1; fileIdx <= 2; fileIdx++)
+        {
+            const String *fileCache = strNewFmt("%s/cache-lru%s/repo/file%u", testPath(), testPath(), fileIdx);
+
+            utimeTest.actime = 1000000000 + fileIdx;
+            utimeTest.modtime = storageInfoNP(storageTest, fileCache).timeModified;
+
+            THROW_ON_SYS_ERROR(utime(strPtr(fileCache), &utimeTest) != 0, FileWriteError, "unable to set time");
+        }
+
+        // Read file1 so it is more recently used than file2
+        storageGetNP(storageNewReadNP(storage, strNew("file1")));
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storage, strNew("file3")), BUFSTRDEF("3333333333")), "put file");
+        TEST_RESULT_STR(
+            strPtr(
+                strLstJoin(strLstSort(storageListNP(storageTest, strNewFmt("cache-lru%s/repo", testPath())), sortOrderAsc), ",")),
+            "file1,file3", "    check least recently used file removed");
+        TEST_RESULT_UINT(statGet(STRDEF("storage.cache.remove")).total, 1, "    check remove");
+
+        // Cache errors do not affect the repo
+        // -------------------------------------------------------------------------------------------------------------------------
+        storagePutNP(storageNewWriteNP(storageTest, strNew("cache-error")), NULL);
+
+        TEST_ASSIGN(
+            storage,
+            storageCacheNew(
+                storagePosixNew(strNewFmt("%s/repo", testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL),
+                strNewFmt("%s/repo", testPath()), true, NULL, strNewFmt("%s/cache-error", testPath()), 20, NULL, NULL),
+            "new cache storage with invalid path");
+
+        TEST_RESULT_VOID(storagePutNP(storageNewWriteNP(storage, strNew("file6")), BUFSTRDEF("FILE6")), "put file");
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   WARN: unable to write '%s/repo/file6' to cache: unable to open file"
+                        " '%s/cache-error%s/repo/file6.%d." STORAGE_FILE_TEMP_EXT "' for write: [20] Not a directory",
+                    testPath() + 1, testPath(), testPath(), getpid())));
+        TEST_RESULT_STR(
+            strPtr(strNewBuf(storageGetNP(storageNewReadNP(storage, strNew("file6"))))), "FILE6", "    get file");
+        harnessLogResult(
+            strPtr(
+                strNewFmt(
+                    "P00   WARN: unable to read '%s/repo/file6' from cache: unable to get info for path/file"
+                        " '%s/cache-error%s/repo/file6': [20] Not a directory\n"
+                    "P00   WARN: unable to write '%s/repo/file6' to cache: unable to open file"
+                        " '%s/cache-error%s/repo/file6.%d." STORAGE_FILE_TEMP_EXT "' for write: [20] Not a directory",
+                    testPath() + 1, testPath(), testPath(), testPath() + 1, testPath(), testPath(), getpid())));
+    }
+
+    FUNCTION_HARNESS_RESULT_VOID();
+}
@@ -39,6 +39,22 @@ Macro to create a path and file that cannot be accessed
             strPtr(fileNoPerm)))),                                                                                                 \
         0, "create no perm path/file");
 
+/***********************************************************************************************************************************
+Recursive info list for a driver that implements it
+***********************************************************************************************************************************/
+static bool
+testInfoListRecurse(void *driver, const String *path, StorageInfoListCallback callback, void *callbackData)
+{
+    (void)driver;
+    (void)path;
+
+    callback(
+        callbackData,
+        &(StorageInfo){.name = STRDEF("path/file"), .type = storageTypeFile, .size = 8, .mode = 0640, .exists = true});
+
+    return true;
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -360,6 +376,91 @@ testRun(void)
             callbackData.content,
             "path {path, m=0700}",
             "    check content");
+        // Each info in a run is read as a line so the buffer must be large enough to hold it
+        // -------------------------------------------------------------------------------------------------------------------------
+        ioBufferSizeSet(8192);
+
+        Storage *storageSort = storagePosixNew(
+            strNewFmt("%s/sort", testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL);
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListP(
+                storageTest, strNew("pg"), hrnStorageInfoListCallback, &callbackData, .sortOrder = sortOrderAsc, .recurse = true,
+                .sortStorage = storageSort, .sortMax = 2),
+            "recurse ascending sorted in runs");
+        TEST_RESULT_STR_Z(
+            callbackData.content,
+            ". {path}\n"
+            "file {file, s=8, m=0660}\n"
+            "link {link, d=../file}\n"
+            "path {path, m=0700}\n"
+            "path/file {file, s=8}\n"
+            "pipe {special}",
+            "    check content");
+        TEST_RESULT_STR_Z(strLstJoin(storageListNP(storageSort, NULL), ","), "", "    check runs were removed");
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListP(
+                storageTest, strNew("pg"), hrnStorageInfoListCallback, &callbackData, .sortOrder = sortOrderDesc, .recurse = true,
+                .sortStorage = storageSort, .sortMax = 2),
+            "recurse descending sorted in runs");
+        TEST_RESULT_STR_Z(
+            callbackData.content,
+            "pipe {special}\n"
+            "path/file {file, s=8}\n"
+            "path {path, m=0700}\n"
+            "link {link, d=../file}\n"
+            "file {file, s=8, m=0660}\n"
+            ". {path}",
+            "    check content");
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListP(
+                storageTest, strNew("pg"), hrnStorageInfoListCallback, &callbackData, .sortOrder = sortOrderAsc, .recurse = true,
+                .sortStorage = storageSort, .sortMax = 1),
+            "recurse ascending sorted with a run for each info");
+        TEST_RESULT_STR_Z(
+            callbackData.content,
+            ". {path}\n"
+            "file {file, s=8, m=0660}\n"
+            "link {link, d=../file}\n"
+            "path {path, m=0700}\n"
+            "path/file {file, s=8}\n"
+            "pipe {special}",
+            "    check content");
+
+        // Recursive list is done by the driver when it can and there is no expression or sort
+        // -------------------------------------------------------------------------------------------------------------------------
+        StorageInterface interfaceRecurse = storageInterface(storageTest);
+        interfaceRecurse.infoListRecurse = testInfoListRecurse;
+
+        const Storage *storageRecurse = storageNew(
+            STRDEF("test"), strNew(testPath()), STORAGE_MODE_FILE_DEFAULT, STORAGE_MODE_PATH_DEFAULT, true, NULL,
+            storageDriver(storageTest), interfaceRecurse);
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListP(storageRecurse, strNew("pg"), hrnStorageInfoListCallback, &callbackData, .recurse = true),
+            "recurse with driver");
+        TEST_RESULT_STR_Z(callbackData.content, "path/file {file, s=8, m=0640}", "    check content");
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListP(
+                storageRecurse, strNew("pg"), hrnStorageInfoListCallback, &callbackData, .recurse = true,
+                .expression = STRDEF("^path")),
+            "recurse with expression");
+        TEST_RESULT_STR_Z(callbackData.content, "path {path, m=0700}\npath/file {file, s=8}", "    check content");
+
+        ioBufferSizeSet(2);
     }
 
     // *****************************************************************************************************************************